@@ -223,6 +223,9 @@ bool ClassInfo::parse(const IBK::Path & headerFilePath) {
 					if (tokens[i] == "required") {
 						xmlInfo.required = true;
 					}
+					else if (tokens[i] == "parallel") {
+						xmlInfo.parallel = true;
+					}
 					else if (tokens[i].find("tag=") == 0) {
 						std::string::size_type p = tokens[i].find("tag=");
 						std::string alternativeName = tokens[i].substr(p+4);
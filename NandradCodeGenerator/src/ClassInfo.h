@@ -39,6 +39,7 @@ public:
 		std::string		typeStr;			// C++ type string
 		std::string		varName;			// Name of the variable without m_ prefix
 		std::string		alternativeTagName;	// Alternative tag name to use instead of default type name (see docs for situations where this works)
+		bool			parallel = false;	// if true, elements of a std::vector collection are read in parallel (XML:E:parallel)
 	};
 
 
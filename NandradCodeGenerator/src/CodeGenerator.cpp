@@ -900,7 +900,7 @@ void CodeGenerator::generateReadWriteCode() {
 								// generate write code for enum type
 								attribs +=
 									"				try {\n"
-									"					m_"+attribName+" = ("+einfo.enumType()+")KeywordList::Enumeration(\""+einfo.categoryName+"\", attrib->ValueStr());\n"
+									"					m_"+attribName+" = ("+einfo.enumType()+")KeywordList::Enumeration<KeywordList::CategoryHash(\""+einfo.categoryName+"\")>(attrib->ValueStr());\n"
 									"				}\n"
 									"				catch (IBK::Exception & ex) {\n"
 									"					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(\n"
@@ -1214,7 +1214,7 @@ void CodeGenerator::generateReadWriteCode() {
 								const ClassInfo::EnumInfo & einfo = *einfo_it;
 								elementCodeKeyword +=
 										"				try {\n"
-										"					"+einfo.enumType()+" ptype = ("+einfo.enumType()+")KeywordList::Enumeration(\""+einfo.categoryName+"\", name);\n"
+										"					"+einfo.enumType()+" ptype = ("+einfo.enumType()+")KeywordList::Enumeration<KeywordList::CategoryHash(\""+einfo.categoryName+"\")>(name);\n"
 										"					m_"+varName2+"[ptype] = p; success = true;\n"
 										"				}\n"
 										"				catch (...) { /* intentional fail */  }\n";
@@ -1272,7 +1272,7 @@ void CodeGenerator::generateReadWriteCode() {
 								elementCodeKeyword +=
 										"				"+einfo.enumType()+" ptype;\n"
 										"				try {\n"
-										"					ptype = ("+einfo.enumType()+")KeywordList::Enumeration(\""+einfo.categoryName+"\", p.name);\n"
+										"					ptype = ("+einfo.enumType()+")KeywordList::Enumeration<KeywordList::CategoryHash(\""+einfo.categoryName+"\")>(p.name);\n"
 										"					m_"+varName2+"[ptype] = p; success = true;\n"
 										"				}\n"
 										"				catch (...) { /* intentional fail */  }\n";
@@ -1342,7 +1342,7 @@ void CodeGenerator::generateReadWriteCode() {
 								const ClassInfo::EnumInfo & einfo = *einfo_it;
 								elementCodeKeyword +=
 										"				try {\n"
-										"					"+einfo.enumType()+" ptype = ("+einfo.enumType()+")KeywordList::Enumeration(\""+einfo.categoryName+"\", p.name);\n"
+										"					"+einfo.enumType()+" ptype = ("+einfo.enumType()+")KeywordList::Enumeration<KeywordList::CategoryHash(\""+einfo.categoryName+"\")>(p.name);\n"
 										"					m_"+varName2+"[ptype] = p; success = true;\n"
 										"				}\n"
 										"				catch (...) { /* intentional fail */  }\n";
@@ -1399,7 +1399,7 @@ void CodeGenerator::generateReadWriteCode() {
 								const ClassInfo::EnumInfo & einfo = *einfo_it;
 								elementCodeKeyword +=
 										"				try {\n"
-										"					"+einfo.enumType()+" ftype = ("+einfo.enumType()+")KeywordList::Enumeration(\""+einfo.categoryName+"\", f.name());\n"
+										"					"+einfo.enumType()+" ftype = ("+einfo.enumType()+")KeywordList::Enumeration<KeywordList::CategoryHash(\""+einfo.categoryName+"\")>(f.name());\n"
 										"					m_"+varName2+"[ftype] = f; success=true;\n"
 										"				}\n"
 										"				catch (...) { /* intentional fail */  }\n";
@@ -1457,7 +1457,7 @@ void CodeGenerator::generateReadWriteCode() {
 								elementCodeKeyword +=
 										"				try {\n"
 										"					"+einfo.enumType()+" ptype;\n"
-										"					ptype = ("+einfo.enumType()+")KeywordList::Enumeration(\""+einfo.categoryName+"\", p.m_name);\n"
+										"					ptype = ("+einfo.enumType()+")KeywordList::Enumeration<KeywordList::CategoryHash(\""+einfo.categoryName+"\")>(p.m_name);\n"
 										"					m_"+varName2+"[ptype] = p; success = true;\n"
 										"				}\n"
 										"				catch (...) { /* intentional fail */  }\n";
@@ -1512,19 +1512,28 @@ void CodeGenerator::generateReadWriteCode() {
 								childTagName = childTagName.substr(7);
 
 							// generate code for reading vector of complex data types with own readXML() functions
-							elements +=
-									"			"+elseStr+"if (cName == \""+tagName+"\") {\n"
-									"				const TiXmlElement * c2 = c->FirstChildElement();\n"
-									"				while (c2) {\n"
-									"					const std::string & c2Name = c2->ValueStr();\n"
-									"					if (c2Name != \""+childTagName+"\")\n"
-									"						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);\n"
-									"					"+childType+" obj;\n"
-									"					obj.readXML(c2);\n"
-									"					m_"+varName+".push_back(obj);\n"
-									"					c2 = c2->NextSiblingElement();\n"
-									"				}\n"
-									"			}\n";
+							if (xmlInfo.parallel) {
+								// large collections: read objects concurrently
+								includes.insert("NANDRAD_Utilities.h");
+								elements +=
+										"			"+elseStr+"if (cName == \""+tagName+"\")\n"
+										"				NANDRAD::readVectorOfObjects(c, \""+childTagName+"\", m_"+varName+");\n";
+							}
+							else {
+								// objects are constructed in place, avoids copying large objects
+								elements +=
+										"			"+elseStr+"if (cName == \""+tagName+"\") {\n"
+										"				const TiXmlElement * c2 = c->FirstChildElement();\n"
+										"				while (c2) {\n"
+										"					const std::string & c2Name = c2->ValueStr();\n"
+										"					if (c2Name != \""+childTagName+"\")\n"
+										"						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);\n"
+										"					m_"+varName+".emplace_back();\n"
+										"					m_"+varName+".back().readXML(c2);\n"
+										"					c2 = c2->NextSiblingElement();\n"
+										"				}\n"
+										"			}\n";
+							}
 						}
 
 						// generate code for reading std::vector
@@ -1646,7 +1655,7 @@ void CodeGenerator::generateReadWriteCode() {
 						elements +=
 								"			"+elseStr+"if (cName == \""+tagName2+"\") {\n"
 								"				try {\n"
-								"					m_"+varName2+" = ("+it->enumType()+")KeywordList::Enumeration(\""+it->categoryName+"\", c->GetText());\n"
+								"					m_"+varName2+" = ("+it->enumType()+")KeywordList::Enumeration<KeywordList::CategoryHash(\""+it->categoryName+"\")>(c->GetText());\n"
 								"				}\n"
 								"				catch (IBK::Exception & ex) {\n"
 								"					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(\n"
@@ -1711,6 +1720,15 @@ void CodeGenerator::generateReadWriteCode() {
 
 // ********* Private Utility functions **************
 
+/*! Computes 32-bit FNV-1a hash of a category name, must match KeywordList::CategoryHash(). */
+static unsigned int categoryHash(const std::string & categoryName) {
+	unsigned int h = 2166136261u;
+	for (char c : categoryName)
+		h = (h ^ (unsigned char)c) * 16777619u;
+	return h;
+}
+
+
 bool CodeGenerator::listHeaders(const std::string & dir, std::vector<std::string> & files) {
 #ifdef _WIN32
 	WIN32_FIND_DATA fd;
@@ -1801,16 +1819,81 @@ void CodeGenerator::generateKeywordlistCode(const IBK::Path & keywordListCpp) {
 	cpp << "\t\t\"" + catnames.back() + "\"\n";
 	cpp << "\t};\n\n";
 
-	// write middle part
+	// compute category hashes and search for a multiplier, so that the upper bits of (hash*multiplier)
+	// give a collision-free slot in a power-of-two table; start with smallest table size possible
+	std::vector<unsigned int> catHashes;
+	for (const std::string & catname : catnames)
+		catHashes.push_back(categoryHash(catname));
+	unsigned int hashTableSize = 2;
+	unsigned int hashBits = 1;
+	while (hashTableSize < catnames.size()) {
+		hashTableSize *= 2;
+		++hashBits;
+	}
+	std::vector<int> hashTable;
+	unsigned int hashMultiplier = 0;
+	for (;;) {
+		if (hashTableSize > 0x10000)
+			throw IBK::Exception("Cannot create collision-free hash table for categories.", FUNC_ID);
+		bool collision = true;
+		unsigned int seed = 1;
+		for (unsigned int trial = 0; trial < 100000 && collision; ++trial) {
+			seed = seed*1664525u + 1013904223u; // LCG, so that generated code is reproducible
+			hashMultiplier = seed | 1u;
+			hashTable.assign(hashTableSize, -1);
+			collision = false;
+			for (unsigned int i=0; i<catHashes.size() && !collision; ++i) {
+				unsigned int slot = (catHashes[i]*hashMultiplier) >> (32-hashBits);
+				if (hashTable[slot] != -1)
+					collision = true;
+				else
+					hashTable[slot] = (int)i;
+			}
+		}
+		if (!collision)
+			break;
+		hashTableSize *= 2;
+		++hashBits;
+	}
+
+	// write category hashes
+	cpp <<
+		"	/*! Holds the hashes of all enum types/categories (see KeywordList::CategoryHash()). */\n"
+		"	const unsigned int ENUM_TYPE_HASHES["<< catnames.size() << "] = {\n";
+	for (unsigned int i=0; i<catnames.size(); ++i) {
+		cpp << "\t\t" << catHashes[i] << "u" << (i+1 < catnames.size() ? "," : "") << " // " << catnames[i] << "\n";
+	}
+	cpp << "\t};\n\n";
+
+	// write hash table
+	cpp <<
+		"	/*! Collision-free hash table, maps ((hash*"<< hashMultiplier << "u) >> "<< 32-hashBits << ") to category index (-1 for empty slots). */\n"
+		"	const short ENUM_TYPE_HASH_TABLE["<< hashTableSize << "] = {";
+	for (unsigned int i=0; i<hashTableSize; ++i) {
+		if (i % 16 == 0)
+			cpp << "\n\t\t";
+		cpp << hashTable[i] << (i+1 < hashTableSize ? "," : "");
+	}
+	cpp << "\n\t};\n\n";
+
+	// write lookup functions
 	cpp <<
 		"	/*! Converts a category string to respective enumeration value. */\n"
-		"	int enum2index(const std::string & enumtype) {\n"
-		"		for (int i=0; i<"<< catnames.size() << "; ++i) {\n"
-		"			if (enumtype == ENUM_TYPES[i]) return i;\n"
-		"		}\n"
+		"	int enum2index(const char * const enumtype) {\n"
+		"		int idx = ENUM_TYPE_HASH_TABLE[(KeywordList::CategoryHash(enumtype)*" << hashMultiplier << "u) >> " << 32-hashBits << "];\n"
+		"		if (idx != -1 && std::strcmp(enumtype, ENUM_TYPES[idx]) == 0)\n"
+		"			return idx;\n"
 		"		//std::cerr << \"Unknown enumeration type '\" << enumtype<< \"'.\" << std::endl;\n"
 		"		return -1;\n"
 		"	}\n"
+		"	\n"
+		"	/*! Converts a category hash to respective enumeration value. */\n"
+		"	int hash2index(unsigned int categoryHash) {\n"
+		"		int idx = ENUM_TYPE_HASH_TABLE[(categoryHash*" << hashMultiplier << "u) >> " << 32-hashBits << "];\n"
+		"		if (idx != -1 && ENUM_TYPE_HASHES[idx] == categoryHash)\n"
+		"			return idx;\n"
+		"		return -1;\n"
+		"	}\n"
 		"	\n\n";
 
 	// *** write theKeyword() function ***
@@ -1848,35 +1931,92 @@ void CodeGenerator::generateKeywordlistCode(const IBK::Path & keywordListCpp) {
 	cpp <<	"		return INVALID_KEYWORD_INDEX_STRING;\n"
 			"	}\n\n";
 
-	// *** write allKeywords() function ***
-	cpp <<
-		"	/*! Returns all keywords including deprecated for a given category (typenum) and type number (t). */\n"
-		"	const char * allKeywords(int typenum, int t) {\n"
-		"		switch (typenum) {\n";
-
+	// *** write keyword table ***
+
+	// collect all keywords including deprecated alternatives for each category
+	struct KeywordTableEntry {
+		std::string		keyword;
+		int				index;
+		unsigned int	alternative; // 0 = current keyword, > 0 = deprecated keyword
+		bool operator<(const KeywordTableEntry & other) const {
+			if (keyword != other.keyword) return keyword < other.keyword;
+			if (index != other.index) return index < other.index;
+			return alternative < other.alternative;
+		}
+	};
+	std::vector<std::vector<KeywordTableEntry> > keywordTable(catnames.size());
 	lastCategory.clear();
-	switchIndex = 0;
+	switchIndex = -1;
 	for (unsigned int i=0; i<m_keywordlist.size(); ++i) {
-		// new category = new switch clause
 		if (m_keywordlist[i].category != lastCategory) {
-			// if last category wasn't empty, close last switch clause
-			if (!lastCategory.empty()) {
-				cpp << "			} break;\n";
-				++switchIndex;
-			}
 			lastCategory = m_keywordlist[i].category;
-			// open new switch clause
-			cpp << "			// "<< lastCategory <<"\n";
-			cpp << "			case "<< switchIndex <<" :\n";
-			cpp << "			switch (t) {\n";
+			++switchIndex;
+		}
+		std::stringstream strm(m_keywordlist[i].keyword);
+		KeywordTableEntry e;
+		e.index = m_keywordlist[i].index;
+		e.alternative = 0;
+		while (strm >> e.keyword) {
+			keywordTable[switchIndex].push_back(e);
+			++e.alternative;
 		}
-		cpp << "				case " << m_keywordlist[i].index << " : return \"" << m_keywordlist[i].keyword << "\";\n";
 	}
-	// close last switch clause and close switch statement
-	cpp << "			} break;\n";
-	cpp << "		} // switch\n";
-	cpp <<	"		return INVALID_KEYWORD_INDEX_STRING;\n"
-			"	}\n\n";
+	// sort keywords within each category, so that we can use binary search;
+	// for duplicate keywords the lowest index comes first
+	unsigned int keywordCount = 0;
+	for (std::vector<KeywordTableEntry> & entries : keywordTable) {
+		std::sort(entries.begin(), entries.end());
+		keywordCount += entries.size();
+	}
+
+	cpp <<
+		"	/*! Entry in keyword table. */\n"
+		"	struct KeywordTableEntry {\n"
+		"		/*! Keyword (current or deprecated). */\n"
+		"		const char *	keyword;\n"
+		"		/*! Enumeration value. */\n"
+		"		int				index;\n"
+		"		/*! True if keyword is deprecated. */\n"
+		"		bool			deprecated;\n"
+		"	};\n\n"
+		"	/*! All keywords including deprecated, sorted by keyword within each category. */\n"
+		"	const KeywordTableEntry KEYWORD_TABLE["<< keywordCount << "] = {\n";
+	unsigned int entryCount = 0;
+	std::vector<unsigned int> categoryOffsets;
+	for (unsigned int c=0; c<keywordTable.size(); ++c) {
+		categoryOffsets.push_back(entryCount);
+		cpp << "		// " << catnames[c] << "\n";
+		for (const KeywordTableEntry & e : keywordTable[c]) {
+			++entryCount;
+			cpp << "		{ \"" << e.keyword << "\", " << e.index << ", " << (e.alternative != 0 ? "true" : "false") << " }"
+				<< (entryCount < keywordCount ? "," : "") << "\n";
+		}
+	}
+	categoryOffsets.push_back(entryCount);
+	cpp << "	};\n\n";
+
+	cpp <<
+		"	/*! Index of first keyword of each category in KEYWORD_TABLE, last value is the table size. */\n"
+		"	const unsigned int KEYWORD_TABLE_OFFSETS["<< categoryOffsets.size() << "] = {";
+	for (unsigned int i=0; i<categoryOffsets.size(); ++i) {
+		if (i % 16 == 0)
+			cpp << "\n\t\t";
+		cpp << categoryOffsets[i] << (i+1 < categoryOffsets.size() ? "," : "");
+	}
+	cpp << "\n\t};\n\n";
+
+	cpp <<
+		"	/*! Returns keyword table entry for given keyword in category with index typenum, or nullptr if not found. */\n"
+		"	const KeywordTableEntry * findKeyword(int typenum, const std::string & kw) {\n"
+		"		const KeywordTableEntry * first = KEYWORD_TABLE + KEYWORD_TABLE_OFFSETS[typenum];\n"
+		"		const KeywordTableEntry * last = KEYWORD_TABLE + KEYWORD_TABLE_OFFSETS[typenum+1];\n"
+		"		const char * const kwStr = kw.c_str();\n"
+		"		first = std::lower_bound(first, last, kwStr,\n"
+		"			[](const KeywordTableEntry & e, const char * k) { return std::strcmp(e.keyword, k) < 0; });\n"
+		"		if (first != last && kw == first->keyword)\n"
+		"			return first;\n"
+		"		return nullptr;\n"
+		"	}\n\n";
 
 	// *** write description function ***
 	cpp <<	"	const char * KeywordList::Description(const char * const enumtype, int t, bool * no_description) {\n"
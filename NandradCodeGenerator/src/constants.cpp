@@ -231,7 +231,30 @@ const char * const HEADER_TEMPLATE =
 		"		\\param kw 			The keyword string.\n"
 		"		\\param deprecated 	The optional argument is set the true if the keyword kw is deprecated.\n"
 		"	*/\n"
-		"	static int Enumeration(const char * const enumtype, const std::string & kw, bool * deprecated = nullptr);\n\n\n"
+		"	static int Enumeration(const char * const enumtype, const std::string & kw, bool * deprecated = nullptr);\n\n"
+		"	/*! Returns an enumeration value for a given keyword kw of the category identified by its hash.\n"
+		"		This function throws an exception if the keyword or the enumeration type is invalid or unknown.\n"
+		"		\\param categoryHash	Hash of the full enumeration type, computed with CategoryHash().\n"
+		"		\\param kw 			The keyword string.\n"
+		"		\\param deprecated 	The optional argument is set the true if the keyword kw is deprecated.\n"
+		"	*/\n"
+		"	static int Enumeration(unsigned int categoryHash, const std::string & kw, bool * deprecated = nullptr);\n\n"
+		"	/*! Returns an enumeration value for a given keyword kw, with the category hash resolved at compile time.\n"
+		"		\\code\n"
+		"		Interval::para_t p = (Interval::para_t)KeywordList::Enumeration<KeywordList::CategoryHash(\"Interval::para_t\")>(kw);\n"
+		"		\\endcode\n"
+		"	*/\n"
+		"	template <unsigned int CATEGORY_HASH>\n"
+		"	static int Enumeration(const std::string & kw, bool * deprecated = nullptr) { return Enumeration(CATEGORY_HASH, kw, deprecated); }\n\n"
+		"	/*! Computes the hash (32-bit FNV-1a) of an enumeration type name.\n"
+		"		Categories are looked up via a collision-free hash table generated by the code generator.\n"
+		"		The function is constexpr, so that the hash of a string literal can be computed at compile time.\n"
+		"		\\param enumtype 	The full enumeration type including the class name.\n"
+		"		\\param h			Current hash value (used in recursion).\n"
+		"	*/\n"
+		"	static constexpr unsigned int CategoryHash(const char * const enumtype, unsigned int h = 2166136261u) {\n"
+		"		return (*enumtype == 0) ? h : CategoryHash(enumtype + 1, (h ^ (unsigned char)*enumtype) * 16777619u);\n"
+		"	}\n\n\n"
 		"	/*!	Returns the maximum index for entries of a category in the keyword list.\n"
 		"		This function throws an exception if the enumeration type is invalid or unknown.\n"
 		"		\\param enumtype 	The full enumeration type including the class name.\n"
@@ -246,6 +269,11 @@ const char * const HEADER_TEMPLATE =
 		"		\\return Returns true if the keyword is valid, otherwise false.\n"
 		"	*/\n"
 		"	static bool KeywordExists(const char * const enumtype, const std::string & kw);\n"
+		"	/*! Checks whether a keyword exists in the enumeration of the category identified by its hash.\n"
+		"		\\param categoryHash	Hash of the full enumeration type, computed with CategoryHash().\n"
+		"		\\return Returns true if the keyword is valid, otherwise false.\n"
+		"	*/\n"
+		"	static bool KeywordExists(unsigned int categoryHash, const std::string & kw);\n"
 		"	/*! Checks whether a category of type enumtype exists.\n"
 		"		\\return Returns true if the category/enum type exists, otherwise false.\n"
 		"	*/\n"
@@ -308,7 +336,9 @@ const char * const CPP_HEADER_TEMPLATE =
 		"#include \"${PREFIX}_KeywordList.h\"\n\n"
 		"#include <map>\n"
 		"#include <limits>\n"
-		"#include <iostream>\n\n"
+		"#include <iostream>\n"
+		"#include <algorithm>\n"
+		"#include <cstring>\n\n"
 		"#include <IBK_FormatString.h>\n"
 		"#include <IBK_Exception.h>\n\n\n"
 		"namespace ${NAMESPACE} {\n";
@@ -326,49 +356,47 @@ const char * const CPP_FOOTER =
 		"\n"
 		"	bool KeywordList::KeywordExists(const char * const enumtype, const std::string & kw) {\n"
 		"		int typenum = enum2index(enumtype);\n"
-		"		int i = 0;\n"
-		"		int maxIndexInCategory = MaxIndex( enumtype ); \n"
-		"		for ( ; i <= maxIndexInCategory; ++i ) {\n"
-		"			std::string keywords = allKeywords(typenum, i);\n"
-		"			if (keywords == INVALID_KEYWORD_INDEX_STRING)\n"
-		"				continue;\n"
-		"			std::stringstream strm(keywords);\n"
-		"			int j = 0;\n"
-		"			std::string kws;\n"
-		"			while (strm >> kws) {\n"
-		"				if (kws == kw) {\n"
-		"					return true; // keyword exists\n"
-		"				}\n"
-		"				++j;\n"
-		"			}\n"
-		"		}\n"
-		"		return false; // nothing found keyword doesn't exist.\n"
+		"		if (typenum == -1)\n"
+		"			throw IBK::Exception(IBK::FormatString(\"Invalid enumeration type '%1'.\")\n"
+		"				.arg(enumtype), \"[KeywordList::KeywordExists]\");\n"
+		"		return findKeyword(typenum, kw) != nullptr;\n"
+		"	}\n"
+		"\n"
+		"	bool KeywordList::KeywordExists(unsigned int categoryHash, const std::string & kw) {\n"
+		"		int typenum = hash2index(categoryHash);\n"
+		"		if (typenum == -1)\n"
+		"			throw IBK::Exception(IBK::FormatString(\"Invalid enumeration type hash '%1'.\")\n"
+		"				.arg(categoryHash), \"[KeywordList::KeywordExists]\");\n"
+		"		return findKeyword(typenum, kw) != nullptr;\n"
 		"	}\n"
 		"\n"
 		"	int KeywordList::Enumeration(const char * const enumtype, const std::string & kw, bool * deprecated) {\n"
 		"		int typenum = enum2index(enumtype);\n"
-		"		int i = 0;\n"
-		"		int maxIndexInCategory = MaxIndex( enumtype ); \n"
-		"		for ( ; i <= maxIndexInCategory; ++i ) {\n"
-		"			std::string keywords = allKeywords(typenum, i);\n"
-		"			if (keywords == INVALID_KEYWORD_INDEX_STRING)\n"
-		"				continue;\n"
-		"			std::stringstream strm(keywords);\n"
-		"			int j = 0;\n"
-		"			std::string kws;\n"
-		"			while (strm >> kws) {\n"
-		"				if (kws == kw) {\n"
-		"					if (deprecated != nullptr) {\n"
-		"						*deprecated = (j != 0);\n"
-		"					}\n"
-		"					return i;\n"
-		"				}\n"
-		"				++j;\n"
-		"			}\n"
-		"		} // for ( ; i < maxIndexInCategory; ++i ) {\n"
-		"		throw IBK::Exception(IBK::FormatString(\"Cannot determine enumeration value for \"\n"
-		"			\"enumeration type '%1' and keyword '%2'.\")\n"
-		"			.arg(enumtype).arg(kw), \"[KeywordList::Enumeration]\");\n"
+		"		if (typenum == -1)\n"
+		"			throw IBK::Exception(IBK::FormatString(\"Invalid enumeration type '%1'.\")\n"
+		"				.arg(enumtype), \"[KeywordList::Enumeration]\");\n"
+		"		const KeywordTableEntry * entry = findKeyword(typenum, kw);\n"
+		"		if (entry == nullptr)\n"
+		"			throw IBK::Exception(IBK::FormatString(\"Cannot determine enumeration value for \"\n"
+		"				\"enumeration type '%1' and keyword '%2'.\")\n"
+		"				.arg(enumtype).arg(kw), \"[KeywordList::Enumeration]\");\n"
+		"		if (deprecated != nullptr)\n"
+		"			*deprecated = entry->deprecated;\n"
+		"		return entry->index;\n"
+		"	}\n\n"
+		"	int KeywordList::Enumeration(unsigned int categoryHash, const std::string & kw, bool * deprecated) {\n"
+		"		int typenum = hash2index(categoryHash);\n"
+		"		if (typenum == -1)\n"
+		"			throw IBK::Exception(IBK::FormatString(\"Invalid enumeration type hash '%1'.\")\n"
+		"				.arg(categoryHash), \"[KeywordList::Enumeration]\");\n"
+		"		const KeywordTableEntry * entry = findKeyword(typenum, kw);\n"
+		"		if (entry == nullptr)\n"
+		"			throw IBK::Exception(IBK::FormatString(\"Cannot determine enumeration value for \"\n"
+		"				\"enumeration type '%1' and keyword '%2'.\")\n"
+		"				.arg(ENUM_TYPES[typenum]).arg(kw), \"[KeywordList::Enumeration]\");\n"
+		"		if (deprecated != nullptr)\n"
+		"			*deprecated = entry->deprecated;\n"
+		"		return entry->index;\n"
 		"	}\n\n"
 		"	bool KeywordList::CategoryExists(const char * const enumtype) {\n"
 		"		return enum2index(enumtype) != -1;\n"
@@ -0,0 +1,28 @@
+# Project file for SplineBenchmark
+#
+# remember to set DYLD_FALLBACK_LIBRARY_PATH on MacOSX
+# set LD_LIBRARY_PATH on Linux
+
+TARGET = SplineBenchmark
+TEMPLATE = app
+
+# this pri must be sourced from all our libraries,
+# it contains all functions defined for casual libraries
+include( ../../../externals/IBK/projects/Qt/IBK.pri )
+
+QT -= core gui
+
+CONFIG += console
+CONFIG -= app_bundle
+
+LIBS += \
+	-lIBK
+
+INCLUDEPATH = \
+	../../src \
+	../../../externals/IBK/src
+
+DEPENDPATH = $${INCLUDEPATH}
+
+SOURCES += \
+	../../src/main_spline_benchmark.cpp
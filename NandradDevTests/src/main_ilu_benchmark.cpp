@@ -0,0 +1,164 @@
+/*	Micro-benchmark for serial and level-scheduled ILU factorization and backsolve of sparse CSR matrices.
+
+	Usage:
+
+		IluBenchmark [jacobian_sparse.bin] [gamma]
+
+	Without arguments, a synthetic matrix with the typical NANDRAD structure is generated (many
+	one-dimensional constructions coupled to a few zone balances). Otherwise, the matrix is read from
+	a binary Jacobian dump (see DUMP_JACOBIAN_BINARY in SOLFRA_JacobianInterface.h) and the iteration
+	matrix I - gamma*J is composed.
+
+	Set OMP_NUM_THREADS to control the number of threads used by the level-scheduled variants.
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include <IBK_InputOutput.h>
+#include <IBK_Exception.h>
+#include <IBKMK_SparseMatrixCSR.h>
+
+/*! Creates a matrix with nBlocks tridiagonal blocks of blockSize rows each, followed by nZones rows.
+	First and last row of each block is coupled to one zone row.
+*/
+void createSyntheticMatrix(unsigned int nBlocks, unsigned int blockSize, unsigned int nZones, IBKMK::SparseMatrixCSR & mat) {
+	unsigned int n = nBlocks*blockSize + nZones;
+	std::vector<std::vector<unsigned int> > cols(n);
+	for (unsigned int b=0; b<nBlocks; ++b) {
+		unsigned int offset = b*blockSize;
+		unsigned int zone = nBlocks*blockSize + b % nZones;
+		for (unsigned int i=0; i<blockSize; ++i) {
+			unsigned int row = offset + i;
+			if (i > 0)
+				cols[row].push_back(row-1);
+			cols[row].push_back(row);
+			if (i < blockSize-1)
+				cols[row].push_back(row+1);
+		}
+		cols[offset].push_back(zone);
+		cols[zone].push_back(offset);
+		if (blockSize > 1) {
+			cols[offset + blockSize - 1].push_back(zone);
+			cols[zone].push_back(offset + blockSize - 1);
+		}
+	}
+	for (unsigned int z=0; z<nZones; ++z)
+		cols[nBlocks*blockSize + z].push_back(nBlocks*blockSize + z);
+
+	std::vector<unsigned int> ia(n+1, 0), ja;
+	for (unsigned int i=0; i<n; ++i) {
+		std::sort(cols[i].begin(), cols[i].end());
+		ja.insert(ja.end(), cols[i].begin(), cols[i].end());
+		ia[i+1] = (unsigned int)ja.size();
+	}
+	mat.resize(n, (unsigned int)ja.size(), &ia[0], &ja[0]);
+
+	// diagonally dominant values
+	const unsigned int * iaPtr = mat.constIa();
+	const unsigned int * jaPtr = mat.constJa();
+	double * data = mat.data();
+	for (unsigned int i=0; i<n; ++i) {
+		for (unsigned int k=iaPtr[i]; k<iaPtr[i+1]; ++k) {
+			if (jaPtr[k] == i)
+				data[k] = 4 + 0.001*(i % 17);
+			else
+				data[k] = -1 - 0.001*(jaPtr[k] % 13);
+		}
+	}
+}
+
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+int main(int argc, char * argv[]) {
+	try {
+		IBKMK::SparseMatrixCSR original;
+		if (argc > 1) {
+			IBK::read_matrix_binary(argv[1], original);
+			double gamma = 1;
+			if (argc > 2)
+				gamma = std::atof(argv[2]);
+			// compose iteration matrix I - gamma*J
+			double * data = original.data();
+			for (unsigned int k=0; k<original.nnz(); ++k)
+				data[k] *= -gamma;
+			original.addIdentityMatrix();
+		}
+		else
+			createSyntheticMatrix(5000, 20, 100, original);
+
+		unsigned int n = original.n();
+		std::cout << "n = " << n << ", nnz = " << original.nnz() << std::endl;
+#if defined(_OPENMP)
+		std::cout << "Threads: " << omp_get_max_threads() << std::endl;
+#else
+		std::cout << "Threads: 1 (compiled without OpenMP)" << std::endl;
+#endif
+
+		original.computeLevelSchedule();
+		std::cout << "Levels L = " << original.levelCountL() << ", levels U = " << original.levelCountU()
+				  << ", level scheduling efficient = " << (original.levelScheduleEfficient() ? "yes" : "no") << std::endl;
+
+		const unsigned int REPEAT = 50;
+		std::vector<double> rhs(n);
+		for (unsigned int i=0; i<n; ++i)
+			rhs[i] = 1 + 0.01*(i % 7);
+
+		// serial variant
+		IBKMK::SparseMatrixCSR serial(original);
+		std::vector<double> bSerial;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (unsigned int r=0; r<REPEAT; ++r) {
+			std::memcpy(serial.data(), original.data(), sizeof(double)*original.nnz());
+			serial.iluSerial();
+		}
+		double tIluSerial = elapsedMs(start)/REPEAT;
+		start = std::chrono::steady_clock::now();
+		for (unsigned int r=0; r<REPEAT; ++r) {
+			bSerial = rhs;
+			serial.backsolveILUSerial(&bSerial[0]);
+		}
+		double tSolveSerial = elapsedMs(start)/REPEAT;
+
+		// level-scheduled variant
+		IBKMK::SparseMatrixCSR levels(original);
+		std::vector<double> bLevels;
+		start = std::chrono::steady_clock::now();
+		for (unsigned int r=0; r<REPEAT; ++r) {
+			std::memcpy(levels.data(), original.data(), sizeof(double)*original.nnz());
+			levels.iluLevelScheduled();
+		}
+		double tIluLevels = elapsedMs(start)/REPEAT;
+		start = std::chrono::steady_clock::now();
+		for (unsigned int r=0; r<REPEAT; ++r) {
+			bLevels = rhs;
+			levels.backsolveILULevelScheduled(&bLevels[0]);
+		}
+		double tSolveLevels = elapsedMs(start)/REPEAT;
+
+		std::cout << "ilu()          serial: " << tIluSerial << " ms, level-scheduled: " << tIluLevels << " ms" << std::endl;
+		std::cout << "backsolveILU() serial: " << tSolveSerial << " ms, level-scheduled: " << tSolveLevels << " ms" << std::endl;
+
+		// results must be bitwise identical
+		bool identical = std::memcmp(serial.data(), levels.data(), sizeof(double)*original.nnz()) == 0 &&
+						 std::memcmp(&bSerial[0], &bLevels[0], sizeof(double)*n) == 0;
+		std::cout << "Results identical: " << (identical ? "yes" : "NO") << std::endl;
+		return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	catch (IBK::Exception & ex) {
+		ex.writeMsgStackToError();
+		return EXIT_FAILURE;
+	}
+}
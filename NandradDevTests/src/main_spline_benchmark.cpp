@@ -0,0 +1,109 @@
+/*	Micro-benchmark for IBK::LinearSpline::value() and the pre-scaled IBK::LinearSplineLookup.
+
+	Usage:
+
+		SplineBenchmark [nPoints] [nQueries]
+
+	A non-uniform spline with nPoints supporting points (default 50, similar to fluid property tables)
+	is evaluated at nQueries (default 100000) pseudo-random x values, partly outside the spline range.
+	The benchmark reports the time per evaluation for the original spline, the lookup with double and
+	float storage, and the maximum deviations from the original spline values.
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include <IBK_Exception.h>
+#include <IBK_LinearSpline.h>
+#include <IBK_LinearSplineLookup.h>
+
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+/*! Returns maximum absolute difference between two vectors. */
+double maxDeviation(const std::vector<double> & a, const std::vector<double> & b) {
+	double dev = 0;
+	for (unsigned int i=0; i<a.size(); ++i)
+		dev = std::max(dev, std::fabs(a[i] - b[i]));
+	return dev;
+}
+
+
+/*! Times nRepeat batched evaluations of the given lookup table, returns time per evaluation in ns. */
+template <typename T>
+double timeLookup(const IBK::LinearSplineLookup<T> & lookup, const std::vector<double> & x, std::vector<double> & y,
+				  unsigned int nRepeat)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (unsigned int r=0; r<nRepeat; ++r)
+		lookup.values(x.data(), y.data(), (unsigned int)x.size());
+	return elapsedMs(start)*1e6/(nRepeat*x.size());
+}
+
+
+int main(int argc, char * argv[]) {
+	try {
+		unsigned int nPoints = 50;
+		unsigned int nQueries = 100000;
+		if (argc > 1)
+			nPoints = (unsigned int)std::max(1, std::atoi(argv[1]));
+		if (argc > 2)
+			nQueries = (unsigned int)std::max(1, std::atoi(argv[2]));
+
+		// non-uniform spline in range 0..100, similar to a kinematic viscosity curve
+		std::vector<double> xs, ys;
+		for (unsigned int i=0; i<nPoints; ++i) {
+			double t = nPoints > 1 ? double(i)/(nPoints-1) : 0;
+			xs.push_back(100*t*t);
+			ys.push_back(1.8e-6*std::exp(-0.025*xs.back()));
+		}
+		IBK::LinearSpline spline;
+		spline.setValues(xs, ys);
+		std::string errMsg;
+		if (!spline.makeSpline(errMsg))
+			throw IBK::Exception(errMsg, "[main]");
+
+		// query points, 5% of them outside spline range (linear congruential generator for reproducibility)
+		std::vector<double> x(nQueries);
+		unsigned int seed = 12345;
+		for (unsigned int i=0; i<nQueries; ++i) {
+			seed = seed*1103515245u + 12345u;
+			x[i] = -2.5 + 105*double(seed >> 8)/double(1u << 24);
+		}
+
+		IBK::LinearSplineLookup<double> lookupDouble;
+		lookupDouble.setup(spline);
+		IBK::LinearSplineLookup<float> lookupFloat;
+		lookupFloat.setup(spline);
+
+		std::cout << "Spline points: " << nPoints << ", queries: " << nQueries << std::endl;
+		std::cout << "Table size: " << lookupDouble.tableSize() << ", search steps: " << lookupDouble.searchSteps() << std::endl;
+
+		const unsigned int REPEAT = std::max(1u, 20000000u/nQueries);
+		std::vector<double> yRef(nQueries), yDouble(nQueries), yFloat(nQueries);
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (unsigned int r=0; r<REPEAT; ++r)
+			for (unsigned int i=0; i<nQueries; ++i)
+				yRef[i] = spline.value(x[i]);
+		double tSpline = elapsedMs(start)*1e6/(REPEAT*nQueries);
+		double tDouble = timeLookup(lookupDouble, x, yDouble, REPEAT);
+		double tFloat = timeLookup(lookupFloat, x, yFloat, REPEAT);
+
+		std::cout << "LinearSpline::value()           : " << tSpline << " ns" << std::endl;
+		std::cout << "LinearSplineLookup<double>      : " << tDouble << " ns, max deviation = " << maxDeviation(yRef, yDouble) << std::endl;
+		std::cout << "LinearSplineLookup<float>       : " << tFloat << " ns, max deviation = " << maxDeviation(yRef, yFloat) << std::endl;
+		return EXIT_SUCCESS;
+	}
+	catch (IBK::Exception & ex) {
+		ex.writeMsgStackToError();
+		return EXIT_FAILURE;
+	}
+}
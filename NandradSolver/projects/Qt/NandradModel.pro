@@ -52,10 +52,12 @@ INCLUDEPATH = \
 
 SOURCES += \
 	../../src/NM_AbstractModel.cpp \
+	../../src/NM_BatchRunner.cpp \
 	../../src/NM_ConstantZoneModel.cpp \
 	../../src/NM_ConstructionBalanceModel.cpp \
 	../../src/NM_ConstructionStatesModel.cpp \
 	../../src/NM_Controller.cpp \
+	../../src/NM_DailyCycleScheduleTable.cpp \
 	../../src/NM_DefaultModel.cpp \
 	../../src/NM_DefaultStateDependency.cpp \
 	../../src/NM_Directories.cpp \
@@ -70,10 +72,12 @@ SOURCES += \
 	../../src/NM_InternalMoistureLoadsModel.cpp \
 	../../src/NM_KeywordList.cpp \
 	../../src/NM_Loads.cpp \
+	../../src/NM_LongWaveRadiationExchangeModel.cpp \
 	../../src/NM_NandradModel.cpp \
 	../../src/NM_NaturalVentilationModel.cpp \
 	../../src/NM_NetworkInterfaceAdapterModel.cpp \
 	../../src/NM_OutputFile.cpp \
+	../../src/NM_OutputGridQueue.cpp \
 	../../src/NM_OutputHandler.cpp \
 	../../src/NM_Physics.cpp \
 	../../src/NM_QuantityName.cpp \
@@ -81,6 +85,7 @@ SOURCES += \
 	../../src/NM_RoomRadiationLoadsModel.cpp \
 	../../src/NM_RoomStatesModel.cpp \
 	../../src/NM_Schedules.cpp \
+	../../src/NM_SharedInputData.cpp \
 	../../src/NM_ShadingControlModel.cpp \
 	../../src/NM_StateModelGroup.cpp \
 	../../src/NM_SteadyStateSolver.cpp \
@@ -89,6 +94,7 @@ SOURCES += \
 	../../src/NM_ThermalNetworkAbstractFlowElementWithHeatLoss.cpp \
 	../../src/NM_ThermalNetworkBalanceModel.cpp \
 	../../src/NM_ThermalNetworkFlowElements.cpp \
+	../../src/NM_ThermalNetworkPipeBatch.cpp \
 	../../src/NM_ThermalNetworkPrivate.cpp \
 	../../src/NM_ThermalNetworkStatesModel.cpp \
 	../../src/NM_ThermostatModel.cpp \
@@ -102,8 +108,10 @@ HEADERS += \
 	../../src/NM_AbstractModel.h \
 	../../src/NM_AbstractStateDependency.h \
 	../../src/NM_AbstractTimeDependency.h \
+	../../src/NM_BatchRunner.h \
 	../../src/NM_ConstructionBalanceModel.h \
 	../../src/NM_ConstructionStatesModel.h \
+	../../src/NM_DailyCycleScheduleTable.h \
 	../../src/NM_DefaultModel.h \
 	../../src/NM_DefaultStateDependency.h \
 	../../src/NM_Directories.h \
@@ -120,10 +128,12 @@ HEADERS += \
 	../../src/NM_InternalMoistureLoadsModel.h \
 	../../src/NM_KeywordList.h \
 	../../src/NM_Loads.h \
+	../../src/NM_LongWaveRadiationExchangeModel.h \
 	../../src/NM_NandradModel.h \
 	../../src/NM_NaturalVentilationModel.h \
 	../../src/NM_NetworkInterfaceAdapterModel.h \
 	../../src/NM_OutputFile.h \
+	../../src/NM_OutputGridQueue.h \
 	../../src/NM_OutputHandler.h \
 	../../src/NM_Physics.h \
 	../../src/NM_QuantityDescription.h \
@@ -132,6 +142,7 @@ HEADERS += \
 	../../src/NM_RoomRadiationLoadsModel.h \
 	../../src/NM_RoomStatesModel.h \
 	../../src/NM_Schedules.h \
+	../../src/NM_SharedInputData.h \
 	../../src/NM_StateModelGroup.h \
 	../../src/NM_SteadyStateSolver.h \
 	../../src/NM_ThermalComfortModel.h \
@@ -144,6 +155,7 @@ HEADERS += \
 	../../src/NM_WindowModel.h \
 	../../src/NM_InternalLoadsModel.h \
 	../../src/NM_ThermalNetworkPrivate.h \
+	../../src/NM_ThermalNetworkPipeBatch.h \
 	../../src/NM_ThermalNetworkAbstractFlowElement.h \
 	../../src/NM_ThermalNetworkFlowElements.h \
 	../../src/NM_AbstractController.h \
@@ -0,0 +1,319 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NM_BatchRunner.h"
+
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include <IBK_messages.h>
+#include <IBK_Exception.h>
+#include <IBK_MessageHandler.h>
+#include <IBK_MessageHandlerRegistry.h>
+#include <IBK_StopWatch.h>
+#include <IBK_StringUtils.h>
+#include <IBK_FileUtils.h>
+
+#include <SOLFRA_SolverControlFramework.h>
+
+#include <NANDRAD_ArgsParser.h>
+#include <NANDRAD_Project.h>
+
+#include "NM_NandradModel.h"
+
+namespace NANDRAD_MODEL {
+
+/*! Installs a message handler for the current thread and removes it again when going out of scope. */
+class ThreadMessageHandlerGuard {
+public:
+	explicit ThreadMessageHandlerGuard(IBK::MessageHandler * handler) {
+		IBK::MessageHandlerRegistry::instance().setThreadMessageHandler(handler);
+	}
+	~ThreadMessageHandlerGuard() {
+		IBK::MessageHandlerRegistry::instance().setThreadMessageHandler(nullptr);
+	}
+};
+
+
+std::vector<IBK::Path> BatchRunner::readProjectList(const IBK::Path & listFile) {
+	FUNCID(BatchRunner::readProjectList);
+
+	std::ifstream in;
+	if (!IBK::open_ifstream(in, listFile))
+		throw IBK::Exception(IBK::FormatString("Cannot open project list file '%1'.").arg(listFile), FUNC_ID);
+
+	std::vector<IBK::Path> projectFiles;
+	std::string line;
+	while (std::getline(in, line)) {
+		IBK::trim(line);
+		if (line.empty() || line[0] == '#')
+			continue;
+		IBK::Path p(line);
+		if (!p.isAbsolute())
+			p = listFile.parentPath() / p;
+		projectFiles.push_back(p);
+	}
+	if (projectFiles.empty())
+		throw IBK::Exception(IBK::FormatString("Project list file '%1' does not contain any project files.").arg(listFile), FUNC_ID);
+	return projectFiles;
+}
+
+
+void BatchRunner::run(const std::vector<IBK::Path> & projectFiles, const NANDRAD::ArgsParser & args, unsigned int numThreads) {
+	FUNCID(BatchRunner::run);
+
+	IBK::StopWatch timer;
+
+	m_results.clear();
+	m_results.resize(projectFiles.size());
+	for (unsigned int i=0; i<projectFiles.size(); ++i)
+		m_results[i].m_projectFile = projectFiles[i];
+	m_finishedJobs = 0;
+	m_numThreads = std::max<unsigned int>(1, std::min<unsigned int>(numThreads, (unsigned int)projectFiles.size()));
+
+	IBK::IBK_Message(IBK::FormatString("Running %1 projects with %2 concurrent simulation(s)\n")
+					 .arg(projectFiles.size()).arg(m_numThreads), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+
+	// each worker picks the next unprocessed project until all are done
+	std::atomic<unsigned int> nextJob(0);
+	std::vector<std::thread> workers;
+	for (unsigned int t=0; t<m_numThreads; ++t) {
+		workers.push_back(std::thread([&]() {
+#if defined(_OPENMP)
+			// parallelization happens on project level
+			omp_set_num_threads(1);
+#endif // _OPENMP
+			for (;;) {
+				unsigned int jobIdx = nextJob++;
+				if (jobIdx >= m_results.size())
+					break;
+				runJob(m_results[jobIdx], args, false);
+			}
+		}));
+	}
+	for (std::thread & w : workers)
+		w.join();
+
+	m_wallClockTime = timer.difference()*1e-3;
+}
+
+
+void BatchRunner::runPrefix(const IBK::Path & baseProjectFile, const NANDRAD::ArgsParser & args, unsigned int numThreads) {
+	FUNCID(BatchRunner::runPrefix);
+
+	m_prefixResult = JobResult();
+	m_prefixResult.m_projectFile = baseProjectFile;
+	m_snapshot.clear();
+
+	IBK::IBK_Message(IBK::FormatString("Running base project '%1' with %2 thread(s)\n")
+					 .arg(baseProjectFile.filename()).arg(numThreads), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+#if defined(_OPENMP)
+	// prefix runs alone, so it may use all threads
+	omp_set_num_threads((int)std::max<unsigned int>(1, numThreads));
+#endif // _OPENMP
+
+	// only a single job in progress counter
+	m_finishedJobs = 0;
+	m_results.clear();
+	runJob(m_prefixResult, args, true);
+	if (!m_prefixResult.m_success)
+		throw IBK::Exception(IBK::FormatString("Simulation of base project '%1' failed: %2")
+							 .arg(baseProjectFile).arg(m_prefixResult.m_errorMessage), FUNC_ID);
+	if (!m_snapshot.empty())
+		IBK::IBK_Message(IBK::FormatString("Forking variants at t = %1 d\n").arg(m_forkTime/86400, 0, 'f', 3),
+						 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+}
+
+
+void BatchRunner::writeSummary() const {
+	FUNCID(BatchRunner::writeSummary);
+
+	unsigned int nFailed = 0;
+	double sumRunDuration = 0;
+	double sumInitDuration = 0;
+	double sumSimulatedTime = 0;
+	for (const JobResult & job : m_results) {
+		if (!job.m_success) {
+			++nFailed;
+			continue;
+		}
+		sumRunDuration += job.m_runDuration;
+		sumInitDuration += job.m_initDuration;
+		sumSimulatedTime += job.m_simulatedTime;
+	}
+
+	IBK::IBK_Message("\nBatch summary\n", IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	IBK_MSG_INDENT;
+	for (const JobResult & job : m_results) {
+		std::stringstream strm;
+		if (job.m_success)
+			strm << "OK     " << std::setw(10) << std::right << std::fixed << std::setprecision(2) << job.m_initDuration << " s "
+				 << std::setw(10) << std::right << job.m_runDuration << " s   " << job.m_projectFile.str() << "\n";
+		else
+			strm << "FAILED " << std::setw(26) << " " << job.m_projectFile.str() << "\n";
+		IBK::IBK_Message(strm.str(), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	}
+
+	unsigned int nSuccess = (unsigned int)m_results.size() - nFailed;
+	IBK::IBK_Message(IBK::FormatString("Projects                  = %1 (%2 failed)\n").arg(m_results.size()).arg(nFailed),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	IBK::IBK_Message(IBK::FormatString("Concurrent simulations    = %1\n").arg(m_numThreads),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	IBK::IBK_Message(IBK::FormatString("Wall clock time           = %1 s\n").arg(m_wallClockTime, 0, 'f', 2),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	if (nSuccess == 0 || m_wallClockTime <= 0)
+		return;
+	IBK::IBK_Message(IBK::FormatString("Sum of project run times  = %1 s (initialization %2 s)\n")
+					 .arg(sumRunDuration, 0, 'f', 2).arg(sumInitDuration, 0, 'f', 2),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	IBK::IBK_Message(IBK::FormatString("Thread utilization        = %1 %\n")
+					 .arg(100*sumRunDuration/(m_wallClockTime*m_numThreads), 0, 'f', 1),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	double simsPerHour = nSuccess/m_wallClockTime*3600;
+	IBK::IBK_Message(IBK::FormatString("Throughput                = %1 simulations/h (%2 simulations/h per core)\n")
+					 .arg(simsPerHour, 0, 'f', 1).arg(simsPerHour/m_numThreads, 0, 'f', 1),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	double simDaysPerSecond = sumSimulatedTime/86400/m_wallClockTime;
+	IBK::IBK_Message(IBK::FormatString("Simulated time            = %1 d/s (%2 d/s per core)\n")
+					 .arg(simDaysPerSecond, 0, 'f', 1).arg(simDaysPerSecond/m_numThreads, 0, 'f', 1),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	IBK::IBK_Message(IBK::FormatString("Shared input data         = %1 reused, %2 created\n")
+					 .arg(m_sharedInputData.m_cacheHits).arg(m_sharedInputData.m_cacheMisses),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	if (!m_snapshot.empty())
+		IBK::IBK_Message(IBK::FormatString("Shared prefix             = %1 d in %2 s (not included above)\n")
+						 .arg(m_prefixResult.m_simulatedTime/86400, 0, 'f', 1).arg(m_prefixResult.m_runDuration, 0, 'f', 2),
+						 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+}
+
+
+void BatchRunner::runJob(JobResult & job, const NANDRAD::ArgsParser & args, bool prefixRun) {
+	FUNCID(BatchRunner::runJob);
+
+	IBK::StopWatch timer;
+
+	// each project gets its own message handler, so that log output goes into the project's log directory
+	IBK::MessageHandler messageHandler;
+	unsigned int verbosityLevel = IBK::string2val<unsigned int>(args.option(IBK::SolverArgsParser::DO_VERBOSITY_LEVEL));
+	messageHandler.setConsoleVerbosityLevel(0); // console is reserved for batch progress
+	messageHandler.setLogfileVerbosityLevel((int)verbosityLevel);
+	messageHandler.m_contextIndentation = 48;
+
+	{
+		ThreadMessageHandlerGuard guard(&messageHandler);
+
+		try {
+			NANDRAD::ArgsParser jobArgs(args);
+			jobArgs.m_projectFile = job.m_projectFile;
+			if (args.hasOption(IBK::SolverArgsParser::GO_OUTPUT_DIR)) {
+				IBK::Path outputDir = IBK::Path(args.option(IBK::SolverArgsParser::GO_OUTPUT_DIR)) / job.m_projectFile.filename().withoutExtension();
+				jobArgs.setOption(args.keyword(IBK::SolverArgsParser::GO_OUTPUT_DIR), outputDir.str());
+			}
+
+			NandradModel model;
+			model.setSharedInputData(&m_sharedInputData);
+			model.setupDirectories(jobArgs);
+
+			std::string errmsg;
+			IBK::Path logfile = model.dirs().m_logDir / "screenlog.txt";
+			if (!messageHandler.openLogFile(logfile.str(), false, errmsg))
+				IBK::IBK_Message(errmsg, IBK::MSG_WARNING, FUNC_ID);
+
+			// variants of a sweep continue from the snapshot, their output files continue the prefix results
+			bool fork = !prefixRun && !m_snapshot.empty();
+			if (fork) {
+				jobArgs.m_restartFrom = true;
+				jobArgs.m_restartTime = m_forkTime;
+			}
+
+			NandradModel::printVersionStrings();
+			model.init(jobArgs);
+			job.m_initDuration = timer.difference()*1e-3;
+			IBK::IBK_Message( IBK::FormatString("Model initialization complete, duration: %1\n\n").arg(timer.diff_str()),
+							  IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+
+			if (fork) {
+				if (model.t0() > m_forkTime + 1e-6 || model.tEnd() < m_forkTime + 1e-6)
+					throw IBK::Exception(IBK::FormatString("Fork time %1 d is outside the simulation interval of the project.")
+										 .arg(m_forkTime/86400), FUNC_ID);
+				if (model.project().m_outputs != m_prefixOutputs)
+					throw IBK::Exception("Output definitions of project differ from base project.", FUNC_ID);
+				// output files are created/re-opened on first output, so we can copy the prefix results now
+				if (!IBK::Path::copy(m_prefixResultsDir, model.dirs().m_resultsDir))
+					throw IBK::Exception(IBK::FormatString("Cannot copy results of base project into '%1'.")
+										 .arg(model.dirs().m_resultsDir), FUNC_ID);
+			}
+
+			SOLFRA::SolverControlFramework solver(&model);
+			solver.m_useStepStatistics = args.flagEnabled(IBK::SolverArgsParser::DO_STEP_STATS);
+			solver.m_logDirectory = model.dirs().m_logDir;
+			solver.m_stopAfterSolverInit = args.flagEnabled(IBK::SolverArgsParser::GO_TEST_INIT);
+			solver.m_restartFilename = model.dirs().m_varDir / "restart.bin";
+			if (fork) {
+				IBK::IBK_Message(IBK::FormatString("Continuing computation from snapshot at t = %1 d\n\n").arg(m_forkTime/86400),
+								 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+				solver.restartFromSnapshot(m_forkTime, m_snapshot);
+			}
+			else
+				solver.run();
+			if (!solver.m_stopAfterSolverInit) {
+				solver.writeMetrics();
+				job.m_simulatedTime = model.tEnd() - (fork ? m_forkTime : model.t0());
+				if (prefixRun) {
+					solver.lastRestartPoint(m_forkTime, m_snapshot);
+					m_prefixOutputs = model.project().m_outputs;
+					m_prefixResultsDir = model.dirs().m_resultsDir;
+				}
+			}
+			job.m_success = true;
+		}
+		catch (IBK::Exception & ex) {
+			ex.writeMsgStackToError();
+			job.m_errorMessage = ex.what();
+		}
+		catch (std::exception & ex) {
+			IBK::IBK_Message(ex.what(), IBK::MSG_ERROR, FUNC_ID);
+			job.m_errorMessage = ex.what();
+		}
+	}
+	job.m_runDuration = timer.difference()*1e-3;
+
+	// guard has been released, so this message goes to the batch message handler
+	std::lock_guard<std::mutex> lock(m_progressMutex);
+	++m_finishedJobs;
+	if (prefixRun)
+		return; // reported by runPrefix()
+	if (job.m_success)
+		IBK::IBK_Message(IBK::FormatString("[%1/%2] Finished '%3' (%4 s)\n").arg(m_finishedJobs).arg(m_results.size())
+						 .arg(job.m_projectFile.filename()).arg(job.m_runDuration, 0, 'f', 2), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	else
+		IBK::IBK_Message(IBK::FormatString("[%1/%2] Failed '%3': %4\n").arg(m_finishedJobs).arg(m_results.size())
+						 .arg(job.m_projectFile.filename()).arg(job.m_errorMessage), IBK::MSG_ERROR, FUNC_ID);
+}
+
+} // namespace NANDRAD_MODEL
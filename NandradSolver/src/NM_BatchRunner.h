@@ -0,0 +1,148 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NM_BatchRunnerH
+#define NM_BatchRunnerH
+
+#include <string>
+#include <vector>
+#include <mutex>
+
+#include <IBK_Path.h>
+
+#include <NANDRAD_Outputs.h>
+
+#include "NM_SharedInputData.h"
+
+namespace NANDRAD {
+	class ArgsParser;
+}
+
+namespace NANDRAD_MODEL {
+
+/*!	Runs many NANDRAD projects (e.g. variants of a parameter study) in a single process.
+
+	Projects are distributed onto a pool of worker threads, each thread runs one NandradModel at a time
+	with its own solver framework, log file and output directories - exactly as if the solver was started
+	for each project individually. Immutable input data (climate data, Jacobian coloring) is read/computed
+	only once and shared between all models via SharedInputData.
+
+	Each model runs with a single OpenMP thread, parallelization happens on the level of projects.
+
+	\code
+	BatchRunner runner;
+	runner.run(BatchRunner::readProjectList(listFile), args, 8);
+	runner.writeSummary();
+	\endcode
+
+	For parameter sweeps that share a common warm-up period, runPrefix() simulates this period once
+	and stores the final integrator and model state (snapshot). Afterwards run() forks all variants from
+	this snapshot instead of simulating each variant from its initial conditions.
+*/
+class BatchRunner {
+public:
+	/*! Result/statistics of a single project run. */
+	struct JobResult {
+		/*! Project file. */
+		IBK::Path		m_projectFile;
+		/*! True, if simulation completed successfully. */
+		bool			m_success = false;
+		/*! Error message in case of failed simulation. */
+		std::string		m_errorMessage;
+		/*! Wall clock time needed for model initialization in [s]. */
+		double			m_initDuration = 0;
+		/*! Wall clock time needed for the entire project (including initialization) in [s]. */
+		double			m_runDuration = 0;
+		/*! Simulated time interval in [s]. */
+		double			m_simulatedTime = 0;
+	};
+
+	/*! Reads list of project files from a text file, one project file per line.
+		Empty lines and lines starting with # are skipped. Relative paths are resolved relative to
+		the directory of the list file.
+		Throws an exception if the file cannot be read or does not contain any project.
+	*/
+	static std::vector<IBK::Path> readProjectList(const IBK::Path & listFile);
+
+	/*! Runs all projects and returns when all simulations have finished.
+		\param projectFiles Project files to simulate.
+		\param args Parsed command line, used for all projects (project file is replaced). If an
+			output directory is given, each project writes to a sub-directory named after the project file.
+		\param numThreads Number of simulations running concurrently.
+	*/
+	void run(const std::vector<IBK::Path> & projectFiles, const NANDRAD::ArgsParser & args, unsigned int numThreads);
+
+	/*! Simulates the shared prefix of a snapshot-fork sweep and keeps the state at its simulation end.
+		The simulation end of the base project defines the fork time. All projects passed to a subsequent call
+		of run() are continued from this state, whereby each project applies its own parameters (schedules,
+		setpoints, FMI input values, ...) from the fork time onwards. Projects must therefore have the same
+		model structure (number of unknowns, model state data) and the same output definitions as the base
+		project, and their simulation interval must contain the fork time.
+		The results of the prefix are copied into each project's result directory and continued, so that
+		each variant gets complete result files.
+		\param baseProjectFile Project file of the shared prefix.
+		\param args Parsed command line (see run()).
+		\param numThreads Number of OpenMP threads used for the prefix simulation.
+		Throws an IBK::Exception if the prefix simulation fails.
+	*/
+	void runPrefix(const IBK::Path & baseProjectFile, const NANDRAD::ArgsParser & args, unsigned int numThreads);
+
+	/*! Writes summary of batch run (per-project durations and throughput) to the message handler. */
+	void writeSummary() const;
+
+	/*! Results of all projects (same order as projectFiles passed to run()). */
+	std::vector<JobResult>		m_results;
+	/*! Number of threads used in last call to run(). */
+	unsigned int				m_numThreads = 1;
+	/*! Wall clock time of last call to run() in [s]. */
+	double						m_wallClockTime = 0;
+
+	/*! Data shared by all models. */
+	SharedInputData				m_sharedInputData;
+
+	/*! Result of the prefix simulation, only set by runPrefix(). */
+	JobResult					m_prefixResult;
+	/*! Fork time in [s], simulation time of snapshot. */
+	double						m_forkTime = 0;
+
+private:
+	/*! Runs a single project, called from worker threads.
+		\param prefixRun If true, the project is the base project of a sweep and its final state is
+			stored as snapshot.
+	*/
+	void runJob(JobResult & job, const NANDRAD::ArgsParser & args, bool prefixRun);
+
+	/*! Solution vector and model serialization data at fork time, empty if no prefix was simulated. */
+	std::vector<double>			m_snapshot;
+	/*! Output definitions of base project, variants must use the same definitions. */
+	NANDRAD::Outputs			m_prefixOutputs;
+	/*! Result directory of base project. */
+	IBK::Path					m_prefixResultsDir;
+
+	/*! Serializes progress messages of worker threads. */
+	std::mutex					m_progressMutex;
+	/*! Number of finished projects. */
+	unsigned int				m_finishedJobs = 0;
+};
+
+} // namespace NANDRAD_MODEL
+
+#endif // NM_BatchRunnerH
@@ -31,6 +31,7 @@
 #include "NM_IdealSurfaceHeatingCoolingModel.h"
 #include "NM_InternalLoadsModel.h"
 #include "NM_KeywordList.h"
+#include "NM_LongWaveRadiationExchangeModel.h"
 #include "NM_ThermalNetworkBalanceModel.h"
 
 namespace NANDRAD_MODEL {
@@ -54,7 +55,10 @@ void ConstructionBalanceModel::setup(const NANDRAD::ConstructionInstance & con,
 	m_area = con.m_netHeatTransferArea;
 
 	// resize storage vectors for divergences, sources, and initialize boundary conditions
-	m_ydot.resize(m_statesModel->m_n);
+	m_ydotStorage.resize(m_statesModel->m_n);
+	m_ydot = m_ydotStorage.data();
+	if (m_statesModel->m_nModes != 0)
+		m_elementHeatFluxes.resize(m_statesModel->m_nElements);
 	m_results.resize(NUM_R);
 	m_vectorValuedResults.resize(NUM_VVR);
 	m_vectorValuedResults[VVR_ThermalLoad] = VectorValuedQuantity(con.m_constructionType->m_materialLayers.size(), 0);
@@ -151,11 +155,6 @@ void ConstructionBalanceModel::initInputReferences(const std::vector<AbstractMod
 	// return already generated references
 	m_inputRefs.resize(NUM_InputRef);
 
-	// Input references to values of long wave radiation that is emitted by other instances and received by this one at side A.
-	std::vector<InputReference>						inputRefsAbsorbedLWRadiationA;
-	// Input references to values of long wave radiation that is emitted by other instances and received by this one at side B.
-	std::vector<InputReference>						inputRefsAbsorbedLWRadiationB;
-
 	// compute input references depending on requirements of interfaces
 
 	// side A
@@ -184,28 +183,16 @@ void ConstructionBalanceModel::initInputReferences(const std::vector<AbstractMod
 			// Note: for LW exchange with ambient we don't need input references, as we access loads model directly
 
 			if (m_con->m_interfaceA.m_zoneId != 0) {
-				// for internal LW exchange we need emitted LW fluxes from each connected interface
-				const auto &connectedInterfacesA = m_con->m_interfaceA.m_connectedInterfaces;
-				for (auto it=connectedInterfacesA.begin(); it!=connectedInterfacesA.end(); ++it) {
-					InputReference ref;
-					ref.m_id = it->first; // id of emitting construction instance
-					ref.m_referenceType = NANDRAD::ModelInputReference::MRT_CONSTRUCTIONINSTANCE;
-					// we need to find out if this interface is side A or B or connected construction
-					bool sideA = it->second->m_isSideA;
-					if (sideA)
-						ref.m_name.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::VectorValuedResults", ConstructionStatesModel::VVR_EmittedLongWaveRadiationA);
-					else
-						ref.m_name.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::VectorValuedResults", ConstructionStatesModel::VVR_EmittedLongWaveRadiationB);
-					ref.m_name.m_index = int(m_id); // id of absorbing instance (ourself)
-					inputRefsAbsorbedLWRadiationA.push_back(ref);
-				}
-
+				// for internal LW exchange we need the net absorbed LW flux density, computed by the
+				// long wave radiation exchange model of the zone
 				InputReference ref;
-				ref.m_id = m_con->m_id;
-				ref.m_referenceType = NANDRAD::ModelInputReference::MRT_CONSTRUCTIONINSTANCE;
-				ref.m_name.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::Results", ConstructionStatesModel::R_FluxEmittedLongWaveRadiationA);
+				ref.m_id = m_con->m_interfaceA.m_zoneId;
+				ref.m_referenceType = NANDRAD::ModelInputReference::MRT_ZONE;
+				ref.m_name.m_name = NANDRAD_MODEL::KeywordList::Keyword("LongWaveRadiationExchangeModel::VectorValuedResults",
+																		LongWaveRadiationExchangeModel::VVR_NetLongWaveRadiationFluxDensity);
+				ref.m_name.m_index = int(m_id); // id of absorbing instance (ourself)
 				ref.m_required = true;
-				m_inputRefs[InputRef_SideAEmittedLongWaveRadiation] = ref;
+				m_inputRefs[InputRef_SideANetLongWaveRadiation] = ref;
 			}
 		}
 	}
@@ -237,27 +224,14 @@ void ConstructionBalanceModel::initInputReferences(const std::vector<AbstractMod
 
 			// dependencies only for inside radiation exchange
 			if (m_con->m_interfaceB.m_zoneId != 0) {
-				const auto &connectedInterfacesB = m_con->m_interfaceB.m_connectedInterfaces;
-				for (auto it=connectedInterfacesB.begin(); it!=connectedInterfacesB.end(); ++it) {
-					InputReference ref;
-					ref.m_id = it->first;  // id of emitting construction instance
-					ref.m_referenceType = NANDRAD::ModelInputReference::MRT_CONSTRUCTIONINSTANCE;
-					// we need to find out if this interface is side A or B or connected construction
-					bool sideA = it->second->m_isSideA;
-					if (sideA)
-						ref.m_name.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::VectorValuedResults", ConstructionStatesModel::VVR_EmittedLongWaveRadiationA);
-					else
-						ref.m_name.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::VectorValuedResults", ConstructionStatesModel::VVR_EmittedLongWaveRadiationB);
-					ref.m_name.m_index = int(m_id); // id of absorbing instance (ourself)
-					inputRefsAbsorbedLWRadiationB.push_back(ref);
-				}
-
 				InputReference ref;
-				ref.m_id = m_con->m_id;
-				ref.m_referenceType = NANDRAD::ModelInputReference::MRT_CONSTRUCTIONINSTANCE;
-				ref.m_name.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::Results", ConstructionStatesModel::R_FluxEmittedLongWaveRadiationB);
+				ref.m_id = m_con->m_interfaceB.m_zoneId;
+				ref.m_referenceType = NANDRAD::ModelInputReference::MRT_ZONE;
+				ref.m_name.m_name = NANDRAD_MODEL::KeywordList::Keyword("LongWaveRadiationExchangeModel::VectorValuedResults",
+																		LongWaveRadiationExchangeModel::VVR_NetLongWaveRadiationFluxDensity);
+				ref.m_name.m_index = int(m_id); // id of absorbing instance (ourself)
 				ref.m_required = true;
-				m_inputRefs[InputRef_SideBEmittedLongWaveRadiation] = ref;
+				m_inputRefs[InputRef_SideBNetLongWaveRadiation] = ref;
 			}
 		}
 	}
@@ -413,12 +387,6 @@ void ConstructionBalanceModel::initInputReferences(const std::vector<AbstractMod
 		}
 	} // model object loop
 
-	// insert references for absorbed long wave radiation
-	m_inputRefs.insert(m_inputRefs.end(), inputRefsAbsorbedLWRadiationA.begin(), inputRefsAbsorbedLWRadiationA.end());
-	m_inputRefs.insert(m_inputRefs.end(), inputRefsAbsorbedLWRadiationB.begin(), inputRefsAbsorbedLWRadiationB.end());
-	m_absorbedLWRadiationACount = inputRefsAbsorbedLWRadiationA.size();
-	m_absorbedLWRadiationBCount = inputRefsAbsorbedLWRadiationB.size();
-
 	// insert references to all surface heating load mdoels
 	m_inputRefs.insert(m_inputRefs.end(), surfaceHeatLoadRH.begin(), surfaceHeatLoadRH.end());
 }
@@ -441,15 +409,7 @@ void ConstructionBalanceModel::setInputValueRefs(const std::vector<QuantityDescr
 	for(unsigned int i = 0; i < NUM_InputRef; ++i)
 		m_valueRefs[i] = resultValueRefs[i];
 
-	// copy optional values for inside long wave radiation, side A and B
 	unsigned int lastIdx = NUM_InputRef;
-	for (unsigned int i = lastIdx; i < lastIdx + m_absorbedLWRadiationACount; ++i)
-		m_valueRefsAbsorbedLWRadiationA.push_back( resultValueRefs[i] );
-	lastIdx += m_absorbedLWRadiationACount;
-
-	for (unsigned int i = lastIdx; i < lastIdx + m_absorbedLWRadiationBCount; ++i)
-		m_valueRefsAbsorbedLWRadiationB.push_back( resultValueRefs[i] );
-	lastIdx += m_absorbedLWRadiationBCount;
 
 	// copy optional values for active layer
 	if (m_statesModel->m_activeLayerIndex != NANDRAD::INVALID_ID) {
@@ -482,15 +442,23 @@ void ConstructionBalanceModel::stateDependencies(std::vector<std::pair<const dou
 	//       from the layer temperatures ourselves.
 
 	// ydot  (depend on element temperatures), boundary ydot also from boundary fluxes (added below)
-	for (unsigned int i=0; i<m_statesModel->m_nElements; ++i) {
-		// each ydot depends on the temperature in the cell itself
-		resultInputValueReferences.push_back(std::make_pair(&m_ydot[i], m_statesModel->m_vectorValuedResults[ConstructionStatesModel::VVR_ElementTemperature].dataPtr() + i ) );
-		// and on right-side element
-		if (i<m_statesModel->m_nElements-1)
-			resultInputValueReferences.push_back(std::make_pair(&m_ydot[i], m_statesModel->m_vectorValuedResults[ConstructionStatesModel::VVR_ElementTemperature].dataPtr() + i+1 ) );
-		// and on left-side element
-		if (i > 0)
-			resultInputValueReferences.push_back(std::make_pair(&m_ydot[i], m_statesModel->m_vectorValuedResults[ConstructionStatesModel::VVR_ElementTemperature].dataPtr() + i-1 ) );
+	if (m_statesModel->m_nModes != 0) {
+		// in reduced models, each mode divergence depends on all internal fluxes and hence all element temperatures
+		for (unsigned int k=0; k<m_statesModel->m_nModes; ++k)
+			for (unsigned int i=0; i<m_statesModel->m_nElements; ++i)
+				resultInputValueReferences.push_back(std::make_pair(&m_ydot[k], m_statesModel->m_vectorValuedResults[ConstructionStatesModel::VVR_ElementTemperature].dataPtr() + i ) );
+	}
+	else {
+		for (unsigned int i=0; i<m_statesModel->m_nElements; ++i) {
+			// each ydot depends on the temperature in the cell itself
+			resultInputValueReferences.push_back(std::make_pair(&m_ydot[i], m_statesModel->m_vectorValuedResults[ConstructionStatesModel::VVR_ElementTemperature].dataPtr() + i ) );
+			// and on right-side element
+			if (i<m_statesModel->m_nElements-1)
+				resultInputValueReferences.push_back(std::make_pair(&m_ydot[i], m_statesModel->m_vectorValuedResults[ConstructionStatesModel::VVR_ElementTemperature].dataPtr() + i+1 ) );
+			// and on left-side element
+			if (i > 0)
+				resultInputValueReferences.push_back(std::make_pair(&m_ydot[i], m_statesModel->m_vectorValuedResults[ConstructionStatesModel::VVR_ElementTemperature].dataPtr() + i-1 ) );
+		}
 	}
 
 	if (m_moistureBalanceConstruction) {
@@ -507,7 +475,7 @@ void ConstructionBalanceModel::stateDependencies(std::vector<std::pair<const dou
 			resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxHeatConductionA], m_valueRefs[InputRef_RoomATemperature]));
 			resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxHeatConductionA], &m_statesModel->m_results[ConstructionStatesModel::R_SurfaceTemperatureA]));
 			// ydot of first element depends on boundary flux
-			resultInputValueReferences.push_back(std::make_pair(&m_ydot[0], &m_results[R_FluxHeatConductionA] ) );
+			addBoundaryYdotDependency(true, &m_results[R_FluxHeatConductionA], resultInputValueReferences);
 		}
 	}
 	// R_FluxHeatConductionB
@@ -516,32 +484,28 @@ void ConstructionBalanceModel::stateDependencies(std::vector<std::pair<const dou
 			resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxHeatConductionB], m_valueRefs[InputRef_RoomBTemperature]));
 			resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxHeatConductionB], &m_statesModel->m_results[ConstructionStatesModel::R_SurfaceTemperatureB]));
 			// ydot of last element depends on boundary flux
-			resultInputValueReferences.push_back(std::make_pair(&m_ydot[m_statesModel->m_nElements-1], &m_results[R_FluxHeatConductionB] ) );
+			addBoundaryYdotDependency(false, &m_results[R_FluxHeatConductionB], resultInputValueReferences);
 		}
 	}
 
 	// R_FluxLongWaveRadiationA
 	if (m_con->m_interfaceA.m_longWaveEmission.m_modelType != NANDRAD::InterfaceLongWaveEmission::NUM_MT) {
 		resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxLongWaveRadiationA], &m_statesModel->m_results[ConstructionStatesModel::R_SurfaceTemperatureA]));
-		// if we have an internal long wave radiation model, we need to add dependencies to all long wave radiation fluxes received from other surfaces as well
-		if (m_con->m_interfaceA.m_zoneId != 0) {
-			for (unsigned int i=0; i<m_absorbedLWRadiationACount; ++i)
-				resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxLongWaveRadiationA], m_valueRefsAbsorbedLWRadiationA[i]));
-		}
+		// if we have an internal long wave radiation model, we depend on the net flux computed by the zone's exchange model
+		if (m_valueRefs[InputRef_SideANetLongWaveRadiation] != nullptr)
+			resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxLongWaveRadiationA], m_valueRefs[InputRef_SideANetLongWaveRadiation]));
 
 		// ydot of first element depends on boundary flux
-		resultInputValueReferences.push_back(std::make_pair(&m_ydot[0], &m_results[R_FluxLongWaveRadiationA] ) );
+		addBoundaryYdotDependency(true, &m_results[R_FluxLongWaveRadiationA], resultInputValueReferences);
 	}
 	// R_FluxLongWaveRadiationB
 	if (m_con->m_interfaceB.m_longWaveEmission.m_modelType != NANDRAD::InterfaceLongWaveEmission::NUM_MT) {
 		resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxLongWaveRadiationB], &m_statesModel->m_results[ConstructionStatesModel::R_SurfaceTemperatureB]));
-		// if we have an internal long wave radiation model, we need to add dependencies to all long wave radiation fluxes received from other surfaces as well
-		if (m_con->m_interfaceB.m_zoneId != 0) {
-			for (unsigned int i=0; i<m_absorbedLWRadiationBCount; ++i)
-				resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxLongWaveRadiationB], m_valueRefsAbsorbedLWRadiationB[i]));
-		}
+		// if we have an internal long wave radiation model, we depend on the net flux computed by the zone's exchange model
+		if (m_valueRefs[InputRef_SideBNetLongWaveRadiation] != nullptr)
+			resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxLongWaveRadiationB], m_valueRefs[InputRef_SideBNetLongWaveRadiation]));
 		// ydot of last element depends on boundary flux
-		resultInputValueReferences.push_back(std::make_pair(&m_ydot[m_statesModel->m_nElements-1], &m_results[R_FluxLongWaveRadiationB] ) );
+		addBoundaryYdotDependency(false, &m_results[R_FluxLongWaveRadiationB], resultInputValueReferences);
 	}
 
 	// R_FluxShortWaveRadiationA and R_FluxShortWaveRadiationB depend on Loads -> not a state dependency, so we do not need this
@@ -563,7 +527,7 @@ void ConstructionBalanceModel::stateDependencies(std::vector<std::pair<const dou
 	}
 	// ydot of side A element depends on short wave radiation flux, if computed
 	if (haveSideAShortWaveRadiationFlux)
-		resultInputValueReferences.push_back(std::make_pair(&m_ydot[0], &m_results[R_FluxShortWaveRadiationA] ) );
+		addBoundaryYdotDependency(true, &m_results[R_FluxShortWaveRadiationA], resultInputValueReferences);
 
 	// R_FluxShortWaveRadiationB
 	bool haveSideBShortWaveRadiationFlux = false;
@@ -581,7 +545,7 @@ void ConstructionBalanceModel::stateDependencies(std::vector<std::pair<const dou
 	}
 	// ydot of side A element depends on short wave radiation flux, if computed
 	if (haveSideBShortWaveRadiationFlux)
-		resultInputValueReferences.push_back(std::make_pair(&m_ydot[m_statesModel->m_nElements-1], &m_results[R_FluxShortWaveRadiationB] ) );
+		addBoundaryYdotDependency(false, &m_results[R_FluxShortWaveRadiationB], resultInputValueReferences);
 
 
 	// add active layer heat source dependencies
@@ -614,6 +578,27 @@ int ConstructionBalanceModel::update() {
 	if (m_moistureBalanceConstruction) {
 		/// \todo hygrothermal code
 	}
+	else if (m_statesModel->m_nModes != 0) {
+		// reduced model: compute net heat flux densities into all elements, then project these onto the modes
+		double * f = &m_elementHeatFluxes[0];
+		const double * qHeatCond = &m_statesModel->m_fluxes_q[0];
+		f[0] = m_fluxDensityHeatConductionA + m_fluxDensityShortWaveRadiationA + m_fluxDensityLongWaveRadiationA; // left BC fluxes
+		for (unsigned int i=1; i<nElements; ++i) {
+			f[i-1] -= qHeatCond[i];
+			f[i] = qHeatCond[i];
+		}
+		f[nElements-1] -= m_fluxDensityHeatConductionB + m_fluxDensityShortWaveRadiationB + m_fluxDensityLongWaveRadiationB; // right BC fluxes
+
+		unsigned int nModes = m_statesModel->m_nModes;
+		const double * proj = &m_statesModel->m_modeProjection[0];
+		for (unsigned int k=0; k<nModes; ++k, proj += nElements) {
+			double ydot = 0;
+			for (unsigned int i=0; i<nElements; ++i)
+				ydot += proj[i]*f[i];
+			m_ydot[k] = ydot;
+		}
+		// Note: reduced models cannot have active layers
+	}
 	else {
 		double * ydot = &m_ydot[0];
 		const double * qHeatCond = &m_statesModel->m_fluxes_q[0];
@@ -660,9 +645,24 @@ unsigned int ConstructionBalanceModel::interfaceBZoneID() const {
 }
 
 
-int ConstructionBalanceModel::ydot(double * ydot) {
-	std::memcpy(ydot, &m_ydot[0], sizeof(double)*m_ydot.size());
-	return 0; // signal success
+void ConstructionBalanceModel::addBoundaryYdotDependency(bool sideA, const double * flux,
+	std::vector<std::pair<const double *, const double *> > & resultInputValueReferences) const
+{
+	if (m_statesModel->m_nModes != 0) {
+		for (unsigned int k=0; k<m_statesModel->m_nModes; ++k)
+			resultInputValueReferences.push_back(std::make_pair(&m_ydot[k], flux) );
+	}
+	else if (sideA)
+		resultInputValueReferences.push_back(std::make_pair(&m_ydot[0], flux) );
+	else
+		resultInputValueReferences.push_back(std::make_pair(&m_ydot[m_statesModel->m_nElements-1], flux) );
+}
+
+
+void ConstructionBalanceModel::setYdotTarget(double * ydot) {
+	// copy current values to new location
+	std::memcpy(ydot, m_ydot, sizeof(double)*m_ydotStorage.size());
+	m_ydot = ydot;
 }
 
 
@@ -757,19 +757,14 @@ void ConstructionBalanceModel::calculateBoundaryConditions(bool sideA, const NAN
 			}
 		}
 		else {
-			// inside LW rad exchange
+			// inside LW rad exchange, net absorbed flux density (in W/m2) is computed by the zone's exchange model
 			if (sideA) {
-				// subtract emitted LW rad (this is in W/m2), sign definition positive into construction
-				m_fluxDensityLongWaveRadiationA = - *m_valueRefs[InputRef_SideAEmittedLongWaveRadiation];
-				// add all received LW rad (these are in W, we need to devide by OUR area)
-				for (unsigned int i=0; i<m_valueRefsAbsorbedLWRadiationA.size(); ++i)
-					m_fluxDensityLongWaveRadiationA += *m_valueRefsAbsorbedLWRadiationA[i] / m_area;
+				// sign definition positive into construction
+				m_fluxDensityLongWaveRadiationA = *m_valueRefs[InputRef_SideANetLongWaveRadiation];
 			}
 			else {
 				// same as for side A, but with inverse sign
-				m_fluxDensityLongWaveRadiationB += *m_valueRefs[InputRef_SideBEmittedLongWaveRadiation];
-				for (unsigned int i=0; i<m_valueRefsAbsorbedLWRadiationB.size(); ++i)
-					m_fluxDensityLongWaveRadiationB -= *m_valueRefsAbsorbedLWRadiationB[i] / m_area;
+				m_fluxDensityLongWaveRadiationB = - *m_valueRefs[InputRef_SideBNetLongWaveRadiation];
 			}
 		}
 	}
@@ -141,13 +141,21 @@ public:
 	/*! Returns ID of associated zone at interface B (> 0 if a room zone is connected). */
 	unsigned int interfaceBZoneID() const;
 
-	/*! Stores the divergences of all balance equations in this zone in vector ydot. */
-	int ydot(double* ydot);
+	/*! Redirects storage of divergences to the construction's slice of the global ydot vector.
+		\note Must be called before stateDependencies() or resultValueRef() for 'ydot' are requested.
+	*/
+	void setYdotTarget(double * ydot);
 
 private:
 	/*! Computes boundary condition fluxes. */
 	void calculateBoundaryConditions(bool sideA, const NANDRAD::Interface & iface);
 
+	/*! Adds dependencies of the divergences affected by the boundary flux at side A or B on the quantity 'flux'.
+		For the full grid this is the divergence of the boundary element, for reduced models all mode divergences.
+	*/
+	void addBoundaryYdotDependency(bool sideA, const double * flux,
+								   std::vector< std::pair<const double *, const double *> > & resultInputValueReferences) const;
+
 
 	/*! Enumeration types for ordered input references, some may be unused and remain nullptr. */
 	enum InputReferences {
@@ -162,10 +170,10 @@ private:
 		InputRef_SideBRadiationFromPersonLoads,
 		InputRef_SideARadiationFromLightingLoads,
 		InputRef_SideBRadiationFromLightingLoads,
-		/*! Emitted long-wave radiation from this construction at side A in [W/m2] (provided by ConstructionStatesModel). */
-		InputRef_SideAEmittedLongWaveRadiation,
-		/*! Emitted long-wave radiation from this construction at side B in [W/m2] (provided by ConstructionStatesModel). */
-		InputRef_SideBEmittedLongWaveRadiation,
+		/*! Net absorbed long-wave radiation at side A in [W/m2] (provided by LongWaveRadiationExchangeModel). */
+		InputRef_SideANetLongWaveRadiation,
+		/*! Net absorbed long-wave radiation at side B in [W/m2] (provided by LongWaveRadiationExchangeModel). */
+		InputRef_SideBNetLongWaveRadiation,
 		InputRef_ActiveLayerHeatLoads,
 		NUM_InputRef
 	};
@@ -186,26 +194,24 @@ private:
 	std::vector<VectorValuedQuantity>				m_vectorValuedResults;
 
 
-	/*! Cached divergences of balance equations. */
-	std::vector<double>								m_ydot;
+	/*! Divergences of balance equations, points either to m_ydotStorage or into global ydot vector. */
+	double											*m_ydot = nullptr;
+	/*! Model-owned storage for divergences, used until setYdotTarget() is called. */
+	std::vector<double>								m_ydotStorage;
+	/*! Net heat flux densities into all elements [W/m2], only used for reduced construction models
+		(projected onto the modes afterwards).
+	*/
+	std::vector<double>								m_elementHeatFluxes;
 
 	/*! Vector with input references, holds ONLY the NUM_InputRef scalar input refs. */
 	std::vector<const double*>						m_valueRefs;
 
-	/*! References to values of long wave radiation that is emitted by other instances and received by this one at side A in [W]. */
-	std::vector<const double*>						m_valueRefsAbsorbedLWRadiationA;
-
-	/*! References to values of long wave radiation that is emitted by other instances and received by this one at side B in [W]. */
-	std::vector<const double*>						m_valueRefsAbsorbedLWRadiationB;
-
 	/*! Input references used by this object. These references store optional loads from
 		internal sources as well as obnligatory references for heat exchange with all neighboring
 		zones.
 
 		Order of input refs in vector:
 		  0...NUM_InputRef-1 : named, always present input variables
-		  inputRefsAbsorbedLWRadiationA  - vector
-		  inputRefsAbsorbedLWRadiationB  - vector
 		  surfaceHeatLoadRH              - vector   -> we only select one of the delivered variables and store it in slot InputRef_ActiveLayerHeatLoads
 	*/
 	std::vector<InputReference>						m_inputRefs;
@@ -230,13 +236,8 @@ private:
 	/*! Number of ideal surface heating model input refs that we have generated and that we get value refs for. */
 	unsigned int									m_surfaceHeatingCoolingModelCount = 0;
 
-	/*! Number of model input refs for long wave radiation at side A */
-	unsigned int									m_absorbedLWRadiationACount = 0;
-	unsigned int									m_absorbedLWRadiationBCount = 0;
-
 	double											m_totalAdsorptionAreaA = 6666;
 	double											m_totalAdsorptionAreaB = 7777;
-
 };
 
 } // namespace NANDRAD_MODEL
@@ -22,6 +22,8 @@
 #include "NM_ConstructionStatesModel.h"
 
 #include <algorithm>
+#include <complex>
+#include <cstring>
 
 #include <IBK_messages.h>
 #include <IBK_physics.h>
@@ -129,8 +131,6 @@ void ConstructionStatesModel::setup(const NANDRAD::ConstructionInstance & con,
 
 	// *** storage member initialization
 
-	m_y.resize(nPrimaryStateResults());
-
 	m_rhoce.resize(m_nElements);
 
 	m_fluxes_q.resize(m_nElements+1);
@@ -159,6 +159,11 @@ void ConstructionStatesModel::setup(const NANDRAD::ConstructionInstance & con,
 	}
 	// Note: m_rTInv[0] and m_rTInv[m_nElements] are not used and remain uninitialized.
 
+	// *** optional reduced construction model
+
+	setupModalReduction();
+
+	m_y.resize(nPrimaryStateResults());
 
 	// *** now resize the memory cache for results
 
@@ -171,17 +176,32 @@ void ConstructionStatesModel::setup(const NANDRAD::ConstructionInstance & con,
 	m_results.resize(skalarResultCount); // NOTE: for now the same as m_results.resize(NUM_R)
 
 	m_vectorValuedResults.resize(NUM_VVR);
-	m_vectorValuedResults[VVR_ElementTemperature] = VectorValuedQuantity(nPrimaryStateResults(), 0);
-
-	// we access long wave emission fluxes via construction ID, hence we need to compose a vector of construction IDs
-	std::vector<unsigned int> indexKeys;
-	for (auto it=m_con->m_interfaceA.m_connectedInterfaces.begin(); it!=m_con->m_interfaceA.m_connectedInterfaces.end(); ++it)
-		indexKeys.push_back(it->first);
-	m_vectorValuedResults[VVR_EmittedLongWaveRadiationA] = VectorValuedQuantity(indexKeys, 0);
-	indexKeys.clear();
-	for (auto it=m_con->m_interfaceB.m_connectedInterfaces.begin(); it!=m_con->m_interfaceB.m_connectedInterfaces.end(); ++it)
-		indexKeys.push_back(it->first);
-	m_vectorValuedResults[VVR_EmittedLongWaveRadiationB] = VectorValuedQuantity(indexKeys, 0);
+	m_vectorValuedResults[VVR_ElementTemperature] = VectorValuedQuantity(m_nElements, 0);
+
+	// pre-compute emission coefficients for inside long wave radiation exchange, so that the emitted flux density
+	// is a single multiplication in update()
+	if (m_con->m_interfaceA.m_zoneId != 0 &&
+		m_con->m_interfaceA.m_longWaveEmission.m_modelType != NANDRAD::InterfaceLongWaveEmission::NUM_MT)
+	{
+		double sourceEps = m_con->m_interfaceA.m_longWaveEmission.m_para[NANDRAD::InterfaceLongWaveEmission::P_Emissivity].value;
+		m_lwEmissionCoeffA = 0;
+		for (auto it=m_con->m_interfaceA.m_connectedInterfaces.begin(); it!=m_con->m_interfaceA.m_connectedInterfaces.end(); ++it) {
+			double viewFactor = m_con->m_interfaceA.m_viewFactors.at(it->first);
+			double targetEps = it->second->m_longWaveEmission.m_para[NANDRAD::InterfaceLongWaveEmission::P_Emissivity].value;
+			m_lwEmissionCoeffA += viewFactor * sourceEps * targetEps;
+		}
+	}
+	if (m_con->m_interfaceB.m_zoneId != 0 &&
+		m_con->m_interfaceB.m_longWaveEmission.m_modelType != NANDRAD::InterfaceLongWaveEmission::NUM_MT)
+	{
+		double sourceEps = m_con->m_interfaceB.m_longWaveEmission.m_para[NANDRAD::InterfaceLongWaveEmission::P_Emissivity].value;
+		m_lwEmissionCoeffB = 0;
+		for (auto it=m_con->m_interfaceB.m_connectedInterfaces.begin(); it!=m_con->m_interfaceB.m_connectedInterfaces.end(); ++it) {
+			double viewFactor = m_con->m_interfaceB.m_viewFactors.at(it->first);
+			double targetEps = it->second->m_longWaveEmission.m_para[NANDRAD::InterfaceLongWaveEmission::P_Emissivity].value;
+			m_lwEmissionCoeffB += viewFactor * sourceEps * targetEps;
+		}
+	}
 }
 
 
@@ -228,26 +248,14 @@ void ConstructionStatesModel::resultDescriptions(std::vector<QuantityDescription
 	if (m_con->m_interfaceA.m_zoneId != 0) {
 		// emitted inner long wave radiation of surface A
 		if (m_con->m_interfaceA.m_longWaveEmission.m_modelType != NANDRAD::InterfaceLongWaveEmission::NUM_MT) {
-			// first publish individual emitted long wave radiation fluxes to all connected surfaces
 			QuantityDescription res;
 			res.m_referenceType = NANDRAD::ModelInputReference::MRT_CONSTRUCTIONINSTANCE;
 			res.m_id = m_id; // id of emmitting instance (ourself)
 
-			res.m_description = NANDRAD_MODEL::KeywordList::Description("ConstructionStatesModel::VectorValuedResults", VVR_EmittedLongWaveRadiationA);
-			res.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::VectorValuedResults", VVR_EmittedLongWaveRadiationA);
-			res.m_unit = NANDRAD_MODEL::KeywordList::Unit("ConstructionStatesModel::VectorValuedResults", VVR_EmittedLongWaveRadiationA);
-
-			const std::map<unsigned int, const NANDRAD::Interface*>	&connectedInterfacesA = m_con->m_interfaceA.m_connectedInterfaces;
-			for (auto it = connectedInterfacesA.begin(); it!=connectedInterfacesA.end(); ++it)
-				res.m_indexKeys.push_back(it->first); // id of targeted instance (the absorbing construction instance)
-			res.m_indexKeyType = VectorValuedQuantityIndex::IK_ModelID;
-			resDesc.push_back(res);
-
 			// publish sum of emitted radiation flux density
 			res.m_description = NANDRAD_MODEL::KeywordList::Description("ConstructionStatesModel::Results", R_FluxEmittedLongWaveRadiationA);
 			res.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::Results", R_FluxEmittedLongWaveRadiationA);
 			res.m_unit = NANDRAD_MODEL::KeywordList::Unit("ConstructionStatesModel::Results", R_FluxEmittedLongWaveRadiationA);
-			res.m_indexKeys.clear();
 			resDesc.push_back(res);
 		}
 	}
@@ -259,21 +267,10 @@ void ConstructionStatesModel::resultDescriptions(std::vector<QuantityDescription
 			res.m_referenceType = NANDRAD::ModelInputReference::MRT_CONSTRUCTIONINSTANCE;
 			res.m_id = m_id; // id of emmitting instance (ourself)
 
-			res.m_description = NANDRAD_MODEL::KeywordList::Description("ConstructionStatesModel::VectorValuedResults", VVR_EmittedLongWaveRadiationB);
-			res.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::VectorValuedResults", VVR_EmittedLongWaveRadiationB);
-			res.m_unit = NANDRAD_MODEL::KeywordList::Unit("ConstructionStatesModel::VectorValuedResults", VVR_EmittedLongWaveRadiationB);
-
-			const std::map<unsigned int, const NANDRAD::Interface*>	&connectedInterfacesB = m_con->m_interfaceB.m_connectedInterfaces;
-			for (auto it = connectedInterfacesB.begin(); it!=connectedInterfacesB.end(); ++it)
-				res.m_indexKeys.push_back(it->first); // id of targeted instance (the absorbing construction instance)
-			res.m_indexKeyType = VectorValuedQuantityIndex::IK_ModelID;
-			resDesc.push_back(res);
-
 			// publish sum of emitted radiation flux density
 			res.m_description = NANDRAD_MODEL::KeywordList::Description("ConstructionStatesModel::Results", R_FluxEmittedLongWaveRadiationB);
 			res.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::Results", R_FluxEmittedLongWaveRadiationB);
 			res.m_unit = NANDRAD_MODEL::KeywordList::Unit("ConstructionStatesModel::Results", R_FluxEmittedLongWaveRadiationB);
-			res.m_indexKeys.clear();
 			resDesc.push_back(res);
 		}
 	}
@@ -324,6 +321,10 @@ const double * ConstructionStatesModel::resultValueRef(const InputReference & qu
 
 
 unsigned int ConstructionStatesModel::nPrimaryStateResults() const {
+	if (m_nModes != 0) {
+		// *** reduced construction model, mode amplitudes ***
+		return m_nModes;
+	}
 	if (!m_moistureBalanceConstruction) {
 		// *** thermal transport ***
 		return m_nElements;
@@ -339,6 +340,23 @@ void ConstructionStatesModel::stateDependencies(std::vector<std::pair<const doub
 	if (m_moistureBalanceConstruction) {
 		/// \todo hygrothermal
 	}
+	else if (m_nModes != 0) {
+		// in reduced models, each element temperature is composed of all mode amplitudes
+		for (unsigned int i=0; i<m_nElements; ++i)
+			for (unsigned int k=0; k<m_nModes; ++k)
+				resultInputValueReferences.push_back(std::make_pair(&m_vectorValuedResults[VVR_ElementTemperature].data()[i], &m_y[k]) );
+
+		for (unsigned int k=0; k<m_nModes; ++k) {
+			resultInputValueReferences.push_back(std::make_pair(&m_results[R_SurfaceTemperatureA], &m_y[k]) );
+			resultInputValueReferences.push_back(std::make_pair(&m_results[R_SurfaceTemperatureB], &m_y[k]) );
+		}
+
+		// Note: reduced models cannot have active layers
+
+		// emitted long-wave radiation fluxes depend exclusively on surface temperature
+		resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxEmittedLongWaveRadiationA], &m_results[R_SurfaceTemperatureA]) );
+		resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxEmittedLongWaveRadiationB], &m_results[R_SurfaceTemperatureB]) );
+	}
 	else {
 		// we add dependencies of all scalar vars and all vector valued vars to the states vector m_y
 
@@ -371,13 +389,6 @@ void ConstructionStatesModel::stateDependencies(std::vector<std::pair<const doub
 		// emitted long-wave radiation fluxes depend exclusively on surface temperature
 		resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxEmittedLongWaveRadiationA], &m_results[R_SurfaceTemperatureA]) );
 		resultInputValueReferences.push_back(std::make_pair(&m_results[R_FluxEmittedLongWaveRadiationB], &m_results[R_SurfaceTemperatureB]) );
-
-		// the individal emitted fluxes also depend on surface temperature
-		for (unsigned int i=0; i<m_vectorValuedResults[VVR_EmittedLongWaveRadiationA].size(); ++i)
-			resultInputValueReferences.push_back(std::make_pair(&m_vectorValuedResults[VVR_EmittedLongWaveRadiationA].data()[i], &m_results[R_SurfaceTemperatureA]) );
-		for (unsigned int i=0; i<m_vectorValuedResults[VVR_EmittedLongWaveRadiationB].size(); ++i)
-			resultInputValueReferences.push_back(std::make_pair(&m_vectorValuedResults[VVR_EmittedLongWaveRadiationB].data()[i], &m_results[R_SurfaceTemperatureB]) );
-
 	}
 }
 
@@ -395,6 +406,16 @@ unsigned int ConstructionStatesModel::interfaceBZoneID() const {
 void ConstructionStatesModel::yInitial(double * y) const {
 	// retrieve initial temperature, which has already been checked for valid values
 	double T_initial = m_simPara->m_para[NANDRAD::SimulationParameter::P_InitialTemperature].value;
+	if (m_nModes != 0) {
+		// project energy contents of all elements onto the modes
+		for (unsigned int k=0; k<m_nModes; ++k) {
+			const double * proj = &m_modeProjection[k*m_nElements];
+			y[k] = 0;
+			for (unsigned int i=0; i<m_nElements; ++i)
+				y[k] += proj[i]*m_rhoce[i]*m_elements[i].dx*T_initial;
+		}
+		return;
+	}
 	for (unsigned i=0; i<m_nElements; ++i) {
 		// energy density
 		y[i] = m_rhoce[i]*T_initial;
@@ -409,7 +430,23 @@ int ConstructionStatesModel::update(const double * y) {
 	// here we compute all temperatures from conserved quantities (i.e. energy densities) and
 	// also compute all thermal fluxes across elements
 
-	if (!m_moistureBalanceConstruction) {
+	if (m_nModes != 0) {
+		// reduced construction model: reconstruct element temperatures from mode amplitudes, then compute
+		// heat conduction fluxes between elements as in the full model
+		std::memcpy(DOUBLE_PTR(m_y), y, m_nModes*sizeof(double));
+
+		double * states_T = m_vectorValuedResults[VVR_ElementTemperature].dataPtr();
+		const double * modeShapes = DOUBLE_PTR(m_modeShapes);
+		for (unsigned int i=0; i<m_nElements; ++i, modeShapes += m_nModes) {
+			double T = 0;
+			for (unsigned int k=0; k<m_nModes; ++k)
+				T += modeShapes[k]*y[k];
+			states_T[i] = T;
+		}
+		for (unsigned int i=1; i<m_nElements; ++i)
+			m_fluxes_q[i] = m_rTInv[i]*(states_T[i-1] - states_T[i]);
+	}
+	else if (!m_moistureBalanceConstruction) {
 
 		/// \todo switch between different loop kernels when PCM materials are in the construction
 
@@ -550,27 +587,11 @@ int ConstructionStatesModel::update(const double * y) {
 			}
 			// emitted long wave radiation to other construction instance
 			else {
-				double sourceEps = m_con->m_interfaceA.m_longWaveEmission.m_para[NANDRAD::InterfaceLongWaveEmission::P_Emissivity].value;
+				// sum of emitted flux densities to all connected constructions, the individual exchange fluxes are
+				// computed by the LongWaveRadiationExchangeModel of the zone
+				// TODO add emitted radiation to windows
 				double TsA2 = m_TsA * m_TsA;
-				double area = m_con->m_netHeatTransferArea;
-				// loop over all connected constructions; NOTE: the ids in the m_vectorValuedResults[VVR_EmittedLongWaveRadiationA] are stored
-				// in the order of the m_connectedInterfaces
-				unsigned int i=0;
-				double emittedFluxSum = 0;
-				double * longWaveRadVector = m_vectorValuedResults[VVR_EmittedLongWaveRadiationA].dataPtr();
-				for (auto it=m_con->m_interfaceA.m_connectedInterfaces.begin(); it!=m_con->m_interfaceA.m_connectedInterfaces.end(); ++it, ++i) {
-					unsigned int targetId = it->first; // id of targeted construction instance
-					double viewFactor = m_con->m_interfaceA.m_viewFactors.at(targetId);
-					double targetEps = it->second->m_longWaveEmission.m_para[NANDRAD::InterfaceLongWaveEmission::P_Emissivity].value;
-					double emittedFlux = viewFactor * sourceEps * targetEps * IBK::BOLTZMANN * TsA2 * TsA2;
-					longWaveRadVector[i] = area * emittedFlux;
-					emittedFluxSum += emittedFlux;
-				}
-				// TODO calculate emitted radiation to window
-//				for (auto it=m_con->m_interfaceA.m_connectedWindows.begin(); it!=m_con->m_interfaceA.m_connectedWindows.end(); ++it, ++i) {
-
-//				}
-				m_results[R_FluxEmittedLongWaveRadiationA] = emittedFluxSum;
+				m_results[R_FluxEmittedLongWaveRadiationA] = m_lwEmissionCoeffA * IBK::BOLTZMANN * TsA2 * TsA2;
 			}
 		}
 	}
@@ -602,26 +623,9 @@ int ConstructionStatesModel::update(const double * y) {
 			// emitted long wave radiation to other construction instance
 			else {
 				IBK_ASSERT(m_con->m_interfaceB.m_viewFactors.size() == m_con->m_interfaceB.m_connectedInterfaces.size() + m_con->m_interfaceB.m_connectedWindows.size());
-				double sourceEps = m_con->m_interfaceB.m_longWaveEmission.m_para[NANDRAD::InterfaceLongWaveEmission::P_Emissivity].value;
+				// TODO add emitted radiation to windows
 				double TsB2 = m_TsB * m_TsB;
-				double area = m_con->m_netHeatTransferArea;
-				// loop over all connected constructions; NOTE: the ids in the m_vectorValuedResults[VVR_EmittedLongWaveRadiationA] are stored
-				// in the order of the m_connectedInterfaces
-				unsigned int i=0;
-				double emittedFluxSum = 0;
-				double * longWaveRadVector = m_vectorValuedResults[VVR_EmittedLongWaveRadiationB].dataPtr();
-				for (auto it=m_con->m_interfaceB.m_connectedInterfaces.begin(); it!=m_con->m_interfaceB.m_connectedInterfaces.end(); ++it, ++i) {
-					unsigned int targetId = it->first; // id of targeted construction instance
-					double viewFactor = m_con->m_interfaceB.m_viewFactors.at(targetId);
-					double targetEps = it->second->m_longWaveEmission.m_para[NANDRAD::InterfaceLongWaveEmission::P_Emissivity].value;
-					double emittedFlux = viewFactor * sourceEps * targetEps * IBK::BOLTZMANN * TsB2 * TsB2;
-					longWaveRadVector[i] = area * emittedFlux;
-					emittedFluxSum += emittedFlux;
-				}
-				// TODO calculate emitted radiation to window
-//				for (auto it=m_con->m_interfaceB.m_connectedWindows.begin(); it!=m_con->m_interfaceB.m_connectedWindows.end(); ++it, ++i) {
-//				}
-				m_results[R_FluxEmittedLongWaveRadiationB] = emittedFluxSum;
+				m_results[R_FluxEmittedLongWaveRadiationB] = m_lwEmissionCoeffB * IBK::BOLTZMANN * TsB2 * TsB2;
 			}
 		}
 	}
@@ -820,6 +824,265 @@ void ConstructionStatesModel::generateGrid() {
 }
 
 
+/*! Solves K x = b for a symmetric positive definite tridiagonal matrix K with main diagonal kDiag and sub-diagonal
+	kOff (kOff[i] couples rows i-1 and i). b is overwritten with the solution.
+*/
+static void solveTridiagonal(const std::vector<double> & kDiag, const std::vector<double> & kOff, std::vector<double> & b) {
+	unsigned int n = (unsigned int)b.size();
+	std::vector<double> d(kDiag);
+	for (unsigned int i=1; i<n; ++i) {
+		double l = kOff[i]/d[i-1];
+		d[i] -= l*kOff[i];
+		b[i] -= l*b[i-1];
+	}
+	b[n-1] /= d[n-1];
+	for (unsigned int i=n-1; i>0; --i)
+		b[i-1] = (b[i-1] - kOff[i]*b[i])/d[i-1];
+}
+
+
+/*! Orthogonalizes v against modes[0..k-1] with respect to the scalar product v^T C w and scales it such that
+	v^T C v = modalMass. All modes must be normalized the same way.
+	\return Returns the norm of v after orthogonalization relative to its original norm.
+*/
+static double orthonormalizeMode(std::vector<double> & v, const std::vector<std::vector<double> > & modes, unsigned int k,
+								 const std::vector<double> & cap, double modalMass)
+{
+	unsigned int n = (unsigned int)v.size();
+	double s0 = 0;
+	for (unsigned int i=0; i<n; ++i)
+		s0 += v[i]*cap[i]*v[i];
+	// two passes of Gram-Schmidt for numerical stability
+	for (unsigned int pass=0; pass<2; ++pass) {
+		for (unsigned int j=0; j<k; ++j) {
+			double s = 0;
+			for (unsigned int i=0; i<n; ++i)
+				s += modes[j][i]*cap[i]*v[i];
+			s /= modalMass;
+			for (unsigned int i=0; i<n; ++i)
+				v[i] -= s*modes[j][i];
+		}
+	}
+	double s = 0;
+	for (unsigned int i=0; i<n; ++i)
+		s += v[i]*cap[i]*v[i];
+	double scale = std::sqrt(modalMass/s);
+	for (unsigned int i=0; i<n; ++i)
+		v[i] *= scale;
+	return std::sqrt(s/s0);
+}
+
+
+/*! Solves the dense linear system A x = b (row-major, size n x n) with Gaussian elimination and partial pivoting.
+	A and b are modified, b holds the solution afterwards.
+*/
+static void solveDenseComplex(unsigned int n, std::vector<std::complex<double> > & A, std::vector<std::complex<double> > & b) {
+	for (unsigned int j=0; j<n; ++j) {
+		unsigned int p = j;
+		for (unsigned int i=j+1; i<n; ++i)
+			if (std::abs(A[i*n+j]) > std::abs(A[p*n+j]))
+				p = i;
+		if (p != j) {
+			for (unsigned int c=0; c<n; ++c)
+				std::swap(A[j*n+c], A[p*n+c]);
+			std::swap(b[j], b[p]);
+		}
+		for (unsigned int i=j+1; i<n; ++i) {
+			std::complex<double> l = A[i*n+j]/A[j*n+j];
+			for (unsigned int c=j; c<n; ++c)
+				A[i*n+c] -= l*A[j*n+c];
+			b[i] -= l*b[j];
+		}
+	}
+	for (unsigned int j=n; j>0; --j) {
+		for (unsigned int c=j; c<n; ++c)
+			b[j-1] -= A[(j-1)*n+c]*b[c];
+		b[j-1] /= A[(j-1)*n+j-1];
+	}
+}
+
+
+void ConstructionStatesModel::setupModalReduction() {
+	FUNCID(ConstructionStatesModel::setupModalReduction);
+
+	m_nModes = 0;
+	m_reductionErrorEstimate = 0;
+	unsigned int nModes = m_con->m_constructionType->m_reducedModeCount;
+	if (nModes == NANDRAD::INVALID_ID)
+		return;
+	if (m_moistureBalanceConstruction) {
+		IBK::IBK_Message("Reduced construction model is not available for hygrothermal calculation, using full grid.",
+						 IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
+		return;
+	}
+	if (nModes >= m_nElements) {
+		IBK::IBK_Message(IBK::FormatString("Reduced mode count (%1) is not smaller than number of elements (%2), using full grid.\n")
+						 .arg(nModes).arg(m_nElements), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_INFO);
+		return;
+	}
+
+	unsigned int n = (unsigned int)m_nElements;
+
+	// *** heat capacities C [J/m2K] and conduction matrix K [W/m2K] with adiabatic boundaries, so that C dT/dt = -K T + f
+
+	std::vector<double> cap(n), kDiag(n, 0), kOff(n, 0);
+	double capTotal = 0;
+	for (unsigned int i=0; i<n; ++i) {
+		cap[i] = m_rhoce[i]*m_elements[i].dx;
+		capTotal += cap[i];
+	}
+	for (unsigned int i=1; i<n; ++i) {
+		kDiag[i-1] += m_rTInv[i];
+		kDiag[i] += m_rTInv[i];
+		kOff[i] = -m_rTInv[i];
+	}
+
+	// heat transfer coefficients at both sides, used for the Krylov basis and the error estimate
+	double alpha[2] = {0, 0};
+	if (m_con->m_interfaceA.m_heatConduction.m_modelType == NANDRAD::InterfaceHeatConduction::MT_Constant)
+		alpha[0] = m_con->m_interfaceA.m_heatConduction.m_para[NANDRAD::InterfaceHeatConduction::P_HeatTransferCoefficient].value;
+	if (m_con->m_interfaceB.m_heatConduction.m_modelType == NANDRAD::InterfaceHeatConduction::MT_Constant)
+		alpha[1] = m_con->m_interfaceB.m_heatConduction.m_para[NANDRAD::InterfaceHeatConduction::P_HeatTransferCoefficient].value;
+	// surface temperatures are taken from the first/last element (see CONSTANT_EXTRAPOLATION in update())
+	unsigned int surfaceElement[2] = {0, n-1};
+
+	// *** reduced basis
+
+	// The basis is a block Krylov subspace of the conduction problem with the surface heat fluxes as inputs:
+	//   span{ K_R^-1 B, (K_R^-1 C) K_R^-1 B, (K_R^-1 C)^2 K_R^-1 B, ... }
+	// with K_R being the conduction matrix including surface heat transfer and B = [e_0, e_n-1]. Thus, the transfer
+	// functions from surface fluxes to surface temperatures of the reduced model match those of the full grid in their
+	// leading moments (moment matching). The first two basis vectors span the uniform temperature and the steady-state
+	// profile for a heat flux through the construction, so that the energy balance and steady-state temperatures of the
+	// reduced model are exact.
+
+	// all modes are normalized such that Phi^T C Phi = modalMass * I, whereby the modal mass is chosen such that
+	// the amplitude of the uniform temperature mode equals the mean energy density in [J/m3]
+	double modalMass = m_constructionWidth*m_constructionWidth/capTotal;
+
+	// K_R with adiabatic surfaces replaced by a typical heat transfer coefficient
+	const double ALPHA_DEFAULT = 8; // W/m2K
+	std::vector<double> kDiagR(kDiag);
+	kDiagR[0] += alpha[0] > 0 ? alpha[0] : ALPHA_DEFAULT;
+	kDiagR[n-1] += alpha[1] > 0 ? alpha[1] : ALPHA_DEFAULT;
+
+	std::vector<std::vector<double> > modes(nModes, std::vector<double>(n, 0));
+	// mode 0: uniform temperature
+	for (unsigned int i=0; i<n; ++i)
+		modes[0][i] = m_constructionWidth/capTotal;
+	// mode 1: steady-state profile for a heat flux through the construction
+	for (unsigned int i=1; i<n; ++i)
+		modes[1][i] = modes[1][i-1] - 1/m_rTInv[i];
+	orthonormalizeMode(modes[1], modes, 1, cap, modalMass);
+	// starting vectors of Krylov sequences for inputs at side A and B, span the same space as modes 0 and 1
+	std::vector<double> krylov[2];
+	for (unsigned int side=0; side<2; ++side) {
+		krylov[side].assign(n, 0);
+		krylov[side][surfaceElement[side]] = 1;
+		solveTridiagonal(kDiagR, kOff, krylov[side]);
+	}
+	// remaining modes: alternately next Krylov vector for inputs at side A and B
+	unsigned int nFound = 2;
+	for (unsigned int it=0, side=0; nFound<nModes && it<2*n; ++it, side = 1 - side) {
+		std::vector<double> & v = krylov[side];
+		for (unsigned int i=0; i<n; ++i)
+			v[i] *= cap[i];
+		solveTridiagonal(kDiagR, kOff, v);
+		modes[nFound] = v;
+		// skip vectors that are (numerically) contained in the basis already, for example when both sequences
+		// become linearly dependent in symmetric constructions
+		double relNorm = orthonormalizeMode(modes[nFound], modes, nFound, cap, modalMass);
+		// continue sequence with orthonormalized vector (block Arnoldi)
+		if (relNorm > 1e-8)
+			v = modes[nFound++];
+	}
+	if (nFound < nModes) {
+		IBK::IBK_Message(IBK::FormatString("Only %1 linearly independent modes found, reduced mode count adjusted.\n").arg(nFound),
+						 IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
+		nModes = nFound;
+		modes.resize(nModes);
+	}
+
+	m_nModes = nModes;
+	m_n = nModes;
+	m_modeShapes.resize(n*nModes);
+	m_modeProjection.resize(nModes*n);
+	for (unsigned int k=0; k<nModes; ++k) {
+		for (unsigned int i=0; i<n; ++i) {
+			m_modeShapes[i*nModes + k] = modes[k][i];
+			m_modeProjection[k*n + i] = modes[k][i]/modalMass;
+		}
+	}
+
+	// *** error estimate
+
+	// Compare amplitudes of surface temperatures for harmonic boundary temperatures with unit amplitude, computed with the
+	// full grid and with the reduced model. Constant heat transfer coefficients of the interfaces are used as boundary
+	// conditions, radiation is not considered.
+
+	const double PERIODS[2] = {3600, 24*3600};
+	double maxError[2] = {0, 0};
+	typedef std::complex<double> cplx;
+	for (unsigned int p=0; p<2; ++p) {
+		double omega = 2*PI/PERIODS[p];
+		for (unsigned int side=0; side<2; ++side) {
+			if (alpha[side] == 0)
+				continue;
+
+			// full grid: tridiagonal system (i omega C + K + Robin terms) T = alpha e_side
+			std::vector<cplx> diag(n), rhs(n, 0);
+			for (unsigned int i=0; i<n; ++i)
+				diag[i] = cplx(kDiag[i], omega*cap[i]);
+			diag[0] += alpha[0];
+			diag[n-1] += alpha[1];
+			rhs[surfaceElement[side]] = alpha[side];
+			for (unsigned int i=1; i<n; ++i) {
+				cplx l = kOff[i]/diag[i-1];
+				diag[i] -= l*kOff[i];
+				rhs[i] -= l*rhs[i-1];
+			}
+			rhs[n-1] /= diag[n-1];
+			for (unsigned int i=n-1; i>0; --i)
+				rhs[i-1] = (rhs[i-1] - kOff[i]*rhs[i])/diag[i-1];
+
+			// reduced model: Phi^T (i omega C + K + Robin terms) Phi a = Phi^T alpha e_side
+			std::vector<cplx> A(nModes*nModes), b(nModes);
+			for (unsigned int j=0; j<nModes; ++j) {
+				for (unsigned int k=0; k<nModes; ++k) {
+					// Phi_j^T K Phi_k
+					double s = 0;
+					for (unsigned int i=0; i<n; ++i) {
+						double Kphi = kDiag[i]*modes[k][i];
+						if (i > 0)
+							Kphi += kOff[i]*modes[k][i-1];
+						if (i+1 < n)
+							Kphi += kOff[i+1]*modes[k][i+1];
+						s += modes[j][i]*Kphi;
+					}
+					s += alpha[0]*modes[j][0]*modes[k][0] + alpha[1]*modes[j][n-1]*modes[k][n-1];
+					A[j*nModes + k] = cplx(s, j == k ? omega*modalMass : 0);
+				}
+				b[j] = alpha[side]*modes[j][surfaceElement[side]];
+			}
+			solveDenseComplex(nModes, A, b);
+
+			for (unsigned int s=0; s<2; ++s) {
+				cplx TsReduced = 0;
+				for (unsigned int k=0; k<nModes; ++k)
+					TsReduced += modes[k][surfaceElement[s]]*b[k];
+				maxError[p] = std::max(maxError[p], std::abs(TsReduced - rhs[surfaceElement[s]]));
+			}
+		}
+	}
+	m_reductionErrorEstimate = std::max(maxError[0], maxError[1]);
+
+	IBK::IBK_Message(IBK::FormatString("Reduced construction model with %1 modes instead of %2 elements, "
+									   "max. deviation of surface temperature amplitudes: %3 K/K (period 1 h), %4 K/K (period 24 h).\n")
+					 .arg(nModes).arg(n).arg(maxError[0], 0, 'g', 3).arg(maxError[1], 0, 'g', 3),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_INFO);
+}
+
+
 
 
 
@@ -48,10 +48,6 @@ public:
 
 	enum VectorValuedResults {
 		VVR_ElementTemperature,			// Keyword: ElementTemperature			[C]		'Finite-volume mean element temperature'
-		/*! The index key is the ID of the interconnected construction instance. */
-		VVR_EmittedLongWaveRadiationA,	// Keyword: EmittedLongWaveRadiationA	[W]		'Emitted internal long-wave radiation from side A.'
-		/*! The index key is the ID of the interconnected construction instance. */
-		VVR_EmittedLongWaveRadiationB,	// Keyword: EmittedLongWaveRadiationB	[W]		'Emitted internal long-wave radiation from side B.'
 		NUM_VVR
 	};
 
@@ -141,10 +137,28 @@ public:
 	/*! Access to underlaying data model - provided for convenience. */
 	const NANDRAD::ConstructionInstance * construction() const { return m_con; }
 
+	/*! Returns number of finite-volume elements (also for reduced construction models). */
+	unsigned int elementCount() const { return (unsigned int)m_nElements; }
+
+	/*! Returns true if a reduced construction model is used. */
+	bool isReduced() const { return m_nModes != 0; }
+
+	/*! Estimated error of reduced construction model, i.e. maximum deviation of surface temperature amplitudes
+		from those of the full grid for harmonic boundary temperatures with unit amplitude [K/K].
+		Returns 0 for full grid models.
+	*/
+	double reductionErrorEstimate() const { return m_reductionErrorEstimate; }
+
 private:
 	/*! Generates computational grid and all associated data structures. */
 	void generateGrid();
 
+	/*! Computes basis (mode shapes) and projection matrix of the reduced construction model, if requested in construction type.
+		Also prints an error estimate by comparing the frequency response of the reduced model against the full grid.
+		Requires m_rhoce and m_rTInv to be initialized.
+	*/
+	void setupModalReduction();
+
 	/*! Construction instance ID. */
 	unsigned int									m_id;
 	/*! Display name (for error messages). */
@@ -230,21 +244,33 @@ private:
 	/*! Inverse thermal resistance between element centers (size m_nElements + 1) [W/m2K]. */
 	std::vector<double>				m_rTInv;
 
+	/*! Number of modes in reduced construction model, 0 if the full finite-volume grid is used.
+		In a reduced model the states are mode amplitudes (scaled like energy densities in [J/m3]) and element
+		temperatures are reconstructed from these. The basis is a Krylov subspace of the conduction problem with surface
+		heat fluxes as inputs (see setupModalReduction()).
+	*/
+	unsigned int					m_nModes = 0;
+	/*! Mode shapes, element temperatures are T_i = sum_k m_modeShapes[i*m_nModes + k] * y_k (size m_nElements*m_nModes). */
+	std::vector<double>				m_modeShapes;
+	/*! Galerkin projection of net heat flux densities f_i [W/m2] into the elements onto the modes,
+		ydot_k = sum_i m_modeProjection[k*m_nElements + i] * f_i (size m_nModes*m_nElements).
+	*/
+	std::vector<double>				m_modeProjection;
+	/*! Error estimate of reduced model, see reductionErrorEstimate(). */
+	double							m_reductionErrorEstimate = 0;
+
 	/*! Surface temperature at left side (side A) [K]. */
 	double							m_TsA;
 	/*! Surface temperature at right side (side B) [K]. */
 	double							m_TsB;
 
-//	/*! Emitted long wave radiation to all construction instances visible from side A. The values are stored in a map
-//		with the key being the id of the targeted (radiation receiving) construction instance.
-//		The value of the map is the heat flux in [W].
-//	*/
-//	std::map<unsigned int, double>	m_emittedLongWaveRadiationA;
-//	/*! Emitted long wave radiation to all construction instances visible from side B. The values are stored in a map
-//		with the key being the id of the targeted (radiation receiving) construction instance.
-//		The value of the map is the heat flux in [W].
-//	*/
-//	std::map<unsigned int, double>	m_emittedLongWaveRadiationB;
+	/*! Pre-computed emission coefficient for inside long wave radiation at side A, sum of F_ij * eps_i * eps_j
+		over all connected construction instances (windows excluded) [-].
+		Emitted flux density is then m_lwEmissionCoeffA * sigma * T^4.
+	*/
+	double							m_lwEmissionCoeffA = 0;
+	/*! Pre-computed emission coefficient for inside long wave radiation at side B [-]. */
+	double							m_lwEmissionCoeffB = 0;
 
 
 	friend class ConstructionBalanceModel; // Our balance model can directly take the data from us
@@ -0,0 +1,148 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NM_DailyCycleScheduleTable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include <IBK_assert.h>
+#include <IBK_Constants.h>
+#include <IBK_LinearSpline.h>
+
+namespace NANDRAD_MODEL {
+
+/*! Combines hash value h with hash of value v. */
+template <typename T>
+inline void hashCombine(std::size_t & h, const T & v) {
+	h ^= std::hash<T>()(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+}
+
+
+unsigned int DailyCycleScheduleTable::addSchedule(const IBK::LinearSpline & spline) {
+	const std::vector<double> & x = spline.x();
+	const std::vector<double> & y = spline.y();
+	IBK_ASSERT(!x.empty() && x.size() == y.size());
+
+	// *** cut spline into day profiles and compose calendar
+
+	std::vector<unsigned int> calendar(365);
+	for (unsigned int d=0; d<365; ++d) {
+		double dayStart = d*IBK::SECONDS_PER_DAY;
+		double dayEnd = dayStart + IBK::SECONDS_PER_DAY;
+		// all points within [dayStart, dayEnd], plus the last point before and the first point after
+		std::size_t first = (std::size_t)(std::lower_bound(x.begin(), x.end(), dayStart) - x.begin());
+		std::size_t last = (std::size_t)(std::upper_bound(x.begin(), x.end(), dayEnd) - x.begin());
+		if (first > 0)
+			--first;
+		if (last < x.size())
+			++last;
+		DayProfile profile;
+		profile.m_x.reserve(last - first);
+		// Note: shifting by dayStart is exact, since dayStart is an integer and the result is smaller in magnitude
+		//       than x; hence evaluation with shifted time points gives bitwise identical results
+		for (std::size_t i=first; i<last; ++i)
+			profile.m_x.push_back(x[i] - dayStart);
+		profile.m_y.assign(y.begin() + (std::ptrdiff_t)first, y.begin() + (std::ptrdiff_t)last);
+		calendar[d] = dayProfileIndex(profile);
+	}
+
+	// *** look for schedule with identical calendar
+
+	std::size_t h = 0;
+	for (unsigned int idx : calendar)
+		hashCombine(h, idx);
+	auto range = m_calendarLookup.equal_range(h);
+	for (auto it = range.first; it != range.second; ++it) {
+		if (std::equal(calendar.begin(), calendar.end(), m_calendars.begin() + it->second*365))
+			return it->second;
+	}
+
+	// *** add new schedule
+
+	unsigned int scheduleIdx = (unsigned int)m_values.size();
+	m_calendars.insert(m_calendars.end(), calendar.begin(), calendar.end());
+	m_calendarLookup.insert(std::make_pair(h, scheduleIdx));
+	m_cursors.push_back(0);
+	m_values.push_back(0);
+	return scheduleIdx;
+}
+
+
+void DailyCycleScheduleTable::setTime(double t) {
+	// day index, time points outside the year use the first/last day, which contain the first/last point
+	// of the annual spline and hence extrapolate constantly
+	int day = (int)std::floor(t/IBK::SECONDS_PER_DAY);
+	day = std::max(0, std::min(364, day));
+	double tDay = t - day*IBK::SECONDS_PER_DAY;
+
+	for (unsigned int i=0; i<m_values.size(); ++i) {
+		const DayProfile & profile = m_dayProfiles[m_calendars[i*365 + (unsigned int)day]];
+		const std::vector<double> & x = profile.m_x;
+		const std::vector<double> & y = profile.m_y;
+		unsigned int n = (unsigned int)x.size();
+
+		// same rules as in IBK::LinearSpline::value() with constant extrapolation
+		if (n == 1 || tDay <= x[0]) {
+			m_values[i] = y[0];
+			continue;
+		}
+		if (tDay > x[n-1]) {
+			m_values[i] = y[n-1];
+			continue;
+		}
+
+		// find interval j with x[j] < tDay <= x[j+1], starting with the interval of the last evaluation
+		unsigned int j = std::min(m_cursors[i], n-2);
+		while (tDay > x[j+1])
+			++j;
+		while (tDay <= x[j])
+			--j;
+		m_cursors[i] = j;
+
+		double alpha = (tDay - x[j])/(x[j+1] - x[j]);
+		m_values[i] = y[j]*(1-alpha) + y[j+1]*alpha;
+	}
+}
+
+
+unsigned int DailyCycleScheduleTable::dayProfileIndex(const DayProfile & profile) {
+	std::size_t h = 0;
+	for (double v : profile.m_x)
+		hashCombine(h, v);
+	for (double v : profile.m_y)
+		hashCombine(h, v);
+
+	auto range = m_dayProfileLookup.equal_range(h);
+	for (auto it = range.first; it != range.second; ++it) {
+		const DayProfile & other = m_dayProfiles[it->second];
+		if (other.m_x == profile.m_x && other.m_y == profile.m_y)
+			return it->second;
+	}
+
+	unsigned int idx = (unsigned int)m_dayProfiles.size();
+	m_dayProfiles.push_back(profile);
+	m_dayProfileLookup.insert(std::make_pair(h, idx));
+	return idx;
+}
+
+} // namespace NANDRAD_MODEL
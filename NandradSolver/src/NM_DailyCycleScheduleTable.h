@@ -0,0 +1,110 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NM_DailyCycleScheduleTableH
+#define NM_DailyCycleScheduleTableH
+
+#include <vector>
+#include <unordered_map>
+
+namespace IBK {
+	class LinearSpline;
+}
+
+namespace NANDRAD_MODEL {
+
+/*! Compact storage and evaluation of annual schedules composed of daily cycles.
+
+	NANDRAD::Schedules::generateLinearSpline() expands the daily cycles of a schedule into a spline over
+	all 365 days of the year. Since schedules usually consist of only a few different days (weekdays,
+	weekends, holidays), this spline is mostly repetition. This table cuts each annual spline into
+	day profiles and stores each distinct day profile only once. An annual schedule is then just a
+	calendar with the index of the day profile for each day of the year. Identical schedules (e.g. the
+	same schedule assigned to several object lists) share the same calendar and are evaluated only once.
+
+	A day profile holds all spline points of its day, plus the last point of the previous day and the
+	first point of the next day (if any). Hence, evaluating a day profile uses exactly the same
+	interval and interpolation as evaluating the annual spline, and the computed values are bitwise
+	identical to IBK::LinearSpline::value().
+
+	During evaluation, the day is found by integer division and the interval within the day profile
+	is searched starting from the interval used in the last evaluation. Since the simulation time
+	usually advances in small steps, this is O(1).
+*/
+class DailyCycleScheduleTable { // NO KEYWORDS
+public:
+	/*! Adds an annual schedule.
+		\param spline Annual spline generated by NANDRAD::Schedules::generateLinearSpline(), x values
+			are time points in [s] since begin of the year, spline must be initialized (makeSpline()).
+		\return Returns index of the schedule, identical schedules get the same index.
+	*/
+	unsigned int addSchedule(const IBK::LinearSpline & spline);
+
+	/*! Returns number of distinct schedules. */
+	unsigned int scheduleCount() const { return (unsigned int)m_values.size(); }
+
+	/*! Returns number of distinct day profiles. */
+	unsigned int dayProfileCount() const { return (unsigned int)m_dayProfiles.size(); }
+
+	/*! Evaluates all schedules at the given time point.
+		\param t Time in [s] since begin of the year. Time points outside the year (< 0 or > 365 d) yield
+			the first/last value of the annual spline (constant extrapolation).
+	*/
+	void setTime(double t);
+
+	/*! Returns value of schedule with given index, computed in last call to setTime(). */
+	double value(unsigned int scheduleIdx) const { return m_values[scheduleIdx]; }
+
+private:
+	/*! Part of an annual spline that is needed to evaluate one day. */
+	struct DayProfile {
+		/*! Time points in [s] relative to start of the day (first value may be negative, last value
+			may be larger than a day when neighboring points are included).
+		*/
+		std::vector<double>		m_x;
+		/*! Values. */
+		std::vector<double>		m_y;
+	};
+
+	/*! Returns index of day profile in m_dayProfiles, adds the day profile if it does not exist yet. */
+	unsigned int dayProfileIndex(const DayProfile & profile);
+
+	/*! All distinct day profiles. */
+	std::vector<DayProfile>								m_dayProfiles;
+	/*! Maps hash of day profile to indexes in m_dayProfiles (used to find existing day profiles). */
+	std::unordered_multimap<std::size_t, unsigned int>	m_dayProfileLookup;
+
+	/*! Calendars of all schedules, m_calendars[scheduleIdx*365 + day] is the index of the day profile
+		in m_dayProfiles.
+	*/
+	std::vector<unsigned int>							m_calendars;
+	/*! Maps hash of calendar to schedule indexes (used to find existing schedules). */
+	std::unordered_multimap<std::size_t, unsigned int>	m_calendarLookup;
+
+	/*! Index of interval in day profile used in last evaluation (size = number of schedules). */
+	std::vector<unsigned int>							m_cursors;
+	/*! Values of all schedules computed in last call to setTime() (size = number of schedules). */
+	std::vector<double>									m_values;
+};
+
+} // namespace NANDRAD_MODEL
+
+#endif // NM_DailyCycleScheduleTableH
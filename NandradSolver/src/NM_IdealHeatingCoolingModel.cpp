@@ -340,6 +340,8 @@ void IdealHeatingCoolingModel::setInputValueRefs(const std::vector<QuantityDescr
 	}
 
 	m_valueRefs = thermostatValueRefs;
+	m_heatingControlValues.resize(indexKeys.size());
+	m_coolingControlValues.resize(indexKeys.size());
 }
 
 
@@ -360,24 +362,34 @@ void IdealHeatingCoolingModel::stateDependencies(std::vector<std::pair<const dou
 
 
 int IdealHeatingCoolingModel::update() {
-	for (unsigned int i=0; i<m_objectList->m_filterID.m_ids.size(); ++i) {
+	unsigned int nZones = m_heatingControlValues.size();
+
+	// gather control values (controller error values) of all zones into contiguous memory, so that the
+	// following loop only works on contiguous arrays
+	for (unsigned int i=0; i<nZones; ++i) {
+		m_heatingControlValues[i] = *m_valueRefs[i*2];
+		m_coolingControlValues[i] = *m_valueRefs[i*2 + 1];
+	}
+
+	double deltaT = std::max(0.0, m_tCurrent - m_tEndOfLastStep); // protection against output errors
+	double * heatingLoads = m_vectorValuedResults[VVR_IdealHeatingLoad].dataPtr();
+	double * coolingLoads = m_vectorValuedResults[VVR_IdealCoolingLoad].dataPtr();
+
+	for (unsigned int i=0; i<nZones; ++i) {
 		// retrieve zone area
 		double area = m_zoneAreas[i];
-		// get control values (controller error values)
-		double heatingControlValue = *m_valueRefs[i*2];
-		double coolingControlValue = *m_valueRefs[i*2 + 1];
+		double heatingControlValue = m_heatingControlValues[i];
+		double coolingControlValue = m_coolingControlValues[i];
 
 		double P_heating = m_Kp*heatingControlValue;
 		double P_cooling = m_Kp*coolingControlValue;
-		double deltaT = std::max(0.0, m_tCurrent - m_tEndOfLastStep); // protection against output errors
 		double I_heating = m_Ki*(m_controllerIntegralValues[i*2]     + heatingControlValue*deltaT);
 		double I_cooling = m_Ki*(m_controllerIntegralValues[i*2 + 1] + coolingControlValue*deltaT);
 		heatingControlValue = std::max(0.0, std::min(1.0, P_heating + I_heating)); // max - to avoid cooling by heating; min - to clip to maximum power
 		coolingControlValue = std::max(0.0, std::min(1.0, P_cooling + I_cooling));
 
-		*(m_vectorValuedResults[VVR_IdealHeatingLoad].dataPtr() + i) = heatingControlValue*area*m_maxHeatingPower;
-		*(m_vectorValuedResults[VVR_IdealCoolingLoad].dataPtr() + i) = coolingControlValue*area*m_maxCoolingPower; // Cooling load is positively defined!
-
+		heatingLoads[i] = heatingControlValue*area*m_maxHeatingPower;
+		coolingLoads[i] = coolingControlValue*area*m_maxCoolingPower; // Cooling load is positively defined!
 	}
 
 	return 0; // signal success
@@ -179,6 +179,11 @@ private:
 	*/
 	std::vector<const double*>						m_valueRefs;
 
+	/*! Heating control values of all zones, gathered from m_valueRefs in update() (size matches ids in m_objectList). */
+	std::vector<double>								m_heatingControlValues;
+	/*! Cooling control values of all zones, gathered from m_valueRefs in update() (size matches ids in m_objectList). */
+	std::vector<double>								m_coolingControlValues;
+
 	/*! Integral values for each PI controller (if used). */
 	std::vector<double>								m_controllerIntegralValues;
 
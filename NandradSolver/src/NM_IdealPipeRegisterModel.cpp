@@ -68,7 +68,7 @@ void IdealPipeRegisterModel::setup(const NANDRAD::IdealPipeRegisterModel & model
 	m_fluidHeatCapacity = model.m_fluid.m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].value;
 	m_fluidDensity = model.m_fluid.m_para[NANDRAD::HydraulicFluid::P_Density].value;
 	m_fluidConductivity = model.m_fluid.m_para[NANDRAD::HydraulicFluid::P_Conductivity].value;
-	m_fluidViscosity = model.m_fluid.m_kinematicViscosity.m_values;
+	m_fluidViscosity.setup(model.m_fluid.m_kinematicViscosity.m_values);
 
 	// compute fluid cross section and volume
 	m_fluidCrossSection = IBK::PI/4. * m_innerDiameter * m_innerDiameter * m_nParallelPipes;
@@ -26,7 +26,7 @@
 #include "NM_AbstractStateDependency.h"
 #include "NM_VectorValuedQuantity.h"
 
-#include <IBK_LinearSpline.h>
+#include <IBK_LinearSplineLookup.h>
 
 namespace NANDRAD {
 	class IdealPipeRegisterModel;
@@ -150,8 +150,8 @@ private:
 	/*! Fluid conductivity [W/mK].*/
 	double											m_fluidConductivity = 0.01;
 
-	/*! Fluid dynamic viscosity [m/s] (temperature dependend).*/
-	IBK::LinearSpline								m_fluidViscosity;
+	/*! Fluid dynamic viscosity [m/s] (temperature dependend), pre-scaled lookup table of the fluid's spline.*/
+	IBK::LinearSplineLookup<>						m_fluidViscosity;
 
 	/*! Equivalent u-value of the pipe wall and insulation per length of pipe in [W/mK] */
 	double											m_UValuePipeWall;
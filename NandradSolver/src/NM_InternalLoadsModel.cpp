@@ -242,6 +242,7 @@ void InternalLoadsModel::setInputValueRefs(const std::vector<QuantityDescription
 		return;
 	IBK_ASSERT(resultValueRefs.size() ==  3 * m_zoneAreas.size());
 	m_valueRefs = resultValueRefs; // Note: we set all our input refs as mandatory, so we can rely on getting valid pointers
+	m_loadsPerArea.resize(resultValueRefs.size());
 }
 
 
@@ -268,18 +269,28 @@ int InternalLoadsModel::update() {
 	double * convLightLoadPtr = m_vectorValuedResults[VVR_ConvectiveLightingHeatLoad].dataPtr();
 	double * radLightLoadPtr = m_vectorValuedResults[VVR_RadiantLightingHeatLoad].dataPtr();
 
+	// gather scheduled loads of all zones into contiguous memory
+	// Exactly 3 values per zone
+	// m_valueRefs has order: [equipLoad_1, personLoad_1, lighting_1,
+	//                         equipLoad_2, personLoad_2, lighting_2,
+	//                         ...
+	//                         equipLoad_n, personLoad_n, lighting_n ]
+	const double * equipmentLoadsPerArea = m_loadsPerArea.data();
+	const double * personLoadsPerArea = equipmentLoadsPerArea + nZones;
+	const double * lightingLoadsPerArea = personLoadsPerArea + nZones;
+	for (unsigned int i = 0; i < nZones; ++i) {
+		m_loadsPerArea[i] = *m_valueRefs[i * 3];
+		m_loadsPerArea[nZones + i] = *m_valueRefs[i * 3 + 1];
+		m_loadsPerArea[2*nZones + i] = *m_valueRefs[i * 3 + 2];
+	}
+
 	// loop through all zone areas
 	for(unsigned int i = 0; i < nZones; ++i) {
 		// retrieve zone area
 		double area = m_zoneAreas[i];
-		// Exactly 3 values per zone
-		// m_valueRefs has order: [equipLoad_1, personLoad_1, lighting_1,
-		//                         equipLoad_2, personLoad_2, lighting_2,
-		//                         ...
-		//                         equipLoad_n, personLoad_n, lighting_n ]
-		double equipmentLoad = area * (*m_valueRefs[i * 3]);
-		double personLoad = area * (*m_valueRefs[i * 3 + 1]);
-		double lightingLoad = area * (*m_valueRefs[i * 3 + 2]);
+		double equipmentLoad = area * equipmentLoadsPerArea[i];
+		double personLoad = area * personLoadsPerArea[i];
+		double lightingLoad = area * lightingLoadsPerArea[i];
 
 		equipElectricalPowerPtr[i] = equipmentLoad;
 		lightElectricalPowerPtr[i] = lightingLoad;
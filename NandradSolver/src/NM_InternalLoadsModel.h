@@ -159,6 +159,11 @@ private:
 	std::vector<VectorValuedQuantity>				m_vectorValuedResults;
 	/*! Vector with input references. */
 	std::vector<const double*>						m_valueRefs;
+	/*! Scheduled loads per area of all zones, gathered from m_valueRefs in update().
+		Values are stored per quantity: [equipLoad_1, ..., equipLoad_n, personLoad_1, ..., personLoad_n,
+		lighting_1, ..., lighting_n].
+	*/
+	std::vector<double>								m_loadsPerArea;
 };
 
 } // namespace NANDRAD_MODEL
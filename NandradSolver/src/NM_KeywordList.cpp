@@ -24,6 +24,8 @@
 #include <map>
 #include <limits>
 #include <iostream>
+#include <algorithm>
+#include <cstring>
 
 #include <IBK_FormatString.h>
 #include <IBK_Exception.h>
@@ -34,7 +36,7 @@ namespace NANDRAD_MODEL {
 	const char * const INVALID_KEYWORD_INDEX_STRING = "KEYWORD_ERROR_STRING: Invalid type index";
 
 	/*! Holds a list of all enum types/categories. */
-	const char * const ENUM_TYPES[23] = {
+	const char * const ENUM_TYPES[24] = {
 		"ConstructionBalanceModel::Results",
 		"ConstructionBalanceModel::VectorValuedResults",
 		"ConstructionStatesModel::VectorValuedResults",
@@ -48,6 +50,7 @@ namespace NANDRAD_MODEL {
 		"KeywordList::MyParameters",
 		"Loads::Results",
 		"Loads::VectorValuedResults",
+		"LongWaveRadiationExchangeModel::VectorValuedResults",
 		"NaturalVentilationModel::VectorValuedResults",
 		"NetworkInterfaceAdapterModel::Results",
 		"OutputHandler::OutputFileNames",
@@ -60,15 +63,57 @@ namespace NANDRAD_MODEL {
 		"WindowModel::Results"
 	};
 
+	/*! Holds the hashes of all enum types/categories (see KeywordList::CategoryHash()). */
+	const unsigned int ENUM_TYPE_HASHES[24] = {
+		2340706301u, // ConstructionBalanceModel::Results
+		1430764053u, // ConstructionBalanceModel::VectorValuedResults
+		470396607u, // ConstructionStatesModel::VectorValuedResults
+		3020457275u, // ConstructionStatesModel::Results
+		115774535u, // HeatLoadSummationModel::Results
+		1453600674u, // IdealHeatingCoolingModel::VectorValuedResults
+		2113690438u, // IdealPipeRegisterModel::VectorValuedResults
+		1623219861u, // IdealSurfaceHeatingCoolingModel::VectorValuedResults
+		1366113400u, // InternalLoadsModel::VectorValuedResults
+		1037013658u, // InternalMoistureLoadsModel::VectorValuedResults
+		3557163906u, // KeywordList::MyParameters
+		209781064u, // Loads::Results
+		2832931732u, // Loads::VectorValuedResults
+		3792399265u, // LongWaveRadiationExchangeModel::VectorValuedResults
+		1314607280u, // NaturalVentilationModel::VectorValuedResults
+		3412187086u, // NetworkInterfaceAdapterModel::Results
+		1528891469u, // OutputHandler::OutputFileNames
+		2580341603u, // RoomBalanceModel::Results
+		1018714623u, // RoomRadiationLoadsModel::Results
+		1300913561u, // RoomStatesModel::Results
+		645722501u, // Schedules::KnownQuantities
+		3234579961u, // ThermalComfortModel::Results
+		3801596153u, // ThermostatModel::VectorValuedResults
+		3937825524u // WindowModel::Results
+	};
+
+	/*! Collision-free hash table, maps ((hash*252639123u) >> 27) to category index (-1 for empty slots). */
+	const short ENUM_TYPE_HASH_TABLE[32] = {
+		-1,15,7,19,13,16,2,17,5,-1,3,10,23,-1,0,8,
+		-1,12,1,18,20,22,4,21,-1,9,14,-1,-1,6,11,-1
+	};
+
 	/*! Converts a category string to respective enumeration value. */
-	int enum2index(const std::string & enumtype) {
-		for (int i=0; i<23; ++i) {
-			if (enumtype == ENUM_TYPES[i]) return i;
-		}
+	int enum2index(const char * const enumtype) {
+		int idx = ENUM_TYPE_HASH_TABLE[(KeywordList::CategoryHash(enumtype)*252639123u) >> 27];
+		if (idx != -1 && std::strcmp(enumtype, ENUM_TYPES[idx]) == 0)
+			return idx;
 		//std::cerr << "Unknown enumeration type '" << enumtype<< "'." << std::endl;
 		return -1;
 	}
 	
+	/*! Converts a category hash to respective enumeration value. */
+	int hash2index(unsigned int categoryHash) {
+		int idx = ENUM_TYPE_HASH_TABLE[(categoryHash*252639123u) >> 27];
+		if (idx != -1 && ENUM_TYPE_HASHES[idx] == categoryHash)
+			return idx;
+		return -1;
+	}
+	
 
 	/*! Returns a keyword string for a given category (typenum) and type number t. */
 	const char * theKeyword(int typenum, int t) {
@@ -94,8 +139,6 @@ namespace NANDRAD_MODEL {
 			case 2 :
 			switch (t) {
 				case 0 : return "ElementTemperature";
-				case 1 : return "EmittedLongWaveRadiationA";
-				case 2 : return "EmittedLongWaveRadiationB";
 			} break;
 			// ConstructionStatesModel::Results
 			case 3 :
@@ -187,249 +230,25 @@ namespace NANDRAD_MODEL {
 				case 2 : return "GlobalSWRadOnPlane";
 				case 3 : return "IncidenceAngleOnPlane";
 			} break;
-			// NaturalVentilationModel::VectorValuedResults
+			// LongWaveRadiationExchangeModel::VectorValuedResults
 			case 13 :
 			switch (t) {
-				case 0 : return "VentilationRate";
-				case 1 : return "VentilationHeatFlux";
-				case 2 : return "VentilationMoistureMassFlux";
-			} break;
-			// NetworkInterfaceAdapterModel::Results
-			case 14 :
-			switch (t) {
-				case 0 : return "ReturnTemperature";
-			} break;
-			// OutputHandler::OutputFileNames
-			case 15 :
-			switch (t) {
-				case 0 : return "states";
-				case 1 : return "loads";
-				case 2 : return "load_integrals";
-				case 3 : return "fluxes";
-				case 4 : return "flux_integrals";
-				case 5 : return "network";
-				case 6 : return "network_elements";
-				case 7 : return "misc";
-			} break;
-			// RoomBalanceModel::Results
-			case 16 :
-			switch (t) {
-				case 0 : return "CompleteThermalLoad";
-				case 1 : return "VentilationHeatLoad";
-				case 2 : return "ConvectiveEquipmentHeatLoad";
-				case 3 : return "ConvectivePersonHeatLoad";
-				case 4 : return "ConvectiveLightingHeatLoad";
-				case 5 : return "IdealHeatingLoad";
-				case 6 : return "IdealCoolingLoad";
-				case 7 : return "ConstructionHeatConductionLoad";
-				case 8 : return "WindowHeatConductionLoad";
-				case 9 : return "WindowSolarRadiationLoad";
-				case 10 : return "NetworkHeatLoad";
-				case 11 : return "EquipmentElectricalPower";
-				case 12 : return "LightingElectricalPower";
-				case 13 : return "TotalElectricalPower";
-				case 14 : return "CompleteMoistureLoad";
-			} break;
-			// RoomRadiationLoadsModel::Results
-			case 17 :
-			switch (t) {
-				case 0 : return "WindowSolarRadiationFluxSum";
-			} break;
-			// RoomStatesModel::Results
-			case 18 :
-			switch (t) {
-				case 0 : return "AirTemperature";
-				case 1 : return "RelativeHumidity";
-				case 2 : return "VaporPressure";
-				case 3 : return "AbsoluteHumidity";
-				case 4 : return "SpecificHumidity";
-			} break;
-			// Schedules::KnownQuantities
-			case 19 :
-			switch (t) {
-				case 0 : return "VentilationRateSchedule";
-				case 1 : return "VentilationRateIncreaseSchedule";
-				case 2 : return "VentilationMaxAirTemperatureSchedule";
-				case 3 : return "VentilationMinAirTemperatureSchedule";
-				case 4 : return "EquipmentHeatLoadPerAreaSchedule";
-				case 5 : return "PersonHeatLoadPerAreaSchedule";
-				case 6 : return "MoistureLoadPerAreaSchedule";
-				case 7 : return "LightingHeatLoadPerAreaSchedule";
-				case 8 : return "HeatingSetpointSchedule";
-				case 9 : return "CoolingSetpointSchedule";
-				case 10 : return "CondenserMeanTemperatureSchedule";
-				case 11 : return "CondenserOutletSetpointSchedule";
-				case 12 : return "EvaporatorMeanTemperatureSchedule";
-				case 13 : return "MaxMassFluxSchedule";
-				case 14 : return "MassFluxSchedule";
-				case 15 : return "MassFluxSetpointSchedule";
-				case 16 : return "TemperatureDifferenceSetpointSchedule";
-				case 17 : return "HeatPumpOnOffSignalSchedule";
-				case 18 : return "DomesticHotWaterDemandSchedule";
-				case 19 : return "SupplyTemperatureSchedule";
-				case 20 : return "PressureHeadSchedule";
-				case 21 : return "PressureLossSchedule";
-				case 22 : return "TemperatureSchedule";
-			} break;
-			// ThermalComfortModel::Results
-			case 20 :
-			switch (t) {
-				case 0 : return "OperativeTemperature";
-			} break;
-			// ThermostatModel::VectorValuedResults
-			case 21 :
-			switch (t) {
-				case 0 : return "HeatingControlValue";
-				case 1 : return "CoolingControlValue";
-				case 2 : return "ThermostatHeatingSetpoint";
-				case 3 : return "ThermostatCoolingSetpoint";
-			} break;
-			// WindowModel::Results
-			case 22 :
-			switch (t) {
-				case 0 : return "FluxHeatConductionA";
-				case 1 : return "FluxHeatConductionB";
-				case 2 : return "FluxShortWaveRadiationA";
-				case 3 : return "FluxShortWaveRadiationB";
-				case 4 : return "SurfaceTemperatureA";
-				case 5 : return "SurfaceTemperatureB";
-				case 6 : return "ShadingFactor";
-			} break;
-		} // switch
-		return INVALID_KEYWORD_INDEX_STRING;
-	}
-
-	/*! Returns all keywords including deprecated for a given category (typenum) and type number (t). */
-	const char * allKeywords(int typenum, int t) {
-		switch (typenum) {
-			// ConstructionBalanceModel::Results
-			case 0 :
-			switch (t) {
-				case 0 : return "FluxHeatConductionA";
-				case 1 : return "FluxHeatConductionB";
-				case 2 : return "FluxHeatConductionAreaSpecificA";
-				case 3 : return "FluxHeatConductionAreaSpecificB";
-				case 4 : return "FluxShortWaveRadiationA";
-				case 5 : return "FluxShortWaveRadiationB";
-				case 6 : return "FluxLongWaveRadiationA";
-				case 7 : return "FluxLongWaveRadiationB";
-			} break;
-			// ConstructionBalanceModel::VectorValuedResults
-			case 1 :
-			switch (t) {
-				case 0 : return "ThermalLoad";
-			} break;
-			// ConstructionStatesModel::VectorValuedResults
-			case 2 :
-			switch (t) {
-				case 0 : return "ElementTemperature";
-				case 1 : return "EmittedLongWaveRadiationA";
-				case 2 : return "EmittedLongWaveRadiationB";
-			} break;
-			// ConstructionStatesModel::Results
-			case 3 :
-			switch (t) {
-				case 0 : return "SurfaceTemperatureA";
-				case 1 : return "SurfaceTemperatureB";
-				case 2 : return "SolarRadiationFluxA";
-				case 3 : return "SolarRadiationFluxB";
-				case 4 : return "FluxLongWaveRadiationBalanceA";
-				case 5 : return "FluxLongWaveRadiationBalanceB";
-				case 6 : return "FluxEmittedLongWaveRadiationA";
-				case 7 : return "FluxEmittedLongWaveRadiationB";
-			} break;
-			// HeatLoadSummationModel::Results
-			case 4 :
-			switch (t) {
-				case 0 : return "TotalHeatLoad";
-			} break;
-			// IdealHeatingCoolingModel::VectorValuedResults
-			case 5 :
-			switch (t) {
-				case 0 : return "IdealHeatingLoad";
-				case 1 : return "IdealCoolingLoad";
-			} break;
-			// IdealPipeRegisterModel::VectorValuedResults
-			case 6 :
-			switch (t) {
-				case 0 : return "MassFlux";
-				case 1 : return "ActiveLayerThermalLoad";
-				case 2 : return "ReturnTemperature";
-			} break;
-			// IdealSurfaceHeatingCoolingModel::VectorValuedResults
-			case 7 :
-			switch (t) {
-				case 0 : return "ActiveLayerThermalLoad";
-			} break;
-			// InternalLoadsModel::VectorValuedResults
-			case 8 :
-			switch (t) {
-				case 0 : return "TotalElectricalPower";
-				case 1 : return "EquipmentElectricalPower";
-				case 2 : return "LightingElectricalPower";
-				case 3 : return "ConvectiveEquipmentHeatLoad";
-				case 4 : return "ConvectivePersonHeatLoad";
-				case 5 : return "ConvectiveLightingHeatLoad";
-				case 6 : return "RadiantEquipmentHeatLoad";
-				case 7 : return "RadiantPersonHeatLoad";
-				case 8 : return "RadiantLightingHeatLoad";
-			} break;
-			// InternalMoistureLoadsModel::VectorValuedResults
-			case 9 :
-			switch (t) {
-				case 0 : return "MoistureLoad";
-				case 1 : return "MoistureEnthalpyFlux";
-			} break;
-			// KeywordList::MyParameters
-			case 10 :
-			switch (t) {
-				case 0 : return "Temperature";
-				case 1 : return "Mass";
-			} break;
-			// Loads::Results
-			case 11 :
-			switch (t) {
-				case 0 : return "Temperature";
-				case 1 : return "RelativeHumidity";
-				case 2 : return "SWRadDirectNormal";
-				case 3 : return "SWRadDiffuseHorizontal";
-				case 4 : return "LongWaveSkyRadiation";
-				case 5 : return "WindDirection";
-				case 6 : return "WindVelocity";
-				case 7 : return "AirPressure";
-				case 8 : return "VaporPressure";
-				case 9 : return "AbsoluteHumidity";
-				case 10 : return "CO2Concentration";
-				case 11 : return "CO2Density";
-				case 12 : return "DeclinationAngle";
-				case 13 : return "ElevationAngle";
-				case 14 : return "AzimuthAngle";
-				case 15 : return "Albedo";
-				case 16 : return "Latitude";
-				case 17 : return "Longitude";
-			} break;
-			// Loads::VectorValuedResults
-			case 12 :
-			switch (t) {
-				case 0 : return "DirectSWRadOnPlane";
-				case 1 : return "DiffuseSWRadOnPlane";
-				case 2 : return "GlobalSWRadOnPlane";
-				case 3 : return "IncidenceAngleOnPlane";
+				case 0 : return "NetLongWaveRadiationFluxDensity";
 			} break;
 			// NaturalVentilationModel::VectorValuedResults
-			case 13 :
+			case 14 :
 			switch (t) {
 				case 0 : return "VentilationRate";
 				case 1 : return "VentilationHeatFlux";
 				case 2 : return "VentilationMoistureMassFlux";
 			} break;
 			// NetworkInterfaceAdapterModel::Results
-			case 14 :
+			case 15 :
 			switch (t) {
 				case 0 : return "ReturnTemperature";
 			} break;
 			// OutputHandler::OutputFileNames
-			case 15 :
+			case 16 :
 			switch (t) {
 				case 0 : return "states";
 				case 1 : return "loads";
@@ -441,7 +260,7 @@ namespace NANDRAD_MODEL {
 				case 7 : return "misc";
 			} break;
 			// RoomBalanceModel::Results
-			case 16 :
+			case 17 :
 			switch (t) {
 				case 0 : return "CompleteThermalLoad";
 				case 1 : return "VentilationHeatLoad";
@@ -460,12 +279,12 @@ namespace NANDRAD_MODEL {
 				case 14 : return "CompleteMoistureLoad";
 			} break;
 			// RoomRadiationLoadsModel::Results
-			case 17 :
+			case 18 :
 			switch (t) {
 				case 0 : return "WindowSolarRadiationFluxSum";
 			} break;
 			// RoomStatesModel::Results
-			case 18 :
+			case 19 :
 			switch (t) {
 				case 0 : return "AirTemperature";
 				case 1 : return "RelativeHumidity";
@@ -474,7 +293,7 @@ namespace NANDRAD_MODEL {
 				case 4 : return "SpecificHumidity";
 			} break;
 			// Schedules::KnownQuantities
-			case 19 :
+			case 20 :
 			switch (t) {
 				case 0 : return "VentilationRateSchedule";
 				case 1 : return "VentilationRateIncreaseSchedule";
@@ -501,12 +320,12 @@ namespace NANDRAD_MODEL {
 				case 22 : return "TemperatureSchedule";
 			} break;
 			// ThermalComfortModel::Results
-			case 20 :
+			case 21 :
 			switch (t) {
 				case 0 : return "OperativeTemperature";
 			} break;
 			// ThermostatModel::VectorValuedResults
-			case 21 :
+			case 22 :
 			switch (t) {
 				case 0 : return "HeatingControlValue";
 				case 1 : return "CoolingControlValue";
@@ -514,7 +333,7 @@ namespace NANDRAD_MODEL {
 				case 3 : return "ThermostatCoolingSetpoint";
 			} break;
 			// WindowModel::Results
-			case 22 :
+			case 23 :
 			switch (t) {
 				case 0 : return "FluxHeatConductionA";
 				case 1 : return "FluxHeatConductionB";
@@ -528,6 +347,191 @@ namespace NANDRAD_MODEL {
 		return INVALID_KEYWORD_INDEX_STRING;
 	}
 
+	/*! Entry in keyword table. */
+	struct KeywordTableEntry {
+		/*! Keyword (current or deprecated). */
+		const char *	keyword;
+		/*! Enumeration value. */
+		int				index;
+		/*! True if keyword is deprecated. */
+		bool			deprecated;
+	};
+
+	/*! All keywords including deprecated, sorted by keyword within each category. */
+	const KeywordTableEntry KEYWORD_TABLE[129] = {
+		// ConstructionBalanceModel::Results
+		{ "FluxHeatConductionA", 0, false },
+		{ "FluxHeatConductionAreaSpecificA", 2, false },
+		{ "FluxHeatConductionAreaSpecificB", 3, false },
+		{ "FluxHeatConductionB", 1, false },
+		{ "FluxLongWaveRadiationA", 6, false },
+		{ "FluxLongWaveRadiationB", 7, false },
+		{ "FluxShortWaveRadiationA", 4, false },
+		{ "FluxShortWaveRadiationB", 5, false },
+		// ConstructionBalanceModel::VectorValuedResults
+		{ "ThermalLoad", 0, false },
+		// ConstructionStatesModel::VectorValuedResults
+		{ "ElementTemperature", 0, false },
+		// ConstructionStatesModel::Results
+		{ "FluxEmittedLongWaveRadiationA", 6, false },
+		{ "FluxEmittedLongWaveRadiationB", 7, false },
+		{ "FluxLongWaveRadiationBalanceA", 4, false },
+		{ "FluxLongWaveRadiationBalanceB", 5, false },
+		{ "SolarRadiationFluxA", 2, false },
+		{ "SolarRadiationFluxB", 3, false },
+		{ "SurfaceTemperatureA", 0, false },
+		{ "SurfaceTemperatureB", 1, false },
+		// HeatLoadSummationModel::Results
+		{ "TotalHeatLoad", 0, false },
+		// IdealHeatingCoolingModel::VectorValuedResults
+		{ "IdealCoolingLoad", 1, false },
+		{ "IdealHeatingLoad", 0, false },
+		// IdealPipeRegisterModel::VectorValuedResults
+		{ "ActiveLayerThermalLoad", 1, false },
+		{ "MassFlux", 0, false },
+		{ "ReturnTemperature", 2, false },
+		// IdealSurfaceHeatingCoolingModel::VectorValuedResults
+		{ "ActiveLayerThermalLoad", 0, false },
+		// InternalLoadsModel::VectorValuedResults
+		{ "ConvectiveEquipmentHeatLoad", 3, false },
+		{ "ConvectiveLightingHeatLoad", 5, false },
+		{ "ConvectivePersonHeatLoad", 4, false },
+		{ "EquipmentElectricalPower", 1, false },
+		{ "LightingElectricalPower", 2, false },
+		{ "RadiantEquipmentHeatLoad", 6, false },
+		{ "RadiantLightingHeatLoad", 8, false },
+		{ "RadiantPersonHeatLoad", 7, false },
+		{ "TotalElectricalPower", 0, false },
+		// InternalMoistureLoadsModel::VectorValuedResults
+		{ "MoistureEnthalpyFlux", 1, false },
+		{ "MoistureLoad", 0, false },
+		// KeywordList::MyParameters
+		{ "Mass", 1, false },
+		{ "Temperature", 0, false },
+		// Loads::Results
+		{ "AbsoluteHumidity", 9, false },
+		{ "AirPressure", 7, false },
+		{ "Albedo", 15, false },
+		{ "AzimuthAngle", 14, false },
+		{ "CO2Concentration", 10, false },
+		{ "CO2Density", 11, false },
+		{ "DeclinationAngle", 12, false },
+		{ "ElevationAngle", 13, false },
+		{ "Latitude", 16, false },
+		{ "LongWaveSkyRadiation", 4, false },
+		{ "Longitude", 17, false },
+		{ "RelativeHumidity", 1, false },
+		{ "SWRadDiffuseHorizontal", 3, false },
+		{ "SWRadDirectNormal", 2, false },
+		{ "Temperature", 0, false },
+		{ "VaporPressure", 8, false },
+		{ "WindDirection", 5, false },
+		{ "WindVelocity", 6, false },
+		// Loads::VectorValuedResults
+		{ "DiffuseSWRadOnPlane", 1, false },
+		{ "DirectSWRadOnPlane", 0, false },
+		{ "GlobalSWRadOnPlane", 2, false },
+		{ "IncidenceAngleOnPlane", 3, false },
+		// LongWaveRadiationExchangeModel::VectorValuedResults
+		{ "NetLongWaveRadiationFluxDensity", 0, false },
+		// NaturalVentilationModel::VectorValuedResults
+		{ "VentilationHeatFlux", 1, false },
+		{ "VentilationMoistureMassFlux", 2, false },
+		{ "VentilationRate", 0, false },
+		// NetworkInterfaceAdapterModel::Results
+		{ "ReturnTemperature", 0, false },
+		// OutputHandler::OutputFileNames
+		{ "flux_integrals", 4, false },
+		{ "fluxes", 3, false },
+		{ "load_integrals", 2, false },
+		{ "loads", 1, false },
+		{ "misc", 7, false },
+		{ "network", 5, false },
+		{ "network_elements", 6, false },
+		{ "states", 0, false },
+		// RoomBalanceModel::Results
+		{ "CompleteMoistureLoad", 14, false },
+		{ "CompleteThermalLoad", 0, false },
+		{ "ConstructionHeatConductionLoad", 7, false },
+		{ "ConvectiveEquipmentHeatLoad", 2, false },
+		{ "ConvectiveLightingHeatLoad", 4, false },
+		{ "ConvectivePersonHeatLoad", 3, false },
+		{ "EquipmentElectricalPower", 11, false },
+		{ "IdealCoolingLoad", 6, false },
+		{ "IdealHeatingLoad", 5, false },
+		{ "LightingElectricalPower", 12, false },
+		{ "NetworkHeatLoad", 10, false },
+		{ "TotalElectricalPower", 13, false },
+		{ "VentilationHeatLoad", 1, false },
+		{ "WindowHeatConductionLoad", 8, false },
+		{ "WindowSolarRadiationLoad", 9, false },
+		// RoomRadiationLoadsModel::Results
+		{ "WindowSolarRadiationFluxSum", 0, false },
+		// RoomStatesModel::Results
+		{ "AbsoluteHumidity", 3, false },
+		{ "AirTemperature", 0, false },
+		{ "RelativeHumidity", 1, false },
+		{ "SpecificHumidity", 4, false },
+		{ "VaporPressure", 2, false },
+		// Schedules::KnownQuantities
+		{ "CondenserMeanTemperatureSchedule", 10, false },
+		{ "CondenserOutletSetpointSchedule", 11, false },
+		{ "CoolingSetpointSchedule", 9, false },
+		{ "DomesticHotWaterDemandSchedule", 18, false },
+		{ "EquipmentHeatLoadPerAreaSchedule", 4, false },
+		{ "EvaporatorMeanTemperatureSchedule", 12, false },
+		{ "HeatPumpOnOffSignalSchedule", 17, false },
+		{ "HeatingSetpointSchedule", 8, false },
+		{ "LightingHeatLoadPerAreaSchedule", 7, false },
+		{ "MassFluxSchedule", 14, false },
+		{ "MassFluxSetpointSchedule", 15, false },
+		{ "MaxMassFluxSchedule", 13, false },
+		{ "MoistureLoadPerAreaSchedule", 6, false },
+		{ "PersonHeatLoadPerAreaSchedule", 5, false },
+		{ "PressureHeadSchedule", 20, false },
+		{ "PressureLossSchedule", 21, false },
+		{ "SupplyTemperatureSchedule", 19, false },
+		{ "TemperatureDifferenceSetpointSchedule", 16, false },
+		{ "TemperatureSchedule", 22, false },
+		{ "VentilationMaxAirTemperatureSchedule", 2, false },
+		{ "VentilationMinAirTemperatureSchedule", 3, false },
+		{ "VentilationRateIncreaseSchedule", 1, false },
+		{ "VentilationRateSchedule", 0, false },
+		// ThermalComfortModel::Results
+		{ "OperativeTemperature", 0, false },
+		// ThermostatModel::VectorValuedResults
+		{ "CoolingControlValue", 1, false },
+		{ "HeatingControlValue", 0, false },
+		{ "ThermostatCoolingSetpoint", 3, false },
+		{ "ThermostatHeatingSetpoint", 2, false },
+		// WindowModel::Results
+		{ "FluxHeatConductionA", 0, false },
+		{ "FluxHeatConductionB", 1, false },
+		{ "FluxShortWaveRadiationA", 2, false },
+		{ "FluxShortWaveRadiationB", 3, false },
+		{ "ShadingFactor", 6, false },
+		{ "SurfaceTemperatureA", 4, false },
+		{ "SurfaceTemperatureB", 5, false }
+	};
+
+	/*! Index of first keyword of each category in KEYWORD_TABLE, last value is the table size. */
+	const unsigned int KEYWORD_TABLE_OFFSETS[25] = {
+		0,8,9,10,18,19,21,24,25,34,36,38,56,60,61,64,
+		65,73,88,89,94,117,118,122,129
+	};
+
+	/*! Returns keyword table entry for given keyword in category with index typenum, or nullptr if not found. */
+	const KeywordTableEntry * findKeyword(int typenum, const std::string & kw) {
+		const KeywordTableEntry * first = KEYWORD_TABLE + KEYWORD_TABLE_OFFSETS[typenum];
+		const KeywordTableEntry * last = KEYWORD_TABLE + KEYWORD_TABLE_OFFSETS[typenum+1];
+		const char * const kwStr = kw.c_str();
+		first = std::lower_bound(first, last, kwStr,
+			[](const KeywordTableEntry & e, const char * k) { return std::strcmp(e.keyword, k) < 0; });
+		if (first != last && kw == first->keyword)
+			return first;
+		return nullptr;
+	}
+
 	const char * KeywordList::Description(const char * const enumtype, int t, bool * no_description) {
 		if (no_description != nullptr)
 			*no_description = false; // we are optimistic
@@ -553,8 +557,6 @@ namespace NANDRAD_MODEL {
 			case 2 :
 			switch (t) {
 				case 0 : return "Finite-volume mean element temperature";
-				case 1 : return "Emitted internal long-wave radiation from side A.";
-				case 2 : return "Emitted internal long-wave radiation from side B.";
 			} break;
 			// ConstructionStatesModel::Results
 			case 3 :
@@ -646,20 +648,25 @@ namespace NANDRAD_MODEL {
 				case 2 : return "Global short wave radiation on a given plane.";
 				case 3 : return "The incidence angle of the suns ray onto the surface (0 deg = directly perpendicular).";
 			} break;
-			// NaturalVentilationModel::VectorValuedResults
+			// LongWaveRadiationExchangeModel::VectorValuedResults
 			case 13 :
+			switch (t) {
+				case 0 : return "Net absorbed long wave radiation flux density of inside surfaces (positive into surface).";
+			} break;
+			// NaturalVentilationModel::VectorValuedResults
+			case 14 :
 			switch (t) {
 				case 0 : return "Natural ventilation/infiltration air change rate";
 				case 1 : return "Natural ventilation/infiltration heat flux";
 				case 2 : return "Natural ventilation/infiltration moisture mass flux";
 			} break;
 			// NetworkInterfaceAdapterModel::Results
-			case 14 :
+			case 15 :
 			switch (t) {
 				case 0 : return "Return temperature.";
 			} break;
 			// OutputHandler::OutputFileNames
-			case 15 :
+			case 16 :
 			switch (t) {
 				case 0 : if (no_description != nullptr) *no_description = true; return "states";
 				case 1 : if (no_description != nullptr) *no_description = true; return "loads";
@@ -671,7 +678,7 @@ namespace NANDRAD_MODEL {
 				case 7 : if (no_description != nullptr) *no_description = true; return "misc";
 			} break;
 			// RoomBalanceModel::Results
-			case 16 :
+			case 17 :
 			switch (t) {
 				case 0 : return "Sum of all thermal fluxes into the room and energy sources";
 				case 1 : return "Natural ventilation/infiltration heat flux into the room";
@@ -690,12 +697,12 @@ namespace NANDRAD_MODEL {
 				case 14 : return "Sum of all moisture fluxes into the room and moisture sources";
 			} break;
 			// RoomRadiationLoadsModel::Results
-			case 17 :
+			case 18 :
 			switch (t) {
 				case 0 : return "Sum of all short wave radiation fluxes across all windows of a zone (positive into zone).";
 			} break;
 			// RoomStatesModel::Results
-			case 18 :
+			case 19 :
 			switch (t) {
 				case 0 : return "Room air temperature";
 				case 1 : return "Room air relative humidity";
@@ -704,7 +711,7 @@ namespace NANDRAD_MODEL {
 				case 4 : return "Mass specific air humidity";
 			} break;
 			// Schedules::KnownQuantities
-			case 19 :
+			case 20 :
 			switch (t) {
 				case 0 : if (no_description != nullptr) *no_description = true; return "VentilationRateSchedule";
 				case 1 : if (no_description != nullptr) *no_description = true; return "VentilationRateIncreaseSchedule";
@@ -731,12 +738,12 @@ namespace NANDRAD_MODEL {
 				case 22 : if (no_description != nullptr) *no_description = true; return "TemperatureSchedule";
 			} break;
 			// ThermalComfortModel::Results
-			case 20 :
+			case 21 :
 			switch (t) {
 				case 0 : return "Operative temperature";
 			} break;
 			// ThermostatModel::VectorValuedResults
-			case 21 :
+			case 22 :
 			switch (t) {
 				case 0 : return "Heating control signal";
 				case 1 : return "Cooling control signal";
@@ -744,7 +751,7 @@ namespace NANDRAD_MODEL {
 				case 3 : return "Cooling setpoint";
 			} break;
 			// WindowModel::Results
-			case 22 :
+			case 23 :
 			switch (t) {
 				case 0 : return "Heat conduction flux across interface A (into window)";
 				case 1 : return "Heat conduction flux across interface B (into window)";
@@ -782,8 +789,6 @@ namespace NANDRAD_MODEL {
 			case 2 :
 			switch (t) {
 				case 0 : return "C";
-				case 1 : return "W";
-				case 2 : return "W";
 			} break;
 			// ConstructionStatesModel::Results
 			case 3 :
@@ -875,20 +880,25 @@ namespace NANDRAD_MODEL {
 				case 2 : return "W/m2";
 				case 3 : return "Deg";
 			} break;
-			// NaturalVentilationModel::VectorValuedResults
+			// LongWaveRadiationExchangeModel::VectorValuedResults
 			case 13 :
+			switch (t) {
+				case 0 : return "W/m2";
+			} break;
+			// NaturalVentilationModel::VectorValuedResults
+			case 14 :
 			switch (t) {
 				case 0 : return "1/h";
 				case 1 : return "W";
 				case 2 : return "kg/s";
 			} break;
 			// NetworkInterfaceAdapterModel::Results
-			case 14 :
+			case 15 :
 			switch (t) {
 				case 0 : return "C";
 			} break;
 			// OutputHandler::OutputFileNames
-			case 15 :
+			case 16 :
 			switch (t) {
 				case 0 : return "";
 				case 1 : return "";
@@ -900,7 +910,7 @@ namespace NANDRAD_MODEL {
 				case 7 : return "";
 			} break;
 			// RoomBalanceModel::Results
-			case 16 :
+			case 17 :
 			switch (t) {
 				case 0 : return "W";
 				case 1 : return "W";
@@ -919,12 +929,12 @@ namespace NANDRAD_MODEL {
 				case 14 : return "kg/s";
 			} break;
 			// RoomRadiationLoadsModel::Results
-			case 17 :
+			case 18 :
 			switch (t) {
 				case 0 : return "W";
 			} break;
 			// RoomStatesModel::Results
-			case 18 :
+			case 19 :
 			switch (t) {
 				case 0 : return "C";
 				case 1 : return "%";
@@ -933,7 +943,7 @@ namespace NANDRAD_MODEL {
 				case 4 : return "kg/kg";
 			} break;
 			// Schedules::KnownQuantities
-			case 19 :
+			case 20 :
 			switch (t) {
 				case 0 : return "1/h";
 				case 1 : return "1/h";
@@ -960,12 +970,12 @@ namespace NANDRAD_MODEL {
 				case 22 : return "C";
 			} break;
 			// ThermalComfortModel::Results
-			case 20 :
+			case 21 :
 			switch (t) {
 				case 0 : return "C";
 			} break;
 			// ThermostatModel::VectorValuedResults
-			case 21 :
+			case 22 :
 			switch (t) {
 				case 0 : return "---";
 				case 1 : return "---";
@@ -973,7 +983,7 @@ namespace NANDRAD_MODEL {
 				case 3 : return "C";
 			} break;
 			// WindowModel::Results
-			case 22 :
+			case 23 :
 			switch (t) {
 				case 0 : return "W";
 				case 1 : return "W";
@@ -1011,8 +1021,6 @@ namespace NANDRAD_MODEL {
 			case 2 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
-				case 1 : return "#FFFFFF";
-				case 2 : return "#FFFFFF";
 			} break;
 			// ConstructionStatesModel::Results
 			case 3 :
@@ -1104,20 +1112,25 @@ namespace NANDRAD_MODEL {
 				case 2 : return "#FFFFFF";
 				case 3 : return "#FFFFFF";
 			} break;
-			// NaturalVentilationModel::VectorValuedResults
+			// LongWaveRadiationExchangeModel::VectorValuedResults
 			case 13 :
+			switch (t) {
+				case 0 : return "#FFFFFF";
+			} break;
+			// NaturalVentilationModel::VectorValuedResults
+			case 14 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
 				case 2 : return "#FFFFFF";
 			} break;
 			// NetworkInterfaceAdapterModel::Results
-			case 14 :
+			case 15 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
 			} break;
 			// OutputHandler::OutputFileNames
-			case 15 :
+			case 16 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
@@ -1129,7 +1142,7 @@ namespace NANDRAD_MODEL {
 				case 7 : return "#FFFFFF";
 			} break;
 			// RoomBalanceModel::Results
-			case 16 :
+			case 17 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
@@ -1148,12 +1161,12 @@ namespace NANDRAD_MODEL {
 				case 14 : return "#FFFFFF";
 			} break;
 			// RoomRadiationLoadsModel::Results
-			case 17 :
+			case 18 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
 			} break;
 			// RoomStatesModel::Results
-			case 18 :
+			case 19 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
@@ -1162,7 +1175,7 @@ namespace NANDRAD_MODEL {
 				case 4 : return "#FFFFFF";
 			} break;
 			// Schedules::KnownQuantities
-			case 19 :
+			case 20 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
@@ -1189,12 +1202,12 @@ namespace NANDRAD_MODEL {
 				case 22 : return "#FFFFFF";
 			} break;
 			// ThermalComfortModel::Results
-			case 20 :
+			case 21 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
 			} break;
 			// ThermostatModel::VectorValuedResults
-			case 21 :
+			case 22 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
@@ -1202,7 +1215,7 @@ namespace NANDRAD_MODEL {
 				case 3 : return "#FFFFFF";
 			} break;
 			// WindowModel::Results
-			case 22 :
+			case 23 :
 			switch (t) {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
@@ -1240,8 +1253,6 @@ namespace NANDRAD_MODEL {
 			case 2 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
-				case 1 : return std::numeric_limits<double>::quiet_NaN();
-				case 2 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// ConstructionStatesModel::Results
 			case 3 :
@@ -1333,20 +1344,25 @@ namespace NANDRAD_MODEL {
 				case 2 : return std::numeric_limits<double>::quiet_NaN();
 				case 3 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
-			// NaturalVentilationModel::VectorValuedResults
+			// LongWaveRadiationExchangeModel::VectorValuedResults
 			case 13 :
+			switch (t) {
+				case 0 : return std::numeric_limits<double>::quiet_NaN();
+			} break;
+			// NaturalVentilationModel::VectorValuedResults
+			case 14 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
 				case 2 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// NetworkInterfaceAdapterModel::Results
-			case 14 :
+			case 15 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// OutputHandler::OutputFileNames
-			case 15 :
+			case 16 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
@@ -1358,7 +1374,7 @@ namespace NANDRAD_MODEL {
 				case 7 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// RoomBalanceModel::Results
-			case 16 :
+			case 17 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
@@ -1377,12 +1393,12 @@ namespace NANDRAD_MODEL {
 				case 14 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// RoomRadiationLoadsModel::Results
-			case 17 :
+			case 18 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// RoomStatesModel::Results
-			case 18 :
+			case 19 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
@@ -1391,7 +1407,7 @@ namespace NANDRAD_MODEL {
 				case 4 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// Schedules::KnownQuantities
-			case 19 :
+			case 20 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
@@ -1418,12 +1434,12 @@ namespace NANDRAD_MODEL {
 				case 22 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// ThermalComfortModel::Results
-			case 20 :
+			case 21 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// ThermostatModel::VectorValuedResults
-			case 21 :
+			case 22 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
@@ -1431,7 +1447,7 @@ namespace NANDRAD_MODEL {
 				case 3 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// WindowModel::Results
-			case 22 :
+			case 23 :
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
@@ -1454,7 +1470,7 @@ namespace NANDRAD_MODEL {
 			// ConstructionBalanceModel::VectorValuedResults
 			case 1 : return 1;
 			// ConstructionStatesModel::VectorValuedResults
-			case 2 : return 3;
+			case 2 : return 1;
 			// ConstructionStatesModel::Results
 			case 3 : return 8;
 			// HeatLoadSummationModel::Results
@@ -1475,26 +1491,28 @@ namespace NANDRAD_MODEL {
 			case 11 : return 18;
 			// Loads::VectorValuedResults
 			case 12 : return 4;
+			// LongWaveRadiationExchangeModel::VectorValuedResults
+			case 13 : return 1;
 			// NaturalVentilationModel::VectorValuedResults
-			case 13 : return 3;
+			case 14 : return 3;
 			// NetworkInterfaceAdapterModel::Results
-			case 14 : return 1;
+			case 15 : return 1;
 			// OutputHandler::OutputFileNames
-			case 15 : return 8;
+			case 16 : return 8;
 			// RoomBalanceModel::Results
-			case 16 : return 15;
+			case 17 : return 15;
 			// RoomRadiationLoadsModel::Results
-			case 17 : return 1;
+			case 18 : return 1;
 			// RoomStatesModel::Results
-			case 18 : return 5;
+			case 19 : return 5;
 			// Schedules::KnownQuantities
-			case 19 : return 23;
+			case 20 : return 23;
 			// ThermalComfortModel::Results
-			case 20 : return 1;
+			case 21 : return 1;
 			// ThermostatModel::VectorValuedResults
-			case 21 : return 4;
+			case 22 : return 4;
 			// WindowModel::Results
-			case 22 : return 7;
+			case 23 : return 7;
 		} // switch
 		throw IBK::Exception(IBK::FormatString("Invalid enumeration type '%1'.")
 			.arg(enumtype), "[KeywordList::Count]");
@@ -1508,7 +1526,7 @@ namespace NANDRAD_MODEL {
 			// ConstructionBalanceModel::VectorValuedResults
 			case 1 : return 0;
 			// ConstructionStatesModel::VectorValuedResults
-			case 2 : return 2;
+			case 2 : return 0;
 			// ConstructionStatesModel::Results
 			case 3 : return 7;
 			// HeatLoadSummationModel::Results
@@ -1529,26 +1547,28 @@ namespace NANDRAD_MODEL {
 			case 11 : return 17;
 			// Loads::VectorValuedResults
 			case 12 : return 3;
+			// LongWaveRadiationExchangeModel::VectorValuedResults
+			case 13 : return 0;
 			// NaturalVentilationModel::VectorValuedResults
-			case 13 : return 2;
+			case 14 : return 2;
 			// NetworkInterfaceAdapterModel::Results
-			case 14 : return 0;
+			case 15 : return 0;
 			// OutputHandler::OutputFileNames
-			case 15 : return 7;
+			case 16 : return 7;
 			// RoomBalanceModel::Results
-			case 16 : return 14;
+			case 17 : return 14;
 			// RoomRadiationLoadsModel::Results
-			case 17 : return 0;
+			case 18 : return 0;
 			// RoomStatesModel::Results
-			case 18 : return 4;
+			case 19 : return 4;
 			// Schedules::KnownQuantities
-			case 19 : return 22;
+			case 20 : return 22;
 			// ThermalComfortModel::Results
-			case 20 : return 0;
+			case 21 : return 0;
 			// ThermostatModel::VectorValuedResults
-			case 21 : return 3;
+			case 22 : return 3;
 			// WindowModel::Results
-			case 22 : return 7;
+			case 23 : return 7;
 		} // switch
 		throw IBK::Exception(IBK::FormatString("Invalid enumeration type '%1'.")
 			.arg(enumtype), "[KeywordList::MaxIndex]");
@@ -1565,49 +1585,48 @@ namespace NANDRAD_MODEL {
 
 	bool KeywordList::KeywordExists(const char * const enumtype, const std::string & kw) {
 		int typenum = enum2index(enumtype);
-		int i = 0;
-		int maxIndexInCategory = MaxIndex( enumtype ); 
-		for ( ; i <= maxIndexInCategory; ++i ) {
-			std::string keywords = allKeywords(typenum, i);
-			if (keywords == INVALID_KEYWORD_INDEX_STRING)
-				continue;
-			std::stringstream strm(keywords);
-			int j = 0;
-			std::string kws;
-			while (strm >> kws) {
-				if (kws == kw) {
-					return true; // keyword exists
-				}
-				++j;
-			}
-		}
-		return false; // nothing found keyword doesn't exist.
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type '%1'.")
+				.arg(enumtype), "[KeywordList::KeywordExists]");
+		return findKeyword(typenum, kw) != nullptr;
+	}
+
+	bool KeywordList::KeywordExists(unsigned int categoryHash, const std::string & kw) {
+		int typenum = hash2index(categoryHash);
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type hash '%1'.")
+				.arg(categoryHash), "[KeywordList::KeywordExists]");
+		return findKeyword(typenum, kw) != nullptr;
 	}
 
 	int KeywordList::Enumeration(const char * const enumtype, const std::string & kw, bool * deprecated) {
 		int typenum = enum2index(enumtype);
-		int i = 0;
-		int maxIndexInCategory = MaxIndex( enumtype ); 
-		for ( ; i <= maxIndexInCategory; ++i ) {
-			std::string keywords = allKeywords(typenum, i);
-			if (keywords == INVALID_KEYWORD_INDEX_STRING)
-				continue;
-			std::stringstream strm(keywords);
-			int j = 0;
-			std::string kws;
-			while (strm >> kws) {
-				if (kws == kw) {
-					if (deprecated != nullptr) {
-						*deprecated = (j != 0);
-					}
-					return i;
-				}
-				++j;
-			}
-		} // for ( ; i < maxIndexInCategory; ++i ) {
-		throw IBK::Exception(IBK::FormatString("Cannot determine enumeration value for "
-			"enumeration type '%1' and keyword '%2'.")
-			.arg(enumtype).arg(kw), "[KeywordList::Enumeration]");
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type '%1'.")
+				.arg(enumtype), "[KeywordList::Enumeration]");
+		const KeywordTableEntry * entry = findKeyword(typenum, kw);
+		if (entry == nullptr)
+			throw IBK::Exception(IBK::FormatString("Cannot determine enumeration value for "
+				"enumeration type '%1' and keyword '%2'.")
+				.arg(enumtype).arg(kw), "[KeywordList::Enumeration]");
+		if (deprecated != nullptr)
+			*deprecated = entry->deprecated;
+		return entry->index;
+	}
+
+	int KeywordList::Enumeration(unsigned int categoryHash, const std::string & kw, bool * deprecated) {
+		int typenum = hash2index(categoryHash);
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type hash '%1'.")
+				.arg(categoryHash), "[KeywordList::Enumeration]");
+		const KeywordTableEntry * entry = findKeyword(typenum, kw);
+		if (entry == nullptr)
+			throw IBK::Exception(IBK::FormatString("Cannot determine enumeration value for "
+				"enumeration type '%1' and keyword '%2'.")
+				.arg(ENUM_TYPES[typenum]).arg(kw), "[KeywordList::Enumeration]");
+		if (deprecated != nullptr)
+			*deprecated = entry->deprecated;
+		return entry->index;
 	}
 
 	bool KeywordList::CategoryExists(const char * const enumtype) {
@@ -46,6 +46,7 @@
 #include <NANDRAD_SimulationParameter.h>
 
 #include "NM_KeywordList.h"
+#include "NM_SharedInputData.h"
 
 #include <CCM_Defines.h>  // include this last, since here we have defines that would otherwise conflict with included files
 
@@ -58,7 +59,7 @@ inline bool nearlyEqual(double a, double b, double eps = 1e-5) {
 // *** Loads ***
 
 void Loads::setup(const NANDRAD::Location & location, const NANDRAD::SimulationParameter &simPara,
-	const std::map<std::string, IBK::Path> & pathPlaceHolders)
+	const std::map<std::string, IBK::Path> & pathPlaceHolders, SharedInputData * sharedInputData)
 {
 	FUNCID(Loads::setup);
 
@@ -69,8 +70,14 @@ void Loads::setup(const NANDRAD::Location & location, const NANDRAD::SimulationP
 		IBK::Path climateFile = IBK::Path(location.m_climateFilePath).withReplacedPlaceholders(pathPlaceHolders);
 
 		try {
-			IBK::IBK_Message(IBK::FormatString("Reading climate data file '%1'\n").arg(climateFile), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
-			m_solarRadiationModel.m_climateDataLoader.readClimateData(climateFile);
+			if (sharedInputData != nullptr) {
+				// copy parsed data, since the climate data loader holds the interpolation state
+				m_solarRadiationModel.m_climateDataLoader = *sharedInputData->climateData(climateFile);
+			}
+			else {
+				IBK::IBK_Message(IBK::FormatString("Reading climate data file '%1'\n").arg(climateFile), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+				m_solarRadiationModel.m_climateDataLoader.readClimateData(climateFile);
+			}
 
 			// check for valid columns in climate data file
 			// TODO : we need to find out which climate data is referenced!
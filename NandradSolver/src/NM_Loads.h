@@ -41,6 +41,7 @@ namespace NANDRAD {
 
 namespace NANDRAD_MODEL {
 
+class SharedInputData;
 
 /*! Provides access to climatic loads.
 	Note that Loads only provides time-dependent results and therefore defines all values
@@ -99,9 +100,10 @@ public:
 		This function checks for parameters.
 		\param location Location data.
 		\param pathPlaceHolders Path placeholders to resolve path to climate data
+		\param sharedInputData If not nullptr, climate data is taken from this cache instead of reading the file.
 	*/
 	void setup(const NANDRAD::Location & location, const NANDRAD::SimulationParameter &simPara,
-				const std::map<std::string, IBK::Path> & pathPlaceHolders) ;
+				const std::map<std::string, IBK::Path> & pathPlaceHolders, SharedInputData * sharedInputData = nullptr) ;
 
 
 	// *** Re-implemented from AbstractModel
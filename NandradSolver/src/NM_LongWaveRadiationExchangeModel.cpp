@@ -0,0 +1,228 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NM_LongWaveRadiationExchangeModel.h"
+
+#include <IBK_assert.h>
+#include <IBK_Exception.h>
+#include <IBK_physics.h>
+
+#include <IBKMK_DenseMatrix.h>
+
+#include <NANDRAD_ConstructionInstance.h>
+
+#include "NM_ConstructionStatesModel.h"
+#include "NM_KeywordList.h"
+
+namespace NANDRAD_MODEL {
+
+void LongWaveRadiationExchangeModel::setup(const std::vector<const NANDRAD::ConstructionInstance *> & constructionInstances,
+										   bool exactRadiosity)
+{
+	FUNCID(LongWaveRadiationExchangeModel::setup);
+
+	// collect all surfaces facing this zone
+	std::vector<const NANDRAD::Interface *> interfaces;
+	std::vector<double> areas;
+	std::vector<double> eps;
+	for (const NANDRAD::ConstructionInstance * ci : constructionInstances) {
+		bool sideA = ci->m_interfaceA.m_zoneId == m_id &&
+				ci->m_interfaceA.m_longWaveEmission.m_modelType != NANDRAD::InterfaceLongWaveEmission::NUM_MT;
+		bool sideB = ci->m_interfaceB.m_zoneId == m_id &&
+				ci->m_interfaceB.m_longWaveEmission.m_modelType != NANDRAD::InterfaceLongWaveEmission::NUM_MT;
+		// results are accessed via construction instance ID, hence each construction may only face the zone once
+		if (sideA && sideB)
+			throw IBK::Exception(IBK::FormatString("Construction instance #%1 '%2' faces zone #%3 with both interfaces, which is not "
+												   "supported for long wave radiation exchange.")
+								 .arg(ci->m_id).arg(ci->m_displayName).arg(m_id), FUNC_ID);
+		if (!sideA && !sideB)
+			continue;
+		const NANDRAD::Interface & iface = sideA ? ci->m_interfaceA : ci->m_interfaceB;
+		m_constructionIds.push_back(ci->m_id);
+		m_sideA.push_back(sideA);
+		interfaces.push_back(&iface);
+		areas.push_back(ci->m_netHeatTransferArea);
+		eps.push_back(iface.m_longWaveEmission.m_para[NANDRAD::InterfaceLongWaveEmission::P_Emissivity].value);
+	}
+
+	unsigned int n = (unsigned int)m_constructionIds.size();
+	m_surfaceTemperatureRefs.resize(n, nullptr);
+	m_emissions.resize(n, 0);
+	m_results = VectorValuedQuantity(m_constructionIds, 0);
+	m_coefficients.resize(n*n, 0);
+	if (n == 0)
+		return;
+
+	// view factor matrix, F(i,j) is the view factor from surface i to surface j
+	// Note: view factors to windows are ignored, see class documentation
+	IBKMK::DenseMatrix F(n, 0);
+	for (unsigned int i=0; i<n; ++i) {
+		for (unsigned int j=0; j<n; ++j) {
+			if (i == j)
+				continue;
+			std::map<unsigned int, double>::const_iterator it = interfaces[i]->m_viewFactors.find(m_constructionIds[j]);
+			if (it != interfaces[i]->m_viewFactors.end())
+				F(i,j) = it->second;
+		}
+	}
+
+	if (!exactRadiosity) {
+		// net exchange approximation:
+		//   emitted by i:   sum_j eps_i * eps_j * F_ij * E_i
+		//   absorbed by i:  sum_j A_j/A_i * eps_j * eps_i * F_ji * E_j
+		for (unsigned int i=0; i<n; ++i) {
+			double * row = &m_coefficients[i*n];
+			for (unsigned int j=0; j<n; ++j) {
+				if (i == j)
+					continue;
+				row[j] = areas[j]/areas[i] * F(j,i) * eps[j] * eps[i];
+				row[i] -= F(i,j) * eps[i] * eps[j];
+			}
+		}
+	}
+	else {
+		// gray-body radiosity method:
+		//   (I - (1-eps)*F) * J = eps * E    and    q = F*J - J
+		// we solve for the radiosities resulting from unit emissions of each surface, i.e. X = (I - (1-eps)*F)^-1 * eps,
+		// and compose C = (F - I) * X
+		// The radiosity method requires a closed enclosure. Since windows are not part of the exchange, we scale the
+		// view factors of each surface such that they sum up to 1 (otherwise the missing part would act as a black sink).
+		for (unsigned int i=0; i<n; ++i) {
+			double sumF = 0;
+			for (unsigned int j=0; j<n; ++j)
+				sumF += F(i,j);
+			if (sumF > 0)
+				for (unsigned int j=0; j<n; ++j)
+					F(i,j) /= sumF;
+		}
+		IBKMK::DenseMatrix M(n, 0);
+		for (unsigned int i=0; i<n; ++i) {
+			for (unsigned int j=0; j<n; ++j)
+				M(i,j) = -(1 - eps[i])*F(i,j);
+			M(i,i) += 1;
+		}
+		if (M.lu() != 0)
+			throw IBK::Exception(IBK::FormatString("Radiosity equation system for zone #%1 '%2' is singular, check view factors and emissivities.")
+								 .arg(m_id).arg(m_displayName), FUNC_ID);
+		IBKMK::DenseMatrix X(n, 0);
+		std::vector<double> b(n);
+		for (unsigned int k=0; k<n; ++k) {
+			std::fill(b.begin(), b.end(), 0);
+			b[k] = eps[k];
+			M.backsolve(&b[0]);
+			for (unsigned int j=0; j<n; ++j)
+				X(j,k) = b[j];
+		}
+		for (unsigned int i=0; i<n; ++i) {
+			double * row = &m_coefficients[i*n];
+			for (unsigned int k=0; k<n; ++k) {
+				double c = -X.value(i,k);
+				for (unsigned int j=0; j<n; ++j)
+					c += F.value(i,j)*X.value(j,k);
+				row[k] = c;
+			}
+		}
+	}
+}
+
+
+void LongWaveRadiationExchangeModel::resultDescriptions(std::vector<QuantityDescription> & resDesc) const {
+	QuantityDescription res;
+	res.m_constant = false;
+	res.m_referenceType = NANDRAD::ModelInputReference::MRT_ZONE;
+	res.m_id = m_id;
+	res.m_description = NANDRAD_MODEL::KeywordList::Description("LongWaveRadiationExchangeModel::VectorValuedResults", VVR_NetLongWaveRadiationFluxDensity);
+	res.m_name = NANDRAD_MODEL::KeywordList::Keyword("LongWaveRadiationExchangeModel::VectorValuedResults", VVR_NetLongWaveRadiationFluxDensity);
+	res.m_unit = NANDRAD_MODEL::KeywordList::Unit("LongWaveRadiationExchangeModel::VectorValuedResults", VVR_NetLongWaveRadiationFluxDensity);
+	res.m_indexKeys = m_constructionIds; // id of absorbing construction instance
+	res.m_indexKeyType = VectorValuedQuantityIndex::IK_ModelID;
+	resDesc.push_back(res);
+}
+
+
+const double * LongWaveRadiationExchangeModel::resultValueRef(const InputReference & quantity) const {
+	const QuantityName & quantityName = quantity.m_name;
+	if (quantityName.m_name != NANDRAD_MODEL::KeywordList::Keyword("LongWaveRadiationExchangeModel::VectorValuedResults", VVR_NetLongWaveRadiationFluxDensity))
+		return nullptr;
+	if (m_constructionIds.empty())
+		return nullptr;
+	// no index is given (requesting entire vector?)
+	if (quantityName.m_index == -1)
+		return &m_results.data()[0];
+	// Note: function may throw an IBK::Exception if the requested index is out of range
+	return &m_results[(unsigned int)quantityName.m_index];
+}
+
+
+void LongWaveRadiationExchangeModel::inputReferences(std::vector<InputReference> & inputRefs) const {
+	for (unsigned int i=0; i<m_constructionIds.size(); ++i) {
+		InputReference ref;
+		ref.m_id = m_constructionIds[i];
+		ref.m_referenceType = NANDRAD::ModelInputReference::MRT_CONSTRUCTIONINSTANCE;
+		ref.m_name.m_name = NANDRAD_MODEL::KeywordList::Keyword("ConstructionStatesModel::Results",
+			m_sideA[i] ? ConstructionStatesModel::R_SurfaceTemperatureA : ConstructionStatesModel::R_SurfaceTemperatureB);
+		ref.m_required = true;
+		inputRefs.push_back(ref);
+	}
+}
+
+
+void LongWaveRadiationExchangeModel::setInputValueRefs(const std::vector<QuantityDescription> &,
+													   const std::vector<const double *> & resultValueRefs)
+{
+	IBK_ASSERT(m_surfaceTemperatureRefs.size() == resultValueRefs.size());
+	m_surfaceTemperatureRefs = resultValueRefs;
+}
+
+
+void LongWaveRadiationExchangeModel::stateDependencies(std::vector<std::pair<const double *, const double *> > & resultInputValueReferences) const {
+	// each net flux depends on all surface temperatures with non-zero coefficient
+	unsigned int n = (unsigned int)m_constructionIds.size();
+	for (unsigned int i=0; i<n; ++i) {
+		for (unsigned int j=0; j<n; ++j) {
+			if (m_coefficients[i*n + j] != 0.0)
+				resultInputValueReferences.push_back(std::make_pair(&m_results.data()[i], m_surfaceTemperatureRefs[j]));
+		}
+	}
+}
+
+
+int LongWaveRadiationExchangeModel::update() {
+	unsigned int n = (unsigned int)m_constructionIds.size();
+	// black body emissions of all surfaces
+	for (unsigned int j=0; j<n; ++j) {
+		double T = *m_surfaceTemperatureRefs[j];
+		double T2 = T*T;
+		m_emissions[j] = IBK::BOLTZMANN*T2*T2;
+	}
+	// net absorbed flux densities
+	double * q = m_results.dataPtr();
+	const double * c = m_coefficients.data();
+	for (unsigned int i=0; i<n; ++i, c += n) {
+		double sum = 0;
+		for (unsigned int j=0; j<n; ++j)
+			sum += c[j]*m_emissions[j];
+		q[i] = sum;
+	}
+	return 0; // signal success
+}
+
+} // namespace NANDRAD_MODEL
@@ -0,0 +1,137 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NM_LongWaveRadiationExchangeModelH
+#define NM_LongWaveRadiationExchangeModelH
+
+#include "NM_AbstractModel.h"
+#include "NM_AbstractStateDependency.h"
+#include "NM_VectorValuedQuantity.h"
+
+namespace NANDRAD {
+	class ConstructionInstance;
+}
+
+namespace NANDRAD_MODEL {
+
+/*! Computes the long wave radiation exchange between all inside surfaces of a zone.
+
+	The model is set up once per zone and holds a dense coefficient matrix C, such that the net
+	long wave radiation flux density absorbed by each surface is obtained from the vector of black body
+	emissions E_j = sigma * T_j^4 of all surfaces with a single matrix-vector product:
+
+	\code
+	q_i = sum_j C_ij * E_j
+	\endcode
+
+	The matrix is composed during setup() from view factors, emissivities and surface areas. Two methods
+	are supported:
+	- net exchange approximation (default): each surface emits eps_i * eps_j * F_ij * E_i towards surface j,
+	  the reflected radiation is neglected
+	- exact gray-body radiosity method (flag ExactLongWaveRadiationExchange in simulation parameters): radiosities
+	  J = eps * E + (1 - eps) * F * J are solved during setup for unit emissions, so that C = (F - I) * (I - (1-eps)*F)^-1 * eps;
+	  since this requires a closed enclosure, the view factors of each surface are scaled to sum up to 1
+
+	\note Windows are not yet included in the long wave radiation exchange, the radiation emitted towards windows
+		(view factors between constructions and embedded objects) is lost.
+*/
+class LongWaveRadiationExchangeModel : public AbstractModel, public AbstractStateDependency {
+public:
+	/*! Computed results, provided with access via construction instance ID. */
+	enum VectorValuedResults {
+		VVR_NetLongWaveRadiationFluxDensity,	// Keyword: NetLongWaveRadiationFluxDensity		[W/m2]	'Net absorbed long wave radiation flux density of inside surfaces (positive into surface).'
+		NUM_VVR
+	};
+
+	/*! Constructor. */
+	LongWaveRadiationExchangeModel(unsigned int id, const std::string &displayName) :
+		m_id(id), m_displayName(displayName)
+	{
+	}
+
+	/*! Initializes model.
+		\param constructionInstances Construction instances with at least one interface to this zone and long
+			wave emission model. checkAndPrepareLongWaveHeatExchange() must have been called on all instances before.
+		\param exactRadiosity If true, the gray-body radiosity method is used instead of the net exchange approximation.
+	*/
+	void setup(const std::vector<const NANDRAD::ConstructionInstance *> & constructionInstances, bool exactRadiosity);
+
+	// *** Re-implemented from AbstractModel
+
+	/*! Net long wave radiation fluxes can be requested via zone reference. */
+	virtual NANDRAD::ModelInputReference::referenceType_t referenceType() const override {
+		return NANDRAD::ModelInputReference::MRT_ZONE;
+	}
+
+	/*! Return unique class ID name of implemented model. */
+	virtual const char * ModelIDName() const override { return "LongWaveRadiationExchangeModel"; }
+
+	/*! Returns unique ID of this model instance (the zone ID). */
+	virtual unsigned int id() const override { return m_id; }
+
+	/*! Populates the vector resDesc with descriptions of all results provided by this model. */
+	virtual void resultDescriptions(std::vector<QuantityDescription> & resDesc) const override;
+
+	/*! Retrieves reference pointer to a value with given input reference name. */
+	virtual const double * resultValueRef(const InputReference & quantity) const override;
+
+
+	// *** Re-implemented from AbstractStateDependency
+
+	/*! Returns vector with model input references (surface temperatures of all surfaces). */
+	virtual void inputReferences(std::vector<InputReference>  & inputRefs) const override;
+
+	/*! Provides the object with references to requested input variables (persistent memory location). */
+	virtual void setInputValueRefs(const std::vector<QuantityDescription> &,
+								   const std::vector<const double *> & resultValueRefs) override;
+
+	/*! Returns dependencies between result variables and input variables. */
+	virtual void stateDependencies(std::vector< std::pair<const double *, const double *> > & resultInputValueReferences) const override;
+
+	/*! Computes net long wave radiation flux densities of all surfaces. */
+	int update() override;
+
+private:
+	/*! Model instance ID (zone ID). */
+	unsigned int									m_id;
+	/*! Display name (for error messages). */
+	std::string										m_displayName;
+
+	/*! Construction instance IDs of all surfaces, also index keys of the result vector. */
+	std::vector<unsigned int>						m_constructionIds;
+	/*! For each surface, true if interface A of the construction faces the zone. */
+	std::vector<bool>								m_sideA;
+
+	/*! Coefficient matrix, maps black body emissions to net absorbed flux densities (dense, row-major, size n*n). */
+	std::vector<double>								m_coefficients;
+
+	/*! Value references to surface temperatures in [K]. */
+	std::vector<const double *>						m_surfaceTemperatureRefs;
+	/*! Black body emissions sigma * T^4 in [W/m2], cached during update(). */
+	std::vector<double>								m_emissions;
+
+	/*! Net absorbed long wave radiation flux densities in [W/m2], index key is construction instance ID. */
+	VectorValuedQuantity							m_results;
+};
+
+} // namespace NANDRAD_MODEL
+
+#endif // NM_LongWaveRadiationExchangeModelH
@@ -26,6 +26,7 @@
 #endif // _OPENMP
 
 #include <memory>
+#include <algorithm>
 
 #include <IBK_Version.h>
 #include <IBK_messages.h>
@@ -45,6 +46,7 @@
 #include <SOLFRA_IntegratorImplicitEuler.h>
 #include <SOLFRA_JacobianSparseCSR.h>
 #include <SOLFRA_Constants.h>
+#include <SOLFRA_Profiler.h>
 
 #include <sundials/sundials_config.h>
 #include <sundials/sundials_timer.h>
@@ -55,6 +57,7 @@
 #include <SOLFRA_LESKLU.h>
 #include <SOLFRA_PrecondILU.h>
 #include <SOLFRA_PrecondILUT.h>
+#include <SOLFRA_PrecondBlock.h>
 
 #ifdef IBK_STATISTICS
 #define NANDRAD_TIMER_TIMEDEPENDENT 11
@@ -64,7 +67,6 @@
 #define NANDRAD_TIMER_UPDATE_ODEMODELS 15
 #define NANDRAD_TIMER_UPDATE_MODELGROUPS 16
 #define NANDRAD_TIMER_UPDATE_MODELS 17
-#define NANDRAD_TIMER_YDOT 18
 #endif
 
 // Models
@@ -80,6 +82,7 @@
 #include "NM_OutputHandler.h"
 #include "NM_ConstructionStatesModel.h"
 #include "NM_ConstructionBalanceModel.h"
+#include "NM_LongWaveRadiationExchangeModel.h"
 #include "NM_NaturalVentilationModel.h"
 #include "NM_InternalLoadsModel.h"
 #include "NM_InternalMoistureLoadsModel.h"
@@ -97,6 +100,7 @@
 #include "NM_ThermalNetworkStatesModel.h"
 #include "NM_ThermalNetworkBalanceModel.h"
 #include "NM_ThermalComfortModel.h"
+#include "NM_SharedInputData.h"
 
 namespace NANDRAD_MODEL {
 
@@ -109,7 +113,7 @@ NandradModel::NandradModel() :
 NandradModel::~NandradModel() {
 	// final flush of outputs - only needed in case of solver crash or manual abort
 	if (m_outputHandler != nullptr)
-		m_outputHandler->flushCache();
+		m_outputHandler->flushCache(true);
 
 	// free memory of owned instances
 	delete m_project;
@@ -223,6 +227,8 @@ void NandradModel::init(const NANDRAD::ArgsParser & args) {
 	initModelDependencies();
 	// *** Setup states model graph and generate model groups ***
 	initModelGraph();
+	// *** Register profiler counters for all models ***
+	initProfilerCounters();
 	// *** Initialize list with output references ***
 	initOutputReferenceList();
 	// *** Initialize Global Solver ***
@@ -382,8 +388,9 @@ void NandradModel::writeFinalOutputs() {
 	if (m_outputHandler == nullptr)
 		return;
 	SUNDIALS_TIMED_FUNCTION( SUNDIALS_TIMER_WRITE_OUTPUTS,
-		m_outputHandler->flushCache();
+		m_outputHandler->flushCache(true);
 	);
+	m_outputHandler->writeThinningStatistics();
 }
 
 
@@ -438,8 +445,7 @@ SOLFRA::LESInterface * NandradModel::lesInterface() {
 
 		// KLU
 		case NANDRAD::SolverParameter::LES_KLU: {
-			SOLFRA::JacobianSparseCSR *jacSparse = new SOLFRA::JacobianSparseCSR(n(), nnz(), &m_ia[0], &m_ja[0],
-				&m_iaT[0], &m_jaT[0]);
+			SOLFRA::JacobianSparseCSR *jacSparse = createJacobianSparse();
 			m_jacobian = jacSparse;
 			// create KLU solver
 			m_lesSolver = new SOLFRA::LESKLU;
@@ -473,8 +479,7 @@ SOLFRA::LESInterface * NandradModel::lesInterface() {
 		// ILU preconditioner
 		case NANDRAD::SolverParameter::PRE_ILU : {
 			// work with a sparse jacobian
-			SOLFRA::JacobianSparseCSR *jacSparse = new SOLFRA::JacobianSparseCSR(n(), nnz(), &m_ia[0], &m_ja[0],
-				&m_iaT[0], &m_jaT[0]);
+			SOLFRA::JacobianSparseCSR *jacSparse = createJacobianSparse();
 
 			m_jacobian = jacSparse;
 
@@ -493,6 +498,29 @@ SOLFRA::LESInterface * NandradModel::lesInterface() {
 			}
 		} break;
 
+		// block preconditioner
+		case NANDRAD::SolverParameter::PRE_Block : {
+			// work with a sparse jacobian
+			SOLFRA::JacobianSparseCSR *jacSparse = createJacobianSparse();
+
+			m_jacobian = jacSparse;
+
+			// each construction forms a tridiagonal block, zone and network states are treated together
+			// Note: reduced construction models have dense blocks (modal coupling), these are not tridiagonal;
+			//       we treat their unknowns together with zone and network states, where the ILU factorization
+			//       of the dense block is exact
+			std::vector<unsigned int> blockOffsets;
+			std::vector<unsigned int> blockSizes;
+			for (unsigned int i=0; i<m_nWalls; ++i) {
+				if (m_constructionStatesModelContainer[i]->isReduced())
+					continue;
+				blockOffsets.push_back(m_constructionVariableOffset[i]);
+				blockSizes.push_back(m_constructionStatesModelContainer[i]->nPrimaryStateResults());
+			}
+			m_preconditioner = new SOLFRA::PrecondBlock(SOLFRA::PrecondInterface::Right, blockOffsets, blockSizes);
+			precondName = IBK::FormatString("Block preconditioner (%1 construction blocks)").arg(blockSizes.size()).str();
+		} break;
+
 		// no preconditioner
 		case NANDRAD::SolverParameter::NUM_PRE : ;
 	}
@@ -503,6 +531,7 @@ SOLFRA::LESInterface * NandradModel::lesInterface() {
 	// set iterative LES solver options
 	lesIter->m_maxKrylovDim = m_project->m_solverParameter.m_intPara[NANDRAD::SolverParameter::IP_MaxKrylovDim].toUInt();
 	lesIter->m_linIterConvCoeff = m_project->m_solverParameter.m_para[NANDRAD::SolverParameter::P_IterativeSolverConvCoeff].value;
+	lesIter->m_matrixFreeJacTimesVec = m_project->m_solverParameter.m_flag[NANDRAD::SolverParameter::F_JacobianFreeNewtonKrylov].isEnabled();
 
 	IBK_Message(IBK::FormatString("%1 selected, MaxKrylovDim = %2\n")
 		.arg(precondName).arg(lesIter->m_maxKrylovDim),  IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
@@ -516,6 +545,16 @@ SOLFRA::JacobianInterface *  NandradModel::jacobianInterface() {
 }
 
 
+SOLFRA::JacobianSparseCSR * NandradModel::createJacobianSparse() const {
+	SOLFRA::JacobianSparseCSR *jacSparse = new SOLFRA::JacobianSparseCSR(n(), nnz(), &m_ia[0], &m_ja[0],
+		&m_iaT[0], &m_jaT[0]);
+	// variants with identical model structure share the same Jacobian pattern, so we can re-use the coloring
+	if (m_sharedInputData != nullptr)
+		jacSparse->setColors(*m_sharedInputData->jacobianColors(m_ia, m_ja, m_iaT, m_jaT));
+	return jacSparse;
+}
+
+
 SOLFRA::IntegratorInterface * NandradModel::integratorInterface() {
 	FUNCID(NandradModel::integratorInterface);
 
@@ -690,12 +729,7 @@ void NandradModel::writeMetrics(double simtime, std::ostream * metricsFile) {
 		.arg(tModelsUpdate / simtime * 100, 5, 'f', 2)
 		.arg(m_nModelsUpdate, 8),
 		IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
-	double tYdot = TimerSum(NANDRAD_TIMER_YDOT);
-	IBK::IBK_Message(IBK::FormatString("Nandrad model: Ydot calls                  = %1 (%2 %%)  %3\n")
-		.arg(IBK::Time::format_time_difference(tYdot, ustr, true), 13)
-		.arg(tYdot / simtime * 100, 5, 'f', 2)
-		.arg(m_nYdotCalls, 8),
-		IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	// Note: balance models compute their divergences in update() and are included in "Models update"
 #endif
 }
 
@@ -705,17 +739,11 @@ void NandradModel::writeMetrics(double simtime, std::ostream * metricsFile) {
 
 double NandradModel::nextOutputTime(double t) {
 
-	// loop over all defined output grids and search for next scheduled output
-	double tOutNext = std::numeric_limits<double>::max(); // largest possible value
-
 	// get time including start offset, since output intervals are defined in terms of absolute time reference
 	double tWithStartOffset = t + m_project->m_simulationParameter.m_interval.m_para[NANDRAD::Interval::P_Start].value;
 
-	for (std::vector<NANDRAD::OutputGrid>::const_iterator it = m_project->m_outputs.m_grids.begin();
-		 it != m_project->m_outputs.m_grids.end(); ++it)
-	{
-		tOutNext = std::min(tOutNext, it->computeNextOutputTime(tWithStartOffset));
-	}
+	// ask output handler for next scheduled output of all output grids
+	double tOutNext = m_outputHandler->nextOutputTime(tWithStartOffset);
 
 	// convert tOutNext back to simulation time by subtracting offset
 	return tOutNext - m_project->m_simulationParameter.m_interval.m_para[NANDRAD::Interval::P_Start].value;
@@ -809,6 +837,9 @@ void NandradModel::initSolverParameter(const NANDRAD::ArgsParser & args) {
 					NANDRAD::KeywordList::Keyword("SolverParameter::intPara_t", NANDRAD::SolverParameter::IP_PreILUWidth),
 					(int)args.m_preconditionerOption);
 		}
+		else if (IBK::toupper_string(args.m_preconditionerName) == "BLOCK") {
+			solverParameter.m_preconditioner = NANDRAD::SolverParameter::PRE_Block;
+		}
 		else {
 			throw IBK::Exception( IBK::FormatString("Unknown/unsupported preconditioner '%1'.").arg(args.m_preconditionerName), FUNC_ID);
 		}
@@ -919,7 +950,7 @@ void NandradModel::initClimateData() {
 		// insert into time model container
 		m_timeModelContainer.push_back(m_loads);
 
-		m_loads->setup(m_project->m_location, m_project->m_simulationParameter, m_project->m_placeholders);
+		m_loads->setup(m_project->m_location, m_project->m_simulationParameter, m_project->m_placeholders, m_sharedInputData);
 	}
 	catch (IBK::Exception & ex) {
 		throw IBK::Exception(ex, IBK::FormatString("Error initializing climatic loads model."), FUNC_ID);
@@ -1034,7 +1065,7 @@ void NandradModel::initZones() {
 				}
 
 				// also remember this model in the container with room state models m_roomBalanceModelContainer
-				// because we need to call ydot().
+				// because we need to redirect its ydot storage into the global ydot vector.
 				m_roomBalanceModelContainer.push_back(roomBalanceModel);
 				// and register model for evaluation
 				registerStateDependendModel(roomBalanceModel);
@@ -1228,7 +1259,7 @@ void NandradModel::initWallsAndInterfaces() {
 			// register model for evaluation
 			registerStateDependendModel(balanceModel);
 
-			// remember model in balance container, so that we can call ydot(ydot)
+			// remember model in balance container, so that we can redirect its ydot storage
 			m_constructionBalanceModelContainer.push_back(balanceModel);
 
 
@@ -1266,6 +1297,47 @@ void NandradModel::initWallsAndInterfaces() {
 
 	}
 	m_nWalls = (unsigned int) m_constructionBalanceModelContainer.size();
+
+	// *** long wave radiation exchange models ***
+
+	// collect all construction instances with inside long wave radiation exchange per zone (keep order of first appearance)
+	std::vector<unsigned int> lwZoneIds;
+	std::map<unsigned int, std::vector<const NANDRAD::ConstructionInstance *> > lwConstructionInstances;
+	for (const NANDRAD::ConstructionInstance & ci : m_project->m_constructionInstances) {
+		const NANDRAD::Interface * ifaces[2] = { &ci.m_interfaceA, &ci.m_interfaceB };
+		for (const NANDRAD::Interface * iface : ifaces) {
+			if (iface->m_id == NANDRAD::INVALID_ID || iface->m_zoneId == 0 ||
+				iface->m_longWaveEmission.m_modelType == NANDRAD::InterfaceLongWaveEmission::NUM_MT)
+			{
+				continue;
+			}
+			std::vector<const NANDRAD::ConstructionInstance *> & cis = lwConstructionInstances[iface->m_zoneId];
+			if (cis.empty())
+				lwZoneIds.push_back(iface->m_zoneId);
+			if (std::find(cis.begin(), cis.end(), &ci) == cis.end())
+				cis.push_back(&ci);
+		}
+	}
+	bool exactRadiosity = m_project->m_simulationParameter.m_flags[NANDRAD::SimulationParameter::F_ExactLongWaveRadiationExchange].isEnabled();
+	for (unsigned int zoneId : lwZoneIds) {
+		const NANDRAD::Zone * zone = nullptr;
+		for (const NANDRAD::Zone & z : m_project->m_zones)
+			if (z.m_id == zoneId) {
+				zone = &z;
+				break;
+			}
+		IBK_ASSERT(zone != nullptr); // zone IDs have been checked already
+		LongWaveRadiationExchangeModel * lwModel = new LongWaveRadiationExchangeModel(zoneId, zone->m_displayName);
+		m_modelContainer.push_back(lwModel); // transfer ownership
+		try {
+			lwModel->setup(lwConstructionInstances[zoneId], exactRadiosity);
+		}
+		catch (IBK::Exception & ex) {
+			throw IBK::Exception(ex, IBK::FormatString("Error initializing long wave radiation exchange model for zone #%1 '%2'.")
+								 .arg(zoneId).arg(zone->m_displayName), FUNC_ID);
+		}
+		registerStateDependendModel(lwModel);
+	}
 	IBK::IBK_Message( IBK::FormatString("%1 construction models.\n").arg(m_nZones), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_INFO);
 
 }
@@ -2205,6 +2277,57 @@ void NandradModel::initModelGraph() {
 }
 
 
+void NandradModel::initProfilerCounters() {
+	SOLFRA::Profiler & profiler = SOLFRA::Profiler::instance();
+
+	// composes counter name and category (model type) for a model object
+	auto registerModelCounter = [&profiler](const AbstractModel * model) -> unsigned int {
+		if (model == nullptr)
+			return profiler.registerCounter("unnamed", "Other");
+		std::string name = IBK::FormatString("#%1").arg(model->id()).str();
+		if (model->displayName()[0] != '\0')
+			name += std::string(" '") + model->displayName() + "'";
+		std::string category = model->ModelIDName();
+		if (category.empty())
+			category = "Other";
+		return profiler.registerCounter(name, category);
+	};
+
+	m_timeModelProfilerCounterIds.clear();
+	for (AbstractTimeDependency * timeModel : m_timeModelContainer) {
+		// schedules are not an AbstractModel
+		if (timeModel == m_schedules)
+			m_timeModelProfilerCounterIds.push_back(profiler.registerCounter("Schedules", "Schedules"));
+		else
+			m_timeModelProfilerCounterIds.push_back(registerModelCounter(dynamic_cast<AbstractModel*>(timeModel)));
+	}
+
+	m_stateDependentProfilerCounterIds.clear();
+	for (const ParallelStateObjects & objs : m_orderedStateDependentSubModels) {
+		m_stateDependentProfilerCounterIds.push_back(std::vector<unsigned int>());
+		std::vector<unsigned int> & counterIds = m_stateDependentProfilerCounterIds.back();
+		for (AbstractStateDependency * obj : objs) {
+			StateModelGroup * group = dynamic_cast<StateModelGroup*>(obj);
+			if (group == nullptr) {
+				counterIds.push_back(registerModelCounter(dynamic_cast<AbstractModel*>(obj)));
+			}
+			else if (group->groupType() == ZEPPELIN::DependencyGroup::CYCLIC) {
+				// cyclic groups are solved iteratively and are profiled as a whole
+				std::string name = IBK::FormatString("Cyclic group with %1 models").arg(group->models().size()).str();
+				counterIds.push_back(profiler.registerCounter(name, "CyclicModelGroup"));
+			}
+			else {
+				// sequential groups record times of their models individually
+				counterIds.push_back(SOLFRA::Profiler::NO_COUNTER);
+				group->m_profilerCounterIds.clear();
+				for (AbstractStateDependency * model : group->models())
+					group->m_profilerCounterIds.push_back(registerModelCounter(dynamic_cast<AbstractModel*>(model)));
+			}
+		}
+	}
+}
+
+
 void NandradModel::initOutputReferenceList() {
 	FUNCID(NandradModel::initOutputReferenceList);
 
@@ -2434,13 +2557,27 @@ void NandradModel::initSolverVariables() {
 
 	// m_n counts the number of unknowns
 	m_constructionVariableOffset.resize(m_nWalls);
+	unsigned int nReducedConstructions = 0;
+	unsigned int nReducedUnknowns = 0;
+	unsigned int nReducedElements = 0;
+	double maxReductionError = 0;
 	for (unsigned int i=0; i<m_nWalls; ++i) {
 		// store starting position inside y-vector
 		m_constructionVariableOffset[i] = m_n;
 		// number of unknowns/state variabes
 		unsigned int nUnknowns = m_constructionStatesModelContainer[i]->nPrimaryStateResults();
 		m_n += nUnknowns;
+		if (m_constructionStatesModelContainer[i]->isReduced()) {
+			++nReducedConstructions;
+			nReducedUnknowns += nUnknowns;
+			nReducedElements += m_constructionStatesModelContainer[i]->elementCount();
+			maxReductionError = std::max(maxReductionError, m_constructionStatesModelContainer[i]->reductionErrorEstimate());
+		}
 	}
+	if (nReducedConstructions != 0)
+		IBK::IBK_Message( IBK::FormatString("%1 of %2 construction models reduced from %3 to %4 unknowns, max. estimated surface temperature amplitude deviation %5 K/K\n")
+						  .arg(nReducedConstructions).arg(m_nWalls).arg(nReducedElements).arg(nReducedUnknowns).arg(maxReductionError, 0, 'g', 3),
+						  IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
 
 	// *** count number of unknowns in thermal networks and initialize wall offsets ***
 
@@ -2479,6 +2616,19 @@ void NandradModel::initSolverVariables() {
 	m_y0.resize(m_n);
 	m_ydot.resize(m_n);
 
+	// *** Redirect divergence storage of balance models into global ydot vector ***
+
+	// Balance models are evaluated as part of the model graph (in parallel if OpenMP is enabled) and
+	// now write their divergences directly into disjoint slices of m_ydot - no copy at the end of
+	// updateStateDependentModels() needed.
+	// Note: m_ydot must not be resized afterwards!
+	for (unsigned int i=0; i<m_nZones; ++i)
+		m_roomBalanceModelContainer[i]->setYdotTarget(&m_ydot[0] + m_zoneVariableOffset[i]);
+	for (unsigned int i=0; i<m_nWalls; ++i)
+		m_constructionBalanceModelContainer[i]->setYdotTarget(&m_ydot[0] + m_constructionVariableOffset[i]);
+	for (unsigned int i=0; i<m_nNetworks; ++i)
+		m_networkBalanceModelContainer[i]->setYdotTarget(&m_ydot[0] + m_networkVariableOffset[i]);
+
 	// *** Retrieve initial conditions ***
 	for (unsigned int i=0; i<m_nZones; ++i) {
 		m_roomStatesModelContainer[i]->yInitial(&m_y0[ m_zoneVariableOffset[i] ]);
@@ -3086,20 +3236,21 @@ void NandradModel::registerStateDependendModel(AbstractStateDependency *stateMod
 
 
 int NandradModel::updateTimeDependentModels() {
+	SOLFRA::ProfilerScope profile(SOLFRA::Profiler::P_TimeDependentModels);
+
 	// *** update time in all directly time dependend models ***
 
 	int calculationResultFlag = 0;
-	for (std::vector<AbstractTimeDependency*>::iterator it1 = m_timeModelContainer.begin();
-		it1 != m_timeModelContainer.end(); ++it1)
-	{
+	for (unsigned int i = 0; i < m_timeModelContainer.size(); ++i) {
+		SOLFRA::ProfilerScope profileModel(m_timeModelProfilerCounterIds[i]);
 #ifdef IBK_STATISTICS
 		// set time for all objects independently
 		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_SETTIME,
-			calculationResultFlag |= (*it1)->setTime(m_t)
+			calculationResultFlag |= m_timeModelContainer[i]->setTime(m_t)
 		);
 		++m_nSetTimeCalls;
 #else
-		calculationResultFlag |= (*it1)->setTime(m_t);
+		calculationResultFlag |= m_timeModelContainer[i]->setTime(m_t);
 #endif
 	}
 	if (calculationResultFlag != 0) {
@@ -3117,6 +3268,7 @@ int NandradModel::updateTimeDependentModels() {
 
 
 int NandradModel::updateStateDependentModels() {
+	SOLFRA::ProfilerScope profile(SOLFRA::Profiler::P_StateDependentModels);
 
 	// *** update global states (head models) ***
 
@@ -3162,6 +3314,7 @@ int NandradModel::updateStateDependentModels() {
 		// process all parallel object groups
 		for (unsigned int k = 0; k < m_orderedStateDependentSubModels.size(); ++k) {
 			ParallelStateObjects &parallelObjects = m_orderedStateDependentSubModels[k];
+			const std::vector<unsigned int> & profilerCounterIds = m_stateDependentProfilerCounterIds[k];
 
 	#pragma omp parallel
 			{
@@ -3169,6 +3322,7 @@ int NandradModel::updateStateDependentModels() {
 				int & calculationResultFlag = calculationResultFlags[omp_get_thread_num()];
 	#pragma omp for
 				for (int i = 0; i < (int)parallelObjects.size(); ++i) {
+					SOLFRA::ProfilerScope profileModel(profilerCounterIds[i]);
 					calculationResultFlag |= parallelObjects[i]->update();
 				} // end for
 
@@ -3193,9 +3347,11 @@ int NandradModel::updateStateDependentModels() {
 	if (m_useSerialCode) {
 		for (unsigned int k = 0; k < m_orderedStateDependentSubModels.size(); ++k) {
 			ParallelStateObjects &parallelObjects = m_orderedStateDependentSubModels[k];
+			const std::vector<unsigned int> & profilerCounterIds = m_stateDependentProfilerCounterIds[k];
 
 			// now begin parallel section
 			for (unsigned int i = 0; i < parallelObjects.size(); ++i) {
+				SOLFRA::ProfilerScope profileModel(profilerCounterIds[i]);
 
 #ifdef IBK_STATISTICS
 				if (parallelObjects[i]->m_modelTypeId & DefaultStateDependency::ODE) {
@@ -3228,61 +3384,7 @@ int NandradModel::updateStateDependentModels() {
 
 
 
-	// *** update ydot-values and store in (locally numbered) m_ydot vector***
-
-	// update states in all room state models
-	for (unsigned int i=0; i<m_roomBalanceModelContainer.size(); ++i) {
-#ifdef IBK_STATISTICS
-		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_YDOT,
-			calculationResultFlag |= m_roomBalanceModelContainer[i]->update();
-			calculationResultFlag |= m_roomBalanceModelContainer[i]->ydot(&m_ydot[0] + m_zoneVariableOffset[i]);
-		);
-#else
-		calculationResultFlag |= m_roomBalanceModelContainer[i]->ydot(&m_ydot[0] + m_zoneVariableOffset[i]);
-#endif
-	}
-	if (calculationResultFlag != 0) {
-		if (calculationResultFlag & 2)
-			return 2;
-		else
-			return 1;
-	}
-
-	// update states in all construction solver models
-	for (unsigned int i=0; i<m_constructionBalanceModelContainer.size(); ++i) {
-#ifdef IBK_STATISTICS
-		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_YDOT,
-			calculationResultFlag |= m_constructionBalanceModelContainer[i]->ydot(&m_ydot[0] + m_constructionVariableOffset[i]);
-		);
-		++m_nYdotCalls;
-#else
-		calculationResultFlag |= m_constructionBalanceModelContainer[i]->ydot(&m_ydot[0] + m_constructionVariableOffset[i]);
-#endif
-	}
-	if (calculationResultFlag != 0) {
-		if (calculationResultFlag & 2)
-			return 2;
-		else
-			return 1;
-	}
-
-	// update states in all thermal network models
-	for (unsigned int i=0; i<m_networkBalanceModelContainer.size(); ++i) {
-#ifdef IBK_STATISTICS
-		SUNDIALS_TIMED_FUNCTION(NANDRAD_TIMER_YDOT,
-			calculationResultFlag |= m_networkBalanceModelContainer[i]->ydot(&m_ydot[0] + m_networkVariableOffset[i]);
-		);
-		++m_nYdotCalls;
-#else
-		calculationResultFlag |= m_networkBalanceModelContainer[i]->ydot(&m_ydot[0] + m_networkVariableOffset[i]);
-#endif
-	}
-	if (calculationResultFlag != 0) {
-		if (calculationResultFlag & 2)
-			return 2;
-		else
-			return 1;
-	}
+	// Note: balance models have written their divergences directly into m_ydot (see initSolverVariables())
 
 	// mark solution as updated
 	m_yChanged = false;
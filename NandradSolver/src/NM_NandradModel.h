@@ -42,6 +42,10 @@ namespace NANDRAD {
 	class Project;
 }
 
+namespace SOLFRA {
+	class JacobianSparseCSR;
+}
+
 /*! The namespace NANDRAD_MODEL contains all classes/functions of the
 	NANDRAD command line solver. The central class is NandradModel, which implements
 	the integrator interface used by the SOLFRA integrator classes.
@@ -69,6 +73,7 @@ class ConstructionBalanceModel;
 
 class ThermalNetworkStatesModel;
 class ThermalNetworkBalanceModel;
+class SharedInputData;
 
 /*! Main NANDRAD model implementation class.
 	This class implements the interface of SOLFRA::ModelInterface and SOLFRA::OutputScheduler and contains
@@ -105,6 +110,14 @@ public:
 	/*! Returns solver/project directories, initialized in init(). */
 	const Directories & dirs() const { return m_dirs; }
 
+	/*! Returns project data, read in init(). */
+	const NANDRAD::Project & project() const { return *m_project; }
+
+	/*! Sets a cache for input data shared with other models in the same process (see BatchRunner).
+		Must be called before init(). The object is not owned by the model and must outlive it.
+	*/
+	void setSharedInputData(SharedInputData * sharedInputData) { m_sharedInputData = sharedInputData; }
+
 
 	// *** MEMBER FUNCTIONS REQUIRED BY SOLVER FRAMEWORK ***
 
@@ -287,6 +300,10 @@ private:
 		\param restart If true, the statistics file is opened in append mode.
 	*/
 	void initStatistics(SOLFRA::ModelInterface * modelInterface, bool restart);
+	/*! Registers profiler counters for all time-dependent models and all objects in the state dependency graph
+		(individual models in sequential groups, cyclic groups as a whole).
+	*/
+	void initProfilerCounters();
 	/*! Depending on model's priorityOfModelEvaluation() (-1 for unordered, or a number for
 		head/tail ordering) the model is added to m_orderedStateDependentSubModelsHead or
 		m_orderedStateDependentSubModelsTail.
@@ -297,6 +314,9 @@ private:
 	/*! Vectors storing sparse matrix pattern (CSR format): number of nonzero elements: */
 	unsigned int nnz() const  { return (unsigned int) m_ja.size(); }
 
+	/*! Creates sparse Jacobian matrix for the current pattern, uses shared coloring information if available. */
+	SOLFRA::JacobianSparseCSR * createJacobianSparse() const;
+
 	/*! Updates all time dependent models due to their order in state dependency graph. */
 	int updateTimeDependentModels();
 	/*! Updates all state dependent models due to their order in state dependency graph. */
@@ -313,6 +333,9 @@ private:
 	/*! The actual NANDRAD project data (owned). */
 	NANDRAD::Project										*m_project;
 
+	/*! Cache for input data shared with other models, nullptr if model runs standalone (not owned). */
+	SharedInputData											*m_sharedInputData = nullptr;
+
 
 	// *** Core Solver Variables ***
 
@@ -406,6 +429,8 @@ private:
 		The evaluation models is sequential.
 	*/
 	std::vector<AbstractTimeDependency*>					m_timeModelContainer;
+	/*! Profiler counter IDs for all models in m_timeModelContainer (same size). */
+	std::vector<unsigned int>								m_timeModelProfilerCounterIds;
 
 	/*! Container for all time-dependent models that need to complete an integrator step when
 		output writing is requested (in order to update referenceable results).
@@ -444,6 +469,10 @@ private:
 			  deleted in the destructor.
 	*/
 	std::vector<ParallelStateObjects>						m_orderedStateDependentSubModels;
+	/*! Profiler counter IDs for all objects in m_orderedStateDependentSubModels (same structure).
+		Sequential model groups hold SOLFRA::Profiler::NO_COUNTER, since they record the times of their models individually.
+	*/
+	std::vector< std::vector<unsigned int> >				m_stateDependentProfilerCounterIds;
 
 	/*! Vector of unordered state dependencies.
 		This container holds all models with undefined priority (-1). Their evaluation order
@@ -295,6 +295,7 @@ void NaturalVentilationModel::setInputValueRefs(const std::vector<QuantityDescri
 
 	// copy result value references
 	m_valueRefs = resultValueRefs;
+	m_zoneInputs.resize(m_objectList->m_filterID.m_ids.size()*m_zoneVariableCount);
 }
 
 
@@ -338,90 +339,73 @@ int NaturalVentilationModel::update() {
 	// get ambient temperature in  [K]
 	double Tambient = *m_valueRefs[0];;
 
-	// store pointer to result quantities
-	double * resultVentRate = m_vectorValuedResults[VVR_VentilationRate].dataPtr();
-
 	// if we have moisture balance enabled, we have one extra variable before scheduled quantities (see variable order)
 	unsigned int moistureBalanceOffset = 0;
 	if (m_moistureBalanceEnabled)
 		moistureBalanceOffset = 1;
 
-	// loop over all zones
+	// gather zone-specific inputs of all zones into contiguous memory, so that all following loops
+	// only work on contiguous arrays
 	for (unsigned int i=0; i<zoneCount; ++i) {
-		unsigned int varOffset = m_zoneVariableOffset+i*m_zoneVariableCount; // offset of first zone-specific variable
-		// get room air temperature in [K]
-		double Tzone = *m_valueRefs[varOffset];
-		// ventilation rate in [1/s]
-		double rate = 999; // initialized to silence compiler warnings
-		switch (m_ventilationModel->m_modelType) {
-
-			case NANDRAD::NaturalVentilationModel::MT_Constant : {
-				rate = m_ventilationRate;
-			} break;
-
-			case NANDRAD::NaturalVentilationModel::MT_Scheduled : {
-				// retrieve scheduled ventilation rate from schedules
-				rate = *m_valueRefs[varOffset + moistureBalanceOffset + 1];
-			} break;
-
-			case NANDRAD::NaturalVentilationModel::MT_ScheduledWithBaseACR : {
-				// initialize rate with base rate
-				rate = *m_valueRefs[varOffset + moistureBalanceOffset + 1];
-				// wind velocity in [m/s]
-				double varWindVelocity = *m_valueRefs[moistureBalanceOffset + 1];
-				double varWindSpeedACRLimit = m_ventilationModel->m_para[NANDRAD::NaturalVentilationModel::P_MaxWindSpeed].value;
-				if (varWindVelocity > varWindSpeedACRLimit)
-					break; // wind speed too large, no increase of ventilation possible - keep already determined "rate"
-
-				// get comfort range of temperatures
-				double maxRoomTemp = m_ventilationModel->m_para[NANDRAD::NaturalVentilationModel::P_VentilationMaxAirTemperature].value;
-				double minRoomTemp = m_ventilationModel->m_para[NANDRAD::NaturalVentilationModel::P_VentilationMinAirTemperature].value;
-
-				// we only increase ventilation when outside of the comfort zone _and_ if increasing the ventilation rate helps
-				const double RAMPING_DELTA_T = 0.2; // ramping range
-
-				double eps = 0; // assume no increase in ventilation
-				if (Tzone < minRoomTemp) {
-					double epsRamp = IBK::scale( std::min(1., (minRoomTemp - Tzone)/RAMPING_DELTA_T ) );
-					// ventilation increases room temperature?
-					if (Tambient > Tzone) {
-						double epsRamp2 = IBK::scale( std::min(1., (Tambient - Tzone)/RAMPING_DELTA_T) );
-						eps = epsRamp*epsRamp2;
-					}
-				}
-
-				// above comfort range?
-				else if (Tzone > maxRoomTemp) {
-					double epsRamp = IBK::scale( std::min(1., (Tzone - maxRoomTemp)/RAMPING_DELTA_T ) );
-					// ventilation decreases room temperature?
-					if (Tambient < Tzone) {
-						double epsRamp2 = IBK::scale( std::min(1., (Tzone - Tambient)/RAMPING_DELTA_T) );
-						eps = epsRamp*epsRamp2;
-					}
-				}
-
-				// get _additional_ ventilation rate
-				double rateIncrease = *m_valueRefs[varOffset + moistureBalanceOffset + 2];
+		const double * const * zoneValueRefs = &m_valueRefs[m_zoneVariableOffset+i*m_zoneVariableCount]; // first zone-specific variable
+		for (unsigned int k=0; k<m_zoneVariableCount; ++k)
+			m_zoneInputs[k*zoneCount + i] = *zoneValueRefs[k];
+	}
+	// room air temperatures in [K]
+	const double * Tzones = m_zoneInputs.data();
+	// scheduled quantities (depending on model type)
+	const double * scheduledValues = Tzones + (1 + moistureBalanceOffset)*zoneCount;
 
-				// compute final rate
-				rate += eps * rateIncrease;
-			} break;
+	// store pointer to result quantities
+	double * resultVentRate = m_vectorValuedResults[VVR_VentilationRate].dataPtr();
 
-			case NANDRAD::NaturalVentilationModel::MT_ScheduledWithBaseACRDynamicTLimit : {
-				// initialize rate with base rate
-				rate = *m_valueRefs[varOffset + moistureBalanceOffset + 1];
-				// get the scheduled quantities
-				double varWindVelocity = *m_valueRefs[moistureBalanceOffset + 1];
-				double varWindSpeedACRLimit = m_ventilationModel->m_para[NANDRAD::NaturalVentilationModel::P_MaxWindSpeed].value;
-				if (varWindVelocity > varWindSpeedACRLimit)
-					break; // wind speed too large, no increase of ventilation possible - keep already determined "rate"
+	// compute ventilation rates in [1/s] of all zones
+	switch (m_ventilationModel->m_modelType) {
+
+		case NANDRAD::NaturalVentilationModel::MT_Constant : {
+			for (unsigned int i=0; i<zoneCount; ++i)
+				resultVentRate[i] = m_ventilationRate;
+		} break;
+
+		case NANDRAD::NaturalVentilationModel::MT_Scheduled : {
+			// retrieve scheduled ventilation rate from schedules
+			for (unsigned int i=0; i<zoneCount; ++i)
+				resultVentRate[i] = scheduledValues[i];
+		} break;
+
+		case NANDRAD::NaturalVentilationModel::MT_ScheduledWithBaseACR :
+		case NANDRAD::NaturalVentilationModel::MT_ScheduledWithBaseACRDynamicTLimit : {
+			// base rate and _additional_ ventilation rate
+			const double * baseRates = scheduledValues;
+			const double * rateIncreases = scheduledValues + zoneCount;
+
+			// initialize rate with base rate
+			for (unsigned int i=0; i<zoneCount; ++i)
+				resultVentRate[i] = baseRates[i];
+
+			// wind velocity in [m/s]
+			double varWindVelocity = *m_valueRefs[moistureBalanceOffset + 1];
+			double varWindSpeedACRLimit = m_ventilationModel->m_para[NANDRAD::NaturalVentilationModel::P_MaxWindSpeed].value;
+			if (varWindVelocity > varWindSpeedACRLimit)
+				break; // wind speed too large, no increase of ventilation possible - keep already determined "rate"
+
+			// get comfort range of temperatures, either constant or scheduled
+			double maxRoomTempConst = m_ventilationModel->m_para[NANDRAD::NaturalVentilationModel::P_VentilationMaxAirTemperature].value;
+			double minRoomTempConst = m_ventilationModel->m_para[NANDRAD::NaturalVentilationModel::P_VentilationMinAirTemperature].value;
+			const double * minRoomTemps = nullptr;
+			const double * maxRoomTemps = nullptr;
+			if (m_ventilationModel->m_modelType == NANDRAD::NaturalVentilationModel::MT_ScheduledWithBaseACRDynamicTLimit) {
+				minRoomTemps = scheduledValues + 2*zoneCount;
+				maxRoomTemps = scheduledValues + 3*zoneCount;
+			}
 
-				// get comfort range of temperatures
-				double minRoomTemp = *m_valueRefs[varOffset + moistureBalanceOffset + 3];
-				double maxRoomTemp = *m_valueRefs[varOffset + moistureBalanceOffset + 4];
+			// we only increase ventilation when outside of the comfort zone _and_ if increasing the ventilation rate helps
+			const double RAMPING_DELTA_T = 0.2; // ramping range
 
-				// we only increase ventilation when outside of the comfort zone _and_ if increasing the ventilation rate helps
-				const double RAMPING_DELTA_T = 0.2; // ramping range
+			for (unsigned int i=0; i<zoneCount; ++i) {
+				double Tzone = Tzones[i];
+				double minRoomTemp = minRoomTemps != nullptr ? minRoomTemps[i] : minRoomTempConst;
+				double maxRoomTemp = maxRoomTemps != nullptr ? maxRoomTemps[i] : maxRoomTempConst;
 
 				double eps = 0; // assume no increase in ventilation
 				if (Tzone < minRoomTemp) {
@@ -443,16 +427,14 @@ int NaturalVentilationModel::update() {
 					}
 				}
 
-				// get _additional_ ventilation rate
-				double rateIncrease = *m_valueRefs[varOffset + moistureBalanceOffset + 2];
-
 				// compute final rate
-				rate += eps * rateIncrease;
-			} break;
-			default: ;
-		}
-		// store ventilation rate result
-		resultVentRate[i] = rate;
+				resultVentRate[i] += eps * rateIncreases[i];
+			}
+		} break;
+
+		default:
+			for (unsigned int i=0; i<zoneCount; ++i)
+				resultVentRate[i] = 999; // initialized to silence compiler warnings
 	}
 
 	// Note: resultVentRate[i] now contains a ventilation rate in [1/s]
@@ -481,19 +463,20 @@ int NaturalVentilationModel::update() {
 
 		// get ambient vapor, gas and air density [kg/m3]
 		double rhoVaporAmbient = *m_valueRefs[1];
+		// zone vapor densities in [kg/m3]
+		const double * rhoVaporZones = Tzones + zoneCount;
 
 		// loop over all zones
 		for (unsigned int i=0; i<zoneCount; ++i) {
-			unsigned int varOffset = m_zoneVariableOffset+i*m_zoneVariableCount; // offset of first zone-specific variable
 			// get room air temperature in [K]
-			double Tzone = *m_valueRefs[varOffset];
+			double Tzone = Tzones[i];
 
 			// get ventilation rate in [1/s]
 			double rate = resultVentRate[i];
 			double mdot_air = rate*m_zoneVolumes[i]*IBK::RHO_AIR; // dry air mass flux
 
 			// get zone vapor density in [kg/m3]
-			double rhoVaporZone = *m_valueRefs[varOffset + 1];
+			double rhoVaporZone = rhoVaporZones[i];
 
 			// [cv] = rho(Vapor) / rho(gas)
 			double cvVaporZone = rhoVaporZone / IBK::RHO_AIR; // for now a constant
@@ -531,13 +514,9 @@ int NaturalVentilationModel::update() {
 
 		// loop over all zones
 		for (unsigned int i=0; i<zoneCount; ++i) {
-			unsigned int varOffset = m_zoneVariableOffset+i*m_zoneVariableCount; // offset of first zone-specific variable
-			// get room air temperature in [K]
-			double Tzone = *m_valueRefs[varOffset];
-
 			// get ventilation rate in [1/s]
 			double rate = resultVentRate[i];
-			resultVentHeatFlux[i] = rhoAirAmbient * cAir * m_zoneVolumes[i]*(Tambient - Tzone)*rate;
+			resultVentHeatFlux[i] = rhoAirAmbient * cAir * m_zoneVolumes[i]*(Tambient - Tzones[i])*rate;
 		}
 	}
 
@@ -150,6 +150,12 @@ private:
 	mutable unsigned int							m_zoneVariableOffset;
 	/*! Number of zone-dependent variables in inputRefs/valueRefs vector. */
 	mutable unsigned int							m_zoneVariableCount;
+
+	/*! Zone-specific input values of all zones, gathered from m_valueRefs in update().
+		Values are stored per variable, i.e. m_zoneInputs[varIndex*zoneCount + zoneIndex], with the same
+		variable order as in the zone variable block of m_valueRefs.
+	*/
+	std::vector<double>								m_zoneInputs;
 };
 
 } // namespace NANDRAD_MODEL
@@ -22,6 +22,8 @@
 #include "NM_OutputFile.h"
 
 #include <fstream>
+#include <cmath>
+#include <algorithm>
 
 #include <IBK_messages.h>
 #include <IBK_Path.h>
@@ -47,12 +49,15 @@ std::size_t OutputFile::serializationSize() const {
 	if (!m_haveIntegrals)
 		return size; // nothing else to serialize
 
-	// last time step
-	size += sizeof (double);
+	// last and current time step
+	size += 2*sizeof (double);
 	std::size_t dataSize = m_integralsAtLastOutput.size() * sizeof(double);
 	// integral values
 	// + integral values at last output time point
 	size += 3 * dataSize;
+	// minimum/maximum values and values at last step
+	if (m_haveExtrema)
+		size += 2 * dataSize;
 
 	return size;
 }
@@ -66,9 +71,11 @@ void OutputFile::serialize(void *& dataPtr) const {
 	if (!m_haveIntegrals)
 		return; // nothing to do
 
-	// cache tLastStep for integration
+	// cache tLastStep and tCurrentStep for integration
 	*(double*)dataPtr = m_tLastStep;
 	dataPtr = (char*)dataPtr + sizeof(double);
+	*(double*)dataPtr = m_tCurrentStep;
+	dataPtr = (char*)dataPtr + sizeof(double);
 	// Note: the vectors m_integralsAtLastOutput, m_integrals[0] and m_integrals[1] have always the same size
 	std::size_t dataSize = m_integralsAtLastOutput.size() * sizeof(double);
 	// cache integrals
@@ -79,6 +86,14 @@ void OutputFile::serialize(void *& dataPtr) const {
 	// cache integralsAtLastOutput
 	std::memcpy(dataPtr, m_integralsAtLastOutput.data(), dataSize);
 	dataPtr = (char*)dataPtr + dataSize;
+
+	if (!m_haveExtrema)
+		return;
+	// cache minimum/maximum values
+	std::memcpy(dataPtr, m_extrema.data(), dataSize);
+	dataPtr = (char*)dataPtr + dataSize;
+	std::memcpy(dataPtr, m_stepValues.data(), dataSize);
+	dataPtr = (char*)dataPtr + dataSize;
 }
 
 
@@ -100,9 +115,11 @@ void OutputFile::deserialize(void *& dataPtr) {
 	if (!m_haveIntegrals)
 		return; // nothing to else do
 
-	// update cached tLastStep
+	// update cached tLastStep and tCurrentStep
 	m_tLastStep = *(double*)dataPtr;
 	dataPtr = (char*)dataPtr + sizeof(double);
+	m_tCurrentStep = *(double*)dataPtr;
+	dataPtr = (char*)dataPtr + sizeof(double);
 	std::size_t dataSize = m_integralsAtLastOutput.size() * sizeof(double);
 	// update cached integrals
 	std::memcpy(m_integrals[0].data(), dataPtr, dataSize);
@@ -112,6 +129,14 @@ void OutputFile::deserialize(void *& dataPtr) {
 	// update cached integralsAtLastOutput
 	std::memcpy(m_integralsAtLastOutput.data(), dataPtr, dataSize);
 	dataPtr = (char*)dataPtr + dataSize;
+
+	if (!m_haveExtrema)
+		return;
+	// update cached minimum/maximum values
+	std::memcpy(m_extrema.data(), dataPtr, dataSize);
+	dataPtr = (char*)dataPtr + dataSize;
+	std::memcpy(m_stepValues.data(), dataPtr, dataSize);
+	dataPtr = (char*)dataPtr + dataSize;
 }
 
 
@@ -134,25 +159,54 @@ void OutputFile::stepCompleted(double t) {
 		/// \todo think of a way to restore integral values in case of restarting
 		m_tLastStep = t;
 		m_tCurrentStep = t;
+		// minimum/maximum values start with the initial values
+		for (unsigned int i=0; i<m_numCols; ++i) {
+			if (m_outputVarInfo[i].m_timeType == NANDRAD::OutputDefinition::OTT_MINIMUM ||
+				m_outputVarInfo[i].m_timeType == NANDRAD::OutputDefinition::OTT_MAXIMUM)
+			{
+				m_extrema[i] = *m_outputVarInfo[i].m_valueRef;
+				m_stepValues[i] = m_extrema[i];
+			}
+		}
 		return; // we have initialized our time points, so let's bail out here... nothing to integrate so far
 	}
+	// no progress since last call, this happens when the simulation is continued from restart data; the
+	// values stored in the model may not yet correspond to t, so we must not use them
+	if (dt <= 0)
+		return;
 	// update our time point values
 	m_tLastStep = m_tCurrentStep;
 	m_tCurrentStep = t;
 
-	// loop over all *available* variables and handle those with OTT_MEAN or OTT_INTEGRAL
+	// loop over all *available* variables and handle those with time type other than OTT_NONE
 	unsigned int col=0; // storage column index
 	for (unsigned int i=0; i<m_numCols; ++i) {
-		if (m_outputVarInfo[i].m_timeType != NANDRAD::OutputDefinition::OTT_NONE) {
+		switch (m_outputVarInfo[i].m_timeType) {
+			case NANDRAD::OutputDefinition::OTT_MEAN :
+			case NANDRAD::OutputDefinition::OTT_INTEGRAL : {
+				m_integrals[0][col] = m_integrals[1][col];
+				// now retrieve value
+				double val = *m_outputVarInfo[i].m_valueRef;
+
+				// integrate over interval, using simple rectangular rule
+				double dVal = val*dt;
+				// add add to integral
+				m_integrals[1][col] = dVal + m_integrals[0][col];
+			} break;
+
+			// the value at the previous step lies within the current output interval, the value at the new
+			// step may already belong to the next interval and is only stored
+			case NANDRAD::OutputDefinition::OTT_MINIMUM :
+				m_extrema[col] = std::min(m_extrema[col], m_stepValues[col]);
+				m_stepValues[col] = *m_outputVarInfo[i].m_valueRef;
+			break;
 
-			m_integrals[0][col] = m_integrals[1][col];
-			// now retrieve value
-			double val = *m_outputVarInfo[i].m_valueRef;
+			case NANDRAD::OutputDefinition::OTT_MAXIMUM :
+				m_extrema[col] = std::max(m_extrema[col], m_stepValues[col]);
+				m_stepValues[col] = *m_outputVarInfo[i].m_valueRef;
+			break;
 
-			// integrate over interval, using simple rectangular rule
-			double dVal = val*dt;
-			// add add to integral
-			m_integrals[1][col] = dVal + m_integrals[0][col];
+			default: ;
 		}
 		++col;
 	}
@@ -201,9 +255,11 @@ void OutputFile::setInputValueRefs(const std::vector<QuantityDescription> & resu
 			// replace value unit
 			outputVarInfo.m_resultUnit = u;
 		}
-		// For MEAN and INTEGRAL we need to create additional storage containers
+		// For MEAN, INTEGRAL, MINIMUM and MAXIMUM we need to create additional storage containers
 		if (od.m_timeType != NANDRAD::OutputDefinition::OTT_NONE)
 			m_haveIntegrals = true;
+		if (od.m_timeType == NANDRAD::OutputDefinition::OTT_MINIMUM || od.m_timeType == NANDRAD::OutputDefinition::OTT_MAXIMUM)
+			m_haveExtrema = true;
 
 		// check that scalar and vector-valued variables are not mixed
 		if (m_inputRefs[i].m_name.m_index == -1 && resultDescriptions[i].m_size != 1)
@@ -221,6 +277,10 @@ void OutputFile::setInputValueRefs(const std::vector<QuantityDescription> & resu
 			quantitySuffix = "-average";
 		else if (outputVarInfo.m_timeType == NANDRAD::OutputDefinition::OTT_INTEGRAL)
 			quantitySuffix = "-integral";
+		else if (outputVarInfo.m_timeType == NANDRAD::OutputDefinition::OTT_MINIMUM)
+			quantitySuffix = "-minimum";
+		else if (outputVarInfo.m_timeType == NANDRAD::OutputDefinition::OTT_MAXIMUM)
+			quantitySuffix = "-maximum";
 
 		std::string quantityString = m_inputRefs[i].m_name.m_name;
 		if (m_inputRefs[i].m_name.m_index != -1)
@@ -256,6 +316,10 @@ void OutputFile::setInputValueRefs(const std::vector<QuantityDescription> & resu
 		m_tLastStep = -1;
 		m_tCurrentStep = -1;
 	}
+	if (m_haveExtrema) {
+		m_extrema.resize(m_numCols, 0.0);
+		m_stepValues.resize(m_numCols, 0.0);
+	}
 
 
 	// Now generate warnings for all requested outputs that could not be generated.
@@ -516,6 +580,12 @@ void OutputFile::createFile(bool restart, bool binary, const std::string & timeC
 }
 
 
+double * OutputFile::appendCacheRow() {
+	m_cache.emplace_back(m_numCols+1); // construct row in place, avoids copying a temporary vector
+	return m_cache.back().data();
+}
+
+
 void OutputFile::cacheOutputs(double t_out, double t_timeOfYear) {
 	// no outputs - nothing to do
 	if (m_numCols == 0)
@@ -523,16 +593,16 @@ void OutputFile::cacheOutputs(double t_out, double t_timeOfYear) {
 
 	// NOTE: t_out is already converted to output time unit!!!
 
-	// append data to cache
-	std::vector<double> vals(m_numCols+1);
+	// complete last row in cache
+	IBK_ASSERT(!m_cache.empty());
+	std::vector<double> & vals = m_cache.back();
 	vals[0] = t_timeOfYear;
 	for (unsigned int i=0; i<m_numCols; ++i) {
 		unsigned int col=i+1; // Mind: column 0 is the time column
 		switch (m_outputVarInfo[i].m_timeType) {
 			case NANDRAD::OutputDefinition::OTT_NONE :
 			default :
-				// retrieve value for this variable and store in cache vector
-				vals[col] = *m_outputVarInfo[i].m_valueRef;
+				// value has already been gathered by the output handler
 			break;
 
 			case NANDRAD::OutputDefinition::OTT_MEAN :
@@ -574,6 +644,24 @@ void OutputFile::cacheOutputs(double t_out, double t_timeOfYear) {
 				}
 			}
 			break;
+
+			case NANDRAD::OutputDefinition::OTT_MINIMUM :
+			case NANDRAD::OutputDefinition::OTT_MAXIMUM : {
+				// value at output time point; solver steps at or after t_out are not yet included in
+				// m_extrema (see stepCompleted()), so we get the extremum of the interval [t_lastOutput, t_out]
+				double val = *m_outputVarInfo[i].m_valueRef;
+				vals[col] = val;
+				// special handling for first output value: stepCompleted() may not have been called, yet
+				if (m_tLastStep != m_tCurrentStep) {
+					if (m_outputVarInfo[i].m_timeType == NANDRAD::OutputDefinition::OTT_MINIMUM)
+						vals[col] = std::min(val, m_extrema[i]);
+					else
+						vals[col] = std::max(val, m_extrema[i]);
+				}
+				// next output interval starts with the value at the output time point
+				m_extrema[i] = val;
+			}
+			break;
 		} // switch
 
 		// perform target unit conversion
@@ -581,8 +669,6 @@ void OutputFile::cacheOutputs(double t_out, double t_timeOfYear) {
 	}
 	// finally update last outputs time point
 	m_tLastOutput = t_out;
-
-	m_cache.emplace_back(vals); // like push-back, but without re-allocation
 }
 
 
@@ -598,36 +684,54 @@ void OutputFile::clearCache() {
 }
 
 
-void OutputFile::flushCache() {
+void OutputFile::flushCache(bool finalFlush) {
 	// no outputs - nothing to do
 	if (m_numCols == 0 || m_ofstream == nullptr)
 		return;
 
 	// avoid writing for empty cache
-	if (m_cache.empty())
+	if (m_cache.empty() && m_thinningPending.empty())
 		return;
 
 	// dump all rows of the cache into file
 	for (std::vector<double> & vals : m_cache) {
-		if (m_binary) {
-			IBK::write_vector_binary(*m_ofstream, vals);
+		if (m_thinningTolerance == 0) {
+			writeRow(vals);
+			continue;
 		}
-		else {
-			// dump vector in ascii mode
-			// first values
-			for (unsigned int i=0; i<vals.size(); ++i) {
-				if (i != 0) {
-					*m_ofstream << "\t" << vals[i];
-				}
-				else {
-					// time value is written with increased precision to avoid
-					// accuracy problems in long simulations with short output intervals (> 10 years with 10 min steps)
-					std::streamsize prec = m_ofstream->precision();
-					*m_ofstream << std::setprecision(10) << vals[i] << std::setprecision(prec);
-				}
+
+		// *** output thinning ***
+
+		// first row is always written
+		if (m_thinningAnchor.empty()) {
+			writeRow(vals);
+			m_thinningAnchor.swap(vals);
+			continue;
+		}
+		if (!m_thinningPending.empty()) {
+			// if all pending rows can be interpolated between anchor and new row, the last pending row becomes obsolete
+			// Note: number of pending rows is limited, since the test effort grows with the number of pending rows
+			const unsigned int MAX_PENDING_ROWS = 100;
+			if (m_thinningPending.size() < MAX_PENDING_ROWS && canThinRows(vals)) {
+				m_thinningPending.emplace_back();
+				m_thinningPending.back().swap(vals);
+				continue;
 			}
-			*m_ofstream << '\n';
+			// otherwise the last pending row is written and becomes the new anchor
+			writeRow(m_thinningPending.back());
+			m_rowsThinned += m_thinningPending.size() - 1;
+			m_thinningAnchor.swap(m_thinningPending.back());
+			m_thinningPending.clear();
 		}
+		m_thinningPending.emplace_back();
+		m_thinningPending.back().swap(vals);
+	}
+	// at end of simulation, write the row held back by thinning
+	if (finalFlush && !m_thinningPending.empty()) {
+		writeRow(m_thinningPending.back());
+		m_rowsThinned += m_thinningPending.size() - 1;
+		m_thinningAnchor.swap(m_thinningPending.back());
+		m_thinningPending.clear();
 	}
 	// flush stream
 	m_ofstream->flush();
@@ -636,4 +740,48 @@ void OutputFile::flushCache() {
 }
 
 
+void OutputFile::writeRow(const std::vector<double> & vals) {
+	++m_rowsWritten;
+	if (m_binary) {
+		IBK::write_vector_binary(*m_ofstream, vals);
+	}
+	else {
+		// dump vector in ascii mode
+		// first values
+		for (unsigned int i=0; i<vals.size(); ++i) {
+			if (i != 0) {
+				*m_ofstream << "\t" << vals[i];
+			}
+			else {
+				// time value is written with increased precision to avoid
+				// accuracy problems in long simulations with short output intervals (> 10 years with 10 min steps)
+				std::streamsize prec = m_ofstream->precision();
+				*m_ofstream << std::setprecision(10) << vals[i] << std::setprecision(prec);
+			}
+		}
+		*m_ofstream << '\n';
+	}
+}
+
+
+bool OutputFile::canThinRows(const std::vector<double> & vals) const {
+	const std::vector<double> & anchor = m_thinningAnchor;
+	double dt = vals[0] - anchor[0];
+	if (dt <= 0)
+		return false;
+	for (const std::vector<double> & row : m_thinningPending) {
+		double alpha = (row[0] - anchor[0])/dt;
+		// Mind: column 0 is the time column
+		for (unsigned int i=1; i<row.size(); ++i) {
+			double interpolated = anchor[i] + alpha*(vals[i] - anchor[i]);
+			// error is measured relative to the magnitude of the involved values
+			double magnitude = std::max(std::fabs(row[i]), std::max(std::fabs(anchor[i]), std::fabs(vals[i])));
+			if (std::fabs(row[i] - interpolated) > m_thinningTolerance*magnitude)
+				return false;
+		}
+	}
+	return true;
+}
+
+
 } // namespace NANDRAD_MODEL
@@ -43,7 +43,12 @@ namespace NANDRAD_MODEL {
 	all output quantities stored in the output file managed by this class.
 
 	The class also implements the AbstractTimeStateDependency interface, in order to
-	receive stepCompleted() calls, needed for time intergration.
+	receive stepCompleted() calls, needed for time intergration and for minimum/maximum values
+	within output intervals. These aggregates are computed from the values at all solver steps, so that
+	peaks between output time points are captured without additional model evaluations.
+
+	Optionally, rows are thinned when written to file: a row is skipped, if all its values can be reconstructed
+	by linear interpolation between the neighboring rows written to file (within the thinning tolerance).
 
 	To add OutputFile objects to the model container of NandradModel we need
 	to derive from AbstractModel, even though output files never generate results. Hence,
@@ -117,7 +122,9 @@ public:
 
 	// *** Other member functions
 
-	/*! Returns true if output file has at least one OTT_MEAN or OTT_INTEGRAL quantity and requires stepCompleted() calls. */
+	/*! Returns true if output file has at least one OTT_MEAN, OTT_INTEGRAL, OTT_MINIMUM or OTT_MAXIMUM quantity
+		and requires stepCompleted() calls.
+	*/
 	bool haveIntegrals() const { return m_haveIntegrals; }
 
 private:
@@ -140,8 +147,16 @@ private:
 	void createFile(bool restart, bool binary, const std::string & timeColumnLabel, const IBK::Path * outputPath,
 					const std::map<std::string, std::string> & varSubstitutionMap, unsigned int startYear);
 
-	/*! Retrieves current output values and appends values to cache.
-		This function only caches current output values. The data is written to file in the next call to flushCache().
+	/*! Appends a new row to the cache and returns a pointer to its first element.
+		The row holds m_numCols+1 values (time column first). The output handler then gathers
+		current values of all OTT_NONE columns into the row and calls cacheOutputs() to complete it.
+	*/
+	double * appendCacheRow();
+
+	/*! Completes the last row of the cache appended with appendCacheRow().
+		Sets the time column, computes integral and mean values and converts all values to the output unit.
+		Values of OTT_NONE columns must have been stored already.
+		The data is written to file in the next call to flushCache().
 
 		\param t_out The time since begin of simulation, for output integral interpolation.
 		\param t_timeOfThe time since begin of the start year already converted to the output unit (this goes into the
@@ -159,8 +174,17 @@ private:
 
 	/*! Called from output handler once sufficient real time has elapsed or amount of data cache exceeds
 		defined limit.
+		\param finalFlush If true, the last row held back by output thinning is written as well (at end of simulation).
 	*/
-	void flushCache();
+	void flushCache(bool finalFlush);
+
+	/*! Writes a single row to the output file. */
+	void writeRow(const std::vector<double> & vals);
+
+	/*! Returns true, if all rows in m_thinningPending can be reconstructed by linear interpolation between
+		m_thinningAnchor and the row vals.
+	*/
+	bool canThinRows(const std::vector<double> & vals) const;
 
 
 	/*! Cached flag to know whether to write in binary or ASCII mode. */
@@ -174,7 +198,7 @@ private:
 	*/
 	std::vector<NANDRAD::OutputDefinition>		m_outputDefinitions;
 
-	/*! Set to true if at least one of the output definitions uses OTT_MEAN or OTT_INTEGRAL.
+	/*! Set to true if at least one of the output definitions uses OTT_MEAN, OTT_INTEGRAL, OTT_MINIMUM or OTT_MAXIMUM.
 		The value is initialized in createInputReferences().
 		\note It is possible that the requested output quantity is not available. Then, the flag
 			is cleared in function setInputValueRef(), when integral values are initialized.
@@ -254,6 +278,31 @@ private:
 	/*! Cached values at last output time point, needed to compute integral mean values (size m_numCols). */
 	std::vector<double>							m_integralsAtLastOutput;
 
+	/*! Set to true if at least one of the variables uses OTT_MINIMUM or OTT_MAXIMUM. */
+	bool										m_haveExtrema = false;
+	/*! Minimum/maximum values in current output interval, from values at last output and all solver steps up to
+		m_tLastStep (size m_numCols, only used for OTT_MINIMUM and OTT_MAXIMUM columns).
+	*/
+	std::vector<double>							m_extrema;
+	/*! Values at m_tCurrentStep (size m_numCols, only used for OTT_MINIMUM and OTT_MAXIMUM columns).
+		These values are added to m_extrema in the next stepCompleted() call, since the current step may already
+		extend past the next output time point.
+	*/
+	std::vector<double>							m_stepValues;
+
+	/*! Relative tolerance for thinning of rows, 0 if thinning is disabled. */
+	double										m_thinningTolerance = 0;
+	/*! Last row written to file, start point of interpolation for thinning (empty if nothing written, yet). */
+	std::vector<double>							m_thinningAnchor;
+	/*! Rows after m_thinningAnchor not written to file, yet. All but the last row can be reconstructed by
+		interpolation between m_thinningAnchor and the last row.
+	*/
+	std::vector< std::vector<double> >			m_thinningPending;
+	/*! Number of rows written to file. */
+	unsigned int								m_rowsWritten = 0;
+	/*! Number of rows skipped by thinning. */
+	unsigned int								m_rowsThinned = 0;
+
 	/*! Output file stream (owned and initialized in createFile()). */
 	std::ofstream								*m_ofstream = nullptr;
 
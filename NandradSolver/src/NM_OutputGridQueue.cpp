@@ -0,0 +1,70 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NM_OutputGridQueue.h"
+
+#include <limits>
+
+#include <IBK_math.h>
+
+#include <NANDRAD_OutputGrid.h>
+
+namespace NANDRAD_MODEL {
+
+void OutputGridQueue::setup(const std::vector<NANDRAD::OutputGrid> & grids) {
+	m_grids = &grids;
+	m_queue = std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> >();
+	m_allDue = true;
+}
+
+
+void OutputGridQueue::advance(double t, std::vector<unsigned int> & dueGrids) {
+	dueGrids.clear();
+
+	// after setup, or when time was reset, we need to process all grids
+	if (m_allDue || t < m_tLast) {
+		m_queue = std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> >();
+		for (unsigned int i=0; i<m_grids->size(); ++i)
+			dueGrids.push_back(i);
+		m_allDue = false;
+	}
+	else {
+		// pop all grids with output time point reached
+		while (!m_queue.empty() && IBK::f_fuzzyLTEQ(m_queue.top().first, t)) {
+			dueGrids.push_back(m_queue.top().second);
+			m_queue.pop();
+		}
+	}
+	m_tLast = t;
+
+	// re-schedule all due grids
+	for (unsigned int i : dueGrids)
+		m_queue.push( Entry((*m_grids)[i].computeNextOutputTime(t), i) );
+}
+
+
+double OutputGridQueue::nextOutputTime() const {
+	if (m_queue.empty())
+		return std::numeric_limits<double>::max();
+	return m_queue.top().first;
+}
+
+} // namespace NANDRAD_MODEL
@@ -0,0 +1,85 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NM_OutputGridQueueH
+#define NM_OutputGridQueueH
+
+#include <vector>
+#include <queue>
+#include <functional>
+
+namespace NANDRAD {
+	class OutputGrid;
+}
+
+namespace NANDRAD_MODEL {
+
+/*! Priority queue holding the next scheduled output time point of each output grid.
+
+	Instead of asking every output grid for its next output time in each call, the queue
+	keeps the next output time of each grid, ordered by due time. When time advances, only
+	those grids whose output time has been reached are removed from the queue, and
+	their next output time is computed and inserted again.
+
+	All time points are absolute times (offset to Midnight, January 1st of the start year) in [s].
+
+	\note Time is expected to advance monotonically. When advance() is called with an
+		earlier time point than before, all grids are re-evaluated.
+*/
+class OutputGridQueue { // NO KEYWORDS
+public:
+	/*! Initializes the queue for the given output grids.
+		The vector must not be modified afterwards (the queue stores a pointer to it).
+		After setup, all grids are considered due in the first call to advance().
+	*/
+	void setup(const std::vector<NANDRAD::OutputGrid> & grids);
+
+	/*! Advances the queue to time point t.
+		All grids with an output time point <= t (fuzzy comparison) are removed from the queue,
+		their indexes are stored in dueGrids and their next output time point past t is inserted again.
+		\param t Current time point in [s].
+		\param dueGrids Vector is cleared and populated with indexes of all grids whose scheduled
+			output time was reached (in no particular order).
+	*/
+	void advance(double t, std::vector<unsigned int> & dueGrids);
+
+	/*! Returns the earliest scheduled output time point past the time passed to the last advance() call,
+		or std::numeric_limits<double>::max() if no grid has any further output.
+	*/
+	double nextOutputTime() const;
+
+private:
+	/*! Queue entry: next output time point and grid index. */
+	typedef std::pair<double, unsigned int>		Entry;
+
+	/*! Pointer to the output grids (not owned). */
+	const std::vector<NANDRAD::OutputGrid>		*m_grids = nullptr;
+	/*! Min-heap with next output time points of all grids. */
+	std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> >	m_queue;
+	/*! Time point of last advance() call in [s]. */
+	double										m_tLast = 0;
+	/*! If true, all grids are due in next call to advance() (set after setup). */
+	bool										m_allDue = true;
+};
+
+} // namespace NANDRAD_MODEL
+
+#endif // NM_OutputGridQueueH
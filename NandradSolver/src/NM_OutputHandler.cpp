@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <array>
 #include <memory>
+#include <functional>
 
 #include <IBK_StringUtils.h>
 #include <IBK_messages.h>
@@ -31,9 +32,12 @@
 #include <IBK_StopWatch.h>
 #include <IBK_UnitList.h>
 #include <IBK_FileUtils.h>
+#include <IBK_assert.h>
 
 #include <NANDRAD_Project.h>
 
+#include <SOLFRA_Profiler.h>
+
 #include "NM_OutputFile.h"
 #include "NM_QuantityName.h"
 #include "NM_KeywordList.h"
@@ -111,6 +115,11 @@ void OutputHandler::setup(bool restart, NANDRAD::Project & prj, const IBK::Path
 	m_restart = restart; // store restart info flag
 	m_outputPath = &outputPath;
 	m_binaryFiles = prj.m_outputs.m_binaryFormat.isEnabled();
+	m_thinningTolerance = 0;
+	if (!prj.m_outputs.m_thinningTolerance.name.empty())
+		m_thinningTolerance = prj.m_outputs.m_thinningTolerance.checkedValue("ThinningTolerance", "---", "---",
+																			0, true, 0.5, true,
+																			"Thinning tolerance must be between 0 and 0.5.");
 	m_timeUnit = prj.m_outputs.m_timeUnit;
 	if (m_timeUnit.base_id() != IBK_UNIT_ID_SECONDS) {
 		throw IBK::Exception( IBK::FormatString("Output time unit '%1' is not a valid time unit.").arg(m_timeUnit.name()), FUNC_ID);
@@ -424,9 +433,15 @@ void OutputHandler::setup(bool restart, NANDRAD::Project & prj, const IBK::Path
 	// *** transfer pointer
 
 	for (std::unique_ptr<OutputFile> & of : tmpOutputFiles) {
+		of->m_thinningTolerance = m_thinningTolerance;
 		m_outputFiles.push_back(of.release());
 	}
 
+	// *** initialize output schedules
+
+	m_grids = &prj.m_outputs.m_grids;
+	m_nextOutputQueue.setup(*m_grids);
+	m_writeOutputQueue.setup(*m_grids);
 }
 
 
@@ -464,29 +479,50 @@ void OutputHandler::writeOutputs(double t_out, double t_secondsOfYear, const std
 
 		// now create timer (becomes owned by us)
 		m_outputTimer = new IBK::StopWatch; // timer starts automatically
+
+		// *** create gather lists (value references are known only now)
+
+		setupGatherLists();
 	}
 
 	// convert to output time unit
 	double t_timeOfYear = t_secondsOfYear;
 	IBK::UnitList::instance().convert(IBK::Unit(IBK_UNIT_ID_SECONDS), m_timeUnit, t_timeOfYear);
 
-	// now pass on the call to each file to cache current results
-	unsigned int storedBytes = 0;
-	for (OutputFile * of : m_outputFiles) {
+	// process only files of grids that are due at this time point
+	m_writeOutputQueue.advance(t_secondsOfYear, m_dueGrids);
+	for (unsigned int gridIdx : m_dueGrids) {
 		// check if output grid is active and only write outputs if this is the case
-		if (of->m_gridRef->isActive(t_secondsOfYear))
+		if (!(*m_grids)[gridIdx].isActive(t_secondsOfYear))
+			continue;
+		const std::vector<OutputFile*> & files = m_gridOutputFiles[gridIdx];
+		if (files.empty())
+			continue;
+
+		// append new cache rows to all files of this grid
+		m_rowBuffers.resize(files.size());
+		for (unsigned int i=0; i<files.size(); ++i)
+			m_rowBuffers[i] = files[i]->appendCacheRow();
+
+		// gather current values of all files at once
+		for (const GatherEntry & e : m_gridGatherLists[gridIdx])
+			m_rowBuffers[e.m_fileIdx][e.m_col] = *e.m_valueRef;
+
+		// let files compute integral/mean values and convert units
+		for (OutputFile * of : files) {
 			of->cacheOutputs(t_out, t_timeOfYear);
-		storedBytes += of->cacheSize();
+			m_storedBytes += of->m_numCols*sizeof(double);
+		}
 	}
 
 	// flush cache to file once cached limit has been exceeded, or realtime delay has passed
 	if (m_outputTimer->difference()/1000.0 > m_realTimeOutputDelay ||
-		storedBytes > m_outputCacheLimit)
+		m_storedBytes > m_outputCacheLimit)
 	{
-		if (storedBytes > m_outputCacheLimit)
+		if (m_storedBytes > m_outputCacheLimit)
 			IBK::IBK_Message("Flushing output cache (cache limit exceeded).\n", IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_DETAILED);
 		else
-			IBK::IBK_Message( IBK::FormatString("Flushing output cache (time delay reached, cache size = %1 Mb).\n").arg(storedBytes/1024./1024.), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_DETAILED);
+			IBK::IBK_Message( IBK::FormatString("Flushing output cache (time delay reached, cache size = %1 Mb).\n").arg(m_storedBytes/1024./1024.), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_DETAILED);
 		flushCache();
 		// restart timer
 		m_outputTimer->start();
@@ -494,9 +530,68 @@ void OutputHandler::writeOutputs(double t_out, double t_secondsOfYear, const std
 }
 
 
-void OutputHandler::flushCache() {
+void OutputHandler::flushCache(bool finalFlush) {
+	SOLFRA::ProfilerScope profile(SOLFRA::Profiler::P_OutputFlush);
 	for (OutputFile * of : m_outputFiles)
-		of->flushCache();
+		of->flushCache(finalFlush);
+	m_storedBytes = 0;
+}
+
+
+void OutputHandler::writeThinningStatistics() const {
+	FUNCID(OutputHandler::writeThinningStatistics);
+	if (m_thinningTolerance == 0)
+		return;
+	IBK::IBK_Message("Output thinning:\n", IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_INFO);
+	IBK_MSG_INDENT;
+	for (const OutputFile * of : m_outputFiles) {
+		if (of->m_rowsWritten == 0)
+			continue;
+		IBK::IBK_Message(IBK::FormatString("%1 : %2 rows written, %3 rows skipped\n")
+						 .arg(of->m_filename,40,std::ios_base::left).arg(of->m_rowsWritten).arg(of->m_rowsThinned),
+						 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_INFO);
+	}
+}
+
+
+double OutputHandler::nextOutputTime(double t_secondsOfYear) {
+	m_nextOutputQueue.advance(t_secondsOfYear, m_dueGrids);
+	return m_nextOutputQueue.nextOutputTime();
+}
+
+
+void OutputHandler::setupGatherLists() {
+	m_gridOutputFiles.clear();
+	m_gridOutputFiles.resize(m_grids->size());
+	m_gridGatherLists.clear();
+	m_gridGatherLists.resize(m_grids->size());
+
+	for (OutputFile * of : m_outputFiles) {
+		// files without columns are never written
+		if (of->m_numCols == 0)
+			continue;
+		// grid reference points into the grids vector
+		unsigned int gridIdx = (unsigned int)(of->m_gridRef - m_grids->data());
+		IBK_ASSERT(gridIdx < m_grids->size());
+		std::vector<OutputFile*> & files = m_gridOutputFiles[gridIdx];
+		unsigned int fileIdx = (unsigned int)files.size();
+		files.push_back(of);
+
+		for (unsigned int i=0; i<of->m_numCols; ++i) {
+			if (of->m_outputVarInfo[i].m_timeType != NANDRAD::OutputDefinition::OTT_NONE)
+				continue;
+			GatherEntry e;
+			e.m_valueRef = of->m_outputVarInfo[i].m_valueRef;
+			e.m_fileIdx = fileIdx;
+			e.m_col = i+1; // Mind: column 0 is the time column
+			m_gridGatherLists[gridIdx].push_back(e);
+		}
+	}
+
+	// sort value references by address, so that results of the same model are read together
+	for (std::vector<GatherEntry> & gatherList : m_gridGatherLists)
+		std::sort(gatherList.begin(), gatherList.end(),
+				  [](const GatherEntry & a, const GatherEntry & b) { return std::less<const double*>()(a.m_valueRef, b.m_valueRef); });
 }
 
 
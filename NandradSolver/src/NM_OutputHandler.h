@@ -29,6 +29,7 @@
 #include <IBK_Path.h>
 
 #include "NM_QuantityDescription.h"
+#include "NM_OutputGridQueue.h"
 
 namespace IBK {
 	class StopWatch;
@@ -36,6 +37,7 @@ namespace IBK {
 
 namespace NANDRAD {
 	class Project;
+	class OutputGrid;
 }
 
 namespace NANDRAD_MODEL {
@@ -55,6 +57,10 @@ class AbstractModel;
 
 	Output files are created on first call.
 
+	Output grids are scheduled with priority queues (see OutputGridQueue), so that only those output files
+	are processed in writeOutputs(), whose output grid is due at the current time point. For all due files,
+	the current values of all columns are gathered at once, with value references sorted by memory address.
+
 	\note Note that output handler operates with three time points (within writeOutputs()):
 	- \a t_out - Output time point in [s] in simulation time (i.e. starts with 0 when solver starts). \a t_out is
 		needed for interpolating integral values and is passed to output files when writing outputs (to cache).
@@ -105,8 +111,19 @@ public:
 	*/
 	void writeOutputs(double t_out, double t_secondsOfYear, const std::map<std::string, std::string> & varSubstitutionMap);
 
-	/*! When called, asks all output files to flush their cached data to file. */
-	void flushCache();
+	/*! When called, asks all output files to flush their cached data to file.
+		\param finalFlush If true, rows held back by output thinning are written as well (at end of simulation).
+	*/
+	void flushCache(bool finalFlush = false);
+
+	/*! Writes number of written and skipped rows of all files, if output thinning is enabled. */
+	void writeThinningStatistics() const;
+
+	/*! Computes and returns next output time point of all output grids past t_secondsOfYear.
+		\param t_secondsOfYear Time point as offset to Midnight January 1st in the start year.
+		\return Next output time point as offset to Midnight January 1st in the start year.
+	*/
+	double nextOutputTime(double t_secondsOfYear);
 
 
 	/*! Vector with output file objects.
@@ -124,6 +141,9 @@ public:
 	/*! Cached flag if using binary files or not. */
 	bool										m_binaryFiles;
 
+	/*! Relative tolerance for output thinning, 0 if disabled. */
+	double										m_thinningTolerance = 0;
+
 	/*! Unit to be used for time points in output files. */
 	IBK::Unit									m_timeUnit;
 
@@ -140,6 +160,46 @@ public:
 
 	/*! Number of seconds to wait before before flushing the cache. */
 	double										m_realTimeOutputDelay;
+
+private:
+	/*! Creates the per-grid lists of output files and gathered value references.
+		Called on first writeOutputs() call, when all value references have been resolved.
+	*/
+	void setupGatherLists();
+
+	/*! A single value reference to be gathered into the cache row of an output file. */
+	struct GatherEntry {
+		/*! Pointer to result value. */
+		const double								*m_valueRef;
+		/*! Index of output file within list of output files of the grid. */
+		unsigned int								m_fileIdx;
+		/*! Column index in cache row (column 0 is the time column). */
+		unsigned int								m_col;
+	};
+
+	/*! Pointer to output grids in project (not owned). */
+	const std::vector<NANDRAD::OutputGrid>		*m_grids = nullptr;
+
+	/*! Schedule of output grids used in nextOutputTime(). */
+	OutputGridQueue								m_nextOutputQueue;
+	/*! Schedule of output grids used in writeOutputs(). */
+	OutputGridQueue								m_writeOutputQueue;
+
+	/*! Output files with at least one column for each grid (index matches m_grids). */
+	std::vector<std::vector<OutputFile*> >		m_gridOutputFiles;
+	/*! Value references of all OTT_NONE columns of the output files for each grid, sorted by address. */
+	std::vector<std::vector<GatherEntry> >		m_gridGatherLists;
+
+	/*! Indexes of due grids (work vector, used in writeOutputs()). */
+	std::vector<unsigned int>					m_dueGrids;
+	/*! Pointers to new cache rows of all output files of a grid (work vector, used in writeOutputs()). */
+	std::vector<double*>						m_rowBuffers;
+
+	/*! Number of bytes currently held in the caches of all output files.
+		Updated whenever a row is cached, so that we do not need to ask every output file for its
+		cache size in each writeOutputs() call.
+	*/
+	unsigned int								m_storedBytes = 0;
 };
 
 
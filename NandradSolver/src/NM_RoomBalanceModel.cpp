@@ -21,6 +21,8 @@
 
 #include "NM_RoomBalanceModel.h"
 
+#include <cstring>
+
 #include <NANDRAD_ModelInputReference.h>
 #include <NANDRAD_SimulationParameter.h>
 #include <NANDRAD_Zone.h>
@@ -50,15 +52,16 @@ void RoomBalanceModel::setup( const NANDRAD::SimulationParameter &simPara) {
 	if (m_moistureBalanceEnabled) {
 		m_results.resize(NUM_R);
 		// resize ydot vector - two balance equations
-		m_ydot.resize(2);
+		m_ydotStorage.resize(2);
 	}
 	else {
 		// resize results vector
 		m_results.resize(R_CompleteMoistureLoad); // R_CompleteMoistureLoad = first moisture-related result
 
 		// resize ydot vector - one balance equation
-		m_ydot.resize(1);
+		m_ydotStorage.resize(1);
 	}
+	m_ydot = m_ydotStorage.data();
 }
 
 
@@ -683,14 +686,10 @@ int RoomBalanceModel::update() {
 }
 
 
-int RoomBalanceModel::ydot(double* ydot) {
-	// copy values to ydot
-	ydot[0] = m_ydot[0];
-	if (m_ydot.size() > 1) {
-		ydot[1] = m_ydot[1];
-	}
-	// signal success
-	return 0;
+void RoomBalanceModel::setYdotTarget(double * ydot) {
+	// copy current values to new location
+	std::memcpy(ydot, m_ydot, m_ydotStorage.size()*sizeof(double));
+	m_ydot = ydot;
 }
 
 
@@ -41,10 +41,8 @@ namespace NANDRAD_MODEL {
 	is enabled, it also balances moisture content in the room air.
 
 	This is a "tail"-type model and explicitely evaluated last in the model evaluation.
-	It is not part of the dependency graph and the solver framework calls update() and ydot()
-	directly at the end of the model update.
-
-	The retrieved ydot values are then used by the time integrator.
+	The divergences are written directly into the zone's slice of the global ydot vector
+	(see setYdotTarget()), which is then used by the time integrator.
 */
 class RoomBalanceModel : public AbstractModel, public AbstractStateDependency {
 public:
@@ -137,8 +135,12 @@ public:
 
 	// *** Other public member functions
 
-	/*! Stores the divergences of all balance equations in this zone in vector ydot. */
-	int ydot(double* ydot);
+	/*! Redirects storage of divergences of all balance equations in this zone to the given memory location.
+		The ydot pointer addresses the zone's slice of the global ydot vector, so that update() writes
+		the divergences directly into the solver's ydot vector.
+		\note Must be called before stateDependencies() or resultValueRef() for 'ydot' are requested.
+	*/
+	void setYdotTarget(double * ydot);
 
 private:
 	/*! Zone ID. */
@@ -211,8 +213,12 @@ private:
 	/*! Value reference for ideal cooling loads in [W] (positive if into room). */
 	const double *									m_idealCoolingLoadValueRef = nullptr;
 
-	/*! Vector with cached derivatives, updated at last call to update(). */
-	std::vector<double>								m_ydot;
+	/*! Pointer to divergences, updated at last call to update().
+		Points either to m_ydotStorage or into global ydot vector (see setYdotTarget()).
+	*/
+	double											*m_ydot = nullptr;
+	/*! Model-owned storage for divergences, used until setYdotTarget() is called. */
+	std::vector<double>								m_ydotStorage;
 
 	/*! Constant pointer to the simulation parameter. */
 	const NANDRAD::SimulationParameter				*m_simPara = nullptr;
@@ -36,6 +36,7 @@
 #include <IBK_StringUtils.h>
 #include <IBK_Time.h>
 #include <IBK_Constants.h>
+#include <IBK_messages.h>
 
 #include <NANDRAD_DailyCycle.h>
 #include <NANDRAD_Interval.h>
@@ -65,10 +66,15 @@ int Schedules::setTime(double t) {
 			t -= IBK::SECONDS_PER_YEAR;
 	}
 
+	// evaluate all distinct daily cycle schedules
+	m_dailyCycleSchedules.setTime(t);
+
 	// calculate all parameter values
 	double * result = &m_results[0]; // points to first double in vector with calculated spline values
 	for (unsigned int i = 0; i<m_results.size(); ++i) {
-		if (m_interpolationMethod[i] == NANDRAD::LinearSplineParameter::I_LINEAR ||
+		if (m_dailyCycleScheduleIndex[i] != NANDRAD::INVALID_ID)
+			result[i] = m_dailyCycleSchedules.value(m_dailyCycleScheduleIndex[i]);
+		else if (m_interpolationMethod[i] == NANDRAD::LinearSplineParameter::I_LINEAR ||
 			m_interpolationMethod[i] == NANDRAD::LinearSplineParameter::NUM_I)
 			result[i] = m_valueSpline[i].value(t);
 		else
@@ -156,15 +162,15 @@ void Schedules::setup(NANDRAD::Project &project) {
 
 			m_variableNames.push_back(objectListName + "::" + var.first);
 			m_variableUnits.push_back(var.second);
-			// now generate the linear splines
+			// empty dummy spline to keep vector at same size
 			m_valueSpline.push_back(IBK::LinearSpline());
 			// and initialize memory for corresponding result values
 			m_results.push_back(0);
 			// this is just a dummy to keep vector at same size
 			m_interpolationMethod.push_back(NANDRAD::LinearSplineParameter::NUM_I);
 
-			// now populate spline
-			IBK::LinearSpline & spl = m_valueSpline.back();
+			// now generate the annual spline and store it in compact form
+			IBK::LinearSpline spl;
 
 			NANDRAD::DailyCycle::interpolation_t interpolationType;
 			try {
@@ -173,8 +179,13 @@ void Schedules::setup(NANDRAD::Project &project) {
 			catch (IBK::Exception & ex) {
 				throw IBK::Exception(ex, "Error initializing schedules (cannot generate schedule from daily cycle data).", FUNC_ID);
 			}
+			m_dailyCycleScheduleIndex.push_back(m_dailyCycleSchedules.addSchedule(spl));
 		}
 	}
+	if (!m_variableNames.empty())
+		IBK::IBK_Message(IBK::FormatString("%1 scheduled quantities from daily cycles, %2 distinct schedules with %3 distinct day profiles.\n")
+						 .arg(m_variableNames.size()).arg(m_dailyCycleSchedules.scheduleCount())
+						 .arg(m_dailyCycleSchedules.dayProfileCount()), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_DETAILED);
 
 	// setup annual splines
 	for (auto itAnnualSched = m_schedules->m_annualSchedules.begin(); itAnnualSched!=m_schedules->m_annualSchedules.end(); ++itAnnualSched){
@@ -224,6 +235,7 @@ void Schedules::setup(NANDRAD::Project &project) {
 			m_variableUnits.push_back(spl.m_yUnit);
 			// now generate the linear splines
 			m_valueSpline.push_back(spl.m_values);
+			m_dailyCycleScheduleIndex.push_back(NANDRAD::INVALID_ID);
 			m_interpolationMethod.push_back(spl.m_interpolationMethod);
 			// and initialize memory for corresponding result values
 			m_results.push_back(0);
@@ -29,6 +29,7 @@
 
 #include "NM_AbstractModel.h"
 #include "NM_AbstractTimeDependency.h"
+#include "NM_DailyCycleScheduleTable.h"
 
 namespace NANDRAD {
 	class Project;
@@ -53,6 +54,8 @@ class InputReference;
 	Important:
 	- Schedules are implemented as linear splines; when these are composed, the values given in DailyCycles
 	  are converted to the base SI unit. Thus, values retrieved from schedules are *always* in base-SI unit
+	- Splines composed of DailyCycles are not kept, but stored and evaluated in compact form
+	  (see DailyCycleScheduleTable); only annual schedules are stored as linear splines
 */
 class Schedules : public AbstractTimeDependency {
 public:
@@ -155,13 +158,22 @@ private:
 	/*! Corresponding input/output units (Note: results are always stored in the respective base SI unit). */
 	std::vector<IBK::Unit>							m_variableUnits;
 	/*! Linear splines with the actual data, x values are time points in [s], y values are the data values
-		in base SI units.
+		in base SI units (only used for annual schedules, empty for schedules composed of daily cycles).
 	*/
 	std::vector<IBK::LinearSpline>					m_valueSpline;
+	/*! Index of schedule in m_dailyCycleSchedules for schedules composed of daily cycles, INVALID_ID for
+		annual schedules.
+	*/
+	std::vector<unsigned int>						m_dailyCycleScheduleIndex;
 	/*! Corresponding interpolation method (only used for annual splines) */
 	std::vector<NANDRAD::LinearSplineParameter::interpolationMethod_t>		m_interpolationMethod;
 	/*! Variables, computed/updated during the calculation.	*/
 	std::vector<double>								m_results;
+
+	/*! Compact storage of all schedules composed of daily cycles, identical schedules (for example the same
+		schedule used for different object lists) are stored and evaluated only once.
+	*/
+	DailyCycleScheduleTable							m_dailyCycleSchedules;
 };
 
 
@@ -0,0 +1,93 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NM_SharedInputData.h"
+
+#include <IBK_messages.h>
+#include <IBK_Exception.h>
+
+#include <CCM_ClimateDataLoader.h>
+
+#include <SOLFRA_JacobianSparseCSR.h>
+
+namespace NANDRAD_MODEL {
+
+std::shared_ptr<const CCM::ClimateDataLoader> SharedInputData::climateData(const IBK::Path & climateFile) {
+	FUNCID(SharedInputData::climateData);
+
+	std::shared_ptr<ClimateEntry> entry;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		std::shared_ptr<ClimateEntry> & e = m_climateData[climateFile.absolutePath().str()];
+		if (e == nullptr)
+			e.reset(new ClimateEntry);
+		entry = e;
+	}
+
+	// only one thread reads the file, all others wait until data is available
+	std::lock_guard<std::mutex> lock(entry->m_mutex);
+	if (entry->m_data != nullptr) {
+		IBK::IBK_Message(IBK::FormatString("Using shared climate data from file '%1'\n").arg(climateFile),
+						 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+		std::lock_guard<std::mutex> statLock(m_mutex);
+		++m_cacheHits;
+		return entry->m_data;
+	}
+
+	IBK::IBK_Message(IBK::FormatString("Reading climate data file '%1'\n").arg(climateFile), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	std::shared_ptr<CCM::ClimateDataLoader> data(new CCM::ClimateDataLoader);
+	data->readClimateData(climateFile); // may throw, in this case next thread will try again
+	entry->m_data = data;
+
+	std::lock_guard<std::mutex> statLock(m_mutex);
+	++m_cacheMisses;
+	return entry->m_data;
+}
+
+
+std::shared_ptr<const std::vector<std::vector<unsigned int> > > SharedInputData::jacobianColors(
+		const std::vector<unsigned int> & ia, const std::vector<unsigned int> & ja,
+		const std::vector<unsigned int> & iaT, const std::vector<unsigned int> & jaT)
+{
+	std::lock_guard<std::mutex> lock(m_coloringMutex);
+	for (const ColoringEntry & e : m_coloring) {
+		if (e.m_ia == ia && e.m_ja == ja) {
+			std::lock_guard<std::mutex> statLock(m_mutex);
+			++m_cacheHits;
+			return e.m_colors;
+		}
+	}
+
+	std::shared_ptr<std::vector<std::vector<unsigned int> > > colors(new std::vector<std::vector<unsigned int> >);
+	SOLFRA::JacobianSparseCSR::computeColors((unsigned int)ia.size()-1, &ia[0], &ja[0], &iaT[0], &jaT[0], *colors);
+
+	ColoringEntry e;
+	e.m_ia = ia;
+	e.m_ja = ja;
+	e.m_colors = colors;
+	m_coloring.push_back(e);
+
+	std::lock_guard<std::mutex> statLock(m_mutex);
+	++m_cacheMisses;
+	return colors;
+}
+
+} // namespace NANDRAD_MODEL
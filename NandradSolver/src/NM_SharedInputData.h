@@ -0,0 +1,93 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NM_SharedInputDataH
+#define NM_SharedInputDataH
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <IBK_Path.h>
+
+namespace CCM {
+	class ClimateDataLoader;
+}
+
+namespace NANDRAD_MODEL {
+
+/*!	Cache for immutable input data that can be shared between several NandradModel instances running
+	in the same process (see BatchRunner).
+
+	All data is created on first request and afterwards only handed out read-only. All functions are
+	thread-safe. When several models request the same data at the same time, the data is created only
+	once and the other threads wait for it.
+*/
+class SharedInputData {
+public:
+	/*! Returns the climate data read from the given file.
+		Throws an exception if the file cannot be read.
+		\param climateFile Climate data file (placeholders must be replaced already).
+	*/
+	std::shared_ptr<const CCM::ClimateDataLoader> climateData(const IBK::Path & climateFile);
+
+	/*! Returns the coloring information (columns grouped by color) for a Jacobian pattern in CSR format.
+		\sa SOLFRA::JacobianSparseCSR::computeColors()
+	*/
+	std::shared_ptr<const std::vector<std::vector<unsigned int> > > jacobianColors(
+			const std::vector<unsigned int> & ia, const std::vector<unsigned int> & ja,
+			const std::vector<unsigned int> & iaT, const std::vector<unsigned int> & jaT);
+
+	/*! Number of requests answered from cache (for statistics). */
+	unsigned int	m_cacheHits = 0;
+	/*! Number of requests where data had to be created (for statistics). */
+	unsigned int	m_cacheMisses = 0;
+
+private:
+	/*! Cached climate data of a single file. */
+	struct ClimateEntry {
+		std::mutex										m_mutex;
+		std::shared_ptr<const CCM::ClimateDataLoader>	m_data;
+	};
+
+	/*! Cached coloring for a single Jacobian pattern. */
+	struct ColoringEntry {
+		std::vector<unsigned int>										m_ia;
+		std::vector<unsigned int>										m_ja;
+		std::shared_ptr<const std::vector<std::vector<unsigned int> > >	m_colors;
+	};
+
+	/*! Protects the maps/vectors below and the statistics counters. */
+	std::mutex										m_mutex;
+	/*! Climate data, key is the absolute climate file path. */
+	std::map<std::string, std::shared_ptr<ClimateEntry> >	m_climateData;
+
+	/*! Protects m_coloring (coloring is computed while holding this lock). */
+	std::mutex										m_coloringMutex;
+	/*! Coloring information for all Jacobian patterns encountered so far. */
+	std::vector<ColoringEntry>						m_coloring;
+};
+
+} // namespace NANDRAD_MODEL
+
+#endif // NM_SharedInputDataH
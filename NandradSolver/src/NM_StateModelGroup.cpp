@@ -31,6 +31,7 @@
 
 //#include <SOLFRA_JacobianDense.h>
 #include <SOLFRA_JacobianSparseCSR.h>
+#include <SOLFRA_Profiler.h>
 
 #include <IBK_assert.h>
 #include <IBK_math.h>
@@ -484,12 +485,11 @@ int StateModelGroup::update() {
 	switch(m_groupType) {
 		case ZEPPELIN::DependencyGroup::SEQUENTIAL : {
 			int calculationResultFlag = 0;
-			for (std::vector<AbstractStateDependency*>::const_iterator it = m_models.begin();
-				it != m_models.end(); ++it)
-			{
+			for (unsigned int i=0; i<m_models.size(); ++i) {
 				// do not allow empty model references
-				IBK_ASSERT(*it != nullptr);
-				calculationResultFlag |= (*it)->update();
+				IBK_ASSERT(m_models[i] != nullptr);
+				SOLFRA::ProfilerScope profile(m_profilerCounterIds.empty() ? SOLFRA::Profiler::NO_COUNTER : m_profilerCounterIds[i]);
+				calculationResultFlag |= m_models[i]->update();
 			}
 			// enforce solver abort
 			if (calculationResultFlag & 2)
@@ -152,6 +152,11 @@ public:
 	*/
 	void updateStates();
 
+	/*! Profiler counter IDs for all models in sequential groups (same size as m_models, or empty if not profiled).
+		Cyclic groups are profiled as a whole by the caller.
+	*/
+	std::vector<unsigned int>				m_profilerCounterIds;
+
 
 protected:
 
@@ -181,7 +181,8 @@ void ThermalNetworkBalanceModel::setup(ThermalNetworkStatesModel *statesModel) {
 	m_modelQuantityOffset.push_back(m_modelQuantities.size());
 
 	// resize vectors (guaranteed to be not empty)
-	m_ydot.resize(m_statesModel->nPrimaryStateResults());
+	m_ydotStorage.resize(m_statesModel->nPrimaryStateResults());
+	m_ydot = m_ydotStorage.data();
 }
 
 
@@ -630,11 +631,10 @@ int ThermalNetworkBalanceModel::update() {
 }
 
 
-int ThermalNetworkBalanceModel::ydot(double* ydot) {
-	// copy values to ydot
-	std::memcpy(ydot, &m_ydot[0], m_ydot.size() * sizeof (double));
-	// signal success
-	return 0;
+void ThermalNetworkBalanceModel::setYdotTarget(double * ydot) {
+	// copy current values to new location
+	std::memcpy(ydot, m_ydot, m_ydotStorage.size() * sizeof (double));
+	m_ydot = ydot;
 }
 
 
@@ -141,8 +141,10 @@ public:
 
 	// *** Other public member functions
 
-	/*! Stores the divergences of all balance equations in this zone in vector ydot. */
-	int ydot(double* ydot);
+	/*! Redirects storage of divergences to the network's slice of the global ydot vector.
+		\note Must be called before stateDependencies() or resultValueRef() for 'ydot' are requested.
+	*/
+	void setYdotTarget(double * ydot);
 
 private:
 	void printVars() const;
@@ -250,8 +252,12 @@ private:
 	unsigned int									m_id;
 	/*! Display name (for error messages). */
 	std::string										m_displayName;
-	/*! Vector with cached derivatives, updated at last call to update(). */
-	std::vector<double>								m_ydot;
+	/*! Pointer to derivatives, updated at last call to update().
+		Points either to m_ydotStorage or into global ydot vector (see setYdotTarget()).
+	*/
+	double											*m_ydot = nullptr;
+	/*! Model-owned storage for derivatives, used until setYdotTarget() is called. */
+	std::vector<double>								m_ydotStorage;
 
 	/*! Properties of all zones involved in heat exchange to a network element.
 		One ZoneProperties element for each zone that one or more flow elements exchange heat with.
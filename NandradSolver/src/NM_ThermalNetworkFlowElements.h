@@ -136,6 +136,7 @@ private:
 	double							m_outerHeatTransferCoefficient = -999;
 
 	friend class ThermalNetworkBalanceModel;
+	friend class ThermalNetworkPipeBatch;
 };
 
 
@@ -334,6 +335,7 @@ private:
 	std::ofstream					*m_ofstream = nullptr;
 
 	friend class ThermalNetworkBalanceModel;
+	friend class ThermalNetworkPipeBatch;
 };
 
 
@@ -465,6 +467,7 @@ private:
 	double							m_UAValue = -999;
 
 	friend class ThermalNetworkBalanceModel;
+	friend class ThermalNetworkPipeBatch;
 };
 
 #endif  // DETAILLED_WALL_CAPACITY
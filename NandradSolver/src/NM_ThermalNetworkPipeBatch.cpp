@@ -0,0 +1,287 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NM_ThermalNetworkPipeBatch.h"
+
+#include "NM_ThermalNetworkFlowElements.h"
+
+#include <NANDRAD_HydraulicFluid.h>
+
+#include <IBK_assert.h>
+#include <IBK_FluidPhysics.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace NANDRAD_MODEL {
+
+// *** ThermalNetworkFluidPropertyTable ***
+
+void ThermalNetworkFluidPropertyTable::setup(const IBK::LinearSpline & spline) {
+	IBK_ASSERT(!spline.empty());
+	m_x = spline.x();
+	m_y = spline.y();
+	// single-point splines are handled through constant extrapolation in value()
+	if (m_x.size() == 1) {
+		m_index.assign(1, 0);
+		m_invCellWidth = 0;
+		return;
+	}
+
+	// cell width is half of the smallest interval width, so that each cell overlaps at most two intervals
+	double minDx = m_x.back() - m_x.front();
+	for (unsigned int i=1; i<m_x.size(); ++i)
+		minDx = std::min(minDx, m_x[i] - m_x[i-1]);
+	// limit table size for splines with very narrow intervals
+	unsigned int nCells = std::min<unsigned int>(100000, (unsigned int)std::ceil(2*(m_x.back() - m_x.front())/minDx));
+	double cellWidth = (m_x.back() - m_x.front())/nCells;
+	m_invCellWidth = 1.0/cellWidth;
+
+	// last entry catches rounding at the upper limit
+	m_index.resize(nCells+1);
+	unsigned int j = 0;
+	for (unsigned int i=0; i<=nCells; ++i) {
+		double x = m_x.front() + i*cellWidth;
+		while (j+2 < m_x.size() && x >= m_x[j+1])
+			++j;
+		m_index[i] = j;
+	}
+}
+
+
+// *** ThermalNetworkPipeBatch ***
+
+void ThermalNetworkPipeBatch::PipeGroup::resize(unsigned int n) {
+	m_UALength.resize(n);
+	m_length.resize(n);
+	m_innerDiameter.resize(n);
+	m_crossSection.resize(n);
+	m_outerResistance.resize(n);
+	m_wallResistance.resize(n);
+	m_nParallelPipes.resize(n);
+	m_massFlux.resize(n);
+	m_meanTemperature.resize(n);
+	m_volumeFlow.resize(n);
+	m_velocity.resize(n);
+	m_viscosity.resize(n);
+	m_reynolds.resize(n);
+	m_prandtl.resize(n);
+	m_nusselt.resize(n);
+	m_UAValue.resize(n);
+}
+
+
+void ThermalNetworkPipeBatch::setup(const std::vector<ThermalNetworkAbstractFlowElement *> & flowElements,
+									const NANDRAD::HydraulicFluid & fluid)
+{
+	m_batched.resize(flowElements.size(), false);
+	m_simplePipeElements.clear();
+	m_dynamicPipeElements.clear();
+
+	for (unsigned int i=0; i<flowElements.size(); ++i) {
+		TNSimplePipeElement * simplePipe = dynamic_cast<TNSimplePipeElement *>(flowElements[i]);
+		if (simplePipe != nullptr) {
+			m_simplePipeElements.push_back(simplePipe);
+			m_batched[i] = true;
+			continue;
+		}
+#ifndef DETAILLED_WALL_CAPACITY
+		TNDynamicPipeElement * dynamicPipe = dynamic_cast<TNDynamicPipeElement *>(flowElements[i]);
+		if (dynamicPipe != nullptr) {
+			m_dynamicPipeElements.push_back(dynamicPipe);
+			m_batched[i] = true;
+		}
+#endif // DETAILLED_WALL_CAPACITY
+	}
+
+	if (m_simplePipeElements.empty() && m_dynamicPipeElements.empty())
+		return;
+
+	// fluid properties are the same for all elements of the network
+	m_fluidDensity = fluid.m_para[NANDRAD::HydraulicFluid::P_Density].value;
+	m_fluidHeatCapacity = fluid.m_para[NANDRAD::HydraulicFluid::P_HeatCapacity].value;
+	m_fluidConductivity = fluid.m_para[NANDRAD::HydraulicFluid::P_Conductivity].value;
+	m_viscosityTable.setup(fluid.m_kinematicViscosity.m_values);
+
+	// copy constant parameters into structure of arrays
+
+	m_simplePipes.resize(m_simplePipeElements.size());
+	for (unsigned int i=0; i<m_simplePipeElements.size(); ++i) {
+		const TNSimplePipeElement * e = m_simplePipeElements[i];
+		m_simplePipes.m_UALength[i] = e->m_length;
+		m_simplePipes.m_length[i] = e->m_length;
+		m_simplePipes.m_innerDiameter[i] = e->m_innerDiameter;
+		m_simplePipes.m_crossSection[i] = e->m_fluidCrossSection;
+		m_simplePipes.m_outerResistance[i] = (e->m_outerHeatTransferCoefficient == 0.) ? 0. :
+				1.0 / (e->m_outerHeatTransferCoefficient * e->m_outerDiameter * PI);
+		m_simplePipes.m_wallResistance[i] = 1.0 / e->m_UValuePipeWall;
+		m_simplePipes.m_nParallelPipes[i] = e->m_nParallelPipes;
+	}
+
+#ifndef DETAILLED_WALL_CAPACITY
+	m_dynamicPipes.resize(m_dynamicPipeElements.size());
+	for (unsigned int i=0; i<m_dynamicPipeElements.size(); ++i) {
+		const TNDynamicPipeElement * e = m_dynamicPipeElements[i];
+		m_dynamicPipes.m_UALength[i] = e->m_discLength;
+		m_dynamicPipes.m_length[i] = e->m_length;
+		m_dynamicPipes.m_innerDiameter[i] = e->m_innerDiameter;
+		m_dynamicPipes.m_crossSection[i] = e->m_fluidCrossSection;
+		m_dynamicPipes.m_outerResistance[i] = (e->m_outerHeatTransferCoefficient == 0.) ? 0. :
+				1.0 / (e->m_outerHeatTransferCoefficient * e->m_outerDiameter * PI);
+		m_dynamicPipes.m_wallResistance[i] = 1.0 / e->m_UValuePipeWall;
+		m_dynamicPipes.m_nParallelPipes[i] = e->m_nParallelPipes;
+	}
+#endif // DETAILLED_WALL_CAPACITY
+}
+
+
+void ThermalNetworkPipeBatch::computeUAValues(PipeGroup & g) const {
+	const unsigned int n = g.m_massFlux.size();
+
+	// Note: the loops are split so that the compiler can vectorize the simple arithmetic parts.
+
+	// volume flow and velocity
+	const double * massFlux = g.m_massFlux.data();
+	const double * crossSection = g.m_crossSection.data();
+	double * volumeFlow = g.m_volumeFlow.data();
+	double * velocity = g.m_velocity.data();
+	for (unsigned int i=0; i<n; ++i) {
+		volumeFlow[i] = std::fabs(massFlux[i])/m_fluidDensity; // m3/s !!! unit conversion is done when writing outputs
+		// note: velocity is calculated for a single pipe (but mass flux interpreted as flux through all parallel pipes)
+		velocity[i] = volumeFlow[i]/crossSection[i];
+	}
+
+	// viscosity lookup from shared table
+	const double * meanTemperature = g.m_meanTemperature.data();
+	double * viscosity = g.m_viscosity.data();
+	for (unsigned int i=0; i<n; ++i)
+		viscosity[i] = m_viscosityTable.value(meanTemperature[i]);
+
+	// dimensionless numbers
+	const double * innerDiameter = g.m_innerDiameter.data();
+	double * reynolds = g.m_reynolds.data();
+	double * prandtl = g.m_prandtl.data();
+	for (unsigned int i=0; i<n; ++i) {
+		// same expressions as in IBK::ReynoldsNumber() and IBK::PrandtlNumber()
+		reynolds[i] = velocity[i] * innerDiameter[i] / viscosity[i];
+		prandtl[i] = viscosity[i] * m_fluidHeatCapacity * m_fluidDensity / m_fluidConductivity;
+	}
+
+	// Nusselt number (branches for laminar/transition/turbulent flow, not vectorized)
+	const double * length = g.m_length.data();
+	double * nusselt = g.m_nusselt.data();
+	for (unsigned int i=0; i<n; ++i)
+		nusselt[i] = IBK::NusseltNumber(reynolds[i], prandtl[i], length[i], innerDiameter[i]);
+
+	// UA-value in W/K, basically the u-value per length pipe (including transfer coefficients) x pipe length
+	const double * UALength = g.m_UALength.data();
+	const double * outerResistance = g.m_outerResistance.data();
+	const double * wallResistance = g.m_wallResistance.data();
+	double * UAValue = g.m_UAValue.data();
+	for (unsigned int i=0; i<n; ++i) {
+		double innerHeatTransferCoefficient = nusselt[i] * m_fluidConductivity / innerDiameter[i];
+		UAValue[i] = UALength[i] /
+				(
+					  1.0 / (innerHeatTransferCoefficient * innerDiameter[i] * PI)
+					+ outerResistance[i]
+					+ wallResistance[i]
+				);
+	}
+}
+
+
+void ThermalNetworkPipeBatch::update() {
+
+	// *** simple pipes ***
+
+	const unsigned int nSimple = m_simplePipeElements.size();
+	if (nSimple != 0) {
+		PipeGroup & g = m_simplePipes;
+		// gather inputs
+		for (unsigned int i=0; i<nSimple; ++i) {
+			const TNSimplePipeElement * e = m_simplePipeElements[i];
+			g.m_massFlux[i] = e->m_massFlux;
+			g.m_meanTemperature[i] = e->m_meanTemperature;
+		}
+
+		computeUAValues(g);
+
+		// scatter results into elements, since these are referenced as model quantities
+		for (unsigned int i=0; i<nSimple; ++i) {
+			TNSimplePipeElement * e = m_simplePipeElements[i];
+			e->m_volumeFlow = g.m_volumeFlow[i];
+			e->m_velocity = g.m_velocity[i];
+			e->m_viscosity = g.m_viscosity[i];
+			e->m_reynolds = g.m_reynolds[i];
+			e->m_prandtl = g.m_prandtl[i];
+			e->m_nusselt = g.m_nusselt[i];
+			e->m_UAValue = g.m_UAValue[i];
+			IBK_ASSERT(e->m_heatExchangeTemperatureRef != nullptr);
+			// Q in [W] = DeltaT * UAValueTotal
+			e->m_heatLoss = g.m_UAValue[i] * (g.m_meanTemperature[i] - *e->m_heatExchangeTemperatureRef) * g.m_nParallelPipes[i];
+		}
+	}
+
+#ifndef DETAILLED_WALL_CAPACITY
+
+	// *** dynamic pipes ***
+
+	const unsigned int nDynamic = m_dynamicPipeElements.size();
+	if (nDynamic != 0) {
+		PipeGroup & g = m_dynamicPipes;
+		for (unsigned int i=0; i<nDynamic; ++i) {
+			const TNDynamicPipeElement * e = m_dynamicPipeElements[i];
+			g.m_massFlux[i] = e->m_massFlux;
+			// assume constant heat transfer coefficient along pipe, using average temperature
+			g.m_meanTemperature[i] = e->m_meanTemperature;
+		}
+
+		computeUAValues(g);
+
+		for (unsigned int i=0; i<nDynamic; ++i) {
+			TNDynamicPipeElement * e = m_dynamicPipeElements[i];
+			e->m_volumeFlow = g.m_volumeFlow[i];
+			e->m_velocity = g.m_velocity[i];
+			e->m_viscosity = g.m_viscosity[i];
+			e->m_reynolds = g.m_reynolds[i];
+			e->m_prandtl = g.m_prandtl[i];
+			e->m_nusselt = g.m_nusselt[i];
+			e->m_UAValue = g.m_UAValue[i];
+
+			IBK_ASSERT(e->m_heatExchangeTemperatureRef != nullptr);
+			const double externalTemperature = *e->m_heatExchangeTemperatureRef;
+			const double UAValue = g.m_UAValue[i];
+			const double nParallelPipes = g.m_nParallelPipes[i];
+			const double * temperatures = e->m_temperatures.data();
+			double * heatLosses = e->m_heatLosses.data();
+			double heatLoss = 0.0;
+			for (unsigned int j=0; j<e->m_nVolumes; ++j) {
+				heatLosses[j] = UAValue * (temperatures[j] - externalTemperature) * nParallelPipes;
+				heatLoss += heatLosses[j];
+			}
+			e->m_heatLoss = heatLoss;
+		}
+	}
+
+#endif // DETAILLED_WALL_CAPACITY
+}
+
+} // namespace NANDRAD_MODEL
@@ -0,0 +1,177 @@
+/*	NANDRAD Solver Framework and Model Implementation.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NM_ThermalNetworkPipeBatchH
+#define NM_ThermalNetworkPipeBatchH
+
+#include <vector>
+
+#include <IBK_LinearSpline.h>
+
+namespace NANDRAD {
+	class HydraulicFluid;
+}
+
+namespace NANDRAD_MODEL {
+
+class ThermalNetworkAbstractFlowElement;
+class TNSimplePipeElement;
+class TNDynamicPipeElement;
+
+/*! Temperature-dependent fluid property lookup table, shared by all pipes of a network.
+
+	The table is generated once from the fluid's linear spline. An equidistant index table maps
+	a temperature to the spline interval in O(1), so that the lookup avoids the binary search of
+	IBK::LinearSpline::value(). Interpolation uses the original spline supporting points and
+	hence yields the same values as the spline itself (constant extrapolation).
+*/
+class ThermalNetworkFluidPropertyTable { // NO KEYWORDS
+public:
+	/*! Initializes table from a linear spline. */
+	void setup(const IBK::LinearSpline & spline);
+
+	/*! Returns interpolated value at temperature x. */
+	double value(double x) const {
+		if (x <= m_x.front())
+			return m_y.front();
+		if (x >= m_x.back())
+			return m_y.back();
+		unsigned int i = m_index[(unsigned int)((x - m_x.front())*m_invCellWidth)];
+		// advance to interval containing x (at most a few steps, since cells are narrower than intervals)
+		while (x > m_x[i+1])
+			++i;
+		double alpha = (x - m_x[i])/(m_x[i+1]-m_x[i]);
+		return m_y[i]*(1-alpha) + m_y[i+1]*alpha;
+	}
+
+private:
+	/*! Supporting points of the spline. */
+	std::vector<double>			m_x;
+	/*! Values at supporting points. */
+	std::vector<double>			m_y;
+	/*! Index of the spline interval at the lower bound of each equidistant cell. */
+	std::vector<unsigned int>	m_index;
+	/*! Inverse of the equidistant cell width in [1/K]. */
+	double						m_invCellWidth = 0;
+};
+
+
+/*! Structure-of-arrays evaluation of all pipe elements with heat exchange in a thermal network.
+
+	For networks with thousands of pipes, the per-element virtual setInflowTemperature() calls with
+	individual viscosity spline evaluations dominate ThermalNetworkModelImpl::update(). The batch
+	collects all TNSimplePipeElement and TNDynamicPipeElement objects at setup and stores their
+	constant parameters in contiguous arrays. During update(), inputs are gathered from the elements,
+	the heat transfer calculation is done in tight loops over all pipes of one type and the results are
+	written back into the element member variables (which are published as model quantities).
+
+	All other flow elements (pumps, heat pumps, ...) are not affected and are still evaluated through
+	their virtual interface.
+*/
+class ThermalNetworkPipeBatch { // NO KEYWORDS
+public:
+
+	/*! Collects all batch-capable pipe elements from the given flow element vector.
+		\param flowElements All thermal flow elements of the network.
+		\param fluid Fluid used in the network, provides viscosity spline.
+	*/
+	void setup(const std::vector<ThermalNetworkAbstractFlowElement*> & flowElements,
+			   const NANDRAD::HydraulicFluid & fluid);
+
+	/*! Returns true, if flow element with given index is evaluated by the batch. */
+	bool isBatched(unsigned int flowElementIdx) const { return m_batched[flowElementIdx]; }
+
+	/*! Computes heat losses of all batched pipes.
+		Mass fluxes, mean temperatures and inflow temperatures must have been set in the elements already.
+	*/
+	void update();
+
+private:
+	/*! Flag for each flow element, true if element is evaluated by the batch. */
+	std::vector<bool>					m_batched;
+
+	/*! Shared kinematic viscosity table (same fluid for all elements in a network). */
+	ThermalNetworkFluidPropertyTable	m_viscosityTable;
+
+	// Common fluid properties
+
+	/*! Fluid density [kg/m3]. */
+	double								m_fluidDensity = -999;
+	/*! Fluid heat capacity [J/kgK]. */
+	double								m_fluidHeatCapacity = -999;
+	/*! Fluid conductivity [W/mK]. */
+	double								m_fluidConductivity = -999;
+
+	/*! Data of a group of pipes of the same element type, stored as structure of arrays. */
+	struct PipeGroup {
+		/*! Resizes all vectors. */
+		void resize(unsigned int n);
+
+		// constant parameters
+
+		/*! Length used for UA-value calculation (full or discretization length) [m]. */
+		std::vector<double>		m_UALength;
+		/*! Pipe length [m]. */
+		std::vector<double>		m_length;
+		/*! Inner diameter [m]. */
+		std::vector<double>		m_innerDiameter;
+		/*! Flow cross-section of all parallel pipes [m2]. */
+		std::vector<double>		m_crossSection;
+		/*! Thermal resistance per length of outer heat transfer [mK/W], 0 if no outer heat transfer coefficient is given. */
+		std::vector<double>		m_outerResistance;
+		/*! Thermal resistance per length of pipe wall [mK/W]. */
+		std::vector<double>		m_wallResistance;
+		/*! Number of parallel pipes. */
+		std::vector<double>		m_nParallelPipes;
+
+		// gathered inputs
+
+		/*! Mass flux [kg/s]. */
+		std::vector<double>		m_massFlux;
+		/*! Mean fluid temperature [K]. */
+		std::vector<double>		m_meanTemperature;
+
+		// computed results
+
+		std::vector<double>		m_volumeFlow;
+		std::vector<double>		m_velocity;
+		std::vector<double>		m_viscosity;
+		std::vector<double>		m_reynolds;
+		std::vector<double>		m_prandtl;
+		std::vector<double>		m_nusselt;
+		std::vector<double>		m_UAValue;
+	};
+
+	/*! Computes UA-values for all pipes in the group, shared by both pipe types. */
+	void computeUAValues(PipeGroup & g) const;
+
+	/*! Simple pipes (single well-mixed volume). */
+	std::vector<TNSimplePipeElement*>	m_simplePipeElements;
+	PipeGroup							m_simplePipes;
+
+	/*! Dynamic pipes (discretized volumes). */
+	std::vector<TNDynamicPipeElement*>	m_dynamicPipeElements;
+	PipeGroup							m_dynamicPipes;
+};
+
+} // namespace NANDRAD_MODEL
+
+#endif // NM_ThermalNetworkPipeBatchH
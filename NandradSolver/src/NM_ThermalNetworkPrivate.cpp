@@ -55,6 +55,8 @@ void ThermalNetworkModelImpl::setup(const Network &nw,
 	m_nodelHeatLoads.resize(nw.m_nodes.size(), 0.0);
 	// get fluid heat capacity
 	m_fluid = &fluid;
+	// collect all pipes that can be evaluated in a vectorized manner
+	m_pipeBatch.setup(m_flowElements, fluid);
 }
 
 
@@ -143,9 +145,15 @@ int ThermalNetworkModelImpl::update() {
 			inflowTemp = m_nodalTemperatures[fe.m_nodeIndexInlet];
 		else
 			inflowTemp = m_nodalTemperatures[fe.m_nodeIndexOutlet];
-		// set all nodal conditions
-		flowElem->setInflowTemperature(inflowTemp);
+		// set all nodal conditions; batched pipes only store the inflow temperature and are computed below
+		if (m_pipeBatch.isBatched(i))
+			flowElem->m_inflowTemperature = inflowTemp;
+		else
+			flowElem->setInflowTemperature(inflowTemp);
 	}
+
+	// now compute heat losses of all batched pipes
+	m_pipeBatch.update();
 	return 0;
 }
 
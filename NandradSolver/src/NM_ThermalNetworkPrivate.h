@@ -23,6 +23,7 @@
 #define NM_ThermalNetworkPrivateH
 
 #include "NM_ThermalNetworkAbstractFlowElementWithHeatLoss.h"
+#include "NM_ThermalNetworkPipeBatch.h"
 
 #include <vector>
 
@@ -96,6 +97,11 @@ public:
 	*/
 	const double									*m_fluidMassFluxes;
 
+	/*! Vectorized evaluation of all pipe elements with heat exchange.
+		Flow elements handled by the batch are skipped when calling setInflowTemperature() in update().
+	*/
+	ThermalNetworkPipeBatch							m_pipeBatch;
+
 private:
 
 	/*! Constant access to fluid. */
@@ -35,14 +35,6 @@
 namespace NANDRAD_MODEL {
 
 
-ThermostatModel::~ThermostatModel() {
-	// memory cleanup
-	for (AbstractController * ptr : m_controllers)
-		delete ptr;
-	m_controllers.clear();
-}
-
-
 void ThermostatModel::setup(const NANDRAD::Thermostat & thermostat,
 							const std::vector<NANDRAD::ObjectList> & objLists,
 							const std::vector<NANDRAD::Zone> & zones)
@@ -102,30 +94,31 @@ void ThermostatModel::initResults(const std::vector<AbstractModel *> &) {
 		zoneCount = indexKeys.size(); // one for each zone
 
 	// actually, we create two controllers for each zone, one for heating, one for cooling
-	for (unsigned int i = 0; i<zoneCount; ++i) {
-		switch (m_thermostat->m_controllerType) {
-			case NANDRAD::Thermostat::NUM_CT : // default to P-Controller
-			case NANDRAD::Thermostat::CT_Analog : {
-				PController * con = new PController;
-				con->m_kP = 1/m_thermostat->m_para[NANDRAD::Thermostat::P_TemperatureTolerance].value;
-				m_controllers.push_back(con);
-				// now the cooling controller
-				con = new PController;
-				con->m_kP = 1/m_thermostat->m_para[NANDRAD::Thermostat::P_TemperatureTolerance].value;
-				m_controllers.push_back(con);
-			} break;
-
-			case NANDRAD::Thermostat::CT_Digital : {
-				DigitalHysteresisController * con = new DigitalHysteresisController;
-				con->m_hysteresisBand = m_thermostat->m_para[NANDRAD::Thermostat::P_TemperatureBand].value;
-				m_controllers.push_back(con);
-				// now the cooling controller
-				con = new DigitalHysteresisController;
-				con->m_hysteresisBand = m_thermostat->m_para[NANDRAD::Thermostat::P_TemperatureBand].value;
-				m_controllers.push_back(con);
-			} break;
-		}
+	// Note: controllers are stored in contiguous memory, so m_controllers can only be populated after the
+	//       controller vectors have been resized
+	switch (m_thermostat->m_controllerType) {
+		case NANDRAD::Thermostat::NUM_CT : // default to P-Controller
+		case NANDRAD::Thermostat::CT_Analog : {
+			m_pControllers.resize(2*zoneCount);
+			for (PController & con : m_pControllers) {
+				con.m_kP = 1/m_thermostat->m_para[NANDRAD::Thermostat::P_TemperatureTolerance].value;
+				m_controllers.push_back(&con);
+			}
+		} break;
+
+		case NANDRAD::Thermostat::CT_Digital : {
+			m_digitalControllers.resize(2*zoneCount);
+			for (DigitalHysteresisController & con : m_digitalControllers) {
+				con.m_hysteresisBand = m_thermostat->m_para[NANDRAD::Thermostat::P_TemperatureBand].value;
+				m_controllers.push_back(&con);
+			}
+		} break;
 	}
+
+	// input values of all controlled zones, constant setpoints are set right here
+	m_roomAirTemperatures.resize(zoneCount);
+	m_heatingSetpoints.resize(zoneCount, m_thermostat->m_para[NANDRAD::Thermostat::P_HeatingSetpoint].value);
+	m_coolingSetpoints.resize(zoneCount, m_thermostat->m_para[NANDRAD::Thermostat::P_CoolingSetpoint].value);
 }
 
 
@@ -347,47 +340,50 @@ int ThermostatModel::update() {
 	double * heatingControlSetpoints = m_vectorValuedResults[VVR_ThermostatHeatingSetpoint].dataPtr();
 	double * coolingControlSetpoints = m_vectorValuedResults[VVR_ThermostatCoolingSetpoint].dataPtr();
 
-	// loop over all thermostats
-	unsigned int nZones = m_controllers.size()/2;
-	for (unsigned int i=0; i<nZones; ++i) {
-		double Troom = *m_valueRefs[i*inputVarsPerZone];
-		double TSetpointHeating = m_thermostat->m_para[NANDRAD::Thermostat::P_HeatingSetpoint].value;
-		double TSetpointCooling = m_thermostat->m_para[NANDRAD::Thermostat::P_CoolingSetpoint].value;
-		if (m_thermostat->m_modelType == NANDRAD::Thermostat::MT_Scheduled) {
-			TSetpointHeating = *m_valueRefs[i*inputVarsPerZone + 1];
-			TSetpointCooling = *m_valueRefs[i*inputVarsPerZone + 2];
-		}
+	// Controllers of all zones are evaluated in a batch: first all inputs are gathered into contiguous
+	// vectors, then all controllers are updated in a single loop (with statically bound calls, since all
+	// controllers have the same type), and finally the results are transferred.
+
+	// number of controlled zones (all zones, or only the reference zone)
+	unsigned int nControlledZones = m_roomAirTemperatures.size();
 
-		// if we have setpoint temperatures in each zone, we store the corresponding setpoint right here
-		if (m_thermostat->m_referenceZoneId == NANDRAD::INVALID_ID) {
-			heatingControlSetpoints[i] = TSetpointHeating;
-			coolingControlSetpoints[i] = TSetpointCooling;
+	// gather inputs
+	for (unsigned int i=0; i<nControlledZones; ++i)
+		m_roomAirTemperatures[i] = *m_valueRefs[i*inputVarsPerZone];
+	if (m_thermostat->m_modelType == NANDRAD::Thermostat::MT_Scheduled) {
+		for (unsigned int i=0; i<nControlledZones; ++i) {
+			m_heatingSetpoints[i] = *m_valueRefs[i*inputVarsPerZone + 1];
+			m_coolingSetpoints[i] = *m_valueRefs[i*inputVarsPerZone + 2];
 		}
+	}
 
-		// update heating and cooling controllers
-		m_controllers[i*2]->update(TSetpointHeating - Troom);
-		m_controllers[i*2+1]->update(Troom - TSetpointCooling); // Mind the sign! Turn on cooling when room is _above_ setpoint
+	// update heating and cooling controllers
+	// Mind the sign for cooling controllers! Turn on cooling when room is _above_ setpoint
+	if (!m_pControllers.empty()) {
+		for (unsigned int i=0; i<nControlledZones; ++i) {
+			m_pControllers[i*2].PController::update(m_heatingSetpoints[i] - m_roomAirTemperatures[i]);
+			m_pControllers[i*2+1].PController::update(m_roomAirTemperatures[i] - m_coolingSetpoints[i]);
+		}
+	}
+	else {
+		for (unsigned int i=0; i<nControlledZones; ++i) {
+			m_digitalControllers[i*2].DigitalHysteresisController::update(m_heatingSetpoints[i] - m_roomAirTemperatures[i]);
+			m_digitalControllers[i*2+1].DigitalHysteresisController::update(m_roomAirTemperatures[i] - m_coolingSetpoints[i]);
+		}
 	}
 
 	double * heatingControlValues = m_vectorValuedResults[VVR_HeatingControlValue].dataPtr();
 	double * coolingControlValues = m_vectorValuedResults[VVR_CoolingControlValue].dataPtr();
 
-	// transfer results
+	// transfer results to all zones of the object list (with reference zone, nControlledZones is 1)
+	unsigned int nZones = m_objectList->m_filterID.m_ids.size();
 	if (m_thermostat->m_referenceZoneId != NANDRAD::INVALID_ID) {
-		double TSetpointHeating = m_thermostat->m_para[NANDRAD::Thermostat::P_HeatingSetpoint].value;
-		double TSetpointCooling = m_thermostat->m_para[NANDRAD::Thermostat::P_CoolingSetpoint].value;
-		if (m_thermostat->m_modelType == NANDRAD::Thermostat::MT_Scheduled) {
-			TSetpointHeating = *m_valueRefs[1];
-			TSetpointCooling = *m_valueRefs[2];
-		}
-
-		// reference zone - all results get the same control values
+		// reference zone - all results get the same control values and setpoints
 		for (unsigned int i=0; i<nZones; ++i) {
 			heatingControlValues[i] = m_controllers[0]->m_controlValue;
 			coolingControlValues[i] = m_controllers[1]->m_controlValue;
-			// setpoints are the same for all zones; override earlier stored zone-specific setpoints
-			heatingControlSetpoints[i] = TSetpointHeating;
-			coolingControlSetpoints[i] = TSetpointCooling;
+			heatingControlSetpoints[i] = m_heatingSetpoints[0];
+			coolingControlSetpoints[i] = m_coolingSetpoints[0];
 		}
 	}
 	else {
@@ -395,6 +391,8 @@ int ThermostatModel::update() {
 		for (unsigned int i=0; i<nZones; ++i) {
 			heatingControlValues[i] = m_controllers[i*2]->m_controlValue;
 			coolingControlValues[i] = m_controllers[i*2 + 1]->m_controlValue;
+			heatingControlSetpoints[i] = m_heatingSetpoints[i];
+			coolingControlSetpoints[i] = m_coolingSetpoints[i];
 		}
 	}
 
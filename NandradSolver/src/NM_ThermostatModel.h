@@ -26,6 +26,7 @@
 #include "NM_AbstractStateDependency.h"
 #include "NM_AbstractTimeDependency.h"
 #include "NM_VectorValuedQuantity.h"
+#include "NM_Controller.h"
 
 namespace NANDRAD {
 	class Zone;
@@ -35,8 +36,6 @@ namespace NANDRAD {
 
 namespace NANDRAD_MODEL {
 
-class AbstractController;
-
 /*! A model for a thermostat.
 	The thermostat generates a HeatingControlValue and CoolingControlValue for each zone in the referenced
 	object list.
@@ -64,9 +63,6 @@ public:
 	{
 	}
 
-	/*! Cleans up allocated memory (controller). */
-	~ThermostatModel() override;
-
 	/*! Initializes object.
 		\param ventilationModel Ventilation model data.
 		\param simPara Required simulation parameter.
@@ -157,8 +153,27 @@ private:
 		Otherwise we have two controllers per zone.
 		Note: for PControllers without state this is a bit of an overhead, but to stay generic,
 			  we must provide a state-containing controller instance in case someone defines a hysteresis or PI controller.
+		The pointers point into m_pControllers or m_digitalControllers, respectively. They are used for
+		controller type independent tasks (serialization, stepCompleted()).
 	*/
 	std::vector<NANDRAD_MODEL::AbstractController*>	m_controllers;
+	/*! Contiguous storage of all P controllers (heating and cooling controllers alternate), only used for
+		analog controller type. In update(), the controllers are updated in a loop with statically bound calls.
+	*/
+	std::vector<PController>						m_pControllers;
+	/*! Contiguous storage of all hysteresis controllers (heating and cooling controllers alternate), only used
+		for digital controller type.
+	*/
+	std::vector<DigitalHysteresisController>		m_digitalControllers;
+
+	/*! Room air temperatures of all controlled zones (or the reference zone), gathered from m_valueRefs in update(). */
+	std::vector<double>								m_roomAirTemperatures;
+	/*! Heating setpoints of all controlled zones (or the reference zone), gathered from m_valueRefs in update()
+		for scheduled thermostats, otherwise constant.
+	*/
+	std::vector<double>								m_heatingSetpoints;
+	/*! Cooling setpoints of all controlled zones (or the reference zone), see m_heatingSetpoints. */
+	std::vector<double>								m_coolingSetpoints;
 
 	/*! Vector valued results, computed/updated during the calculation. */
 	std::vector<VectorValuedQuantity>				m_vectorValuedResults;
@@ -20,6 +20,7 @@
 */
 
 #include <iostream>
+#include <thread>
 
 #include <IBK_MessageHandler.h>
 #include <IBK_MessageHandlerRegistry.h>
@@ -28,6 +29,7 @@
 
 // include solver control framework and integrator
 #include <SOLFRA_SolverControlFramework.h>
+#include <SOLFRA_Profiler.h>
 
 // include header for command line argument parser
 #include <NANDRAD_ArgsParser.h>
@@ -35,6 +37,7 @@
 
 // include model implementation class
 #include "NM_NandradModel.h"
+#include "NM_BatchRunner.h"
 
 const char * const PROGRAM_INFO =
 	"NANDRAD Solver\n"
@@ -46,6 +49,59 @@ const char * const PROGRAM_INFO =
 	"  andreas.nicolai [at] tu-dresden.de\n"
 	"  anne.paepcke [at] gmx.net\n\n";
 
+
+/*! Runs all projects listed in the project list file (passed instead of project file) in a single process.
+	In sweep mode, the first project in the list is the base project which is simulated once, all
+	other projects are forked from its final state.
+*/
+int runBatch(const NANDRAD::ArgsParser & args, bool sweep) {
+	FUNCID(runBatch);
+
+	if (args.m_restart || args.m_restartFrom)
+		throw IBK::Exception("Restart options are not supported in batch mode.", FUNC_ID);
+	// profiler collects data process-wide and is therefore not available in batch mode
+	if (args.IBK::ArgParser::flagEnabled("profile"))
+		throw IBK::Exception("Profiling is not supported in batch mode.", FUNC_ID);
+
+	IBK::MessageHandler * messageHandlerPtr = IBK::MessageHandlerRegistry::instance().messageHandler();
+	messageHandlerPtr->setConsoleVerbosityLevel(IBK::VL_STANDARD);
+	messageHandlerPtr->setLogfileVerbosityLevel(IBK::VL_STANDARD);
+	messageHandlerPtr->m_contextIndentation = 48;
+	std::string errmsg;
+	IBK::Path logfile(args.m_projectFile.withoutExtension().str() + "_batch.log");
+	if (!messageHandlerPtr->openLogFile(logfile.str(), false, errmsg))
+		IBK::IBK_Message(errmsg, IBK::MSG_WARNING, FUNC_ID);
+
+	IBK::IBK_Message(PROGRAM_INFO, IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	IBK::IBK_Message(IBK::FormatString("%1 mode, reading project list '%2'\n").arg(sweep ? "Sweep" : "Batch").arg(args.m_projectFile),
+					 IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+
+	std::vector<IBK::Path> projectFiles = NANDRAD_MODEL::BatchRunner::readProjectList(args.m_projectFile);
+	IBK::Path baseProjectFile;
+	if (sweep) {
+		if (projectFiles.size() < 2)
+			throw IBK::Exception("Sweep mode requires a base project and at least one variant project.", FUNC_ID);
+		baseProjectFile = projectFiles.front();
+		projectFiles.erase(projectFiles.begin());
+	}
+
+	// -p sets the number of concurrently running simulations, default is one per core
+	unsigned int numThreads = std::thread::hardware_concurrency();
+	if (args.hasOption(IBK::SolverArgsParser::GO_PARALLEL_THREADS) && args.m_numParallelThreads > 0)
+		numThreads = (unsigned int)args.m_numParallelThreads;
+
+	NANDRAD_MODEL::BatchRunner runner;
+	if (sweep)
+		runner.runPrefix(baseProjectFile, args, numThreads);
+	runner.run(projectFiles, args, numThreads);
+	runner.writeSummary();
+
+	for (const NANDRAD_MODEL::BatchRunner::JobResult & job : runner.m_results)
+		if (!job.m_success)
+			return 2;
+	return EXIT_SUCCESS;
+}
+
 int main(int argc, char * argv[]) {
 	FUNCID(main);
 
@@ -82,6 +138,12 @@ int main(int argc, char * argv[]) {
 		if (args.handleErrors(std::cerr))
 			return EXIT_FAILURE;
 
+		// *** batch/sweep mode: project file argument is a list of project files ***
+		if (args.IBK::ArgParser::flagEnabled("sweep"))
+			return runBatch(args, true);
+		if (args.IBK::ArgParser::flagEnabled("batch"))
+			return runBatch(args, false);
+
 		// *** create main model instance ***
 		NANDRAD_MODEL::NandradModel model;
 
@@ -121,6 +183,12 @@ int main(int argc, char * argv[]) {
 		}
 #endif // _OPENMP
 
+		// *** Profiler ***
+		if (args.IBK::ArgParser::flagEnabled("profile")) {
+			SOLFRA::Profiler::instance().setEnabled(true, (unsigned int)args.m_numParallelThreads);
+			IBK::IBK_Message("Profiling enabled, results are written to log directory\n\n", IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+		}
+
 		// *** Initialize model. ***
 
 		// init model (first read project, then initialize model)
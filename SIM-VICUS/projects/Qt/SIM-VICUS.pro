@@ -223,6 +223,7 @@ SOURCES += \
 	../../src/SVClimateDataSortFilterProxyModel.cpp \
 	../../src/SVClimateDataTableModel.cpp \
 	../../src/SVClimateFileInfo.cpp \
+	../../src/SVClimateFileScanThread.cpp \
 	../../src/SVConstants.cpp \
 	../../src/SVDatabase.cpp \
 	../../src/SVDatabaseEditDialog.cpp \
@@ -472,6 +473,7 @@ HEADERS  += \
 	../../src/SVClimateDataSortFilterProxyModel.h \
 	../../src/SVClimateDataTableModel.h \
 	../../src/SVClimateFileInfo.h \
+	../../src/SVClimateFileScanThread.h \
 	../../src/SVConstants.h \
 	../../src/SVDatabaseEditDialog.h \
 	../../src/SVDatabase.h \
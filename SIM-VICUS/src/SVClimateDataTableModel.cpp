@@ -26,8 +26,13 @@
 #include "SVClimateDataTableModel.h"
 
 #include <QDir>
+#include <QFile>
+#include <QDataStream>
+#include <QDateTime>
+#include <QSet>
 
 #include <QtExt_Directories.h>
+#include <QtExt_LanguageHandler.h>
 
 #include <IBK_Path.h>
 #include <IBK_messages.h>
@@ -36,6 +41,12 @@
 
 #include "SVSettings.h"
 #include "SVConstants.h" // for the custom roles
+#include "SVClimateFileScanThread.h"
+
+/*! Magic number at begin of climate file catalogue. */
+static const quint32 CATALOGUE_MAGIC = 0x53564343;
+/*! Version of climate file catalogue format, increase when changing the format. */
+static const quint32 CATALOGUE_VERSION = 1;
 
 SVClimateDataTableModel::SVClimateDataTableModel(QObject * parent) :
 	QAbstractTableModel(parent)
@@ -43,6 +54,20 @@ SVClimateDataTableModel::SVClimateDataTableModel(QObject * parent) :
 }
 
 
+SVClimateDataTableModel::~SVClimateDataTableModel() {
+	if (m_scanThread != nullptr) {
+		m_scanThread->stop();
+		m_scanThread->wait();
+		// keep results read so far in catalogue, remaining files will be read on next start
+		QList<SVClimateFileScanThread::ScanResult> results;
+		m_scanThread->takeResults(results);
+		storeScanResults(results, QString());
+		delete m_scanThread;
+		writeCatalogue();
+	}
+}
+
+
 int SVClimateDataTableModel::rowCount(const QModelIndex &) const {
 	return m_climateFiles.size();
 }
@@ -168,19 +193,38 @@ QVariant SVClimateDataTableModel::headerData(int section, Qt::Orientation orient
 }
 
 
-const SVClimateFileInfo * SVClimateDataTableModel::infoForFilename(const QString & climateFilePath) const {
+const SVClimateFileInfo * SVClimateDataTableModel::infoForFilename(const QString & climateFilePath) {
 	for (const SVClimateFileInfo & info : m_climateFiles) {
 		if (info.m_filename == climateFilePath)
 			return &info;
 	}
+	// file may not have been read yet
+	if (isScanning()) {
+		waitForScan();
+		for (const SVClimateFileInfo & info : m_climateFiles) {
+			if (info.m_filename == climateFilePath)
+				return &info;
+		}
+	}
 	return nullptr;
 }
 
 
 void SVClimateDataTableModel::updateClimateFileList() {
-	beginResetModel();
+	// stop a running scan, all files not in the catalogue will be read again below
+	if (m_scanThread != nullptr) {
+		m_scanThread->stop();
+		m_scanThread->wait();
+		m_scanThread->deleteLater();
+		m_scanThread = nullptr;
+	}
 
-	FUNCID(SVSettings::updateClimateFileList);
+	if (!m_catalogueRead) {
+		readCatalogue();
+		m_catalogueRead = true;
+	}
+
+	beginResetModel();
 
 	m_climateFiles.clear();
 
@@ -198,46 +242,176 @@ void SVClimateDataTableModel::updateClimateFileList() {
 		SVSettings::recursiveSearch(userCCDir, userFiles, ccFileExtensions);
 	}
 
-	IBK::Path ccPath(ccDir.toStdString());
-	for (const QString& file : defaultFiles) {
-		// file is now the full file path to built-in database files
-		try {
-			SVClimateFileInfo item;
-			item.readInfo(ccDir, file, false, true);
-			IBK::Path itemPath(file.toStdString());
-			itemPath = itemPath.relativePath(ccPath);
-			QStringList categories = QString::fromStdString(itemPath.str()).split('/');
-			categories.removeLast();
-			item.m_categories = categories;
+	QString langID = QtExt::LanguageHandler::instance().langId();
+	QList<SVClimateFileInfo> filesToScan;
+	QSet<QString> existingFiles;
+
+	// file is the full file path to built-in or user database files
+	auto addFile = [&](const QString & file, const IBK::Path & basePath, bool builtIn) {
+		SVClimateFileInfo item;
+		QHash<QString, CatalogueEntry>::const_iterator it = m_catalogue.constFind(file);
+		QFileInfo finfo(file);
+		bool upToDate = (it != m_catalogue.constEnd() &&
+						 it->m_lastModified == finfo.lastModified().toMSecsSinceEpoch() &&
+						 it->m_size == finfo.size());
+		if (upToDate)
+			item = it->m_info;
+		item.setFilePath(ccDir, file, builtIn);
+		IBK::Path itemPath(file.toStdString());
+		itemPath = itemPath.relativePath(basePath);
+		QStringList categories = QString::fromStdString(itemPath.str()).split('/');
+		categories.removeLast();
+		item.m_categories = categories;
+		existingFiles.insert(file);
+
+		if (!upToDate)
+			filesToScan.push_back(item);
+		else if (it->m_valid) {
+			item.updateInfoFromLoader(langID);
 			m_climateFiles.push_back(item);
 		}
-		catch(IBK::Exception& ex) {
-			ex.writeMsgStackToError();
-			IBK::IBK_Message(IBK::FormatString("Error in climate data set '%1'.\n")
-							 .arg(file.toStdString()), IBK::MSG_WARNING, FUNC_ID);
-		}
-	}
+		// files that could not be read are skipped, error was reported when the file was read
+	};
+
+	IBK::Path ccPath(ccDir.toStdString());
+	for (const QString& file : defaultFiles)
+		addFile(file, ccPath, true);
 
 	IBK::Path uccPath(uccDir.toStdString());
-	for (const QString& file : userFiles) {
-		// file is now the full file path to user database files
-		try {
-			SVClimateFileInfo item;
-			item.readInfo(ccDir, file, false, false);
-			IBK::Path itemPath(file.toStdString());
-			itemPath = itemPath.relativePath(uccPath);
-			QStringList categories = QString::fromStdString(itemPath.str()).split('/');
-			categories.removeLast();
-			item.m_categories = categories;
-			m_climateFiles.push_back(item);
+	for (const QString& file : userFiles)
+		addFile(file, uccPath, false);
+
+	// remove catalogue entries of deleted files
+	bool catalogueModified = false;
+	for (QHash<QString, CatalogueEntry>::iterator it = m_catalogue.begin(); it != m_catalogue.end();) {
+		if (!existingFiles.contains(it.key())) {
+			it = m_catalogue.erase(it);
+			catalogueModified = true;
 		}
-		catch(IBK::Exception& ex) {
+		else
+			++it;
+	}
+
+	endResetModel();
+
+	if (!filesToScan.isEmpty()) {
+		m_scanThread = new SVClimateFileScanThread(this, filesToScan);
+		connect(m_scanThread, &QThread::finished, this, &SVClimateDataTableModel::onScanFinished);
+		m_scanThread->start(QThread::LowPriority);
+	}
+	else if (catalogueModified)
+		writeCatalogue();
+}
+
+
+void SVClimateDataTableModel::waitForScan() {
+	if (m_scanThread == nullptr)
+		return;
+	m_scanThread->wait();
+	onScanFinished();
+}
+
+
+void SVClimateDataTableModel::onScanResultsAvailable() {
+	if (m_scanThread == nullptr)
+		return; // results of an aborted scan
+	QList<SVClimateFileScanThread::ScanResult> results;
+	m_scanThread->takeResults(results);
+	QList<SVClimateFileInfo> newFiles = storeScanResults(results, QtExt::LanguageHandler::instance().langId());
+	if (newFiles.isEmpty())
+		return;
+	beginInsertRows(QModelIndex(), m_climateFiles.size(), m_climateFiles.size() + newFiles.size() - 1);
+	m_climateFiles.append(newFiles);
+	endInsertRows();
+}
+
+
+void SVClimateDataTableModel::onScanFinished() {
+	// may be called for a thread that was aborted in the meantime
+	if (m_scanThread == nullptr || !m_scanThread->isFinished())
+		return;
+	// process remaining results
+	onScanResultsAvailable();
+	m_scanThread->deleteLater();
+	m_scanThread = nullptr;
+	writeCatalogue();
+}
+
+
+QList<SVClimateFileInfo> SVClimateDataTableModel::storeScanResults(QList<SVClimateFileScanThread::ScanResult> & results,
+																	const QString & langID)
+{
+	FUNCID(SVClimateDataTableModel::storeScanResults);
+	QList<SVClimateFileInfo> newFiles;
+	for (SVClimateFileScanThread::ScanResult & res : results) {
+		QFileInfo finfo(res.m_info.m_absoluteFilePath);
+		CatalogueEntry & entry = m_catalogue[res.m_info.m_absoluteFilePath];
+		entry.m_lastModified = finfo.lastModified().toMSecsSinceEpoch();
+		entry.m_size = finfo.size();
+		entry.m_valid = res.m_errorMessage.isEmpty();
+		entry.m_info = res.m_info;
+		if (!entry.m_valid) {
 			IBK::IBK_Message(IBK::FormatString("Error in climate data set '%1'.\n%2")
-							 .arg(file.toStdString())
-							 .arg(ex.what()), IBK::MSG_WARNING, FUNC_ID);
+							 .arg(res.m_info.m_absoluteFilePath.toStdString())
+							 .arg(res.m_errorMessage.toStdString()), IBK::MSG_WARNING, FUNC_ID);
+			continue;
 		}
+		// no need to resolve names, if only the catalogue is updated
+		if (langID.isEmpty())
+			continue;
+		res.m_info.updateInfoFromLoader(langID);
+		newFiles.append(res.m_info);
 	}
+	return newFiles;
+}
 
-	endResetModel();
+
+QString SVClimateDataTableModel::catalogueFilePath() {
+	return QtExt::Directories::userDataDir() + "/DB_climate_catalogue.cache";
 }
 
+
+void SVClimateDataTableModel::readCatalogue() {
+	m_catalogue.clear();
+	QFile f(catalogueFilePath());
+	if (!f.open(QIODevice::ReadOnly))
+		return;
+	QDataStream in(&f);
+	in.setVersion(QDataStream::Qt_5_0);
+	quint32 magic, version, count;
+	in >> magic >> version;
+	if (magic != CATALOGUE_MAGIC || version != CATALOGUE_VERSION)
+		return; // outdated catalogue, will be replaced
+	in >> count;
+	for (quint32 i=0; i<count && in.status() == QDataStream::Ok; ++i) {
+		QString absoluteFilePath;
+		CatalogueEntry entry;
+		in >> absoluteFilePath >> entry.m_lastModified >> entry.m_size >> entry.m_valid;
+		if (entry.m_valid)
+			entry.m_info.readCatalogueEntry(in);
+		m_catalogue[absoluteFilePath] = entry;
+	}
+	// corrupt catalogue? discard it
+	if (in.status() != QDataStream::Ok)
+		m_catalogue.clear();
+}
+
+
+void SVClimateDataTableModel::writeCatalogue() const {
+	FUNCID(SVClimateDataTableModel::writeCatalogue);
+	QDir().mkpath(QtExt::Directories::userDataDir());
+	QFile f(catalogueFilePath());
+	if (!f.open(QIODevice::WriteOnly)) {
+		IBK::IBK_Message(IBK::FormatString("Cannot write climate file catalogue '%1'.")
+						 .arg(catalogueFilePath().toStdString()), IBK::MSG_WARNING, FUNC_ID);
+		return;
+	}
+	QDataStream out(&f);
+	out.setVersion(QDataStream::Qt_5_0);
+	out << CATALOGUE_MAGIC << CATALOGUE_VERSION << (quint32)m_catalogue.size();
+	for (QHash<QString, CatalogueEntry>::const_iterator it = m_catalogue.constBegin(); it != m_catalogue.constEnd(); ++it) {
+		out << it.key() << it->m_lastModified << it->m_size << it->m_valid;
+		if (it->m_valid)
+			it->m_info.writeCatalogueEntry(out);
+	}
+}
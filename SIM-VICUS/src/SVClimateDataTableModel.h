@@ -27,14 +27,20 @@
 #define SVClimateDataTableModelH
 
 #include <QAbstractTableModel>
+#include <QHash>
 
 #include "SVClimateFileInfo.h"
+#include "SVClimateFileScanThread.h"
 
 /*! A table model that provides a table/list of available climate data files.
 	Use the Role_FileName to get just the filename. Use Role_FilePath to get the
 	file path including a database placeholder (this should be used to store the location in the project file).
 	Finally, use Role_AbsoluteFilePath to get the absolute file path, in case the climate data file needs to be
 	read for diagram display.
+
+	The header data of all climate files is kept in a catalogue file in the user data directory, with
+	modification time and size of each file. Only new or modified files are read, in a background thread.
+	Their rows are added to the model when the data becomes available.
 */
 class SVClimateDataTableModel : public QAbstractTableModel {
 	Q_OBJECT
@@ -59,6 +65,8 @@ public:
 	};
 
 	SVClimateDataTableModel(QObject * parent);
+	/*! Destructor, stops background scanning. */
+	~SVClimateDataTableModel() override;
 
 	// QAbstractItemModel interface
 
@@ -72,17 +80,64 @@ public:
 
 	/*! Looks up the climate file path (potentially with 'Database' or 'User Database' placeholders and returns
 		the matching climate file info. If not found, a nullptr is returned.
+		\note If climate files are still being scanned, the function waits until scanning has completed.
 	*/
-	const SVClimateFileInfo * infoForFilename(const QString & climateFilePath) const;
+	const SVClimateFileInfo * infoForFilename(const QString & climateFilePath);
 
 	/*! Parses the climate data base directories and refreshs the list of climate data files.
-		This also resets the model.
+		This also resets the model. Files with up-to-date catalogue entries are added immediately,
+		all other files are read in the background and added once read.
 	*/
 	void updateClimateFileList();
 
+	/*! Returns true, while climate files are read in the background. */
+	bool isScanning() const { return m_scanThread != nullptr; }
+
+	/*! Waits until the background scan has completed and all climate files have been added to the model. */
+	void waitForScan();
+
+private slots:
+	/*! Invoked by scan thread when new results are available, adds rows to the model. */
+	void onScanResultsAvailable();
+	/*! Connected to the finished() signal of the scan thread. */
+	void onScanFinished();
+
 private:
+	/*! Entry of the climate file catalogue. */
+	struct CatalogueEntry {
+		/*! Last modification time of the climate file in [ms] since epoch. */
+		qint64				m_lastModified;
+		/*! File size in bytes. */
+		qint64				m_size;
+		/*! If false, the file could not be read (no need to retry until it is modified). */
+		bool				m_valid;
+		/*! The climate file info (header data only). */
+		SVClimateFileInfo	m_info;
+	};
+
+	/*! Stores scan results in catalogue and returns the successfully read climate files.
+		\param langID Language ID used to resolve city and country names, if empty only the catalogue is updated
+			and an empty list is returned.
+	*/
+	QList<SVClimateFileInfo> storeScanResults(QList<SVClimateFileScanThread::ScanResult> & results, const QString & langID);
+
+	/*! Returns path to catalogue file. */
+	static QString catalogueFilePath();
+	/*! Reads catalogue file into m_catalogue (silently ignores missing or outdated catalogue file). */
+	void readCatalogue();
+	/*! Writes m_catalogue into catalogue file. */
+	void writeCatalogue() const;
+
 	/*! Available climate data files (updated in updateClimateFileList()). */
-	QList<SVClimateFileInfo>	m_climateFiles;
+	QList<SVClimateFileInfo>				m_climateFiles;
+
+	/*! Catalogue with header data of all known climate files, key is absolute file path. */
+	QHash<QString, CatalogueEntry>			m_catalogue;
+	/*! True, if catalogue has been read from file. */
+	bool									m_catalogueRead = false;
+
+	/*! Background thread reading climate files not in the catalogue, nullptr if not scanning. */
+	SVClimateFileScanThread					*m_scanThread = nullptr;
 
 };
 
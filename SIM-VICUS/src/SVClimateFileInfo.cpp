@@ -35,14 +35,21 @@ SVClimateFileInfo::SVClimateFileInfo() :
 	m_longitudeInDegree(13.737),
 	m_latitudeInDegree(51.05),
 	m_elevation(0),
-	m_timeZone(1)
+	m_timeZone(1),
+	m_nonCyclicYears(0)
 {
 	m_checkBits.fill(CCM::ClimateDataLoader::ALL_DATA_MISSING);
 }
 
 
 void SVClimateFileInfo::readInfo(const QString& databaseDir, const QString & absoluteFilePath, bool withData, bool builtIn) {
-	FUNCID(SVClimateFileInfo::readInfo);
+	setFilePath(databaseDir, absoluteFilePath, builtIn);
+	readClimateData(withData);
+	updateInfoFromLoader(QtExt::LanguageHandler::instance().langId());
+}
+
+
+void SVClimateFileInfo::setFilePath(const QString & databaseDir, const QString & absoluteFilePath, bool builtIn) {
 	QFileInfo finfo(absoluteFilePath);
 	m_absoluteFilePath = absoluteFilePath;
 	// store relative path to database dir
@@ -55,6 +62,12 @@ void SVClimateFileInfo::readInfo(const QString& databaseDir, const QString & abs
 			m_filename = QString("${%1}/DB_climate/%2").arg(VICUS::USER_DATABASE_PLACEHOLDER_NAME, m_filename );
 	}
 	m_name = finfo.baseName();
+	m_builtIn = builtIn;
+}
+
+
+void SVClimateFileInfo::readClimateData(bool withData) {
+	FUNCID(SVClimateFileInfo::readClimateData);
 
 	// read data
 	IBK::Path cliPath(m_absoluteFilePath.toStdString());
@@ -72,8 +85,14 @@ void SVClimateFileInfo::readInfo(const QString& databaseDir, const QString & abs
 	else
 		m_checkBits.fill(CCM::ClimateDataLoader::ALL_DATA_MISSING);
 
-	QString langID = QtExt::LanguageHandler::instance().langId();
+	if (m_loader.m_dataTimePoints.empty())
+		m_nonCyclicYears = 0;
+	else
+		m_nonCyclicYears = int((m_loader.m_dataTimePoints.back() - m_loader.m_dataTimePoints.front()) / 3600.0 / 8760.0);
+}
+
 
+void SVClimateFileInfo::updateInfoFromLoader(const QString & langID) {
 	IBK::MultiLanguageString cityName(m_loader.m_city);
 	IBK::MultiLanguageString countryName(m_loader.m_country);
 	m_city = QString::fromStdString(cityName.string(langID.toStdString()));
@@ -88,12 +107,43 @@ void SVClimateFileInfo::readInfo(const QString& databaseDir, const QString & abs
 	m_latitudeInDegree = m_loader.m_latitudeInDegree;
 	m_elevation = m_loader.m_elevation;
 	m_timeZone = m_loader.m_timeZone;
-	if(m_loader.m_dataTimePoints.empty())
+	if (m_nonCyclicYears == 0)
 		m_timeBehaviour = tr("One year, cyclic use.");
 	else
-		m_timeBehaviour = tr("%1 years, non-cyclic use.").
-						  arg(int((m_loader.m_dataTimePoints.back() - m_loader.m_dataTimePoints.front()) / 3600.0 / 8760.0));
-	m_builtIn = builtIn;
+		m_timeBehaviour = tr("%1 years, non-cyclic use.").arg(m_nonCyclicYears);
+}
+
+
+void SVClimateFileInfo::writeCatalogueEntry(QDataStream & out) const {
+	// strings are stored as raw bytes, since climate files are not required to be UTF8 encoded
+	out << QByteArray::fromStdString(m_loader.m_city)
+		<< QByteArray::fromStdString(m_loader.m_country)
+		<< QByteArray::fromStdString(m_loader.m_source)
+		<< QByteArray::fromStdString(m_loader.m_comment)
+		<< m_loader.m_longitudeInDegree
+		<< m_loader.m_latitudeInDegree
+		<< m_loader.m_elevation
+		<< (qint32)m_loader.m_timeZone
+		<< (qint32)m_nonCyclicYears;
+}
+
+
+void SVClimateFileInfo::readCatalogueEntry(QDataStream & in) {
+	QByteArray city, country, source, comment;
+	qint32 timeZone, nonCyclicYears;
+	in >> city >> country >> source >> comment
+	   >> m_loader.m_longitudeInDegree
+	   >> m_loader.m_latitudeInDegree
+	   >> m_loader.m_elevation
+	   >> timeZone
+	   >> nonCyclicYears;
+	m_loader.m_city = city.toStdString();
+	m_loader.m_country = country.toStdString();
+	m_loader.m_source = source.toStdString();
+	m_loader.m_comment = comment.toStdString();
+	m_loader.m_timeZone = timeZone;
+	m_nonCyclicYears = nonCyclicYears;
+	m_checkBits.fill(CCM::ClimateDataLoader::ALL_DATA_MISSING);
 }
 
 
@@ -27,6 +27,7 @@
 #define SVClimateFileInfoH
 
 #include <QFileInfo>
+#include <QDataStream>
 #include <QCoreApplication>
 
 #include <array>
@@ -45,6 +46,28 @@ public:
 	*/
 	void readInfo(const QString& databaseDir, const QString & absoluteFilePath, bool withData, bool builtIn);
 
+	/*! Sets file path related members (first step of readInfo()), does not access the file. */
+	void setFilePath(const QString& databaseDir, const QString & absoluteFilePath, bool builtIn);
+
+	/*! Reads the climate data (or header only) into m_loader (second step of readInfo()).
+		This function does not access any GUI or settings data and can be called from worker threads.
+		\note This function will throw an exception in case of error while reading given file.
+	*/
+	void readClimateData(bool withData);
+
+	/*! Updates the info strings and location data from the data read into m_loader (last step of readInfo()).
+		\param langID Language ID used to select the city and country names.
+	*/
+	void updateInfoFromLoader(const QString & langID);
+
+	/*! Writes the header information needed by the climate file catalogue (see SVClimateDataTableModel) to stream. */
+	void writeCatalogueEntry(QDataStream & out) const;
+
+	/*! Reads the header information written by writeCatalogueEntry() into m_loader.
+		Call setFilePath() and updateInfoFromLoader() afterwards.
+	*/
+	void readCatalogueEntry(QDataStream & in);
+
 	/*! Return true if all climate components for shortwave solar radiation are valid.*/
 	bool hasShortwave() const;
 
@@ -94,6 +117,8 @@ public:
 	double		m_elevation;
 	/*! UTC - Time zone (-12..12) */
 	int			m_timeZone;
+	/*! Number of years for non-cyclic climate data, 0 for cyclic data. */
+	int			m_nonCyclicYears;
 	/*! Array with check bits for validity of climate components.*/
 	std::array<unsigned int, CCM::ClimateDataLoader::NumClimateComponents> m_checkBits;
 	/*! Climate data loader for caching data. */
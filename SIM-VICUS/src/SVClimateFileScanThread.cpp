@@ -0,0 +1,91 @@
+/*	SIM-VICUS - Building and District Energy Simulation Tool.
+
+	Copyright (c) 2020-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Dirk Weiss  <dirk.weiss -[at]- tu-dresden.de>
+	  Stephan Hirth  <stephan.hirth -[at]- tu-dresden.de>
+	  Hauke Hirsch  <hauke.hirsch -[at]- tu-dresden.de>
+
+	  ... all the others from the SIM-VICUS team ... :-)
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "SVClimateFileScanThread.h"
+
+#include <QMutexLocker>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <IBK_Exception.h>
+
+SVClimateFileScanThread::SVClimateFileScanThread(QObject * receiver, const QList<SVClimateFileInfo> & files) :
+	m_receiver(receiver),
+	m_files(files),
+	m_nextIndex(0),
+	m_abort(false),
+	m_notificationPending(false)
+{
+}
+
+
+void SVClimateFileScanThread::takeResults(QList<ScanResult> & results) {
+	QMutexLocker lock(&m_resultMutex);
+	results.append(m_results);
+	m_results.clear();
+	m_notificationPending = false;
+}
+
+
+void SVClimateFileScanThread::run() {
+	// reading climate files is mostly I/O and parsing, so we use a few threads even on small machines
+	unsigned int numThreads = std::max(2u, std::thread::hardware_concurrency());
+	numThreads = std::min(numThreads, (unsigned int)m_files.size());
+	std::vector<std::thread> readers;
+	for (unsigned int i=1; i<numThreads; ++i)
+		readers.push_back(std::thread(&SVClimateFileScanThread::readFiles, this));
+	readFiles();
+	for (std::thread & t : readers)
+		t.join();
+}
+
+
+void SVClimateFileScanThread::readFiles() {
+	for (;;) {
+		int idx = m_nextIndex++;
+		if (m_abort || idx >= m_files.size())
+			return;
+
+		ScanResult res;
+		res.m_info = m_files.at(idx);
+		try {
+			res.m_info.readClimateData(false);
+		}
+		catch (IBK::Exception & ex) {
+			res.m_errorMessage = QString::fromStdString(ex.msgStack());
+			// readClimateData() clears the file path on error, but we need it to report and catalogue the error
+			res.m_info.m_absoluteFilePath = m_files.at(idx).m_absoluteFilePath;
+		}
+
+		QMutexLocker lock(&m_resultMutex);
+		m_results.append(res);
+		if (!m_notificationPending) {
+			m_notificationPending = true;
+			QMetaObject::invokeMethod(m_receiver, "onScanResultsAvailable", Qt::QueuedConnection);
+		}
+	}
+}
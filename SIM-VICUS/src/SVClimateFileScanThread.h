@@ -0,0 +1,91 @@
+/*	SIM-VICUS - Building and District Energy Simulation Tool.
+
+	Copyright (c) 2020-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Dirk Weiss  <dirk.weiss -[at]- tu-dresden.de>
+	  Stephan Hirth  <stephan.hirth -[at]- tu-dresden.de>
+	  Hauke Hirsch  <hauke.hirsch -[at]- tu-dresden.de>
+
+	  ... all the others from the SIM-VICUS team ... :-)
+
+	This program is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef SVClimateFileScanThreadH
+#define SVClimateFileScanThreadH
+
+#include <QThread>
+#include <QMutex>
+#include <QList>
+
+#include <atomic>
+
+#include "SVClimateFileInfo.h"
+
+/*! Worker thread that reads the headers of climate data files in the background.
+
+	The thread distributes the files over several reader threads. Whenever new results are available,
+	the slot 'onScanResultsAvailable()' of the receiver object is invoked (queued connection), and the
+	receiver collects the results with takeResults(). The slot is invoked once for a batch of results, i.e.
+	it is only invoked again after takeResults() has been called.
+
+	The thread does not access GUI or settings data, all file infos must be prepared with
+	SVClimateFileInfo::setFilePath() before. The info strings are not updated by the thread, call
+	SVClimateFileInfo::updateInfoFromLoader() on the results.
+*/
+class SVClimateFileScanThread : public QThread {
+public:
+	/*! Result of a scanned climate file. */
+	struct ScanResult {
+		/*! The climate file info, with loader data set if successful. */
+		SVClimateFileInfo	m_info;
+		/*! Error message, empty if file was read successfully. */
+		QString				m_errorMessage;
+	};
+
+	/*! Constructor, takes receiver object that is notified about new results. */
+	SVClimateFileScanThread(QObject * receiver, const QList<SVClimateFileInfo> & files);
+
+	/*! Requests the thread to stop, the thread returns from run() after the files currently being read. */
+	void stop() { m_abort = true; }
+
+	/*! Moves all results collected so far into the results list (thread-safe). */
+	void takeResults(QList<ScanResult> & results);
+
+protected:
+	void run() override;
+
+private:
+	/*! Reads files until all files are processed, executed by each reader thread. */
+	void readFiles();
+
+	/*! Object whose slot 'onScanResultsAvailable()' is invoked when new results are available. */
+	QObject						*m_receiver;
+	/*! Files to scan. */
+	QList<SVClimateFileInfo>	m_files;
+	/*! Index of next file to scan. */
+	std::atomic<int>			m_nextIndex;
+	/*! Set to abort scanning. */
+	std::atomic<bool>			m_abort;
+
+	/*! Protects m_results and m_notificationPending. */
+	QMutex						m_resultMutex;
+	/*! Results not yet taken by receiver. */
+	QList<ScanResult>			m_results;
+	/*! True, if the receiver has been notified but not yet taken the results. */
+	bool						m_notificationPending;
+};
+
+#endif // SVClimateFileScanThreadH
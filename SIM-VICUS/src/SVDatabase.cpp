@@ -25,6 +25,11 @@
 
 #include "SVDatabase.h"
 
+#include <set>
+#include <unordered_map>
+#include <algorithm>
+#include <thread>
+
 #include <IBK_messages.h>
 #include <IBK_FormatString.h>
 
@@ -719,36 +724,52 @@ void SVDatabase::updateElementChildren() {
 
 
 // local search function to identify duplicates in DBs
+// Elements are first grouped by their content hash, only elements with the same hash need to be compared.
 template <typename T>
 void findDublicates(const VICUS::Database<T> & db, std::vector<SVDatabase::DuplicateInfo> & dupInfos) {
+	// group element IDs by content hash, IDs within each bucket are in ascending order (same as DB)
+	std::unordered_map<std::size_t, std::vector<unsigned int> > buckets;
+	for (typename std::map<unsigned int, T>::const_iterator it = db.begin(); it != db.end(); ++it)
+		buckets[it->second.contentHash()].push_back(it->first);
+
 	std::set<unsigned int> duplicateIDs; // stores all IDs of all already found duplicates
-	// process all database elements
-	for (typename std::map<unsigned int, T>::const_iterator it = db.begin(); it != db.end(); ++it) {
-		// skip elements already marked as duplicates
-		if (duplicateIDs.find(it->first) != duplicateIDs.end() ) continue;
-
-		// process all other elements
-		for (typename std::map<unsigned int, T>::const_iterator it2 = db.begin(); it2 != db.end(); ++it2) {
-			// skip ourselves
-			if (it->first == it2->first) continue;
+	for (const std::pair<const std::size_t, std::vector<unsigned int> > & bucket : buckets) {
+		const std::vector<unsigned int> & ids = bucket.second;
+		if (ids.size() < 2)
+			continue;
+		// process all elements in bucket
+		for (unsigned int id : ids) {
 			// skip elements already marked as duplicates
-			if (duplicateIDs.find(it2->first) != duplicateIDs.end() ) continue;
-
-			// are we sufficiently similar
-			VICUS::AbstractDBElement::ComparisonResult compRes = it->second.equal(&it2->second);
-			if (compRes == VICUS::AbstractDBElement::Equal) {
-				SVDatabase::DuplicateInfo info;
-				info.m_idFirst = it->first;
-				info.m_idSecond = it2->first;
-				// we compare wether both are builtIn or not, this avoids replacing builtin elements
-				info.m_identical = it->second.m_builtIn == it2->second.m_builtIn;
-				dupInfos.push_back(info);
-				duplicateIDs.insert(it->first);
-				duplicateIDs.insert(it2->first);
-				break;
+			if (duplicateIDs.find(id) != duplicateIDs.end() ) continue;
+			const T * elem = db[id];
+
+			// process all other elements in bucket
+			for (unsigned int id2 : ids) {
+				// skip ourselves
+				if (id == id2) continue;
+				// skip elements already marked as duplicates
+				if (duplicateIDs.find(id2) != duplicateIDs.end() ) continue;
+				const T * elem2 = db[id2];
+
+				// are we sufficiently similar
+				VICUS::AbstractDBElement::ComparisonResult compRes = elem->equal(elem2);
+				if (compRes == VICUS::AbstractDBElement::Equal) {
+					SVDatabase::DuplicateInfo info;
+					info.m_idFirst = id;
+					info.m_idSecond = id2;
+					// we compare wether both are builtIn or not, this avoids replacing builtin elements
+					info.m_identical = elem->m_builtIn == elem2->m_builtIn;
+					dupInfos.push_back(info);
+					duplicateIDs.insert(id);
+					duplicateIDs.insert(id2);
+					break;
+				}
 			}
 		}
 	}
+	// sort duplicates by ID of first element, so that the order does not depend on hash values
+	std::sort(dupInfos.begin(), dupInfos.end(),
+			  [](const SVDatabase::DuplicateInfo & a, const SVDatabase::DuplicateInfo & b) { return a.m_idFirst < b.m_idFirst; });
 }
 
 
@@ -756,6 +777,11 @@ void findDublicates(const VICUS::Database<T> & db, std::vector<SVDatabase::Dupli
 void SVDatabase::determineDuplicates(std::vector<std::vector<SVDatabase::DuplicateInfo> > & duplicatePairs) const {
 	duplicatePairs.resize(NUM_DT);
 
+	// the EPD database is by far the largest, so we process it in a worker thread while the
+	// other databases are processed in the calling thread; the worker only reads m_epdDatasets and
+	// writes into its own result vector
+	std::thread epdWorker(findDublicates<VICUS::EpdDataset>, std::cref(m_epdDatasets), std::ref(duplicatePairs[DT_EpdDatasets]));
+
 	// process all databases and search for duplicates
 	findDublicates(m_materials, duplicatePairs[DT_Materials]);
 	findDublicates(m_constructions, duplicatePairs[DT_Constructions]);
@@ -773,7 +799,6 @@ void SVDatabase::determineDuplicates(std::vector<std::vector<SVDatabase::Duplica
 	findDublicates(m_networkControllers, duplicatePairs[DT_NetworkControllers]);
 	findDublicates(m_subNetworks, duplicatePairs[DT_SubNetworks]);
 	findDublicates(m_supplySystems, duplicatePairs[DT_SupplySystems]);
-	//findDublicates(m_epdDatasets, duplicatePairs[DT_EPDDatasets]);
 	findDublicates(m_schedules, duplicatePairs[DT_Schedules]);
 	findDublicates(m_internalLoads, duplicatePairs[DT_InternalLoads]);
 	findDublicates(m_zoneControlThermostat, duplicatePairs[DT_ZoneControlThermostat]);
@@ -785,6 +810,9 @@ void SVDatabase::determineDuplicates(std::vector<std::vector<SVDatabase::Duplica
 	findDublicates(m_zoneTemplates, duplicatePairs[DT_ZoneTemplates]);
 	findDublicates(m_acousticTemplates, duplicatePairs[DT_AcousticTemplates]);
 	findDublicates(m_acousticSoundProtectionTemplates, duplicatePairs[DT_AcousticSoundProtectionTemplates]);
+
+	// wait for EPD duplicate search to finish
+	epdWorker.join();
 }
 
 
@@ -1859,7 +1859,10 @@ void SVMainWindow::onFixProjectAfterRead() {
 			project().generateNandradProject(p, errorStack, SVSettings::instance().m_nandradExportFileName.toStdString());
 			// save project
 			IBK::Path targetNandradFile(SVSettings::instance().m_nandradExportFileName.toStdString());
-			p.writeXML(targetNandradFile);
+			if (SVSettings::instance().m_writeBinaryNandradProject)
+				p.writeBinary(targetNandradFile);
+			else
+				p.writeXML(targetNandradFile);
 
 			IBK::IBK_Message( IBK::FormatString("NANDRAD project file '%1' generated.\n").arg(targetNandradFile.absolutePath()), IBK::MSG_PROGRESS, FUNC_ID);
 		}
@@ -54,6 +54,14 @@ void SVPreferencesPageMisc::updateUi() {
 	m_ui->spinBoxAutosaveInterval->blockSignals(false);
 
 	m_ui->groupBoxAutoSaving->setChecked(s.m_autosaveEnabled); // from ms in min
+
+	m_ui->checkBoxWriteBinaryVicusProject->blockSignals(true);
+	m_ui->checkBoxWriteBinaryVicusProject->setChecked(s.m_writeBinaryVicusProject);
+	m_ui->checkBoxWriteBinaryVicusProject->blockSignals(false);
+
+	m_ui->checkBoxWriteBinaryNandradProject->blockSignals(true);
+	m_ui->checkBoxWriteBinaryNandradProject->setChecked(s.m_writeBinaryNandradProject);
+	m_ui->checkBoxWriteBinaryNandradProject->blockSignals(false);
 }
 
 
@@ -84,3 +92,13 @@ void SVPreferencesPageMisc::on_groupBoxAutoSaving_toggled(bool isEnabled) {
 	emit autosaveSettingsChanged();
 }
 
+
+void SVPreferencesPageMisc::on_checkBoxWriteBinaryVicusProject_toggled(bool checked) {
+	SVSettings::instance().m_writeBinaryVicusProject = checked;
+}
+
+
+void SVPreferencesPageMisc::on_checkBoxWriteBinaryNandradProject_toggled(bool checked) {
+	SVSettings::instance().m_writeBinaryNandradProject = checked;
+}
+
@@ -58,6 +58,10 @@ private slots:
 
 	void on_groupBoxAutoSaving_toggled(bool isEnabled);
 
+	void on_checkBoxWriteBinaryVicusProject_toggled(bool checked);
+
+	void on_checkBoxWriteBinaryNandradProject_toggled(bool checked);
+
 private:
 	Ui::SVPreferencesPageMisc *m_ui;
 };
@@ -1263,7 +1263,10 @@ bool SVProjectHandler::write(QWidget *parent, const QString & fname, bool writeD
 		}
 
 		// filename is converted to utf8 before calling writeXML
-		m_project->writeXML(IBK::Path(fname.toStdString()));
+		if (SVSettings::instance().m_writeBinaryVicusProject)
+			m_project->writeBinary(IBK::Path(fname.toStdString()));
+		else
+			m_project->writeXML(IBK::Path(fname.toStdString()));
 
 		// also set the project file name
 		m_projectFile = fname;
@@ -1277,6 +1280,8 @@ bool SVProjectHandler::write(QWidget *parent, const QString & fname, bool writeD
 			// if we don't have a drawing (maybe it was deleted), then we delete the drawing file
 			if (m_project->m_drawings.empty())
 				IBK::Path::remove(drawingAbsFilePath);
+			else if (SVSettings::instance().m_writeBinaryVicusProject)
+				m_project->writeDrawingBinary(drawingAbsFilePath);
 			else
 				m_project->writeDrawingXML(drawingAbsFilePath);
 		}
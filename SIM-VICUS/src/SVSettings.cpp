@@ -225,6 +225,8 @@ void SVSettings::read() {
 //				 << m_themeSettings[TT_White].m_sceneBackgroundColor.name()
 //				 << m_themeSettings[TT_White].m_selectedSurfaceColor.name();
 	m_useHighDPIScaling = settings.value("UseHighDPIScaling", m_useHighDPIScaling).toBool();
+	m_writeBinaryVicusProject = settings.value("WriteBinaryVicusProject", m_writeBinaryVicusProject).toBool();
+	m_writeBinaryNandradProject = settings.value("WriteBinaryNandradProject", m_writeBinaryNandradProject).toBool();
 
 #if defined(Q_OS_WIN)
 	// on windows, use the native file dialogs
@@ -247,6 +249,8 @@ void SVSettings::write(QByteArray geometry, QByteArray state) {
 	settings.setValue("InvertYMouseAxis", m_invertYMouseAxis);
 	settings.setValue("TerminalEmulator", m_terminalEmulator);
 	settings.setValue("UseHighDPIScaling", m_useHighDPIScaling);
+	settings.setValue("WriteBinaryVicusProject", m_writeBinaryVicusProject);
+	settings.setValue("WriteBinaryNandradProject", m_writeBinaryNandradProject);
 	settings.setValue("NavigationSplitterSize", m_navigationSplitterSize);
 	settings.setValue("AutosaveInterval", m_autosaveInterval);
 	settings.setValue("EnableAutosaving", m_autosaveEnabled);
@@ -305,6 +305,14 @@ public:
 	/*! Enables HighDPI Scaling. */
 	bool						m_useHighDPIScaling = true;
 
+	/*! If true, VICUS project and drawing files are saved as compact binary container instead of XML.
+		Reading detects the format automatically.
+	*/
+	bool						m_writeBinaryVicusProject = false;
+
+	/*! If true, generated NANDRAD projects are written as compact binary container instead of XML. */
+	bool						m_writeBinaryNandradProject = false;
+
 
 private:
 
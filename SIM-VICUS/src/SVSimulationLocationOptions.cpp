@@ -570,6 +570,8 @@ void SVSimulationLocationOptions::onModified(int modificationType, ModificationI
 			if (p.m_location.m_climateFilePath.isValid()) {
 				// is the referenced file in the climate database? If so, it has a placeholder "${Database}" in path or
 				// ${User Database}
+				// the referenced file may not yet be in the model, if new climate files are still being read
+				m_climateDataModel->waitForScan();
 				QModelIndex idx;
 				for (int i=0, count = m_climateDataModel->rowCount(QModelIndex()); i< count; ++i) {
 					QModelIndex curIdx = m_climateDataModel->index(i, 0);
@@ -39,6 +39,7 @@
 
 #include <IBK_physics.h>
 #include <IBK_Time.h>
+#include <IBK_messages.h>
 
 #include <IBKMK_Polygon2D.h>
 
@@ -130,6 +131,7 @@ SVSimulationShadingOptions::SVSimulationShadingOptions(QWidget *parent) :
 	m_ui->comboBoxCalculationMethod->clear();
 	m_ui->comboBoxCalculationMethod->addItem(tr("Ray Tracing"), RayTracing);
 	m_ui->comboBoxCalculationMethod->addItem(tr("Surface Clipping"), SurfaceClipping);
+	m_ui->comboBoxCalculationMethod->addItem(tr("Shadow Map"), ShadowMap);
 
 	m_ui->comboBoxGeometryMode->clear();
 	m_ui->comboBoxGeometryMode->addItem(tr("Flat Surfaces"), Flat);
@@ -335,7 +337,8 @@ void SVSimulationShadingOptions::calculateShadingFactors() {
 	std::vector<SH::StructuralShading::ShadingObject> selObst;
 	std::vector<SH::StructuralShading::ShadingObject> selSurf;
 
-	bool useClipping = m_ui->comboBoxCalculationMethod->currentData().toUInt() == SurfaceClipping;
+	CalculationMethod calculationMethod = (CalculationMethod)m_ui->comboBoxCalculationMethod->currentData().toUInt();
+	bool useClipping = calculationMethod == SurfaceClipping;
 
 	if ( !m_ui->lineEditGridSize->isValid() ) {
 		QMessageBox::critical(this, QString(), tr("Grid size must be > 0 m!"));
@@ -725,14 +728,44 @@ void SVSimulationShadingOptions::calculateShadingFactors() {
 	SVProjectHandler &prj = SVProjectHandler::instance();
 	QDir projectDir = QFileInfo(prj.projectFile()).dir();
 
+	// shading factors of unchanged surfaces are taken from the cache file in the project's results directory
+	QString projectName = QFileInfo(prj.projectFile()).completeBaseName();
+	IBK::Path cacheFile(projectDir.absoluteFilePath(projectName + "/var/shadingFactors.cache").toStdString());
+	if (cacheFile.exists()) {
+		try {
+			m_shading->readShadingCache(cacheFile);
+		}
+		catch (IBK::Exception & ex) {
+			// invalid/outdated cache file, just compute everything
+			IBK::IBK_Message(ex.what(), IBK::MSG_WARNING);
+		}
+	}
+
 	double gridSize = m_ui->lineEditGridSize->value();
-	m_shading->calculateShadingFactors(&progressNotifyer, gridSize, useClipping, IBK::Path(projectDir.absolutePath().toStdString()));
+	SH::StructuralShading::CalculationMethod method = SH::StructuralShading::SCM_RayTracing;
+	switch (calculationMethod) {
+		case RayTracing		: method = SH::StructuralShading::SCM_RayTracing; break;
+		case SurfaceClipping	: method = SH::StructuralShading::SCM_SurfaceClipping; break;
+		case ShadowMap		: method = SH::StructuralShading::SCM_ShadowMap; break;
+	}
+	m_shading->calculateShadingFactors(&progressNotifyer, gridSize, method, IBK::Path(projectDir.absolutePath().toStdString()));
 
 	if (progressNotifyer.m_aborted) {
 		QMessageBox::information(this, QString(), tr("Calculation of shading factors was aborted."));
 		return;
 	}
 
+	// update cache file
+	try {
+		if (!cacheFile.parentPath().exists())
+			IBK::Path::makePath(cacheFile.parentPath());
+		m_shading->writeShadingCache(cacheFile);
+	}
+	catch (IBK::Exception & ex) {
+		// not critical, next calculation will just take longer
+		IBK::IBK_Message(ex.what(), IBK::MSG_WARNING);
+	}
+
 	progressDialog.hide();
 
 	OutputType outputType = (OutputType)m_ui->comboBoxFileType->currentIndex();
@@ -790,9 +823,10 @@ void SVSimulationShadingOptions::updateShadingFileName() {
 
 
 void SVSimulationShadingOptions::on_comboBoxCalculationMethod_activated(int /*index*/) {
-	bool isRayTracing = m_ui->comboBoxCalculationMethod->currentData().toUInt() == RayTracing;
-	m_ui->lineEditGridSize->setEnabled(isRayTracing);
-	m_ui->labelGridSize->setEnabled(isRayTracing);
+	// grid size is used for ray tracing and as texel size for the shadow map
+	bool usesGrid = m_ui->comboBoxCalculationMethod->currentData().toUInt() != SurfaceClipping;
+	m_ui->lineEditGridSize->setEnabled(usesGrid);
+	m_ui->labelGridSize->setEnabled(usesGrid);
 }
 
 
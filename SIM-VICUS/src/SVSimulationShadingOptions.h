@@ -52,6 +52,10 @@ class ModificationInfo;
 
 	All these parameters are merged into a single hash code which is used as part of the resulting
 	shading file name.
+
+	Computed shading factors are kept in a cache file in the project's results directory (var/shadingFactors.cache).
+	The cache is keyed per surface by a hash of its geometry, its visible obstacles, location and sun cone settings,
+	so that after small edits only affected surfaces are recomputed.
 */
 class SVSimulationShadingOptions : public QWidget {
 	Q_OBJECT
@@ -63,7 +67,8 @@ public:
 	/*! Defines the Calculation Method. */
 	enum CalculationMethod {
 		RayTracing,
-		SurfaceClipping
+		SurfaceClipping,
+		ShadowMap
 	};
 
 	/*! Defines the specific output type */
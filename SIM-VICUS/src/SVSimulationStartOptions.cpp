@@ -510,7 +510,10 @@ bool SVSimulationStartOptions::generateNANDRAD(QString & resultPath) {
 	}
 
 	// save project
-	nandradProj.writeXML(IBK::Path(nandradProjectFilePath.toStdString()));
+	if (SVSettings::instance().m_writeBinaryNandradProject)
+		nandradProj.writeBinary(IBK::Path(nandradProjectFilePath.toStdString()));
+	else
+		nandradProj.writeXML(IBK::Path(nandradProjectFilePath.toStdString()));
 	/// TODO : check if project file was correctly written
 
 	// get basename, for example /var/test/project.bla.12.2.nandrad  -> "project.bla.12.2"
@@ -28,11 +28,13 @@ INCLUDEPATH +=	\
 
 SOURCES += \
 	../../src/CCM_ClimateDataLoader.cpp \
+	../../src/CCM_ClimateTimeSeries.cpp \
 	../../src/CCM_SolarRadiationModel.cpp \
 	../../src/CCM_Constants.cpp \
 	../../src/CCM_SunPositionModel.cpp
 HEADERS += \
 	../../src/CCM_ClimateDataLoader.h \
+	../../src/CCM_ClimateTimeSeries.h \
 	../../src/CCM_SolarRadiationModel.h \
 	../../src/CCM_Constants.h \
 	../../src/CCM_SunPositionModel.h \
@@ -250,6 +250,7 @@ void ClimateDataLoader::readClimateDataCCDDirectory(const IBK::Path & directory,
 			}
 		}
 		updateCheckBits();
+		updateTimeSeries();
 	}
 	catch ( IBK::Exception &ex ) {
 		throw IBK::Exception(ex, "Error importing CCD files from climate data directory.", FUNC_ID );
@@ -731,6 +732,7 @@ void ClimateDataLoader::readClimateDataEPW(const IBK::Path & fname, bool headerO
 		throw IBK::Exception(ex, IBK::FormatString("Error reading file '%1'.").arg(fname), FUNC_ID);
 	}
 	updateCheckBits();
+	updateTimeSeries();
 }
 
 
@@ -853,6 +855,7 @@ void ClimateDataLoader::readClimateDataIBK(const IBK::Path & fname, bool headerO
 
 	IBK::read_vector_binary(in, m_dataTimePoints, DATALIMIT);
 	updateCheckBits();
+	updateTimeSeries();
 }
 
 double valueFromParaString(const std::string & valLine) {
@@ -1005,6 +1008,7 @@ void ClimateDataLoader::readClimateDataBBSRDat(const IBK::Path & fname, bool hea
 		throw IBK::Exception(ex, IBK::FormatString("Error reading file '%1'.").arg(fname), FUNC_ID);
 	}
 	updateCheckBits();
+	updateTimeSeries();
 }
 
 
@@ -1257,6 +1261,7 @@ void ClimateDataLoader::readClimateDataWAC(const IBK::Path & fname, bool headerO
 		throw IBK::Exception(ex, IBK::FormatString("Error reading file '%1'.").arg(fname), FUNC_ID);
 	}
 	updateCheckBits();
+	updateTimeSeries();
 }
 
 
@@ -1783,6 +1788,20 @@ void ClimateDataLoader::updateCheckBits() {
 }
 
 
+void ClimateDataLoader::updateTimeSeries() {
+	if (m_dataTimePoints.empty()) {
+		m_timeSeries.clear();
+		return;
+	}
+	// classify time points only once
+	std::string errmsg;
+	bool canBeUsedCyclic = checkForValidCyclicData(m_dataTimePoints, errmsg);
+	// Note: if data vectors have mismatching sizes, the time series is not set up and
+	//       setTime() will throw an exception
+	m_timeSeries.setup(m_dataTimePoints, m_data, NumClimateComponents, canBeUsedCyclic);
+}
+
+
 void ClimateDataLoader::setTime(int year, double secondsOfYear) {
 	FUNCID(ClimateDataLoader::setTime);
 
@@ -1797,6 +1816,9 @@ void ClimateDataLoader::setTime(int year, double secondsOfYear) {
 	double alpha, alphaMean; // 1 = use value at hourIndex1, 0 = use value at hourIndex2
 	unsigned int hourIndex1, hourIndex2;
 	unsigned int hourIndex1Mean, hourIndex2Mean;
+	// for data with time points, interpolated values of all components
+	double interpolatedData[NumClimateComponents];
+	bool haveInterpolatedData = false;
 
 	// equi-distant hourly data?
 	if (m_dataTimePoints.empty()) {
@@ -1833,11 +1855,14 @@ void ClimateDataLoader::setTime(int year, double secondsOfYear) {
 		}
 	}
 	else {
-		if (m_dataTimePoints.size() != m_data[Temperature].size())
-			throw IBK::Exception("Mismatching sizes of time points vector and data vectors.", FUNC_ID);
+		// set up time series engine, if data was modified after reading
+		if (!m_timeSeries.isSetupFor(m_dataTimePoints)) {
+			updateTimeSeries();
+			if (!m_timeSeries.isSetupFor(m_dataTimePoints))
+				throw IBK::Exception("Mismatching sizes of time points vector and data vectors.", FUNC_ID);
+		}
 
-		std::string errmsg;
-		bool canBeUsedCyclic = checkForValidCyclicData(m_dataTimePoints, errmsg);
+		bool canBeUsedCyclic = m_timeSeries.isCyclic();
 
 		if(canBeUsedCyclic) {
 			// normalize to year
@@ -1863,29 +1888,14 @@ void ClimateDataLoader::setTime(int year, double secondsOfYear) {
 									  .arg(year).arg(m_startYear), FUNC_ID);
 		}
 
-		// lookup t in m_dataTimePoints
-		std::vector<double>::const_iterator it = std::lower_bound(m_dataTimePoints.begin(), m_dataTimePoints.end(), t);
-		// it == m_dataTimePoints.begin() : t <= m_dataTimePoints[0]
-		// it == m_dataTimePoints.end() : t > m_dataTimePoints.back()
-		// it == m_dataTimePoints.begin()+1 : m_dataTimePoints[0] < t <= m_dataTimePoints[1]
-		if (it == m_dataTimePoints.begin()) {
-			hourIndex2 = hourIndex1 = 0;
-			alpha = 1;
-		}
-		else if (it == m_dataTimePoints.end()) {
-			hourIndex2 = hourIndex1 = (unsigned int)m_dataTimePoints.size()-1;
-			alpha = 1;
-		}
-		else {
-			// 64bit -> 32bit cast, hope we don't have gigabytes of data... :-)
-			hourIndex2 = static_cast<unsigned int>(it - m_dataTimePoints.begin());
-			hourIndex1 = hourIndex2-1;
-			alpha = 1 - (t - m_dataTimePoints[hourIndex1])/(m_dataTimePoints[hourIndex2]-m_dataTimePoints[hourIndex1]);
-		}
+		// lookup t in m_dataTimePoints (uses cached interval from last call)
+		m_timeSeries.lookup(t, hourIndex1, hourIndex2, alpha);
 		// for data with custom time points, _all_ climate series are linearly interpolated between momentary values
 		alphaMean = alpha;
 		hourIndex1Mean = hourIndex1;
 		hourIndex2Mean = hourIndex2;
+		m_timeSeries.interpolate(hourIndex1, hourIndex2, alpha, interpolatedData);
+		haveInterpolatedData = true;
 	}
 
 	// now compute interpolated values for each component
@@ -1895,16 +1905,20 @@ void ClimateDataLoader::setTime(int year, double secondsOfYear) {
 			IBK_ASSERT_XX(m_data[c].size() > std::max(hourIndex1, hourIndex2),
 						  IBK::FormatString("#CC=%1, hourIndex1=%2, hourIndex2=%3").arg(c).arg(hourIndex1).arg(hourIndex2));
 			double value;
-			// for solar radiation and rain we use middle hour value interpolation, otherwise time points at end of hour
-			switch (c) {
-			case DirectRadiationNormal :
-			case DiffuseRadiationHorizontal :
-			case Rain :
-				value = m_data[c][hourIndex1Mean] * alphaMean + m_data[c][hourIndex2Mean] * (1-alphaMean);
-				break;
+			if (haveInterpolatedData)
+				value = interpolatedData[c];
+			else {
+				// for solar radiation and rain we use middle hour value interpolation, otherwise time points at end of hour
+				switch (c) {
+				case DirectRadiationNormal :
+				case DiffuseRadiationHorizontal :
+				case Rain :
+					value = m_data[c][hourIndex1Mean] * alphaMean + m_data[c][hourIndex2Mean] * (1-alphaMean);
+					break;
 
-			default:
-				value = m_data[c][hourIndex1] * alpha + m_data[c][hourIndex2] * (1-alpha);
+				default:
+					value = m_data[c][hourIndex1] * alpha + m_data[c][hourIndex2] * (1-alpha);
+				}
 			}
 
 			// invalid/missing data points are replaced with defaults - a well-behaving simulation tool
@@ -44,6 +44,8 @@
 #include <IBK_LinearSpline.h>
 #include <IBK_Path.h>
 
+#include "CCM_ClimateTimeSeries.h"
+
 /*! Namespace of the Climate Calculation Module.
 
 	\example CCM_Test.cpp
@@ -235,6 +237,14 @@ public:
 	/*! Processes currently stored data and updates the check bits. */
 	void updateCheckBits();
 
+	/*! Sets up the interpolation engine for data with time points (m_dataTimePoints not empty).
+		This function is called automatically in the various read functions.
+		\warning Mind to call updateTimeSeries() whenever m_data or m_dataTimePoints have been modified
+			directly! A change of size or first/last time point is detected in setTime(), but not
+			changed values.
+	*/
+	void updateTimeSeries();
+
 	// Meta data
 
 	/*! Longitude of climate station location [deg].
@@ -301,6 +311,9 @@ public:
 	*/
 	IBK::LinearSpline		m_overrideData[NumClimateComponents];
 
+	/*! Interpolation engine for data with time points, set up in updateTimeSeries(). */
+	ClimateTimeSeries		m_timeSeries;
+
 
 	// Calculated/interpolated values
 
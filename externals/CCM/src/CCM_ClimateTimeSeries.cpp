@@ -0,0 +1,136 @@
+/*	Copyright (c) 2001-2017, Institut für Bauklimatik, TU Dresden, Germany
+
+	Written by A. Nicolai, H. Fechner, St. Vogelsang, A. Paepcke, J. Grunewald
+	All rights reserved.
+
+	This file is part of the CCM Library.
+
+	Redistribution and use in source and binary forms, with or without modification,
+	are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its contributors
+	   may be used to endorse or promote products derived from this software without
+	   specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+	ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+	WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+	ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+	(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+	LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+	ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+	(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+	SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+
+*/
+#include "CCM_ClimateTimeSeries.h"
+
+#include <algorithm>
+
+namespace CCM {
+
+bool ClimateTimeSeries::setup(const std::vector<double> & timePoints, const std::vector<double> * data, unsigned int nComponents, bool cyclic) {
+	clear();
+	if (timePoints.empty())
+		return false;
+	const unsigned int n = (unsigned int)timePoints.size();
+	for (unsigned int c=0; c<nComponents; ++c) {
+		if (data[c].size() != n)
+			return false;
+	}
+
+	m_timePoints = timePoints;
+	m_nComponents = nComponents;
+	m_cyclic = cyclic;
+	m_values.resize(n*nComponents);
+	for (unsigned int c=0; c<nComponents; ++c) {
+		const double * src = data[c].data();
+		for (unsigned int i=0; i<n; ++i)
+			m_values[i*nComponents + c] = src[i];
+	}
+	return true;
+}
+
+
+void ClimateTimeSeries::clear() {
+	m_timePoints.clear();
+	m_values.clear();
+	m_nComponents = 0;
+	m_cyclic = false;
+	m_cursor = 1;
+}
+
+
+bool ClimateTimeSeries::isSetupFor(const std::vector<double> & timePoints) const {
+	return !m_timePoints.empty() &&
+			m_timePoints.size() == timePoints.size() &&
+			m_timePoints.front() == timePoints.front() &&
+			m_timePoints.back() == timePoints.back();
+}
+
+
+void ClimateTimeSeries::lookup(double t, unsigned int & index1, unsigned int & index2, double & alpha) {
+	const double * tp = m_timePoints.data();
+	const unsigned int n = (unsigned int)m_timePoints.size();
+
+	// Note: conditions match the result of std::lower_bound(), which returns the first
+	//       time point >= t
+
+	// before or at first time point
+	if (t <= tp[0]) {
+		index2 = index1 = 0;
+		alpha = 1;
+		return;
+	}
+	// past last time point
+	if (t > tp[n-1]) {
+		index2 = index1 = n-1;
+		alpha = 1;
+		return;
+	}
+
+	// now we search the interval index k, so that tp[k-1] < t <= tp[k]
+	unsigned int k = m_cursor;
+	if (k < 1 || k > n-1)
+		k = 1;
+	if (tp[k-1] < t) {
+		// t is at or past cursor interval, check cursor interval and the following intervals
+		// (typical case for advancing solver time)
+		const unsigned int kMax = std::min(k + 4, n);
+		while (k < kMax && tp[k] < t)
+			++k;
+		// not found within a few intervals -> binary search in remaining range
+		if (k == kMax)
+			k = (unsigned int)(std::lower_bound(tp + k, tp + n, t) - tp);
+	}
+	else {
+		// time went backwards (solver step rejected, or restart) -> binary search in preceding range
+		k = (unsigned int)(std::lower_bound(tp, tp + k, t) - tp);
+	}
+	m_cursor = k;
+
+	index2 = k;
+	index1 = k-1;
+	alpha = 1 - (t - tp[index1])/(tp[index2]-tp[index1]);
+}
+
+
+void ClimateTimeSeries::interpolate(unsigned int index1, unsigned int index2, double alpha, double * values) const {
+	const double * row1 = m_values.data() + index1*m_nComponents;
+	const double * row2 = m_values.data() + index2*m_nComponents;
+	const double beta = 1-alpha;
+	for (unsigned int c=0; c<m_nComponents; ++c)
+		values[c] = row1[c] * alpha + row2[c] * beta;
+}
+
+} // namespace CCM
@@ -0,0 +1,113 @@
+/*	Copyright (c) 2001-2017, Institut für Bauklimatik, TU Dresden, Germany
+
+	Written by A. Nicolai, H. Fechner, St. Vogelsang, A. Paepcke, J. Grunewald
+	All rights reserved.
+
+	This file is part of the CCM Library.
+
+	Redistribution and use in source and binary forms, with or without modification,
+	are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its contributors
+	   may be used to endorse or promote products derived from this software without
+	   specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+	ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+	WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+	ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+	(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+	LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+	ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+	(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+	SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+
+*/
+#ifndef CCM_ClimateTimeSeriesH
+#define CCM_ClimateTimeSeriesH
+
+#include <vector>
+
+namespace CCM {
+
+/*! Interpolation engine for climate data with arbitrary (non-equidistant or sub-hourly) time points.
+
+	The engine is set up once, after climate data has been read. During setup, the cyclic
+	classification of the time points is stored and the data of all climate components is copied
+	into interleaved storage (time point-major, component-minor). Thus, interpolation of all
+	components at a given time point accesses two contiguous rows of memory and is done in
+	a single (vectorizable) loop.
+
+	Interval lookup uses a cached cursor, which is the interval found in the previous call. Since
+	the solver time usually advances monotonically in small steps, the requested time point
+	is nearly always in the same or the next interval, and lookups are O(1) on average. Only when
+	time jumps, a binary search is used.
+
+	Results are identical to a lookup with std::lower_bound() and linear interpolation of the
+	individual data vectors.
+*/
+class ClimateTimeSeries {
+public:
+	/*! Sets up the engine.
+		\param timePoints Time points in [s], strictly monotonic increasing.
+		\param data Array of data vectors, one for each component, each with the same size as timePoints.
+		\param nComponents Number of components in data.
+		\param cyclic If true, data can be used cyclic (is classified by caller).
+		\return Returns false if sizes of data vectors do not match size of time points. In this case, the
+			engine is not set up.
+	*/
+	bool setup(const std::vector<double> & timePoints, const std::vector<double> * data, unsigned int nComponents, bool cyclic);
+
+	/*! Clears the engine. */
+	void clear();
+
+	/*! Returns true, if the engine has been set up for the given time point vector.
+		Only size and first and last time point are compared.
+	*/
+	bool isSetupFor(const std::vector<double> & timePoints) const;
+
+	/*! Returns true, if data may be used cyclic (classified in setup()). */
+	bool isCyclic() const { return m_cyclic; }
+
+	/*! Searches the interval that encloses t.
+		On return, index1 and index2 hold the indexes of the time points enclosing t and alpha the interpolation
+		factor (1 = use value at index1, 0 = use value at index2). If t is before the first or past the last time
+		point, index1 == index2 holds the first or last index, respectively, and alpha is 1.
+	*/
+	void lookup(double t, unsigned int & index1, unsigned int & index2, double & alpha);
+
+	/*! Interpolates values of all components between time points with index1 and index2.
+		\param values Target array, size must be at least the number of components passed in setup().
+	*/
+	void interpolate(unsigned int index1, unsigned int index2, double alpha, double * values) const;
+
+private:
+	/*! Copy of time points in [s]. */
+	std::vector<double>		m_timePoints;
+	/*! Interleaved data, size m_timePoints.size()*m_nComponents. */
+	std::vector<double>		m_values;
+	/*! Number of components. */
+	unsigned int			m_nComponents = 0;
+	/*! Data can be used cyclic. */
+	bool					m_cyclic = false;
+	/*! Index of upper time point of last interval found in lookup(). */
+	unsigned int			m_cursor = 1;
+};
+
+} // namespace CCM
+
+/*! \file CCM_ClimateTimeSeries.h
+	\brief Contains declaration of class CCM::ClimateTimeSeries.
+*/
+
+#endif // CCM_ClimateTimeSeriesH
@@ -87,6 +87,7 @@ HEADERS += \
 	../../src/IBK_InputOutput.h \
 	../../src/IBK_Line.h \
 	../../src/IBK_LinearSpline.h \
+	../../src/IBK_LinearSplineLookup.h \
 	../../src/IBK_Logfile.h \
 	../../src/IBK_geographic.h \
 	../../src/IBK_math.h \
@@ -0,0 +1,248 @@
+/*	Copyright (c) 2001-2017, Institut für Bauklimatik, TU Dresden, Germany
+
+	Written by A. Nicolai, H. Fechner, St. Vogelsang, A. Paepcke, J. Grunewald
+	All rights reserved.
+
+	This file is part of the IBK Library.
+
+	Redistribution and use in source and binary forms, with or without modification,
+	are permitted provided that the following conditions are met:
+
+	1. Redistributions of source code must retain the above copyright notice, this
+	   list of conditions and the following disclaimer.
+
+	2. Redistributions in binary form must reproduce the above copyright notice,
+	   this list of conditions and the following disclaimer in the documentation
+	   and/or other materials provided with the distribution.
+
+	3. Neither the name of the copyright holder nor the names of its contributors
+	   may be used to endorse or promote products derived from this software without
+	   specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+	ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+	WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+	DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+	ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+	(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+	LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+	ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+	(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+	SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+	This library contains derivative work based on other open-source libraries.
+	See OTHER_LICENCES and source code headers for details.
+
+*/
+
+#ifndef IBK_LinearSplineLookupH
+#define IBK_LinearSplineLookupH
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+
+#include "IBK_LinearSpline.h"
+#include "IBK_Exception.h"
+
+namespace IBK {
+
+/*! Read-only, pre-scaled variant of LinearSpline for frequently evaluated lookups.
+
+	The table is generated once from a valid LinearSpline. An equidistant index table with cells
+	narrower than the smallest spline interval maps x to the spline interval in O(1), so the binary
+	search of LinearSpline::value() is avoided. Slopes are pre-computed, and clamping and the
+	interval correction use min/max and comparison results only, so that value() contains no
+	data-dependent branches (except for capped tables, see below) and the loop in values() can be
+	pipelined by the compiler.
+
+	Interpolation always uses the original supporting points. If the index table for the smallest
+	interval width would exceed the requested maximum table size, the table is capped and a cell may
+	overlap several spline intervals. The interval is then found with a local search of bounded length
+	(see searchSteps()), so results remain exact and only the lookup gets slower for splines with very
+	unevenly distributed supporting points.
+
+	The template argument selects the storage type of the table. With float, the memory footprint
+	is halved at the cost of single precision table values; arithmetic is always done in double.
+
+	\code
+	IBK::LinearSplineLookup<> lookup;
+	lookup.setup(spline);
+	double y = lookup.value(x);
+	lookup.values(xVec.data(), yVec.data(), xVec.size());
+	\endcode
+*/
+template <typename T = double>
+class LinearSplineLookup {
+public:
+	/*! Default maximum number of cells in the index table. */
+	enum { DEFAULT_MAX_TABLE_SIZE = 65536 };
+
+	/*! Generates the lookup table from a linear spline.
+		\param spline The spline, must be valid (makeSpline() called). The extrapolation method is taken over.
+		\param maxTableSize Maximum number of cells in the index table. If the table is capped, lookups
+			use a local search within each cell (see searchSteps()).
+	*/
+	void setup(const LinearSpline & spline, unsigned int maxTableSize = DEFAULT_MAX_TABLE_SIZE);
+
+	/*! Returns the interpolated value at x, or the extrapolated value for x outside the spline range. */
+	double value(double x) const {
+		// clamp x to table range for the interval lookup
+		double xc = std::min(std::max(x, m_xMin), m_xMax);
+		unsigned int cell = std::min((unsigned int)((xc - m_xMin)*m_invCellWidth), m_lastCell);
+		unsigned int i = m_index[cell];
+		// cells are narrower than intervals, so usually a single correction step is needed
+		// (decrement only catches rounding at cell boundaries)
+		if (m_searchSteps <= 1)
+			i += (unsigned int)(xc >= m_intervals[i].m_xUpper);
+		else {
+			// capped table: local search within the cell, ends after at most m_searchSteps steps
+			// (upper bound of last interval is infinity)
+			while (xc >= m_intervals[i].m_xUpper)
+				++i;
+		}
+		i -= (unsigned int)(xc < m_intervals[i].m_x);
+		const Interval & iv = m_intervals[i];
+		// extrapolation bounds are either the table range (constant) or unlimited (linear)
+		double xe = std::min(std::max(x, m_xExtrapolationMin), m_xExtrapolationMax);
+		return (double)iv.m_y + (double)iv.m_slope*(xe - (double)iv.m_x);
+	}
+
+	/*! Batched evaluation: y[k] = value(x[k]) for k = 0...n-1. */
+	void values(const double * x, double * y, unsigned int n) const {
+		for (unsigned int k=0; k<n; ++k)
+			y[k] = value(x[k]);
+	}
+
+	/*! Returns true, if setup() has not been called yet. */
+	bool empty() const { return m_intervals.empty(); }
+
+	/*! Returns maximum number of local search steps per lookup: 1 if each cell overlaps at most two spline
+		intervals, larger if the index table was capped in setup().
+	*/
+	unsigned int searchSteps() const { return m_searchSteps; }
+
+	/*! Returns number of cells in the index table. */
+	unsigned int tableSize() const { return (unsigned int)m_index.size(); }
+
+private:
+	/*! Data of a single spline interval, stored together so that a lookup touches a single cache line. */
+	struct Interval {
+		/*! Lower bound of interval. */
+		T	m_x;
+		/*! Upper bound of interval, infinity for the last interval. */
+		T	m_xUpper;
+		/*! Value at lower bound. */
+		T	m_y;
+		/*! Slope within interval. */
+		T	m_slope;
+	};
+
+	/*! Generates intervals from supporting points. */
+	void setIntervals(const std::vector<double> & x, const std::vector<double> & y);
+
+	/*! All spline intervals, a single-point spline has one interval with zero slope. */
+	std::vector<Interval>		m_intervals;
+	/*! Index of the spline interval at the lower bound of each equidistant cell. */
+	std::vector<unsigned int>	m_index;
+	/*! Index of the last cell. */
+	unsigned int				m_lastCell = 0;
+	/*! Maximum number of local search steps needed to reach the interval of any x within a cell. */
+	unsigned int				m_searchSteps = 0;
+	/*! Inverse of the equidistant cell width. */
+	double						m_invCellWidth = 0;
+	/*! Lower bound of table range (first supporting point). */
+	double						m_xMin = 0;
+	/*! Upper bound of table range (last supporting point). */
+	double						m_xMax = 0;
+	/*! Lower bound for x in extrapolation. */
+	double						m_xExtrapolationMin = 0;
+	/*! Upper bound for x in extrapolation. */
+	double						m_xExtrapolationMax = 0;
+};
+
+
+template <typename T>
+void LinearSplineLookup<T>::setup(const LinearSpline & spline, unsigned int maxTableSize) {
+	FUNCID(LinearSplineLookup::setup);
+	if (!spline.valid())
+		throw IBK::Exception("Linear spline not properly initialized!", FUNC_ID);
+	if (maxTableSize < 2)
+		throw IBK::Exception("Maximum table size must be at least 2.", FUNC_ID);
+
+	setIntervals(spline.x(), spline.y());
+
+	// splines with a single interval (or a single point) only need one cell
+	unsigned int nCells = 1;
+	if (m_intervals.size() > 1) {
+		// cell width is half of the smallest interval width (based on the stored supporting points), so that
+		// each cell overlaps at most two intervals; zero width may result from rounding to float
+		double minDx = m_xMax - m_xMin;
+		for (unsigned int i=0; i+1<m_intervals.size(); ++i)
+			minDx = std::min(minDx, (double)m_intervals[i+1].m_x - (double)m_intervals[i].m_x);
+		double cells = minDx > 0 ? std::ceil(2*(m_xMax - m_xMin)/minDx) : std::numeric_limits<double>::max();
+		// for very small intervals the table is capped, cells then may overlap more intervals
+		nCells = (unsigned int)std::min(cells, (double)maxTableSize);
+	}
+
+	m_lastCell = nCells - 1;
+	m_invCellWidth = m_xMax > m_xMin ? nCells/(m_xMax - m_xMin) : 0;
+	// index table holds an additional entry with the last interval, used to determine the search length
+	m_index.resize(nCells + 1);
+	unsigned int j = 0;
+	for (unsigned int i=0; i<=nCells; ++i) {
+		double x = i < nCells ? m_xMin + i/m_invCellWidth : m_xMax;
+		while (j+1 < m_intervals.size() && x >= (double)m_intervals[j].m_xUpper)
+			++j;
+		m_index[i] = j;
+	}
+	// x within a cell may fall into any interval up to the one at the start of the next cell; we also
+	// include the cell thereafter, since rounding in the cell computation may shift x across the cell boundary
+	m_searchSteps = 0;
+	for (unsigned int i=0; i<nCells; ++i)
+		m_searchSteps = std::max(m_searchSteps, m_index[std::min(i+2, nCells)] - m_index[i]);
+	m_index.pop_back();
+
+	if (spline.m_extrapolationMethod == LinearSpline::EM_Linear) {
+		m_xExtrapolationMin = -std::numeric_limits<double>::max();
+		m_xExtrapolationMax = std::numeric_limits<double>::max();
+	}
+	else {
+		m_xExtrapolationMin = m_xMin;
+		m_xExtrapolationMax = m_xMax;
+	}
+}
+
+
+template <typename T>
+void LinearSplineLookup<T>::setIntervals(const std::vector<double> & x, const std::vector<double> & y) {
+	unsigned int n = (unsigned int)x.size();
+	// a spline with n points has n-1 intervals, a single-point spline is stored as one constant interval
+	m_intervals.resize(std::max(1u, n-1));
+	for (unsigned int i=0; i<m_intervals.size(); ++i) {
+		Interval & iv = m_intervals[i];
+		iv.m_x = (T)x[i];
+		iv.m_y = (T)y[i];
+		if (i+1 < n) {
+			iv.m_xUpper = (T)x[i+1];
+			iv.m_slope = (T)((y[i+1] - y[i])/(x[i+1] - x[i]));
+		}
+		else {
+			iv.m_slope = 0;
+		}
+	}
+	m_intervals.back().m_xUpper = std::numeric_limits<T>::infinity();
+	// range is taken from stored values, so that clamped x never falls below the first interval
+	m_xMin = (double)m_intervals.front().m_x;
+	m_xMax = (double)(T)x.back();
+}
+
+} // namespace IBK
+
+/*! \file IBK_LinearSplineLookup.h
+	\brief Contains the class LinearSplineLookup, a pre-scaled lookup table for linear splines.
+*/
+
+#endif // IBK_LinearSplineLookupH
@@ -43,6 +43,7 @@
 #include <ctime>
 #include <fstream>
 #include <sstream>
+#include <mutex>
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -257,6 +258,9 @@ void MessageHandler::msg(const std::string& msg, msg_type_t t, const char * func
 
 	std::stringstream consoleOut;
 
+	// serialize output, since messages may be issued concurrently (e.g. when reading project files in parallel)
+	std::lock_guard<std::mutex> lock(m_outputMutex);
+
 	switch (t) {
 		case MSG_PROGRESS:
 			// write output for all messages to logfile
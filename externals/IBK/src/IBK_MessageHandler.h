@@ -40,6 +40,7 @@
 #define IBK_MessageHandlerH
 
 #include <string>
+#include <mutex>
 #include "IBK_FormatString.h"
 
 namespace IBK {
@@ -188,6 +189,9 @@ private:
 	/*! Closes currently open logfile and delete allocated memory. */
 	void closeLogFile();
 
+	/*! Serializes console and logfile output of concurrent msg() calls. */
+	std::mutex		m_outputMutex;
+
 	friend class MessageIndentor;
 };
 
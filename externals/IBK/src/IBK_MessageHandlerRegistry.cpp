@@ -48,6 +48,9 @@
 
 namespace IBK {
 
+/*! Thread-specific message handler, overrides process-wide message handler when set. */
+static thread_local MessageHandler * threadMsgHandler = nullptr;
+
 MessageHandlerRegistry::MessageHandlerRegistry() {
 	m_msgHandler = &m_defaultMsgHandler;
 }
@@ -69,5 +72,15 @@ void MessageHandlerRegistry::setMessageHandler(MessageHandler *handle) {
 	m_msgHandler = handle;
 }
 
+void MessageHandlerRegistry::setThreadMessageHandler(MessageHandler *handle) {
+	threadMsgHandler = handle;
+}
+
+MessageHandler * MessageHandlerRegistry::messageHandler() {
+	if (threadMsgHandler != nullptr)
+		return threadMsgHandler;
+	return m_msgHandler;
+}
+
 } // namespace IBK
 
@@ -67,7 +67,7 @@ public:
 				const char * func_id = nullptr,
 				int verbose_level = VL_ALL)
 	{
-		m_msgHandler->msg(msg, t, func_id, verbose_level);
+		messageHandler()->msg(msg, t, func_id, verbose_level);
 	}
 
 	/*! Resets the default message handler. */
@@ -76,8 +76,16 @@ public:
 	/*! Sets a message handler instance. */
 	void setMessageHandler(MessageHandler * handle);
 
-	/*! Returns the message handler instance. */
-	MessageHandler * messageHandler() { return m_msgHandler; }
+	/*! Sets a message handler instance for the calling thread only.
+		While set, all messages issued from this thread are relayed to this handler instead of the
+		process-wide handler. Pass nullptr to revert to the process-wide handler.
+		Used when several independent computations (each with own log file) run in parallel threads.
+		The object does not get owned by the MessageHandlerRegistry singleton.
+	*/
+	void setThreadMessageHandler(MessageHandler * handle);
+
+	/*! Returns the message handler instance (the thread-specific handler, if set for the calling thread). */
+	MessageHandler * messageHandler();
 
 private:
 	/*! Singleton - Constructor hidden from public. */
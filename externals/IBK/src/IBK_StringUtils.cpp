@@ -153,79 +153,53 @@ double string2valDef<double>(const std::string& str, const double & def) {
 
 
 void string2valueVector(const std::string & origStr, std::vector<double> & vec) {
+	string2valueVector(origStr.c_str(), vec, false);
+}
+
+
+void string2valueVector(const char * str, std::vector<double> & vec, bool commaSeparated) {
 	FUNCID(IBK::string2valueVector);
-	// algorithm is simple - search for white-space delimiters and replace the first white-space after each non-white space
-	// substr with \0 and remember its position, then parse all the substrings
+	// algorithm is simple - search for the begin and end of each number (delimited by white-space and optionally
+	// commas) and parse the number directly from the character buffer, without any temporary copies
 
 	vec.clear();
-	size_t strsize = origStr.size();
-	if (strsize == 0)
-		return; // empty string - no data in vector
-
-	std::string str(origStr);
-	size_t pos = 0;
-	size_t numberStart = 0;
-
-	bool inNumber = false;
-
-	// process entire string, search until we toggle from "whitespace" to "number" and remember starting position of number
-	// then continue until we toggle from "number" to "whitespace" and try to convert the string in-between
-	while (pos < strsize) {
-		char ch = str[pos];
-		// do we have a whitespace char?
-		if (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r') {
-			// toggle to "whitespace mode"?
-			if (inNumber) {
-				inNumber = false;
-				// change character to \0
-				str[pos] = 0;
-#ifdef IBK_USE_STOD
-				// try to parse from begin of number to this position
-				size_t charCount;
-				try {
-					double val = std::stod(str.data()+numberStart, &charCount);
-					if (charCount != pos - numberStart)
-						throw std::exception();
-					vec.push_back(val);
-				} catch (...) {
-					throw IBK::Exception(IBK::FormatString("'%1' at character pos #2 is not a valid number.").arg(str.data()+numberStart).arg(numberStart), FUNC_ID);
-				}
-#else
-				// try to parse from begin of number to this position
-				double val;
-				auto answer = fast_float::from_chars(str.data()+numberStart, nullptr, val);
-				if (answer.ec != std::errc())
-					throw IBK::Exception(IBK::FormatString("'%1' at character pos #2 is not a valid number.").arg(str.data()+numberStart).arg(numberStart), FUNC_ID);
-				vec.push_back(val);
-#endif // IBK_USE_STOD
-			}
+	if (str == nullptr)
+		return;
+
+	const char * pos = str;
+	while (*pos != 0) {
+		// skip delimiters
+		char ch = *pos;
+		if (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || (commaSeparated && ch == ',')) {
+			++pos;
+			continue;
 		}
-		else {
-			// toggle to "number" mode?
-			if (!inNumber) {
-				numberStart = pos;
-				inNumber = true;
-			}
+		// search end of number
+		const char * numberStart = pos;
+		while (*pos != 0) {
+			ch = *pos;
+			if (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || (commaSeparated && ch == ','))
+				break;
+			++pos;
 		}
-		++pos;
-	}
-	// if we are still in number mode at end of string, then try to parse the last number
-	if (inNumber) {
 #ifdef IBK_USE_STOD
+		// try to parse from begin of number to this position
+		std::string numberStr(numberStart, pos);
 		size_t charCount;
 		try {
-			double val = std::stod(str.data()+numberStart, &charCount);
-			if (charCount != pos - numberStart)
-				throw;
+			double val = std::stod(numberStr, &charCount);
+			if (charCount != numberStr.size())
+				throw std::exception();
 			vec.push_back(val);
 		} catch (...) {
-			throw IBK::Exception(IBK::FormatString("'%1' at character pos #2 is not a valid number.").arg(str.data()+numberStart).arg(numberStart), FUNC_ID);
+			throw IBK::Exception(IBK::FormatString("'%1' at character pos #%2 is not a valid number.").arg(numberStr).arg((unsigned int)(numberStart - str)), FUNC_ID);
 		}
 #else
+		// try to parse from begin of number to this position
 		double val;
-		auto answer = fast_float::from_chars(str.data()+numberStart, nullptr, val);
-		if (answer.ec != std::errc())
-			throw IBK::Exception(IBK::FormatString("'%1' at character pos #2 is not a valid number.").arg(str.data()+numberStart).arg(numberStart), FUNC_ID);
+		auto answer = fast_float::from_chars(numberStart, pos, val);
+		if (answer.ec != std::errc() || answer.ptr != pos)
+			throw IBK::Exception(IBK::FormatString("'%1' at character pos #%2 is not a valid number.").arg(std::string(numberStart, pos)).arg((unsigned int)(numberStart - str)), FUNC_ID);
 		vec.push_back(val);
 #endif // IBK_USE_STOD
 	}
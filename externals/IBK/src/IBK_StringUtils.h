@@ -238,6 +238,18 @@ double string2valDef<double>(const std::string& str, const double & def);
 */
 void string2valueVector(const std::string & str, std::vector<double> & vec);
 
+/*! Converts a zero-terminated character buffer with white-space separated values into a vector.
+	Numbers are parsed directly from the buffer, so this function can be used on text data of XML elements
+	without creating temporary string copies.
+	\param str Zero-terminated character buffer (nullptr is treated like an empty string).
+	\param vec The vector to hold the numbers, emptied upon start (capacity is kept).
+	\param commaSeparated If true, commas are treated as delimiters, too (sequences of delimiters are
+		treated as a single delimiter).
+
+	This function throws an IBK::Exception in case of invalid numbers in string.
+*/
+void string2valueVector(const char * str, std::vector<double> & vec, bool commaSeparated);
+
 
 /*! Tries to read a vector of numbers of type T out of a string.
 	If the number of read values is less then 2, a runtime error is thrown.
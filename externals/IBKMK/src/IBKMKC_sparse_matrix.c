@@ -694,6 +694,189 @@ void ibkmk_spmat_csr_backsolve(unsigned int n, IBKMK_CONST unsigned int * ia, IB
 }
 
 
+/* Helper function, sorts rows into level buckets (counting sort, keeps ascending row order within each level). */
+static void ibkmk_sort_rows_by_level(unsigned int n, unsigned int nLevels, IBKMK_CONST unsigned int * level,
+	unsigned int * levelStart, unsigned int * levelRows)
+{
+	unsigned int i, l;
+	for (l=0; l<=nLevels; ++l)
+		levelStart[l] = 0;
+	for (i=0; i<n; ++i)
+		++levelStart[level[i]+1];
+	for (l=0; l<nLevels; ++l)
+		levelStart[l+1] += levelStart[l];
+	/* use levelStart as insert position, afterwards shift back */
+	for (i=0; i<n; ++i)
+		levelRows[levelStart[level[i]]++] = i;
+	for (l=nLevels; l>0; --l)
+		levelStart[l] = levelStart[l-1];
+	levelStart[0] = 0;
+}
+
+
+void ibkmk_spmat_csr_levels(unsigned int n,
+							IBKMK_CONST unsigned int * ia,
+							IBKMK_CONST unsigned int * ja,
+							unsigned int * levelL,
+							unsigned int * levelStartL,
+							unsigned int * levelRowsL,
+							unsigned int * levelU,
+							unsigned int * levelStartU,
+							unsigned int * levelRowsU,
+							unsigned int * nLevelsL,
+							unsigned int * nLevelsU)
+{
+	unsigned int i, k, kIdx, lev;
+
+	/* lower triangular part: row i depends on all rows k < i */
+	*nLevelsL = 0;
+	for (i=0; i<n; ++i) {
+		lev = 0;
+		for (kIdx = ia[i]; kIdx < ia[i + 1]; ++kIdx) {
+			k = ja[kIdx];
+			if (k >= i)
+				break;
+			if (levelL[k] + 1 > lev)
+				lev = levelL[k] + 1;
+		}
+		levelL[i] = lev;
+		if (lev + 1 > *nLevelsL)
+			*nLevelsL = lev + 1;
+	}
+	ibkmk_sort_rows_by_level(n, *nLevelsL, levelL, levelStartL, levelRowsL);
+
+	/* upper triangular part: row i depends on all rows k > i */
+	*nLevelsU = 0;
+	for (i=n; i>0; --i) {
+		lev = 0;
+		for (kIdx = ia[i-1]; kIdx < ia[i]; ++kIdx) {
+			k = ja[kIdx];
+			if (k <= i-1)
+				continue;
+			if (levelU[k] + 1 > lev)
+				lev = levelU[k] + 1;
+		}
+		levelU[i-1] = lev;
+		if (lev + 1 > *nLevelsU)
+			*nLevelsU = lev + 1;
+	}
+	ibkmk_sort_rows_by_level(n, *nLevelsU, levelU, levelStartU, levelRowsU);
+}
+
+
+void ibkmk_spmat_csr_ilu_levels(unsigned int n,
+								IBKMK_CONST unsigned int * ia,
+								IBKMK_CONST unsigned int * ja,
+								unsigned int nLevels,
+								IBKMK_CONST unsigned int * levelStart,
+								IBKMK_CONST unsigned int * levelRows,
+								double * A)
+{
+	unsigned int l;
+	int r;
+	(void)n;
+
+	/* process all levels, rows within a level are independent */
+	for (l=0; l<nLevels; ++l) {
+		int rFirst = (int)levelStart[l];
+		int rLast = (int)levelStart[l+1];
+#pragma omp parallel for schedule(static) if(rLast - rFirst > 32)
+		for (r=rFirst; r<rLast; ++r) {
+			unsigned int i = levelRows[r];
+			unsigned int kIdx, jidx, sidx, k, j;
+			double A_ik, A_ii_inv;
+			/* process all columns k < i of row i in ascending order (rows k are already factorized) */
+			for (kIdx = ia[i]; kIdx < ia[i + 1]; ++kIdx) {
+				k = ja[kIdx];
+				if (k >= i)
+					break;
+				A_ik = A[kIdx];
+				/* do A_ij := A_ij - A_ik * A_kj for all j > k in row k that are also in row i;
+				   columns are sorted, so we can search row i starting behind column k */
+				sidx = kIdx + 1;
+				for (jidx = ia[k]; jidx < ia[k + 1]; ++jidx) {
+					j = ja[jidx];
+					if (j <= k)
+						continue;
+					while (sidx < ia[i + 1] && ja[sidx] < j)
+						++sidx;
+					if (sidx == ia[i + 1])
+						break;
+					if (ja[sidx] == j)
+						A[sidx] -= A_ik*A[jidx];
+				}
+			}
+			/* kIdx now points to main diagonal element (if it exists); scale upper triangular part of row i */
+			if (kIdx < ia[i + 1] && ja[kIdx] == i) {
+				A_ii_inv = 1.0/A[kIdx];
+				for (jidx = kIdx + 1; jidx < ia[i + 1]; ++jidx)
+					A[jidx] *= A_ii_inv;
+			}
+		}
+	}
+}
+
+
+void ibkmk_spmat_csr_backsolve_levels(	unsigned int n,
+										IBKMK_CONST unsigned int * ia,
+										IBKMK_CONST unsigned int * ja,
+										IBKMK_CONST double * A,
+										unsigned int nLevelsL,
+										IBKMK_CONST unsigned int * levelStartL,
+										IBKMK_CONST unsigned int * levelRowsL,
+										unsigned int nLevelsU,
+										IBKMK_CONST unsigned int * levelStartU,
+										IBKMK_CONST unsigned int * levelRowsU,
+										double * b)
+{
+	unsigned int l;
+	int r;
+	(void)n;
+
+	/** firstly, L loop (forward elimination) **/
+	for (l=0; l<nLevelsL; ++l) {
+		int rFirst = (int)levelStartL[l];
+		int rLast = (int)levelStartL[l+1];
+#pragma omp parallel for schedule(static) if(rLast - rFirst > 64)
+		for (r=rFirst; r<rLast; ++r) {
+			unsigned int i = levelRowsL[r];
+			unsigned int kIdx, k = 0;
+			double bi = b[i];
+			for (kIdx = ia[i]; kIdx < ia[i + 1]; ++kIdx) {
+				k = ja[kIdx];
+				/* stop once diagonal element (k == i) found */
+				if (k == i)
+					break;
+				bi -= A[kIdx]*b[k];
+			}
+			/* must have stopped multiplication loop at diagonal element */
+			assert(i == k);
+			b[i] = bi/A[kIdx];
+		}
+	}
+	/* now b holds L^-1*b */
+
+	/* secondly, U loop (backward elimination), with special case u_i,i = 1 */
+	for (l=0; l<nLevelsU; ++l) {
+		int rFirst = (int)levelStartU[l];
+		int rLast = (int)levelStartU[l+1];
+#pragma omp parallel for schedule(static) if(rLast - rFirst > 64)
+		for (r=rFirst; r<rLast; ++r) {
+			unsigned int i = levelRowsU[r];
+			unsigned int kIdx;
+			double bi = b[i];
+			for (kIdx = ia[i]; kIdx < ia[i + 1]; ++kIdx) {
+				if (ja[kIdx] <= i)
+					continue;
+				bi -= A[kIdx]*b[ja[kIdx]];
+			}
+			b[i] = bi;
+		}
+	}
+	/* now b holds U^-1 * L^-1 * b	*/
+}
+
+
 void ibkmk_spmat_csr_multiply(	unsigned int n,
 								IBKMK_CONST double * A,
 								IBKMK_CONST unsigned int * ia,
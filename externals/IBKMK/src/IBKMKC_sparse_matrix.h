@@ -152,6 +152,82 @@ void ibkmk_spmat_csr_backsolve(	unsigned int n,
 								IBKMK_CONST double * A,
 								double * b);
 
+/*! Computes level schedules for the lower and upper triangular part of a sparse matrix in CSR format.
+	Row i of the lower triangular part depends on all rows k < i with a non-zero element A_ik, row i of the
+	upper triangular part depends on all rows k > i with a non-zero element A_ik. All rows of the same level
+	are independent of each other and can be processed in parallel.
+	Rows are stored level by level, within each level in ascending order.
+	\param n Matrix dimension.
+	\param ia Row index vector, size n+1.
+	\param ja Column index vector, size nnz, column indexes within a row must be sorted ascending.
+	\param levelL Work/result vector, size n, holds level of each row in lower triangular part.
+	\param levelStartL Start index of each level in levelRowsL, size n+1 (only nLevelsL+1 values used).
+	\param levelRowsL Rows ordered by level of lower triangular part, size n.
+	\param levelU Work/result vector, size n, holds level of each row in upper triangular part.
+	\param levelStartU Start index of each level in levelRowsU, size n+1 (only nLevelsU+1 values used).
+	\param levelRowsU Rows ordered by level of upper triangular part, size n.
+	\param nLevelsL Number of levels of lower triangular part (output).
+	\param nLevelsU Number of levels of upper triangular part (output).
+*/
+void ibkmk_spmat_csr_levels(	unsigned int n,
+								IBKMK_CONST unsigned int * ia,
+								IBKMK_CONST unsigned int * ja,
+								unsigned int * levelL,
+								unsigned int * levelStartL,
+								unsigned int * levelRowsL,
+								unsigned int * levelU,
+								unsigned int * levelStartU,
+								unsigned int * levelRowsU,
+								unsigned int * nLevelsL,
+								unsigned int * nLevelsU);
+
+/*! Level-scheduled sparse matrix incomplete LU factorization - ILU(0), row-oriented (IKJ) variant.
+	Rows of the same level (of the lower triangular part) are factorized in parallel. The result is
+	identical (bitwise) to the one of ibkmk_spmat_csr_ilu_symm() and ibkmk_spmat_csr_ilu_asymm(), independent
+	of the number of threads.
+	\param n Matrix dimension.
+	\param ia Row index vector, size n+1.
+	\param ja Column index vector, size nnz, column indexes within a row must be sorted ascending.
+	\param nLevels Number of levels of lower triangular part.
+	\param levelStart Start index of each level in levelRows, size nLevels+1.
+	\param levelRows Rows ordered by level, size n.
+	\param A Matrix data, will hold iLU factors when function finishes, size nnz.
+*/
+void ibkmk_spmat_csr_ilu_levels(	unsigned int n,
+									IBKMK_CONST unsigned int * ia,
+									IBKMK_CONST unsigned int * ja,
+									unsigned int nLevels,
+									IBKMK_CONST unsigned int * levelStart,
+									IBKMK_CONST unsigned int * levelRows,
+									double * A);
+
+/*! Level-scheduled sparse matrix incomplete backsolve iLU x = b.
+	Rows of the same level are processed in parallel, in the forward and backward sweep. The result is
+	identical (bitwise) to the one of ibkmk_spmat_csr_backsolve(), independent of the number of threads.
+	\param n Matrix dimension.
+	\param ia Row index vector, size n+1.
+	\param ja Column index vector, size nnz, column indexes within a row must be sorted ascending.
+	\param A Matrix data (already ILU-factorized), size nnz.
+	\param nLevelsL Number of levels of lower triangular part.
+	\param levelStartL Start index of each level in levelRowsL, size nLevelsL+1.
+	\param levelRowsL Rows ordered by level of lower triangular part, size n.
+	\param nLevelsU Number of levels of upper triangular part.
+	\param levelStartU Start index of each level in levelRowsU, size nLevelsU+1.
+	\param levelRowsU Rows ordered by level of upper triangular part, size n.
+	\param b Right-hand side vector, size n, holds solution on return.
+*/
+void ibkmk_spmat_csr_backsolve_levels(	unsigned int n,
+										IBKMK_CONST unsigned int * ia,
+										IBKMK_CONST unsigned int * ja,
+										IBKMK_CONST double * A,
+										unsigned int nLevelsL,
+										IBKMK_CONST unsigned int * levelStartL,
+										IBKMK_CONST unsigned int * levelRowsL,
+										unsigned int nLevelsU,
+										IBKMK_CONST unsigned int * levelStartU,
+										IBKMK_CONST unsigned int * levelRowsU,
+										double * b);
+
 /*! Generic sparse matrix - vector multiply r = A*b.
 	\param n Matrix dimension.
 	\param nnz Number of non-zero elements.
@@ -42,12 +42,21 @@
 #include <algorithm>
 #include <functional>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 #include "IBKMK_SparseMatrixCSR.h"
 #include "IBKMKC_sparse_matrix.h"
 #include <IBK_InputOutput.h>
 
 namespace IBKMK {
 
+/*! Minimum average number of rows per level for level-scheduled ilu() and backsolveILU().
+	For fewer rows per level, the synchronization overhead between levels outweighs the gain from parallel processing.
+*/
+static const unsigned int MIN_ROWS_PER_LEVEL = 32;
+
 #define INVALID_INDEX(k,index,offset)  ((k) > 0 && (index)[(offset) + (k)] == (index)[(offset) + (k) - 1])
 
 void SparseMatrixCSR::addIdentityMatrix() {
@@ -141,6 +150,8 @@ void SparseMatrixCSR::resize(unsigned int n, unsigned int nnz, const unsigned in
 		std::memcpy((void*)&m_jaT[0], (const void*)jaT, sizeof(unsigned int)*m_nnz);
 		m_patternMode = PM_Asymmetric;
 	}
+	m_levelStartL.clear();
+	m_levelStartU.clear();
 }
 
 
@@ -159,6 +170,8 @@ void SparseMatrixCSR::resizeFromEID(unsigned int n, unsigned int elementsPerRow,
 	m_ja.clear();
 	// eid format is always symmetric
 	m_patternMode = PM_Symmetric;
+	m_levelStartL.clear();
+	m_levelStartU.clear();
 	// fill ja and ia
 	for (unsigned int i = 0; i < n; ++i) {
 		unsigned int nValidIndices = 0;
@@ -267,6 +280,67 @@ unsigned int SparseMatrixCSR::storageIndex(unsigned int i, unsigned int j) const
 }
 
 void SparseMatrixCSR::ilu() {
+#if defined(_OPENMP)
+	if (omp_get_max_threads() > 1 && levelScheduleEfficient()) {
+		iluLevelScheduled();
+		return;
+	}
+#endif // _OPENMP
+	iluSerial();
+}
+
+
+void SparseMatrixCSR::backsolveILU(double * b) const {
+#if defined(_OPENMP)
+	// Mind: level schedule is already computed in ilu(), unless matrix holds deserialized factorization data
+	if (omp_get_max_threads() > 1 && levelScheduleEfficient()) {
+		backsolveILULevelScheduled(b);
+		return;
+	}
+#endif // _OPENMP
+	backsolveILUSerial(b);
+}
+
+
+void SparseMatrixCSR::computeLevelSchedule() const {
+	if (!m_levelStartL.empty())
+		return;
+	std::vector<unsigned int> levelL(m_n), levelU(m_n);
+	std::vector<unsigned int> levelStartL(m_n+1), levelStartU(m_n+1);
+	m_levelRowsL.resize(m_n);
+	m_levelRowsU.resize(m_n);
+	unsigned int nLevelsL, nLevelsU;
+	ibkmk_spmat_csr_levels(m_n, &m_ia[0], &m_ja[0],
+						   &levelL[0], &levelStartL[0], &m_levelRowsL[0],
+						   &levelU[0], &levelStartU[0], &m_levelRowsU[0],
+						   &nLevelsL, &nLevelsU);
+	m_levelStartU.assign(levelStartU.begin(), levelStartU.begin() + nLevelsU + 1);
+	m_levelStartL.assign(levelStartL.begin(), levelStartL.begin() + nLevelsL + 1);
+}
+
+
+bool SparseMatrixCSR::levelScheduleEfficient() const {
+	computeLevelSchedule();
+	unsigned int nLevels = std::max(levelCountL(), levelCountU());
+	return m_n >= MIN_ROWS_PER_LEVEL*nLevels;
+}
+
+
+void SparseMatrixCSR::iluLevelScheduled() {
+	computeLevelSchedule();
+	ibkmk_spmat_csr_ilu_levels(m_n, &m_ia[0], &m_ja[0], levelCountL(), &m_levelStartL[0], &m_levelRowsL[0], &m_data[0]);
+}
+
+
+void SparseMatrixCSR::backsolveILULevelScheduled(double * b) const {
+	computeLevelSchedule();
+	ibkmk_spmat_csr_backsolve_levels(m_n, &m_ia[0], &m_ja[0], &m_data[0],
+									 levelCountL(), &m_levelStartL[0], &m_levelRowsL[0],
+									 levelCountU(), &m_levelStartU[0], &m_levelRowsU[0], b);
+}
+
+
+void SparseMatrixCSR::iluSerial() {
 	if(m_patternMode == PM_Symmetric) {
 		ibkmk_spmat_csr_ilu_symm(m_n, &m_ia[0], &m_ja[0], &m_data[0]);
 	}
@@ -276,7 +350,7 @@ void SparseMatrixCSR::ilu() {
 }
 
 
-void SparseMatrixCSR::backsolveILU(double * b) const {
+void SparseMatrixCSR::backsolveILUSerial(double * b) const {
 	ibkmk_spmat_csr_backsolve(m_n, &m_ia[0], &m_ja[0], &m_data[0], b);
 }
 
@@ -348,6 +422,8 @@ void SparseMatrixCSR::deserialize(void* & dataPtr) {
 	IBK::deserialize_vector(dataPtr, m_ja);
 	IBK::deserialize_vector(dataPtr, m_iaT);
 	IBK::deserialize_vector(dataPtr, m_jaT);
+	m_levelStartL.clear();
+	m_levelStartU.clear();
 }
 
 
@@ -372,6 +448,11 @@ void SparseMatrixCSR::recreate(void* & dataPtr) {
 
 	if (m_data.size() != m_nnz || m_ia.size() != m_n+1 || m_ja.size() != m_nnz)
 		throw IBK::Exception("Inconsistent binary matrix data.", FUNC_ID);
+
+	// empty tranpose indices mean symmetric matrix pattern
+	m_patternMode = m_iaT.empty() ? PM_Symmetric : PM_Asymmetric;
+	m_levelStartL.clear();
+	m_levelStartU.clear();
 }
 
 
@@ -148,15 +148,50 @@ public:
 	/*! Performs an in-place ILU.
 		Requires the matrix to have the values of the original matrix.
 		Uses LU factorization where <math>u_{i,i} = 1</math>.
+		When running with several OpenMP threads and the matrix pattern offers enough parallelism
+		(see levelScheduleEfficient()), a level-scheduled variant is used that yields bitwise identical results.
 	*/
 	virtual void ilu();
 
 	/*! Solves <math>LUx = b as x = U^{-1} L^{-1} b</math> using backward elimination.
 		The matrix is expected to hold incomplete LU data as generated by ilu() with
 		<math>u_{i,i} = 1</math>.
+		Like ilu(), uses level-scheduled forward/backward sweeps when running with several OpenMP threads.
 	*/
 	virtual void backsolveILU(double * b) const;
 
+	/*! Computes level schedules of lower and upper triangular matrix part (if not yet done).
+		Called automatically from ilu() and backsolveILU() when needed.
+	*/
+	void computeLevelSchedule() const;
+
+	/*! Returns true, if the level schedule of the matrix pattern has enough rows per level so that
+		level-scheduled (parallel) ilu() and backsolveILU() are worth it.
+		Computes the level schedule if not yet done.
+	*/
+	bool levelScheduleEfficient() const;
+
+	/*! Number of levels of lower triangular matrix part (0 if level schedule has not been computed, yet). */
+	unsigned int levelCountL() const { return m_levelStartL.empty() ? 0 : (unsigned int)m_levelStartL.size() - 1; }
+	/*! Number of levels of upper triangular matrix part (0 if level schedule has not been computed, yet). */
+	unsigned int levelCountU() const { return m_levelStartU.empty() ? 0 : (unsigned int)m_levelStartU.size() - 1; }
+
+	/*! Performs an in-place ILU using the level-scheduled algorithm (regardless of thread count).
+		Result is identical to the one of ilu().
+	*/
+	void iluLevelScheduled();
+
+	/*! Solves <math>LUx = b</math> using level-scheduled forward/backward sweeps (regardless of thread count).
+		Result is identical to the one of backsolveILU().
+	*/
+	void backsolveILULevelScheduled(double * b) const;
+
+	/*! Performs an in-place ILU using the serial algorithm (regardless of thread count). */
+	void iluSerial();
+
+	/*! Solves <math>LUx = b</math> using the serial forward/backward sweeps (regardless of thread count). */
+	void backsolveILUSerial(double * b) const;
+
 	/*! Returns number of non-zero eleemnts. */
 	unsigned int nnz() const { return m_nnz; }
 
@@ -276,6 +311,17 @@ protected:
 	/*! j-Indices of the tranposed matrix. Important for the ILU of non-symmetric matrices.*/
 	std::vector<unsigned int>			m_jaT;
 	PatternMode							m_patternMode;
+
+	/*! Level schedule of lower triangular part: start index of each level in m_levelRowsL, size = number of levels + 1.
+		Computed on demand, cleared whenever the matrix pattern changes.
+	*/
+	mutable std::vector<unsigned int>	m_levelStartL;
+	/*! Level schedule of lower triangular part: row indexes ordered by level, size n. */
+	mutable std::vector<unsigned int>	m_levelRowsL;
+	/*! Level schedule of upper triangular part: start index of each level in m_levelRowsU, size = number of levels + 1. */
+	mutable std::vector<unsigned int>	m_levelStartU;
+	/*! Level schedule of upper triangular part: row indexes ordered by level, size n. */
+	mutable std::vector<unsigned int>	m_levelRowsU;
 }; // SparseMatrixCSR
 
 /*! \file IBKMK_SparseMatrixCSR.h
@@ -62,10 +62,12 @@ HEADERS += \
 	../../src/SOLFRA_PrecondADI.h \
 	../../src/SOLFRA_PrecondADISparse.h \
 	../../src/SOLFRA_PrecondBand.h \
+	../../src/SOLFRA_PrecondBlock.h \
 	../../src/SOLFRA_PrecondILU.h \
 	../../src/SOLFRA_PrecondILUT.h \
 	../../src/SOLFRA_PrecondInterface.h \
 	../../src/SOLFRA_PrecondPBPS.h \
+	../../src/SOLFRA_Profiler.h \
 	../../src/SOLFRA_SolverControlFramework.h \
 	../../src/SOLFRA_SolverFeedback.h
 
@@ -94,10 +96,12 @@ SOURCES += \
 	../../src/SOLFRA_PrecondADI.cpp \
 	../../src/SOLFRA_PrecondADISparse.cpp \
 	../../src/SOLFRA_PrecondBand.cpp \
+	../../src/SOLFRA_PrecondBlock.cpp \
 	../../src/SOLFRA_PrecondILU.cpp \
 	../../src/SOLFRA_PrecondILUT.cpp \
 	../../src/SOLFRA_PrecondInterface.cpp \
 	../../src/SOLFRA_PrecondPBPS.cpp \
+	../../src/SOLFRA_Profiler.cpp \
 	../../src/SOLFRA_SolverControlFramework.cpp \
 	../../src/SOLFRA_SolverFeedback.cpp
 
@@ -34,9 +34,11 @@
 #include <sundials/sundials_timer.h>
 
 #include "SOLFRA_LESInterface.h"
+#include "SOLFRA_LESInterfaceIterative.h"
 #include "SOLFRA_LESADI.h"
 #include "SOLFRA_PrecondInterface.h"
 #include "SOLFRA_JacobianInterface.h"
+#include "SOLFRA_Profiler.h"
 
 //#define SOLVER_STEP_STATS
 
@@ -65,6 +67,7 @@ IntegratorImplicitEuler::IntegratorImplicitEuler() :
 	m_model(nullptr),
 	m_lesSolver(nullptr),
 	m_preconditioner(nullptr),
+	m_lesMatrixFree(nullptr),
 	m_dt(0),
 	m_statsFileStream(nullptr)
 {
@@ -140,6 +143,10 @@ void IntegratorImplicitEuler::init(	ModelInterface * model,
 
 	// *** Initialize Linear Equation Solver ***
 	lesSolver->init(m_model, this, precond, jacobian);
+	m_lesMatrixFree = nullptr;
+	LESInterfaceIterative * lesIter = dynamic_cast<LESInterfaceIterative *>(lesSolver);
+	if (lesIter != nullptr && lesIter->m_matrixFreeJacTimesVec)
+		m_lesMatrixFree = lesIter;
 
 	// *** Initialize Jacobian matrix ***
 	if (jacobian != nullptr)
@@ -153,6 +160,7 @@ void IntegratorImplicitEuler::init(	ModelInterface * model,
 	m_nItersSinceJacUpdate = 0;
 	m_nStepsSinceJacUpdate = 0;
 	m_newtonConvergenceError = false;
+	m_precondUpdateNeeded = false;
 
 #ifdef SUNDIALS_USE_INSTRUMENTATION
 	for (int i=0; i<SUNDIALS_TIMER_COUNT; ++i)
@@ -486,6 +494,14 @@ void IntegratorImplicitEuler::determineJacobianUpdate() {
 		return;
 	}
 
+	// with matrix-free J*v products the Newton matrix is always up-to-date, the Jacobian is
+	// only used for the preconditioner, which is only updated when linear convergence degrades
+	if (m_lesMatrixFree != nullptr) {
+		if (m_precondUpdateNeeded || m_nStepsSinceJacUpdate > 200)
+			m_jacUpdateNeeded = true;
+		return;
+	}
+
 	// when time step has changed too much
 	double dtRatio = m_dt/m_dtJacUpdate;
 	const double MAX_DT_RATIO = 1.3;
@@ -552,14 +568,18 @@ IntegratorImplicitEuler::StepResult IntegratorImplicitEuler::tryStep() {
 		// m_ydot contains f(t,y)
 
 		// we are updating the Jacobian with predicted/iterative y values
-		SUNDIALS_TIMED_FUNCTION(SUNDIALS_TIMER_LS_SETUP,
-			m_lesSolver->setup(DOUBLE_PTR(m_y), DOUBLE_PTR(m_ydot), nullptr, m_dt);
-		);
+		{
+			ProfilerScope profile(Profiler::P_LESSetup);
+			SUNDIALS_TIMED_FUNCTION(SUNDIALS_TIMER_LS_SETUP,
+				m_lesSolver->setup(DOUBLE_PTR(m_y), DOUBLE_PTR(m_ydot), nullptr, m_dt);
+			);
+		}
 		++m_statNumJacEvals;
 
 		// reset counters
 		m_nStepsSinceJacUpdate = 0;
 		m_jacCurrent = true;
+		m_precondUpdateNeeded = false;
 
 		// update Jacobian time step
 		m_dtJacUpdate = m_dt;
@@ -624,10 +644,32 @@ IntegratorImplicitEuler::StepResult IntegratorImplicitEuler::newtonIteration() {
 		//    m_deltaY[i] = -m_residuals[i];
 		IBKMK::vector_scale(m_n, -IBKMK_ONE, DOUBLE_PTR(m_residuals), DOUBLE_PTR(m_deltaY));
 
+		// matrix-free J*v products are computed for current iterate and time step
+		unsigned int linItersBefore = 0;
+		unsigned int linConvFailsBefore = 0;
+		if (m_lesMatrixFree != nullptr) {
+			m_lesMatrixFree->setLinearizationPoint(DOUBLE_PTR(m_y), DOUBLE_PTR(m_ydot), m_dt);
+			linItersBefore = m_lesMatrixFree->m_statNumLinIters;
+			linConvFailsBefore = m_lesMatrixFree->m_statNumLinConvFails;
+		}
+
 		// solve equation system, results will be stored in m_deltaY
-		SUNDIALS_TIMED_FUNCTION(SUNDIALS_TIMER_LS_SOLVE,
-			m_lesSolver->solve(DOUBLE_PTR(m_deltaY));
-		);
+		{
+			ProfilerScope profile(Profiler::P_LESSolve);
+			SUNDIALS_TIMED_FUNCTION(SUNDIALS_TIMER_LS_SOLVE,
+				m_lesSolver->solve(DOUBLE_PTR(m_deltaY));
+			);
+		}
+
+		// request preconditioner update for next step if linear convergence degraded
+		if (m_lesMatrixFree != nullptr) {
+			unsigned int linIters = m_lesMatrixFree->m_statNumLinIters - linItersBefore;
+			if (m_lesMatrixFree->m_statNumLinConvFails != linConvFailsBefore ||
+				2*linIters > m_lesMatrixFree->m_maxKrylovDim)
+			{
+				m_precondUpdateNeeded = true;
+			}
+		}
 
 		// increase iteration counters
 		++m_statNumIters; // total Newton iterations
@@ -650,8 +692,9 @@ IntegratorImplicitEuler::StepResult IntegratorImplicitEuler::newtonIteration() {
 		// Since Jacobian matrix is of form: J = I - m_dtJacUpdate*df/dy
 		// the solution in m_deltaY will be too large by a factor about m_dt/m_dtJacUpdate
 		// and we correct this by multiplying with the inverse ratio m_dtRatioInv
+		// Note: not needed for matrix-free J*v products, which always use the current time step
 		double dtRatioInv = m_dtJacUpdate/m_dt;
-		if (m_dtJacUpdate != m_dt) {
+		if (m_dtJacUpdate != m_dt && m_lesMatrixFree == nullptr) {
 			//   m_deltaY[i] *= dtRatioInv;
 			IBKMK::vector_scale_by(m_n, dtRatioInv, DOUBLE_PTR(m_deltaY));
 		}
@@ -777,6 +820,7 @@ IntegratorImplicitEuler::StepResult IntegratorImplicitEuler::newtonIteration() {
 			// reset counters
 			m_nStepsSinceJacUpdate = 0;
 			m_jacCurrent = true;
+			m_precondUpdateNeeded = false;
 
 			// update Jacobian time step
 			m_dtJacUpdate = m_dt;
@@ -32,6 +32,7 @@
 namespace SOLFRA {
 
 class LESInterface;
+class LESInterfaceIterative;
 class PrecondInterface;
 
 /*!	\brief Declaration for class IntegratorImplicitEuler
@@ -231,6 +232,13 @@ private:
 	/*! Pointer to Preconditioner. */
 	PrecondInterface	*m_preconditioner;
 
+	/*! Pointer to iterative linear equation system solver, if it uses matrix-free J*v products
+		(Jacobian-free Newton-Krylov), otherwise nullptr.
+		In this mode the Newton matrix is always evaluated for the current iterate and time step, and
+		the Jacobian matrix/preconditioner is only updated when convergence degrades.
+	*/
+	LESInterfaceIterative	*m_lesMatrixFree;
+
 	/*! Cached system size. */
 	unsigned int		m_n;
 
@@ -251,6 +259,10 @@ private:
 	bool				m_jacUpdateNeeded;
 	/*! If true, the Jacobian matrix was updated in the previous call to tryStep(). */
 	bool				m_jacCurrent;
+	/*! Matrix-free mode only: set to true, when the linear solver failed to converge or required many
+		iterations with the current preconditioner.
+	*/
+	bool				m_precondUpdateNeeded;
 	/*! Holds the current/estimated convergence rate based on the delta norm for the current Jacobian.
 		Convergence rate depends on the quality of the Jacobian matrix. Whenever the Jacobian
 		matrix is updated, the convergence rate estimate is set to 1. During Newton iterations the
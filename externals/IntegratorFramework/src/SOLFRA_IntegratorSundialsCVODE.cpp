@@ -50,6 +50,7 @@
 #include "SOLFRA_LESInterfaceIterative.h"
 #include "SOLFRA_PrecondInterface.h"
 #include "SOLFRA_JacobianInterface.h"
+#include "SOLFRA_Profiler.h"
 
 #include "SOLFRA_IntegratorSundialsCVODEImpl.h"
 
@@ -64,6 +65,9 @@ IBK::StopWatch maxErrorDumpCounter; // maxErrorCounters are dumped only every 20
 
 namespace SOLFRA {
 
+/*! Maximum number of steps between preconditioner setups when using matrix-free J*v products (CVODE default is 20). */
+const int MATRIX_FREE_LSETUP_FREQUENCY = 50;
+
 
 // *** CVODE WRAPPER FUNCTIONS ***
 
@@ -172,6 +176,7 @@ int CVSpilsPrecSetupFn_f(realtype t, N_Vector y, N_Vector fy,
 	bool jacGenerated = false;
 	if (jacobian != nullptr && jok != TRUE) {
 		// update df/dy
+		ProfilerScope profile(Profiler::P_JacobianGeneration);
 		SUNDIALS_TIMED_FUNCTION(SUNDIALS_TIMER_JACOBIAN_GENERATION,
 			res = jacobian->setup(t, NV_DATA(y), NV_DATA(fy), nullptr, gamma);
 		);
@@ -182,6 +187,7 @@ int CVSpilsPrecSetupFn_f(realtype t, N_Vector y, N_Vector fy,
 	bool jacUpdated = false;
 	if (precond != nullptr) {
 		// now call setup in precond
+		ProfilerScope profile(Profiler::P_PrecondSetup);
 		SUNDIALS_TIMED_FUNCTION(SUNDIALS_TIMER_PRE_SETUP,
 			res = precond->setup(t, NV_DATA(y), NV_DATA(fy), nullptr, (jok == TRUE), jacUpdated, gamma);
 		);
@@ -204,7 +210,8 @@ int CVSpilsPrecSolveFn_f(realtype t, N_Vector y, N_Vector fy,
 	// cast user data to pre-conditioner interface
 	PrecondInterface * precond = cvodeMem->m_precond;
 	if (precond != nullptr) {
-		// now call setup in precond
+		// now call solve in precond
+		ProfilerScope profile(Profiler::P_PrecondSolve);
 		return precond->solve(t, NV_DATA(y), NV_DATA(fy), nullptr, NV_DATA(r), NV_DATA(z), gamma, delta, lr);
 	}
 
@@ -366,7 +373,8 @@ void IntegratorSundialsCVODE::init(ModelInterface * model, double t0,
 	// to call CVSpilsSetPreconditioner() if we have a jacobian matrix generator.
 	// The call back functions CVSpilsPrecSetupFn_f() and CVSpilsPrecSolveFn_f()
 	// distinguish automatically between the case jac+precond and jac alone.
-	if (dynamic_cast<SOLFRA::LESInterfaceIterative*>(lesSolver) != nullptr &&
+	SOLFRA::LESInterfaceIterative * lesIter = dynamic_cast<SOLFRA::LESInterfaceIterative*>(lesSolver);
+	if (lesIter != nullptr &&
 			(precond != nullptr || jacobian != nullptr))
 	{
 		// connect pre-conditioner to CVode
@@ -375,8 +383,15 @@ void IntegratorSundialsCVODE::init(ModelInterface * model, double t0,
 				  CVSpilsPrecSolveFn_f);
 		if (res != CV_SUCCESS)
 			throw IBK::Exception("Error registering CVSpilsPrecSetupFn_f and/or CVSpilsPrecSolveFn_f.", FUNC_ID);
-		// set JacTimesVec function when available
-		if (jacobian != nullptr) {
+		// set JacTimesVec function when available, unless matrix-free J*v products are requested
+		if (lesIter->m_matrixFreeJacTimesVec) {
+			IBK::IBK_Message( IBK::FormatString("Using DQ-Approximation for J*v function (Jacobian-free Newton-Krylov), "
+												"Jacobian matrix is only used for preconditioner.\n"), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+			// Newton matrix is always exact, so preconditioner needs to be updated less frequently;
+			// CVODE still calls setup on convergence failures and larger changes of gamma
+			CVodeSetLSetupFrequency(m_impl->m_mem, MATRIX_FREE_LSETUP_FREQUENCY);
+		}
+		else if (jacobian != nullptr) {
 			IBK::IBK_Message( IBK::FormatString("Registering own Jacobian implementation with J*v function.\n"), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
 			res = CVSpilsSetJacTimesVecFn(m_impl->m_mem, CVSpilsJacTimesVecFn_f);
 		}
@@ -45,25 +45,45 @@ void JacobianSparseCSR::init(ModelInterface * model) {
 	m_yMod.resize(m_n);
 	m_ydotMod.resize(m_n);
 	m_ydiff.resize(m_n);
-	m_colors.clear();
+	if (!m_colorsProvided) {
+		IBK::IBK_Message("SparseMatrix: generating color arrays\n",  IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+		computeColors(m_n, ia(), ja(), iaT(), jaT(), m_colors);
+	}
+	else
+		IBK::IBK_Message("SparseMatrix: using precomputed color arrays\n",  IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+
+	IBK::IBK_Message(IBK::FormatString("  %1 colors\n").arg((unsigned int) m_colors.size()),
+		IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+}
+
+
+void JacobianSparseCSR::setColors(const std::vector<std::vector<unsigned int> > & colors) {
+	m_colors = colors;
+	m_colorsProvided = true;
+}
 
-	IBK::IBK_Message("SparseMatrix: generating color arrays\n",  IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+
+void JacobianSparseCSR::computeColors(unsigned int n, const unsigned int * ia, const unsigned int * ja,
+									  const unsigned int * iaT, const unsigned int * jaT,
+									  std::vector<std::vector<unsigned int> > & colors)
+{
+	colors.clear();
 
 	// generate coloring information
 
 	// vector to hold colors associated with individual columns
-	std::vector<unsigned int> colarray(m_n, 0);
+	std::vector<unsigned int> colarray(n, 0);
 
 	// array to flag used colors
-	std::vector<unsigned int> scols(m_n+1); // must have size = m_n+1 since valid color numbers start with 1
+	std::vector<unsigned int> scols(n+1); // must have size = n+1 since valid color numbers start with 1
 
-	const unsigned int * iaIdx  = ia();
-	const unsigned int * jaIdx  = ja();
-	const unsigned int * iaIdxT = iaT();
-	const unsigned int * jaIdxT = jaT();
+	const unsigned int * iaIdx  = ia;
+	const unsigned int * jaIdx  = ja;
+	const unsigned int * iaIdxT = iaT;
+	const unsigned int * jaIdxT = jaT;
 
 	// loop over all columns
-	for (unsigned int i=0; i<m_n; ++i) {
+	for (unsigned int i=0; i<n; ++i) {
 
 //#define DEBUG_OUTPUT_COLORING
 #ifdef DEBUG_OUTPUT_COLORING
@@ -96,23 +116,20 @@ void JacobianSparseCSR::init(ModelInterface * model) {
 		}
 		// search lowest unused color
 		unsigned int colIdx = 1;
-		for (; colIdx < m_n; ++colIdx)
+		for (; colIdx < n; ++colIdx)
 			if (scols[colIdx] == 0)
 				break;
-		//IBK_ASSERT(colIdx != m_n); /// \todo check this, might fail when dense matrix is being used!!!
+		//IBK_ASSERT(colIdx != n); /// \todo check this, might fail when dense matrix is being used!!!
 		// set this color number in our colarray
 		colarray[i] = colIdx;
 #ifdef DEBUG_OUTPUT_COLORING
 		std::cout << "  column gets color = " << colIdx << std::endl;
 #endif // DEBUG_OUTPUT_COLORING
 		// store color index in colors array
-		if (m_colors.size() < colIdx)
-			m_colors.resize(colIdx);
-		m_colors[colIdx-1].push_back(i); // associate column number with color
+		if (colors.size() < colIdx)
+			colors.resize(colIdx);
+		colors[colIdx-1].push_back(i); // associate column number with color
 	}
-
-	IBK::IBK_Message(IBK::FormatString("  %1 colors\n").arg((unsigned int) m_colors.size()),
-		IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
 }
 
 
@@ -29,9 +29,27 @@ public:
 	JacobianSparseCSR(unsigned int n, unsigned int nnz, const unsigned int *ia, const unsigned int * ja,
 					  const unsigned int *iaT = nullptr, const unsigned int *jaT = nullptr);
 
-	/*! Initializes sparse matrix. */
+	/*! Initializes sparse matrix.
+		Generates the coloring information, unless colors were already provided via setColors().
+	*/
 	virtual void init(ModelInterface * model) override;
 
+	/*! Provides precomputed coloring information (e.g. shared between several models with the same
+		Jacobian pattern), so that init() skips the coloring.
+		\param colors Colors as computed by computeColors() for the pattern of this matrix.
+	*/
+	void setColors(const std::vector<std::vector<unsigned int> > & colors);
+
+	/*! Computes coloring information for a sparse matrix pattern in CSR format.
+		\param n Dimension
+		\param ia, ja Row pattern of the matrix.
+		\param iaT, jaT Transposed pattern of the matrix.
+		\param colors Here the columns grouped by color are stored.
+	*/
+	static void computeColors(unsigned int n, const unsigned int * ia, const unsigned int * ja,
+							  const unsigned int * iaT, const unsigned int * jaT,
+							  std::vector<std::vector<unsigned int> > & colors);
+
 	/*! In this function, the preconditioner matrix is composed an LU-factorised.
 		This function is called from the linear equation solver during iterations.
 		\param y The current prediction of the solution.
@@ -104,6 +122,8 @@ protected:
 
 	/*! Number of rhs evaluations for ILU preconditioner. */
 	unsigned int							m_nRhsEvals;
+	/*! If true, m_colors was provided via setColors() and is not recomputed in init(). */
+	bool									m_colorsProvided = false;
 };
 
 } // namespace SOLFRA
@@ -28,7 +28,8 @@ namespace SOLFRA {
 LESGMRES::LESGMRES() :
 	m_hessian(nullptr),
 	m_gamma(0.1),
-	m_delta(0.1)
+	m_delta(0.1),
+	m_modelStateModified(false)
 {
 #ifdef DEBUG_EIGENVALUES
 	m_eigenValueUpdateNeeded = false;
@@ -118,6 +119,13 @@ void LESGMRES::init(ModelInterface * model, IntegratorInterface * integrator, Pr
 #endif
 
 		m_ydot.resize(n,0.0);
+		m_yMod.resize(n,0.0);
+		m_FMod.resize(n,0.0);
+		// without Jacobian matrix implementation we can only use directional differences
+		if (jacobian == nullptr)
+			m_matrixFreeJacTimesVec = true;
+		if (m_matrixFreeJacTimesVec)
+			IBK::IBK_Message("Using directional-difference approximation for J*v products (Jacobian-free Newton-Krylov).\n", IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
 		if (m_linIterConvCoeff == 0.0)
 			m_linIterConvCoeff = 0.1; // initialize to default value as in CVODE
 		IBK::IBK_Message( IBK::FormatString("Setting LinIterConvCoeff to %1.\n").arg(m_linIterConvCoeff), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
@@ -193,6 +201,15 @@ void LESGMRES::setup(const double * y, const double * ydot, const double * resid
 }
 
 
+void LESGMRES::setLinearizationPoint(const double * y, const double * ydot, double gamma) {
+	if (!m_matrixFreeJacTimesVec)
+		return;
+	std::memcpy(&m_y[0], y, m_y.size()*sizeof(double));
+	std::memcpy(&m_ydot[0], ydot, m_ydot.size()*sizeof(double));
+	m_gamma = gamma;
+}
+
+
 void LESGMRES::solve(double * rhs) {
 	// only setup linear equation system explicitely if integrator implicit Euler is chosen
 	IntegratorImplicitEuler* integratorImplicitEuler = dynamic_cast<IntegratorImplicitEuler*>(m_integrator);
@@ -430,11 +447,13 @@ void LESGMRES::solve(double * rhs) {
 	for(unsigned int i = 0; i < n; ++i)
 		m_yCorr[i] += m_yCorrTemp[i];
 
+#ifdef DEBUG_ERROR_TEST
 	// validity check
 	int result;
 	result = ATimesVec(&m_yCorrTemp[0], &m_temp[0], time, &m_y[0], &m_ydot[0], nullptr);
 	/// \todo error handling
 	(void)result;
+#endif
 
 #ifdef DEBUG_EIGENVALUES
 	// update eigenvalues
@@ -463,6 +482,12 @@ void LESGMRES::solve(double * rhs) {
 
 #endif
 
+	// restore model state at linearization point, since integrator expects model state to match its y
+	if (m_modelStateModified) {
+		m_model->setY(&m_y[0]);
+		m_modelStateModified = false;
+	}
+
 	// initial solution was 0, so set rhs = yCorr
 	std::memcpy(rhs,&m_yCorr[0],n*sizeof(double) );
 	// correct solver statistics
@@ -477,7 +502,7 @@ int LESGMRES::ATimesVec(const double * v, double * Av, double t, double * y, dou
 	(void) residuals;
 
 	// use jacTimesVec function of the preconditioner if possible
-	if(m_jacobian != nullptr) {
+	if(m_jacobian != nullptr && !m_matrixFreeJacTimesVec) {
 		// ode system: ydot = fy
 		if(m_model != nullptr) {
 			// calculate J*v
@@ -499,15 +524,21 @@ int LESGMRES::ATimesVec(const double * v, double * Av, double t, double * y, dou
 		// store current solution guess
 		std::memcpy(&m_yMod[0], y, m_yMod.size()*sizeof(double));
 
-		// calculate y-norm = 1/n * |y|
-		double ynorm = 0.0;
+		// scale increment such that the perturbation has unit WRMS norm (same as in CVODE's DQ J*v),
+		// i.e. is in the order of the solver tolerances
+		double vnorm = 0.0;
 		for (unsigned int i=0; i<n; ++i) {
-			ynorm += y[i] * y[i];
+			double vw = v[i]*m_weights[i];
+			vnorm += vw*vw;
 		}
-		ynorm = IBK::f_sqrt(ynorm);
-		ynorm/= double(n);
-
-		const double epsi = ynorm*m_relToleranceDQ + m_absToleranceDQ;
+		vnorm = IBK::f_sqrt(vnorm/n);
+		// zero vector, A*v = 0
+		if (vnorm == 0.0) {
+			std::fill(Av, Av + n, 0.0);
+			++m_statNumJacTimesEvals;
+			return 0;
+		}
+		const double epsi = 1.0/vnorm;
 
 		// modify y[]
 		for (unsigned int i=0; i<n; ++i) {
@@ -518,6 +549,7 @@ int LESGMRES::ATimesVec(const double * v, double * Av, double t, double * y, dou
 		{
 			// calculate modified right hand side
 			m_model->setY(&m_yMod[0]);
+			m_modelStateModified = true;
 			// calculate modified right hand side of the model, and store f(t,y) in m_FMod
 			m_model->ydot(&m_FMod[0]);
 			// update statistics
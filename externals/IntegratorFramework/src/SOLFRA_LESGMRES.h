@@ -46,6 +46,11 @@ public:
 	*/
 	virtual void solve(double * rhs) override;
 
+	/*! Stores current Newton iterate for matrix-free J*v products.
+		\sa LESInterfaceIterative::setLinearizationPoint
+	*/
+	virtual void setLinearizationPoint(const double * y, const double * ydot, double gamma) override;
+
 	/*! Called from the framework to write create statistics file and write its header. */
 	virtual void writeStatisticsHeader(const IBK::Path & logfilePath, bool doRestart) override;
 
@@ -116,6 +121,10 @@ private:
 	double									m_gamma;
 	/*! Error limit. */
 	double									m_delta;
+	/*! Set to true, when the model state was modified during the computation of matrix-free J*v products
+		and needs to be restored at the end of solve().
+	*/
+	bool									m_modelStateModified;
 #ifdef DEBUG_EIGENVALUES
 	/*! Flag indicating whether a calculation of eigenvalues is requested. */
 	bool									m_eigenValueUpdateNeeded;
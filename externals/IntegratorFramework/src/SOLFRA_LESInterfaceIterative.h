@@ -19,6 +19,7 @@ public:
 	LESInterfaceIterative() :
 		m_linIterConvCoeff(0),
 		m_maxKrylovDim(50),
+		m_matrixFreeJacTimesVec(false),
 		m_statNumLinIters(0),
 		m_statNumLinConvFails(0),
 		m_statNumPrecEvals(0),
@@ -45,6 +46,17 @@ public:
 	*/
 	virtual void writeMetrics(double simtime, std::ostream * metricsFile=nullptr) override;
 
+	/*! Updates the point the system is linearized at, used for matrix-free J*v products.
+		Called by integrators with own Newton iteration (Implicit Euler) before each call to solve()
+		when m_matrixFreeJacTimesVec is enabled. Default implementation does nothing.
+		\param y The current Newton iterate of the solution.
+		\param ydot The corresponding result of f(y) (model state must be set to y).
+		\param gamma The factor in front of the derivative df/dy (dt in case of Implicit Euler).
+	*/
+	virtual void setLinearizationPoint(const double * y, const double * ydot, double gamma) {
+		(void)y; (void)ydot; (void)gamma;
+	}
+
 
 	/***********************************************
 	 *
@@ -59,6 +71,12 @@ public:
 	/*! Maximum Krylov subspace dimension. */
 	unsigned int	m_maxKrylovDim;
 
+	/*! If true, J*v products are computed with directional differences of the model function
+		(Jacobian-free Newton-Krylov), one model evaluation per product. A Jacobian matrix implementation
+		is then only used for composing the preconditioner, which is updated only when convergence degrades.
+	*/
+	bool			m_matrixFreeJacTimesVec;
+
 
 	/***********************************************
 	 *
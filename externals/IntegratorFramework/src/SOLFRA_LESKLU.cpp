@@ -12,6 +12,7 @@
 #include "SOLFRA_JacobianSparseCSR.h"
 #include "SOLFRA_ModelInterface.h"
 #include "SOLFRA_IntegratorSundialsCVODEImpl.h"
+#include "SOLFRA_Profiler.h"
 
 namespace SOLFRA {
 
@@ -31,6 +32,8 @@ inline int CVSlsSparseJacFn_f(realtype t, N_Vector y, N_Vector ydot,
 
 	// Note: Matrix J was already zeroed by CVODE
 
+	ProfilerScope profile(Profiler::P_JacobianGeneration);
+
 	IntegratorSundialsCVODEImpl * cvodeWrapper = static_cast<IntegratorSundialsCVODEImpl*>(user_data);
 	ModelInterface * model = cvodeWrapper->m_model;
 	IBK_ASSERT(model != nullptr);
@@ -0,0 +1,303 @@
+#include "SOLFRA_PrecondBlock.h"
+
+#include <cstring>
+
+#include <IBK_assert.h>
+#include <IBK_Exception.h>
+#include <IBK_FormatString.h>
+#include <IBKMK_SparseMatrixCSR.h>
+#include <IBKMKC_vector_operations.h>
+
+#include "SOLFRA_JacobianSparse.h"
+#include "SOLFRA_ModelInterface.h"
+
+namespace SOLFRA {
+
+PrecondBlock::PrecondBlock(PreconditionerType precondType, const std::vector<unsigned int> & blockOffsets,
+						   const std::vector<unsigned int> & blockSizes) :
+	PrecondInterface(precondType),
+	m_blockOffsets(blockOffsets),
+	m_blockSizes(blockSizes)
+{
+	IBK_ASSERT(m_blockOffsets.size() == m_blockSizes.size());
+}
+
+
+PrecondBlock::~PrecondBlock() {
+	delete m_restMatrix;
+}
+
+
+void PrecondBlock::init(ModelInterface * model, IntegratorInterface * integrator,
+						const JacobianInterface * jacobianInterface)
+{
+	FUNCID(PrecondBlock::init);
+
+	m_integrator = integrator;
+	m_model = model;
+
+	// transfer jacobian matrix and ensure it is a sparse Jacobian implementation in CSR format
+	m_jacobianSparse = dynamic_cast<const JacobianSparse*>(jacobianInterface);
+	IBK_ASSERT(m_jacobianSparse != nullptr);
+	const IBKMK::SparseMatrixCSR * jac = dynamic_cast<const IBKMK::SparseMatrixCSR *>(m_jacobianSparse->jacobian());
+	if (jac == nullptr)
+		throw IBK::Exception("Block preconditioner requires a sparse Jacobian matrix in CSR format.", FUNC_ID);
+
+	unsigned int n = jac->n();
+	m_nnz = jac->nnz();
+	const unsigned int * ia = jac->constIa();
+	const unsigned int * ja = jac->constJa();
+
+	// *** classify unknowns ***
+
+	// blockOf[i] holds block index of unknown i, or -1 for remaining unknowns
+	std::vector<int> blockOf(n, -1);
+	m_blockRowStart.resize(m_blockOffsets.size() + 1);
+	unsigned int nBlockRows = 0;
+	for (unsigned int b=0; b<m_blockOffsets.size(); ++b) {
+		if (m_blockOffsets[b] + m_blockSizes[b] > n)
+			throw IBK::Exception(IBK::FormatString("Block #%1 exceeds system size.").arg(b), FUNC_ID);
+		m_blockRowStart[b] = nBlockRows;
+		for (unsigned int i=m_blockOffsets[b]; i<m_blockOffsets[b] + m_blockSizes[b]; ++i) {
+			if (blockOf[i] != -1)
+				throw IBK::Exception(IBK::FormatString("Overlapping blocks at unknown #%1.").arg(i), FUNC_ID);
+			blockOf[i] = (int)b;
+		}
+		nBlockRows += m_blockSizes[b];
+	}
+	m_blockRowStart.back() = nBlockRows;
+
+	// *** index tables for tridiagonal blocks and their coupling to remaining unknowns ***
+
+	m_triStorage.resize(3*nBlockRows);
+	m_tri.resize(3*nBlockRows);
+	m_blockCouplingIa.assign(1, 0);
+	m_blockCouplingJa.clear();
+	m_blockCouplingStorage.clear();
+	for (unsigned int b=0; b<m_blockOffsets.size(); ++b) {
+		unsigned int offset = m_blockOffsets[b];
+		unsigned int size = m_blockSizes[b];
+		for (unsigned int k=0; k<size; ++k) {
+			unsigned int i = offset + k;
+			unsigned int * storage = &m_triStorage[3*(m_blockRowStart[b] + k)];
+			storage[0] = (k > 0) ? jac->storageIndex(i, i-1) : m_nnz;
+			storage[1] = jac->storageIndex(i, i);
+			storage[2] = (k+1 < size) ? jac->storageIndex(i, i+1) : m_nnz;
+			for (unsigned int s=ia[i]; s<ia[i+1]; ++s) {
+				if (blockOf[ja[s]] == -1) {
+					m_blockCouplingJa.push_back(ja[s]);
+					m_blockCouplingStorage.push_back(s);
+				}
+			}
+			m_blockCouplingIa.push_back((unsigned int)m_blockCouplingJa.size());
+		}
+	}
+
+	// *** sub-matrix of remaining unknowns and their coupling to block unknowns ***
+
+	m_restRows.clear();
+	std::vector<unsigned int> restIndex(n, n); // global index -> local index in sub-matrix
+	for (unsigned int i=0; i<n; ++i) {
+		if (blockOf[i] == -1) {
+			restIndex[i] = (unsigned int)m_restRows.size();
+			m_restRows.push_back(i);
+		}
+	}
+	delete m_restMatrix;
+	m_restMatrix = nullptr;
+	m_restStorage.clear();
+	m_restCouplingIa.assign(1, 0);
+	m_restCouplingJa.clear();
+	m_restCouplingStorage.clear();
+	if (m_restRows.empty())
+		return;
+
+	std::vector<unsigned int> restIa(1, 0);
+	std::vector<unsigned int> restJa;
+	for (unsigned int i : m_restRows) {
+		// local numbering is monotonic in global numbering, so column indexes remain sorted
+		for (unsigned int s=ia[i]; s<ia[i+1]; ++s) {
+			if (blockOf[ja[s]] == -1) {
+				restJa.push_back(restIndex[ja[s]]);
+				m_restStorage.push_back(s);
+			}
+			else {
+				m_restCouplingJa.push_back(ja[s]);
+				m_restCouplingStorage.push_back(s);
+			}
+		}
+		restIa.push_back((unsigned int)restJa.size());
+		m_restCouplingIa.push_back((unsigned int)m_restCouplingJa.size());
+	}
+	std::vector<unsigned int> restIaT, restJaT;
+	IBKMK::SparseMatrixCSR::generateTransposedIndex(restIa, restJa, restIaT, restJaT);
+	m_restMatrix = new IBKMK::SparseMatrixCSR((unsigned int)m_restRows.size(), (unsigned int)restJa.size(),
+											  &restIa[0], &restJa[0], &restIaT[0], &restJaT[0]);
+	m_restRHS.resize(m_restRows.size());
+}
+
+
+int PrecondBlock::setup(double t, const double * y, const double * ydot, const double * residuals,
+	bool jacOk, bool & jacUpdated, double gamma)
+{
+	(void)t;
+	(void)y;
+	(void)ydot;
+	(void)residuals;
+	(void)jacUpdated;
+	(void)jacOk;
+
+	m_gamma = gamma;
+	const double * jacData = m_jacobianSparse->jacobian()->data();
+
+	// *** compose and factorize tridiagonal blocks of I - gamma*J ***
+
+	int nBlocks = (int)m_blockOffsets.size();
+	int failedBlocks = 0;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) reduction(+:failedBlocks)
+#endif
+	for (int b=0; b<nBlocks; ++b) {
+		unsigned int size = m_blockSizes[b];
+		const unsigned int * storage = &m_triStorage[3*m_blockRowStart[b]];
+		double * tri = &m_tri[3*m_blockRowStart[b]];
+		for (unsigned int k=0; k<size; ++k) {
+			tri[3*k]   = (storage[3*k]   != m_nnz) ? -gamma*jacData[storage[3*k]] : 0;
+			tri[3*k+1] = 1 + ((storage[3*k+1] != m_nnz) ? -gamma*jacData[storage[3*k+1]] : 0);
+			tri[3*k+2] = (storage[3*k+2] != m_nnz) ? -gamma*jacData[storage[3*k+2]] : 0;
+		}
+		// Thomas algorithm: main diagonal holds modified pivot, upper diagonal holds U[k]/pivot
+		for (unsigned int k=0; k<size; ++k) {
+			if (k > 0)
+				tri[3*k+1] -= tri[3*k]*tri[3*k-1];
+			if (tri[3*k+1] == 0) {
+				++failedBlocks;
+				break;
+			}
+			tri[3*k+2] /= tri[3*k+1];
+		}
+	}
+	if (failedBlocks != 0)
+		return 1; // recoverable error, try again with smaller time step
+
+	// *** compose and factorize sub-matrix of remaining unknowns ***
+
+	if (m_restMatrix != nullptr) {
+		double * restData = m_restMatrix->data();
+		for (unsigned int s=0; s<m_restStorage.size(); ++s)
+			restData[s] = -gamma*jacData[m_restStorage[s]];
+		m_restMatrix->addIdentityMatrix();
+		m_restMatrix->ilu();
+	}
+	return 0;
+}
+
+
+int PrecondBlock::solve(double t, const double * y, const double * ydot, const double * residuals,
+	const double * r, double * z, double gamma, double delta, int lr)
+{
+	(void)t;
+	(void)y;
+	(void)ydot;
+	(void)residuals;
+	(void)gamma;
+	(void)delta;
+	(void)lr;
+
+	const double * jacData = m_jacobianSparse->jacobian()->data();
+	IBKMK::vector_copy(m_model->n(), r, z);
+
+	// 1. solve tridiagonal blocks with uncorrected right-hand side
+	solveBlocks(z);
+
+	if (m_restMatrix == nullptr)
+		return 0;
+
+	// 2. solve remaining unknowns; the off-diagonal entries of P are -gamma*J, so subtracting P_rc*z_c
+	//    means adding gamma*J_rc*z_c
+	for (unsigned int k=0; k<m_restRows.size(); ++k) {
+		double rhs = r[m_restRows[k]];
+		for (unsigned int c=m_restCouplingIa[k]; c<m_restCouplingIa[k+1]; ++c)
+			rhs += m_gamma*jacData[m_restCouplingStorage[c]]*z[m_restCouplingJa[c]];
+		m_restRHS[k] = rhs;
+	}
+	m_restMatrix->backsolveILU(&m_restRHS[0]);
+	for (unsigned int k=0; k<m_restRows.size(); ++k)
+		z[m_restRows[k]] = m_restRHS[k];
+
+	// 3. solve tridiagonal blocks again with right-hand side corrected by coupling to remaining unknowns
+	int nBlocks = (int)m_blockOffsets.size();
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+	for (int b=0; b<nBlocks; ++b) {
+		unsigned int offset = m_blockOffsets[b];
+		unsigned int rowStart = m_blockRowStart[b];
+		for (unsigned int k=0; k<m_blockSizes[b]; ++k) {
+			double rhs = r[offset + k];
+			for (unsigned int c=m_blockCouplingIa[rowStart + k]; c<m_blockCouplingIa[rowStart + k + 1]; ++c)
+				rhs += m_gamma*jacData[m_blockCouplingStorage[c]]*z[m_blockCouplingJa[c]];
+			z[offset + k] = rhs;
+		}
+	}
+	solveBlocks(z);
+
+	return 0;
+}
+
+
+void PrecondBlock::solveBlocks(double * z) const {
+	int nBlocks = (int)m_blockOffsets.size();
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+	for (int b=0; b<nBlocks; ++b) {
+		unsigned int size = m_blockSizes[b];
+		if (size == 0)
+			continue;
+		double * x = z + m_blockOffsets[b];
+		const double * tri = &m_tri[3*m_blockRowStart[b]];
+		// forward elimination
+		x[0] /= tri[1];
+		for (unsigned int k=1; k<size; ++k)
+			x[k] = (x[k] - tri[3*k]*x[k-1])/tri[3*k+1];
+		// backward substitution
+		for (unsigned int k=size-1; k>0; --k)
+			x[k-1] -= tri[3*(k-1)+2]*x[k];
+	}
+}
+
+
+std::size_t PrecondBlock::serializationSize() const {
+	std::size_t s = sizeof(double) + m_tri.size()*sizeof(double);
+	if (m_restMatrix != nullptr)
+		s += m_restMatrix->dataSize()*sizeof(double);
+	return s;
+}
+
+
+void PrecondBlock::serialize(void* & dataPtr) const {
+	*(double*)dataPtr = m_gamma;
+	dataPtr = (char*)dataPtr + sizeof(double);
+	std::memcpy(dataPtr, m_tri.data(), m_tri.size()*sizeof(double));
+	dataPtr = (char*)dataPtr + m_tri.size()*sizeof(double);
+	if (m_restMatrix != nullptr) {
+		std::memcpy(dataPtr, m_restMatrix->data(), m_restMatrix->dataSize()*sizeof(double));
+		dataPtr = (char*)dataPtr + m_restMatrix->dataSize()*sizeof(double);
+	}
+}
+
+
+void PrecondBlock::deserialize(void* & dataPtr) {
+	m_gamma = *(double*)dataPtr;
+	dataPtr = (char*)dataPtr + sizeof(double);
+	std::memcpy(m_tri.data(), dataPtr, m_tri.size()*sizeof(double));
+	dataPtr = (char*)dataPtr + m_tri.size()*sizeof(double);
+	if (m_restMatrix != nullptr) {
+		std::memcpy(m_restMatrix->data(), dataPtr, m_restMatrix->dataSize()*sizeof(double));
+		dataPtr = (char*)dataPtr + m_restMatrix->dataSize()*sizeof(double);
+	}
+}
+
+
+} // namespace SOLFRA
@@ -0,0 +1,133 @@
+#ifndef SOLFRA_PrecondBlockH
+#define SOLFRA_PrecondBlockH
+
+#include "SOLFRA_PrecondInterface.h"
+
+#include <vector>
+
+namespace IBKMK {
+	class SparseMatrixCSR;
+}
+
+namespace SOLFRA {
+
+class IntegratorInterface;
+class JacobianSparse;
+class ModelInterface;
+
+/*! A block preconditioner that exploits a known structure of the Jacobian.
+
+	The unknowns are split into a number of tridiagonal blocks (e.g. one-dimensional
+	discretized constructions) and the remaining unknowns (e.g. room balances and networks).
+	The iteration matrix P = I - gamma*J is approximated by a symmetric block Gauss-Seidel sweep:
+
+	1. solve all tridiagonal blocks exactly (Thomas algorithm), using the right-hand side only
+	2. solve the remaining unknowns (ILU of the sub-matrix), with right-hand side corrected by the
+	   coupling to the tridiagonal blocks
+	3. solve all tridiagonal blocks again, with right-hand side corrected by the coupling to the
+	   remaining unknowns
+
+	Coupling between different tridiagonal blocks and entries outside the tridiagonal band within a block are ignored.
+	Tridiagonal blocks are factorized and solved in parallel (OpenMP).
+
+	PrecondBlock requires a sparse Jacobian in CSR format.
+*/
+class PrecondBlock : public PrecondInterface {
+public:
+	/*! Initializes PrecondBlock.
+		\param blockOffsets Index of first unknown of each tridiagonal block.
+		\param blockSizes Number of unknowns in each tridiagonal block (same size as blockOffsets).
+	*/
+	PrecondBlock(PreconditionerType precondType, const std::vector<unsigned int> & blockOffsets,
+				 const std::vector<unsigned int> & blockSizes);
+
+	/*! Destructor, releases sub-matrix memory. */
+	~PrecondBlock();
+
+	/*! Returns type of precondition (where it should be applied in context of the iteration linear equation solver). */
+	virtual PreconditionerType preconditionerType() const override { return m_precondType; }
+
+	/*! Initialize the preconditioner, called from the framework before integration is started.
+		Sets up all index tables needed to extract block data from the Jacobian matrix.
+	*/
+	virtual void init(ModelInterface * model, IntegratorInterface * integrator,
+					  const JacobianInterface * jacobianInterface) override;
+
+	/*! Composes the tridiagonal blocks and the sub-matrix of remaining unknowns from the current Jacobian
+		and factorizes them.
+	*/
+	virtual int setup(double t, const double * y, const double * ydot, const double * residuals,
+		bool jacOk, bool & jacUpdated, double gamma) override;
+
+	/*! Solves P z = r with the symmetric block Gauss-Seidel sweep. */
+	virtual int solve(double t, const double * y, const double * ydot, const double * residuals,
+		const double * r, double * z, double gamma, double delta, int lr) override;
+
+	/*! Holds number of RHS function evaluations (ydot()/residual() calls) used for generating
+		the preconditioner.
+	*/
+	virtual unsigned int nRHSEvals() const override { return 0; }
+
+	/*! Computes and returns serialization size. */
+	virtual std::size_t serializationSize() const override;
+
+	/*! Stores content at memory location pointed to by dataPtr and increases
+		pointer afterwards to point just behind the memory occupied by the copied data.
+	*/
+	virtual void serialize(void* & dataPtr) const override;
+
+	/*! Restores content from memory at location pointed to by dataPtr and increases
+		pointer afterwards to point just behind the memory occupied by the copied data.
+	*/
+	virtual void deserialize(void* & dataPtr) override;
+
+private:
+	/*! Solves all tridiagonal blocks, z holds right-hand side on input and solution on output. */
+	void solveBlocks(double * z) const;
+
+	/*! Index of first unknown of each tridiagonal block. */
+	std::vector<unsigned int>				m_blockOffsets;
+	/*! Number of unknowns in each tridiagonal block. */
+	std::vector<unsigned int>				m_blockSizes;
+	/*! Start of each block in m_triStorage/m_tri (in number of rows). */
+	std::vector<unsigned int>				m_blockRowStart;
+
+	/*! Jacobian matrix (not owned). */
+	const JacobianSparse					*m_jacobianSparse = nullptr;
+	/*! Number of non-zero elements in Jacobian, used as marker for missing storage indexes. */
+	unsigned int							m_nnz = 0;
+
+	/*! Jacobian storage indexes of lower, main and upper diagonal for each block row (3 per row). */
+	std::vector<unsigned int>				m_triStorage;
+	/*! LU-factorized tridiagonal blocks (lower, main and upper diagonal for each block row, 3 per row). */
+	std::vector<double>						m_tri;
+
+	/*! Rows of block unknowns: start index of coupling entries to remaining unknowns, size = number of block rows + 1. */
+	std::vector<unsigned int>				m_blockCouplingIa;
+	/*! Coupling entries of block rows: global column index. */
+	std::vector<unsigned int>				m_blockCouplingJa;
+	/*! Coupling entries of block rows: Jacobian storage index. */
+	std::vector<unsigned int>				m_blockCouplingStorage;
+
+	/*! Global indexes of remaining unknowns. */
+	std::vector<unsigned int>				m_restRows;
+	/*! Jacobian storage index for each non-zero element in m_restMatrix. */
+	std::vector<unsigned int>				m_restStorage;
+	/*! Rows of remaining unknowns: start index of coupling entries to block unknowns, size = m_restRows.size() + 1. */
+	std::vector<unsigned int>				m_restCouplingIa;
+	/*! Coupling entries of remaining unknowns: global column index. */
+	std::vector<unsigned int>				m_restCouplingJa;
+	/*! Coupling entries of remaining unknowns: Jacobian storage index. */
+	std::vector<unsigned int>				m_restCouplingStorage;
+	/*! Sub-matrix of remaining unknowns, holds ILU factorization after setup() (owned). */
+	IBKMK::SparseMatrixCSR					*m_restMatrix = nullptr;
+	/*! Work vector for remaining unknowns. */
+	mutable std::vector<double>				m_restRHS;
+
+	/*! Gamma used in last setup() call, needed to compute coupling terms. */
+	double									m_gamma = 0;
+};
+
+} // namespace SOLFRA
+
+#endif // SOLFRA_PrecondBlockH
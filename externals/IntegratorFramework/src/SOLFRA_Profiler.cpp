@@ -0,0 +1,236 @@
+#include "SOLFRA_Profiler.h"
+
+#include <memory>
+#include <fstream>
+#include <map>
+#include <algorithm>
+#include <iomanip>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include <IBK_FileUtils.h>
+#include <IBK_messages.h>
+#include <IBK_FormatString.h>
+
+namespace SOLFRA {
+
+bool Profiler::m_enabled = false;
+const unsigned int Profiler::NO_COUNTER;
+
+
+/*! Helper function, escapes a string for use in JSON files. */
+static std::string jsonEscape(const std::string & str) {
+	std::string res;
+	res.reserve(str.size());
+	for (char c : str) {
+		switch (c) {
+			case '"'  : res += "\\\""; break;
+			case '\\' : res += "\\\\"; break;
+			case '\n' : res += "\\n"; break;
+			case '\t' : res += "\\t"; break;
+			default:
+				if ((unsigned char)c < 0x20)
+					res += ' ';
+				else
+					res += c;
+		}
+	}
+	return res;
+}
+
+
+Profiler & Profiler::instance() {
+	static Profiler profiler;
+	return profiler;
+}
+
+
+Profiler::Profiler() {
+	const char * const PHASE_NAMES[NUM_P] = {
+		"IntegratorStep",
+		"Outputs",
+		"OutputFlush",
+		"JacobianGeneration",
+		"LESSetup",
+		"LESSolve",
+		"PrecondSetup",
+		"PrecondSolve",
+		"TimeDependentModels",
+		"StateDependentModels"
+	};
+	for (unsigned int i=0; i<NUM_P; ++i) {
+		m_counterNames.push_back(PHASE_NAMES[i]);
+		m_counterCategories.push_back("Solver");
+	}
+	m_startTime = std::chrono::steady_clock::now();
+}
+
+
+void Profiler::setEnabled(bool enabled, unsigned int numThreads) {
+	m_enabled = enabled;
+	if (!enabled)
+		return;
+	m_threadData.clear();
+	m_threadData.resize(std::max<unsigned int>(1, numThreads));
+	for (ThreadData & td : m_threadData) {
+		td.m_time.resize(m_counterNames.size(), 0);
+		td.m_calls.resize(m_counterNames.size(), 0);
+	}
+	m_startTime = std::chrono::steady_clock::now();
+}
+
+
+unsigned int Profiler::registerCounter(const std::string & name, const std::string & category) {
+	// nothing to record, also avoids concurrent modification when several models are set up in parallel threads
+	if (!m_enabled)
+		return NO_COUNTER;
+	m_counterNames.push_back(name);
+	m_counterCategories.push_back(category);
+	// Note: thread data is resized in record() on demand
+	return (unsigned int)m_counterNames.size() - 1;
+}
+
+
+void Profiler::record(unsigned int counterId, double tStart) {
+	double tEnd = now();
+#if defined(_OPENMP)
+	unsigned int threadIdx = (unsigned int)omp_get_thread_num();
+#else
+	unsigned int threadIdx = 0;
+#endif
+	if (threadIdx >= m_threadData.size())
+		return; // more threads running than announced in setEnabled()
+	ThreadData & td = m_threadData[threadIdx];
+	if (counterId >= td.m_time.size()) {
+		td.m_time.resize(m_counterNames.size(), 0);
+		td.m_calls.resize(m_counterNames.size(), 0);
+	}
+	td.m_time[counterId] += tEnd - tStart;
+	++td.m_calls[counterId];
+	if (td.m_events.size() < m_maxTraceEventsPerThread) {
+		TraceEvent e;
+		e.m_counterId = counterId;
+		e.m_start = tStart;
+		e.m_duration = tEnd - tStart;
+		td.m_events.push_back(e);
+	}
+	else
+		++td.m_droppedEvents;
+}
+
+
+void Profiler::writeSummary(const IBK::Path & fname, double wallClockTime) const {
+	FUNCID(Profiler::writeSummary);
+
+	// sum up counters of all threads
+	std::vector<double> counterTime(m_counterNames.size(), 0);
+	std::vector<unsigned long> counterCalls(m_counterNames.size(), 0);
+	unsigned long droppedEvents = 0;
+	for (const ThreadData & td : m_threadData) {
+		for (unsigned int i=0; i<td.m_time.size(); ++i) {
+			counterTime[i] += td.m_time[i];
+			counterCalls[i] += td.m_calls[i];
+		}
+		droppedEvents += td.m_droppedEvents;
+	}
+
+	// sum up counters per category (solver phases are not accumulated, since times are inclusive)
+	std::map<std::string, std::pair<double, unsigned long> > categories;
+	for (unsigned int i=NUM_P; i<m_counterNames.size(); ++i) {
+		std::pair<double, unsigned long> & cat = categories[m_counterCategories[i]];
+		cat.first += counterTime[i];
+		cat.second += counterCalls[i];
+	}
+
+	std::unique_ptr<std::ofstream> out( IBK::create_ofstream(fname) );
+	if (!out || !(*out)) {
+		IBK::IBK_Message(IBK::FormatString("Cannot create profiler summary file '%1'.").arg(fname), IBK::MSG_WARNING, FUNC_ID);
+		return;
+	}
+	std::ostream & o = *out;
+	o << "Profiler summary (inclusive times, summed over all threads)\n";
+	if (wallClockTime > 0)
+		o << "Wall clock time: " << wallClockTime << " s\n";
+	if (droppedEvents > 0)
+		o << "Trace events not stored due to trace event limit: " << droppedEvents << "\n";
+
+	const int W = 14;
+	auto writeHeader = [&](const char * title) {
+		o << "\n" << title << "\n";
+		o << std::setw(W) << std::right << "Time [s]" << std::setw(9) << "[%]" << std::setw(W) << "Calls"
+		  << std::setw(W) << "Mean [us]" << "  Name\n";
+	};
+	auto writeLine = [&](double tUs, unsigned long calls, const std::string & name) {
+		o << std::setw(W) << std::right << std::fixed << std::setprecision(6) << tUs*1e-6;
+		if (wallClockTime > 0)
+			o << std::setw(9) << std::setprecision(2) << tUs*1e-6/wallClockTime*100;
+		else
+			o << std::setw(9) << "-";
+		o << std::setw(W) << calls
+		  << std::setw(W) << std::setprecision(3) << (calls > 0 ? tUs/calls : 0.0)
+		  << "  " << name << "\n";
+	};
+
+	// solver phases in fixed order
+	writeHeader("Solver phases");
+	for (unsigned int i=0; i<NUM_P; ++i) {
+		if (counterCalls[i] == 0)
+			continue;
+		writeLine(counterTime[i], counterCalls[i], m_counterNames[i]);
+	}
+
+	// categories sorted by time
+	std::vector<std::pair<double, std::string> > sortedCategories;
+	for (const auto & cat : categories)
+		sortedCategories.push_back(std::make_pair(cat.second.first, cat.first));
+	std::sort(sortedCategories.begin(), sortedCategories.end(),
+			  [](const std::pair<double, std::string> & a, const std::pair<double, std::string> & b) { return a.first > b.first; });
+	writeHeader("Model types");
+	for (const auto & cat : sortedCategories)
+		writeLine(cat.first, categories[cat.second].second, cat.second);
+
+	// individual counters sorted by time
+	std::vector<unsigned int> sortedCounters;
+	for (unsigned int i=NUM_P; i<m_counterNames.size(); ++i)
+		if (counterCalls[i] != 0)
+			sortedCounters.push_back(i);
+	std::sort(sortedCounters.begin(), sortedCounters.end(),
+			  [&counterTime](unsigned int a, unsigned int b) { return counterTime[a] > counterTime[b]; });
+	writeHeader("Models");
+	for (unsigned int i : sortedCounters)
+		writeLine(counterTime[i], counterCalls[i], m_counterCategories[i] + " " + m_counterNames[i]);
+}
+
+
+void Profiler::writeChromeTrace(const IBK::Path & fname) const {
+	FUNCID(Profiler::writeChromeTrace);
+
+	std::unique_ptr<std::ofstream> out( IBK::create_ofstream(fname) );
+	if (!out || !(*out)) {
+		IBK::IBK_Message(IBK::FormatString("Cannot create profiler trace file '%1'.").arg(fname), IBK::MSG_WARNING, FUNC_ID);
+		return;
+	}
+	std::ostream & o = *out;
+	o << std::fixed << std::setprecision(3);
+	o << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	bool first = true;
+	for (unsigned int t=0; t<m_threadData.size(); ++t) {
+		// thread name meta data
+		if (!first)
+			o << ",\n";
+		first = false;
+		o << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+		  << ",\"args\":{\"name\":\"Thread " << t << "\"}}";
+		for (const TraceEvent & e : m_threadData[t].m_events) {
+			o << ",\n{\"name\":\"" << jsonEscape(m_counterNames[e.m_counterId])
+			  << "\",\"cat\":\"" << jsonEscape(m_counterCategories[e.m_counterId])
+			  << "\",\"ph\":\"X\",\"ts\":" << e.m_start << ",\"dur\":" << e.m_duration
+			  << ",\"pid\":1,\"tid\":" << t << "}";
+		}
+	}
+	o << "\n]}\n";
+}
+
+} // namespace SOLFRA
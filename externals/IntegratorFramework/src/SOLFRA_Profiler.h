@@ -0,0 +1,188 @@
+#ifndef SOLFRA_ProfilerH
+#define SOLFRA_ProfilerH
+
+#include <vector>
+#include <string>
+#include <chrono>
+
+#include <IBK_Path.h>
+
+namespace SOLFRA {
+
+/*! Runtime-switchable profiler for solver phases and model evaluation.
+
+	The profiler is always compiled, but records nothing until it is enabled with setEnabled().
+	When disabled, a ProfilerScope costs a single branch.
+
+	Time measurements are accumulated in counters. The first NUM_P counters are predefined solver phases
+	(see enum Phase), additional counters (e.g. for individual models) are registered with registerCounter()
+	and are grouped by a category (e.g. the model type). Each thread accumulates into its own data
+	block (selected by OpenMP thread number), so that no synchronization is needed while recording.
+
+	Additionally, each measurement is stored as trace event (up to m_maxTraceEventsPerThread events per thread)
+	and can be exported as Chrome/Perfetto trace file (open in chrome://tracing or ui.perfetto.dev).
+
+	\code
+	// enable profiler for 4 threads
+	Profiler::instance().setEnabled(true, 4);
+	// register a counter
+	unsigned int counterId = Profiler::instance().registerCounter("Model #12", "ModelType");
+	...
+	{
+		ProfilerScope profile(counterId);
+		// ... code to be measured
+	}
+	...
+	// write results
+	Profiler::instance().writeSummary(logDir / "profile_summary.txt", wallClockTime);
+	Profiler::instance().writeChromeTrace(logDir / "profile_trace.json");
+	\endcode
+
+	\note Measured times are inclusive, i.e. nested scopes (for example model updates within an integrator step)
+		are counted in both counters.
+*/
+class Profiler {
+public:
+	/*! Predefined counters for solver phases. */
+	enum Phase {
+		/*! Integrator step. */
+		P_IntegratorStep,
+		/*! Output writing (model evaluation and caching of outputs). */
+		P_Outputs,
+		/*! Writing cached outputs to file. */
+		P_OutputFlush,
+		/*! Jacobian matrix generation. */
+		P_JacobianGeneration,
+		/*! Setup of linear equation system solver (incl. factorization). */
+		P_LESSetup,
+		/*! Solution of linear equation system. */
+		P_LESSolve,
+		/*! Preconditioner setup. */
+		P_PrecondSetup,
+		/*! Preconditioner solve. */
+		P_PrecondSolve,
+		/*! Update of time-dependent models. */
+		P_TimeDependentModels,
+		/*! Update of state-dependent models. */
+		P_StateDependentModels,
+		NUM_P
+	};
+
+	/*! Counter ID that is never recorded (used for objects that are profiled at a different level). */
+	static const unsigned int NO_COUNTER = (unsigned int)-1;
+
+	/*! Returns the global profiler instance. */
+	static Profiler & instance();
+
+	/*! Returns true if profiler is enabled (fast inline check). */
+	static bool enabled() { return m_enabled; }
+
+	/*! Enables/disables profiling.
+		\param enabled If true, subsequent scopes are recorded.
+		\param numThreads Number of threads that may record concurrently.
+	*/
+	void setEnabled(bool enabled, unsigned int numThreads = 1);
+
+	/*! Registers a counter and returns its ID (NO_COUNTER if profiler is disabled).
+		\param name Name of counter as shown in summary and trace file (e.g. model name and ID).
+		\param category Category used to accumulate counters in the summary (e.g. model type).
+		\note Must not be called while recording from several threads.
+	*/
+	unsigned int registerCounter(const std::string & name, const std::string & category);
+
+	/*! Returns time elapsed since enabling the profiler in [us]. */
+	double now() const {
+		return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_startTime).count();
+	}
+
+	/*! Records a measurement for given counter, from tStart (returned by now()) until now.
+		Called by ProfilerScope.
+	*/
+	void record(unsigned int counterId, double tStart);
+
+	/*! Writes a summary of all counters, sorted by total time, to the given file.
+		Counters are accumulated per category, followed by the list of individual counters.
+		\param fname Output file path.
+		\param wallClockTime Total wall clock time of the simulation in [s], used for percentages (0 to omit).
+	*/
+	void writeSummary(const IBK::Path & fname, double wallClockTime) const;
+
+	/*! Writes all recorded trace events into a Chrome/Perfetto trace JSON file. */
+	void writeChromeTrace(const IBK::Path & fname) const;
+
+	/*! Maximum number of trace events stored per thread (limits memory use for long simulations).
+		Counter values are accumulated regardless of this limit.
+	*/
+	unsigned int						m_maxTraceEventsPerThread = 2000000;
+
+private:
+	/*! A single measurement. */
+	struct TraceEvent {
+		unsigned int	m_counterId;
+		/*! Start time in [us]. */
+		double			m_start;
+		/*! Duration in [us]. */
+		double			m_duration;
+	};
+
+	/*! Data recorded by a single thread. */
+	struct ThreadData {
+		/*! Accumulated time per counter in [us]. */
+		std::vector<double>				m_time;
+		/*! Number of calls per counter. */
+		std::vector<unsigned long>		m_calls;
+		/*! Trace events. */
+		std::vector<TraceEvent>			m_events;
+		/*! Number of events not stored due to m_maxTraceEventsPerThread limit. */
+		unsigned long					m_droppedEvents = 0;
+		/*! Padding to avoid false sharing of vector size members between threads. */
+		char							m_padding[64];
+	};
+
+	/*! Private constructor, registers predefined phase counters. */
+	Profiler();
+
+	/*! Global enabled flag. */
+	static bool							m_enabled;
+
+	/*! Reference time point (time when profiler was enabled). */
+	std::chrono::steady_clock::time_point	m_startTime;
+
+	/*! Counter names. */
+	std::vector<std::string>			m_counterNames;
+	/*! Counter categories. */
+	std::vector<std::string>			m_counterCategories;
+
+	/*! Recorded data, one entry per thread. */
+	std::vector<ThreadData>				m_threadData;
+};
+
+
+/*! Measures time between construction and destruction and records it for a given counter. */
+class ProfilerScope {
+public:
+	/*! Starts measurement (if profiler is enabled and counterId is not Profiler::NO_COUNTER). */
+	explicit ProfilerScope(unsigned int counterId) :
+		m_counterId(counterId),
+		m_active(Profiler::enabled() && counterId != Profiler::NO_COUNTER)
+	{
+		if (m_active)
+			m_start = Profiler::instance().now();
+	}
+
+	/*! Ends measurement and records time. */
+	~ProfilerScope() {
+		if (m_active)
+			Profiler::instance().record(m_counterId, m_start);
+	}
+
+private:
+	unsigned int	m_counterId;
+	bool			m_active;
+	double			m_start = 0;
+};
+
+} // namespace SOLFRA
+
+
+#endif // SOLFRA_ProfilerH
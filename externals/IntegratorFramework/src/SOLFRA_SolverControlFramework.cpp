@@ -49,6 +49,7 @@
 #include "SOLFRA_PrecondInterface.h"
 #include "SOLFRA_JacobianInterface.h"
 #include "SOLFRA_Constants.h"
+#include "SOLFRA_Profiler.h"
 
 #include <sundials/sundials_config.h>
 #include <sundials/sundials_timer.h>
@@ -203,9 +204,23 @@ void SolverControlFramework::restartFrom(double t_restart) {
 	bool success = readRestartFile(-2, t_restart, t, &tmp[0]);
 	if (!success)
 		throw IBK::Exception("Reading of restart file failed.", FUNC_ID);
+	restartFromSnapshot(t, tmp);
+}
+
+
+void SolverControlFramework::restartFromSnapshot(double t, const std::vector<double> & integratorModelData) {
+	FUNCID(SolverControlFramework::restartFromSnapshot);
+	if (m_model == nullptr || m_integrator == nullptr || m_outputScheduler == nullptr)
+		throw IBK::Exception("Invalid pointers to model, integrator or outputScheduler.", FUNC_ID);
+	// check if enough data is available - i.e. source data memory is large enough for target memory in model
+	unsigned int dataSize = m_model->serializationSize()/sizeof(double); // number of doubles
+	if (integratorModelData.size() < m_model->n() || integratorModelData.size() - m_model->n() != dataSize)
+		throw IBK::Exception("Invalid data size in restart data. You MUST NOT add/remove "
+							 "outputs with time integration/averaging when restarting!", FUNC_ID);
+
 	// initialize integrator with read solution
 	try {
-		m_integrator->init(m_model, t, &tmp[0], m_lesSolver, m_precondInterface, m_jacobianInterface);
+		m_integrator->init(m_model, t, &integratorModelData[0], m_lesSolver, m_precondInterface, m_jacobianInterface);
 	}
 	catch (IBK::Exception & ex) {
 		throw IBK::Exception(ex, "Initialization of Integrator failed.", FUNC_ID);
@@ -215,21 +230,25 @@ void SolverControlFramework::restartFrom(double t_restart) {
 		return;
 	}
 
-	// now pass serialization data to model as well
-	double * modelDataPtr = tmp.data() + m_model->n();
-	void * modPtr = (void*)modelDataPtr;
-	// check if enough data is available - i.e. source data memory is large enough for target memory in model
-	unsigned int dataSize = m_model->serializationSize()/sizeof(double); // number of doubles
-	if (tmp.size() - m_model->n() != dataSize)
-		throw IBK::Exception("Invalid data size in restart file. You MUST NOT add/remove "
-							 "outputs with time integration/averaging when restarting!", FUNC_ID);
+	// now pass serialization data to model as well (deserialize() advances the pointer, so we pass a copy)
+	std::vector<double> modelData(integratorModelData.begin() + m_model->n(), integratorModelData.end());
+	void * modPtr = (void*)modelData.data();
 	m_model->deserialize(modPtr);
 
-
 	run(t);
 }
 
 
+void SolverControlFramework::lastRestartPoint(double & t, std::vector<double> & integratorModelData) const {
+	FUNCID(SolverControlFramework::lastRestartPoint);
+	if (m_model == nullptr)
+		throw IBK::Exception("Missing model.", FUNC_ID);
+	integratorModelData.resize(m_model->n() + m_model->serializationSize()/sizeof(double));
+	if (!readRestartFile(-1, 0, t, &integratorModelData[0]))
+		throw IBK::Exception(IBK::FormatString("Reading of restart file '%1' failed.").arg(m_restartFilename), FUNC_ID);
+}
+
+
 void SolverControlFramework::restart(int step) {
 	FUNCID(SolverControlFramework::restart);
 	if (m_model == nullptr || m_integrator == nullptr || m_outputScheduler == nullptr)
@@ -412,7 +431,11 @@ void SolverControlFramework::run(double t) {
 		while (t < t_end) {
 
 			// (contains parallel code)
-			IntegratorInterface::StepResultType res = m_integrator->step();
+			IntegratorInterface::StepResultType res;
+			{
+				ProfilerScope profile(Profiler::P_IntegratorStep);
+				res = m_integrator->step();
+			}
 			if (res != IntegratorInterface::StepSuccess)
 				throw IBK::Exception("Error during integrator step call.", FUNC_ID);
 
@@ -434,9 +457,12 @@ void SolverControlFramework::run(double t) {
 			// or in the global /build/cmake/CMakeLists.txt file!
 #ifdef OUTPUT_AFTER_EACH_STEP
 			// tell m_model to write outputs
-			SUNDIALS_TIMED_FUNCTION( SUNDIALS_TIMER_WRITE_OUTPUTS,
-				m_model->writeOutputs( t, y_current)
-			);
+			{
+				ProfilerScope profile(Profiler::P_Outputs);
+				SUNDIALS_TIMED_FUNCTION( SUNDIALS_TIMER_WRITE_OUTPUTS,
+					m_model->writeOutputs( t, y_current)
+				);
+			}
 #else
 			// Note: in the check below we add a small value to ensure that for
 			//       t_out = 2.000000001 and t = 2.0 we still get an output at simulation end
@@ -447,9 +473,12 @@ void SolverControlFramework::run(double t) {
 				double t_outNext = 0.0;
 
 				// tell m_model to write outputs
-				SUNDIALS_TIMED_FUNCTION( SUNDIALS_TIMER_WRITE_OUTPUTS,
-					m_model->writeOutputs( t_out, y_out);
-				);
+				{
+					ProfilerScope profile(Profiler::P_Outputs);
+					SUNDIALS_TIMED_FUNCTION( SUNDIALS_TIMER_WRITE_OUTPUTS,
+						m_model->writeOutputs( t_out, y_out);
+					);
+				}
 
 				// ensure that we write the final restart info _exactly_ at end of the simulation
 				// we add a small time difference to ensure that we are actually at end of simulation
@@ -720,6 +749,14 @@ void SolverControlFramework::writeMetrics() {
 	m_model->writeMetrics(wct, of);
 
 	IBK::IBK_Message( IBK::FormatString("------------------------------------------------------------------------------\n"), IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+
+	// write profiler results
+	if (Profiler::enabled() && m_logDirectory.isValid()) {
+		Profiler::instance().writeSummary(m_logDirectory / "profile_summary.txt", wct);
+		Profiler::instance().writeChromeTrace(m_logDirectory / "profile_trace.json");
+		IBK::IBK_Message( IBK::FormatString("Profiler results written to '%1'\n").arg(m_logDirectory / "profile_summary.txt"),
+						  IBK::MSG_PROGRESS, FUNC_ID, IBK::VL_STANDARD);
+	}
 }
 
 
@@ -19,6 +19,7 @@
 #define SolverControlFrameworkH
 
 #include <string>
+#include <vector>
 #include <IBK_StopWatch.h>
 #include <IBK_Path.h>
 
@@ -137,6 +138,23 @@ public:
 	/*! Reads restart information and begins from the step at or just before t. */
 	void restartFrom(double t);
 
+	/*! Initializes integrator and model with a previously recorded state and continues integration from t.
+		This allows forking several continuation runs (e.g. variants with different parameters) from a common
+		state without re-reading the restart file in each run.
+		\param t Time point of the snapshot.
+		\param integratorModelData Solution vector followed by model serialization data, as returned by
+			lastRestartPoint(). The model must have the same size and serialization size as the model the
+			snapshot was taken from.
+	*/
+	void restartFromSnapshot(double t, const std::vector<double> & integratorModelData);
+
+	/*! Reads the last restart point (usually the state at simulation end) from the restart file.
+		\param t Time point of the restart point is stored here.
+		\param integratorModelData Solution vector followed by model serialization data is stored here.
+		Throws an IBK::Exception if the restart file cannot be read.
+	*/
+	void lastRestartPoint(double & t, std::vector<double> & integratorModelData) const;
+
 	/*! Reads restart information and begins from the step with index step.
 		\param step The step index to continue the simulation from.
 			If 0, the simulation is started regularly from begin, same as calling run().
@@ -42,6 +42,15 @@ ArgsParser::ArgsParser() {
 			".BR -o,\n.BR --output-dir\n"
 			"option.";
 
+	addFlag(0, "profile", "Enables profiling of model evaluation and solver phases; writes 'profile_summary.txt' "
+			"and the Chrome/Perfetto trace file 'profile_trace.json' to the log directory.");
+	addFlag(0, "batch", "Batch mode: the project file argument is a text file with one project file per line. "
+			"All projects are simulated in a single process, '-p' sets the number of concurrent simulations "
+			"(default: one per core). Climate data and Jacobian coloring are shared between the simulations.");
+	addFlag(0, "sweep", "Sweep mode: like batch mode, but the first project in the list is a base project that is "
+			"simulated only once. All other projects (variants) are continued from its state at its simulation end, "
+			"and must only differ from the base project in parameters (schedules, setpoints, FMI input values, ...).");
+
 	// adjust options for les-solver, integrator and precond to show only the options available for NANDRAD
 	for (OptionType & ot : m_knownOptions) {
 		if (ot.m_longVersion == "integrator") {
@@ -73,7 +82,13 @@ void ArgsParser::printHelp(std::ostream & out) const {
 		"Starting solver with different LES solver\n"
 		"> "<< m_appname << " --les-solver=GMRES <project file>\n\n"
 		"Starting solver with BiCGStab iterative solver, Krylov subspace limit of 50 and ILUT preconditioner\n"
-		"> "<< m_appname << " --les-solver=BiCGStab(50) --precond=ILU <project file>\n\n";
+		"> "<< m_appname << " --les-solver=BiCGStab(50) --precond=ILU <project file>\n\n"
+		"Profiling model evaluation (results in log directory)\n"
+		"> "<< m_appname << " --profile <project file>\n\n"
+		"Running all projects listed in a text file, 4 simulations at a time\n"
+		"> "<< m_appname << " --batch -p=4 <project list file>\n\n"
+		"Running variants forked from the final state of the first project in the list\n"
+		"> "<< m_appname << " --sweep -p=4 <project list file>\n\n";
 }
 
 } // namespace NANDRAD
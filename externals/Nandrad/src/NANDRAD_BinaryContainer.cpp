@@ -0,0 +1,690 @@
+/*	The NANDRAD data model library.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NANDRAD_BinaryContainer.h"
+
+#include <algorithm>
+#include <clocale>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <locale>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <tinyxml.h>
+
+#include <IBK_Exception.h>
+#include <IBK_FileUtils.h>
+#include <IBK_Path.h>
+#include <IBK_StringUtils.h>
+
+namespace NANDRAD {
+
+/*! File signature, the CR LF sequence detects files damaged by text-mode transfers. */
+static const char BINARY_CONTAINER_SIGNATURE[8] = { 'N', 'D', 'R', 'B', 'I', 'N', '\r', '\n' };
+/*! Current format version. */
+static const std::uint32_t BINARY_CONTAINER_VERSION = 1;
+
+/*! Section IDs. */
+enum SectionID {
+	SID_Names	= 1,
+	SID_Numbers	= 2,
+	SID_Tree	= 3
+};
+
+/*! Node types in tree section. */
+enum NodeType {
+	NT_Element		= 1,
+	NT_Text			= 2,
+	NT_NumberText	= 3,
+	NT_Comment		= 4,
+	NT_Declaration	= 5
+};
+
+/*! Encoding of number section. */
+enum NumberEncoding {
+	NE_Raw				= 0,
+	NE_ShuffledRLE		= 1
+};
+
+/*! Minimum number of values in an element text to be stored in number section. */
+static const unsigned int MIN_NUMBER_TEXT_VALUES = 4;
+/*! Maximum number of different separators in number texts (3 for lists of 3D vectors). */
+static const unsigned int MAX_SEPARATOR_PERIOD = 3;
+
+
+// *** Helper functions for writing ***
+
+static void appendUInt8(std::string & buf, unsigned int v) {
+	buf.push_back((char)(v & 0xFF));
+}
+
+static void appendUInt32(std::string & buf, std::uint32_t v) {
+	for (unsigned int i=0; i<4; ++i)
+		buf.push_back((char)((v >> (8*i)) & 0xFF));
+}
+
+static void appendUInt64(std::string & buf, std::uint64_t v) {
+	for (unsigned int i=0; i<8; ++i)
+		buf.push_back((char)((v >> (8*i)) & 0xFF));
+}
+
+static void appendString(std::string & buf, const std::string & str) {
+	appendUInt32(buf, (std::uint32_t)str.size());
+	buf.append(str);
+}
+
+static void appendSection(std::string & buf, SectionID id, const std::string & data) {
+	appendUInt32(buf, id);
+	appendUInt64(buf, data.size());
+	buf.append(data);
+}
+
+static std::uint64_t doubleBits(double v) {
+	std::uint64_t bits;
+	std::memcpy(&bits, &v, sizeof(double));
+	return bits;
+}
+
+
+/*! Run-length encoding of a byte sequence.
+	Control byte c < 128: c+1 literal bytes follow; c >= 128: next byte is repeated c-125 times (3..130).
+*/
+static void encodeRLE(const std::vector<unsigned char> & data, std::string & buf) {
+	std::size_t n = data.size();
+	std::size_t i = 0;
+	while (i < n) {
+		// length of run starting at i
+		std::size_t j = i + 1;
+		while (j < n && data[j] == data[i] && j - i < 130)
+			++j;
+		if (j - i >= 3) {
+			appendUInt8(buf, (unsigned int)(j - i + 125));
+			appendUInt8(buf, data[i]);
+			i = j;
+			continue;
+		}
+		// collect literal bytes until the next run of 3 equal bytes starts
+		std::size_t start = i;
+		while (i < n && i - start < 128) {
+			if (i + 2 < n && data[i] == data[i+1] && data[i] == data[i+2])
+				break;
+			++i;
+		}
+		appendUInt8(buf, (unsigned int)(i - start - 1));
+		buf.append((const char*)&data[start], i - start);
+	}
+}
+
+
+/*! Formats numbers like a std::stringstream with default flags and given precision (locale-independent).
+	The stream formats with "%.*g", so snprintf() is used directly unless the C locale uses another decimal point.
+*/
+class NumberFormatter {
+public:
+	NumberFormatter() {
+		const char * decimalPoint = std::localeconv()->decimal_point;
+		m_useSnprintf = std::strcmp(decimalPoint, ".") == 0;
+		m_strm.imbue(std::locale::classic());
+	}
+
+	/*! Returns true, if value formatted with given precision matches text at given position. */
+	bool matches(double v, int precision, const std::string & text, std::size_t start, std::size_t len) {
+		if (m_useSnprintf) {
+			char buf[32];
+			int n = std::snprintf(buf, sizeof(buf), "%.*g", precision, v);
+			return n == (int)len && text.compare(start, len, buf, len) == 0;
+		}
+		m_strm.str(std::string());
+		m_strm.precision(precision);
+		m_strm << v;
+		m_buf = m_strm.str();
+		return m_buf.size() == len && text.compare(start, len, m_buf) == 0;
+	}
+
+private:
+	bool				m_useSnprintf;
+	std::ostringstream	m_strm;
+	std::string			m_buf;
+};
+
+
+static bool isDelimiter(char ch) {
+	return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == ',';
+}
+
+
+/*! Returns the number of significant digits in the mantissa of a number token (leading zeros are skipped). */
+static int significantDigits(const std::string & text, std::size_t start, std::size_t len) {
+	int digits = 0;
+	for (std::size_t i=start; i<start+len; ++i) {
+		char ch = text[i];
+		if (ch == 'e' || ch == 'E')
+			break;
+		if (ch >= '1' && ch <= '9')
+			++digits;
+		else if (ch == '0' && digits > 0)
+			++digits;
+	}
+	return digits;
+}
+
+
+/*! Checks if text holds a list of numbers that can be restored exactly from the values and, if so,
+	stores the values and the format information in numText.
+*/
+static bool encodeNumberText(const std::string & text, NumberFormatter & formatter, TiXmlNumberText & numText) {
+	// quick check on allowed characters
+	for (char ch : text) {
+		if (!isDelimiter(ch) && (ch < '0' || ch > '9') && ch != '.' && ch != '-' && ch != '+' && ch != 'e' && ch != 'E')
+			return false;
+	}
+
+	// split into tokens and separators
+	std::vector<std::size_t> tokenStart, tokenLength;
+	std::vector<std::string> separators;
+	std::size_t pos = 0;
+	std::size_t n = text.size();
+	while (pos < n && isDelimiter(text[pos]))
+		++pos;
+	numText.leading = text.substr(0, pos);
+	while (pos < n) {
+		std::size_t start = pos;
+		while (pos < n && !isDelimiter(text[pos]))
+			++pos;
+		tokenStart.push_back(start);
+		tokenLength.push_back(pos - start);
+		start = pos;
+		while (pos < n && isDelimiter(text[pos]))
+			++pos;
+		if (pos < n)
+			separators.push_back(text.substr(start, pos - start));
+		else
+			numText.trailing = text.substr(start);
+	}
+	if (tokenStart.size() < MIN_NUMBER_TEXT_VALUES)
+		return false;
+
+	// separators must follow a periodic pattern
+	unsigned int period = 1;
+	for (; period <= MAX_SEPARATOR_PERIOD; ++period) {
+		unsigned int i = period;
+		for (; i<separators.size(); ++i)
+			if (separators[i] != separators[i % period])
+				break;
+		if (i == separators.size())
+			break;
+	}
+	if (period > MAX_SEPARATOR_PERIOD)
+		return false;
+	numText.separators.assign(separators.begin(), separators.begin() + period);
+
+	// parse values
+	std::vector<double> & vals = numText.values;
+	try {
+		IBK::string2valueVector(text.c_str(), vals, true);
+	}
+	catch (...) {
+		return false;
+	}
+	if (vals.size() != tokenStart.size())
+		return false;
+
+	// If the text was written by a stream with precision p, the largest number of significant digits of all
+	// tokens reproduces the text as well: tokens have at most p digits and the stream switches to exponent
+	// notation for the same values. Hence, a single precision needs to be checked.
+	int precision = 1;
+	for (unsigned int i=0; i<vals.size(); ++i)
+		precision = std::max(precision, significantDigits(text, tokenStart[i], tokenLength[i]));
+	for (unsigned int i=0; i<vals.size(); ++i)
+		if (!formatter.matches(vals[i], precision, text, tokenStart[i], tokenLength[i]))
+			return false;
+	numText.precision = precision;
+	return true;
+}
+
+
+/*! Composes names, numbers and tree sections from document nodes. */
+class ContainerWriter {
+public:
+	void writeNode(const TiXmlNode * node) {
+		FUNCID(NANDRAD::writeBinaryContainer);
+		switch (node->Type()) {
+			case TiXmlNode::TINYXML_ELEMENT : {
+				const TiXmlElement * element = node->ToElement();
+				appendUInt8(m_tree, NT_Element);
+				appendUInt32(m_tree, nameIndex(element->ValueStr()));
+				std::uint32_t attribCount = 0;
+				for (const TiXmlAttribute * attrib = element->FirstAttribute(); attrib; attrib = attrib->Next())
+					++attribCount;
+				appendUInt32(m_tree, attribCount);
+				for (const TiXmlAttribute * attrib = element->FirstAttribute(); attrib; attrib = attrib->Next()) {
+					appendUInt32(m_tree, nameIndex(attrib->NameStr()));
+					appendString(m_tree, attrib->ValueStr());
+				}
+				writeChildren(node);
+			} break;
+
+			case TiXmlNode::TINYXML_TEXT : {
+				const TiXmlText * text = node->ToText();
+				// number texts of documents read from binary containers are written as they are
+				const TiXmlNumberText * numText = text->NumberText();
+				TiXmlNumberText encodedNumText;
+				if (numText == nullptr && !text->CDATA() && text->ValueStr().size() >= 2*MIN_NUMBER_TEXT_VALUES &&
+					encodeNumberText(text->ValueStr(), m_formatter, encodedNumText))
+				{
+					numText = &encodedNumText;
+				}
+				if (numText != nullptr) {
+					appendUInt8(m_tree, NT_NumberText);
+					appendUInt32(m_tree, (std::uint32_t)numText->values.size());
+					appendUInt8(m_tree, (unsigned int)numText->precision);
+					appendString(m_tree, numText->leading);
+					appendString(m_tree, numText->trailing);
+					appendUInt8(m_tree, (unsigned int)numText->separators.size());
+					for (const std::string & s : numText->separators)
+						appendString(m_tree, s);
+					m_numbers.insert(m_numbers.end(), numText->values.begin(), numText->values.end());
+				}
+				else {
+					appendUInt8(m_tree, NT_Text);
+					appendUInt8(m_tree, text->CDATA() ? 1 : 0);
+					appendString(m_tree, text->ValueStr());
+				}
+			} break;
+
+			case TiXmlNode::TINYXML_COMMENT :
+				appendUInt8(m_tree, NT_Comment);
+				appendString(m_tree, node->ValueStr());
+			break;
+
+			case TiXmlNode::TINYXML_DECLARATION : {
+				const TiXmlDeclaration * decl = node->ToDeclaration();
+				appendUInt8(m_tree, NT_Declaration);
+				appendString(m_tree, decl->Version());
+				appendString(m_tree, decl->Encoding());
+				appendString(m_tree, decl->Standalone());
+			} break;
+
+			default:
+				throw IBK::Exception(IBK::FormatString("Unsupported XML node type in line %1.").arg(node->Row()), FUNC_ID);
+		}
+	}
+
+	void writeChildren(const TiXmlNode * node) {
+		std::uint32_t childCount = 0;
+		for (const TiXmlNode * c = node->FirstChild(); c; c = c->NextSibling())
+			++childCount;
+		appendUInt32(m_tree, childCount);
+		for (const TiXmlNode * c = node->FirstChild(); c; c = c->NextSibling())
+			writeNode(c);
+	}
+
+	std::uint32_t nameIndex(const std::string & name) {
+		std::map<std::string, std::uint32_t>::const_iterator it = m_nameIndex.find(name);
+		if (it != m_nameIndex.end())
+			return it->second;
+		std::uint32_t idx = (std::uint32_t)m_names.size();
+		m_nameIndex[name] = idx;
+		m_names.push_back(name);
+		return idx;
+	}
+
+	std::string namesSection() const {
+		std::string buf;
+		appendUInt32(buf, (std::uint32_t)m_names.size());
+		for (const std::string & name : m_names)
+			appendString(buf, name);
+		return buf;
+	}
+
+	std::string numbersSection(bool compress) const {
+		std::string buf;
+		appendUInt64(buf, m_numbers.size());
+		if (!compress) {
+			appendUInt8(buf, NE_Raw);
+			buf.reserve(buf.size() + 8*m_numbers.size());
+			for (double v : m_numbers)
+				appendUInt64(buf, doubleBits(v));
+		}
+		else {
+			appendUInt8(buf, NE_ShuffledRLE);
+			// regroup bytes: most significant bytes (sign/exponent) of all values first
+			std::size_t n = m_numbers.size();
+			std::vector<unsigned char> shuffled(8*n);
+			for (std::size_t i=0; i<n; ++i) {
+				std::uint64_t bits = doubleBits(m_numbers[i]);
+				for (unsigned int b=0; b<8; ++b)
+					shuffled[(7-b)*n + i] = (unsigned char)((bits >> (8*b)) & 0xFF);
+			}
+			encodeRLE(shuffled, buf);
+		}
+		return buf;
+	}
+
+	std::string							m_tree;
+
+private:
+	std::map<std::string, std::uint32_t>	m_nameIndex;
+	std::vector<std::string>			m_names;
+	std::vector<double>					m_numbers;
+	NumberFormatter						m_formatter;
+};
+
+
+// *** Helper functions for reading ***
+
+/*! Bounds-checked reading from a memory buffer. */
+class ContainerReader {
+public:
+	ContainerReader(const char * begin, const char * end) : m_pos(begin), m_end(end) {}
+
+	bool atEnd() const { return m_pos == m_end; }
+
+	void require(std::uint64_t n) const {
+		FUNCID(NANDRAD::readBinaryContainer);
+		if ((std::uint64_t)(m_end - m_pos) < n)
+			throw IBK::Exception("Unexpected end of data, binary container file is corrupt.", FUNC_ID);
+	}
+
+	unsigned int uint8() {
+		require(1);
+		return (unsigned char)*m_pos++;
+	}
+
+	std::uint32_t uint32() {
+		require(4);
+		std::uint32_t v = 0;
+		for (unsigned int i=0; i<4; ++i)
+			v |= (std::uint32_t)(unsigned char)m_pos[i] << (8*i);
+		m_pos += 4;
+		return v;
+	}
+
+	std::uint64_t uint64() {
+		require(8);
+		std::uint64_t v = 0;
+		for (unsigned int i=0; i<8; ++i)
+			v |= (std::uint64_t)(unsigned char)m_pos[i] << (8*i);
+		m_pos += 8;
+		return v;
+	}
+
+	std::string string() {
+		std::uint32_t len = uint32();
+		require(len);
+		std::string s(m_pos, len);
+		m_pos += len;
+		return s;
+	}
+
+	const char * skip(std::uint64_t n) {
+		require(n);
+		const char * p = m_pos;
+		m_pos += n;
+		return p;
+	}
+
+	const char	*m_pos;
+	const char	*m_end;
+};
+
+
+static double bitsToDouble(std::uint64_t bits) {
+	double v;
+	std::memcpy(&v, &bits, sizeof(double));
+	return v;
+}
+
+
+static void decodeNumbers(ContainerReader & r, std::vector<double> & numbers) {
+	FUNCID(NANDRAD::readBinaryContainer);
+	std::uint64_t n = r.uint64();
+	unsigned int encoding = r.uint8();
+	// run-length encoding expands 2 bytes to at most 130 bytes, so more values would indicate a corrupt file
+	if (n > (std::uint64_t)(r.m_end - r.m_pos)*9)
+		throw IBK::Exception("Invalid number count, binary container file is corrupt.", FUNC_ID);
+	numbers.resize(n);
+	if (encoding == NE_Raw) {
+		for (std::uint64_t i=0; i<n; ++i)
+			numbers[i] = bitsToDouble(r.uint64());
+	}
+	else if (encoding == NE_ShuffledRLE) {
+		std::vector<unsigned char> shuffled(8*n);
+		std::size_t pos = 0;
+		while (pos < shuffled.size()) {
+			unsigned int c = r.uint8();
+			if (c < 128) {
+				std::size_t len = c + 1;
+				if (pos + len > shuffled.size())
+					throw IBK::Exception("Invalid run-length encoding in number section.", FUNC_ID);
+				std::memcpy(&shuffled[pos], r.skip(len), len);
+				pos += len;
+			}
+			else {
+				std::size_t len = c - 125;
+				if (pos + len > shuffled.size())
+					throw IBK::Exception("Invalid run-length encoding in number section.", FUNC_ID);
+				std::memset(&shuffled[pos], (int)r.uint8(), len);
+				pos += len;
+			}
+		}
+		for (std::size_t i=0; i<n; ++i) {
+			std::uint64_t bits = 0;
+			for (unsigned int b=0; b<8; ++b)
+				bits |= (std::uint64_t)shuffled[(7-b)*n + i] << (8*b);
+			numbers[i] = bitsToDouble(bits);
+		}
+	}
+	else
+		throw IBK::Exception(IBK::FormatString("Unknown number encoding %1.").arg(encoding), FUNC_ID);
+}
+
+
+/*! Restores document nodes from tree section. */
+class TreeReader {
+public:
+	TreeReader(ContainerReader & r, const std::vector<std::string> & names, const std::vector<double> & numbers) :
+		m_r(r), m_names(names), m_numbers(numbers)
+	{
+	}
+
+	void readChildren(TiXmlNode * parent) {
+		std::uint32_t childCount = m_r.uint32();
+		for (std::uint32_t i=0; i<childCount; ++i)
+			parent->LinkEndChild(readNode());
+	}
+
+	TiXmlNode * readNode() {
+		FUNCID(NANDRAD::readBinaryContainer);
+		unsigned int type = m_r.uint8();
+		switch (type) {
+			case NT_Element : {
+				TiXmlElement * element = new TiXmlElement(name());
+				try {
+					std::uint32_t attribCount = m_r.uint32();
+					for (std::uint32_t i=0; i<attribCount; ++i) {
+						const std::string & attribName = name();
+						element->SetAttribute(attribName, m_r.string());
+					}
+					readChildren(element);
+				}
+				catch (...) {
+					delete element;
+					throw;
+				}
+				return element;
+			}
+
+			case NT_Text : {
+				bool cdata = m_r.uint8() != 0;
+				TiXmlText * text = new TiXmlText(m_r.string());
+				text->SetCDATA(cdata);
+				return text;
+			}
+
+			case NT_NumberText : {
+				// values are kept in the text node, readers take them via TiXmlElement::GetNumbers() and
+				// the text is only composed if requested
+				std::unique_ptr<TiXmlNumberText> numText(new TiXmlNumberText);
+				std::uint32_t count = m_r.uint32();
+				numText->precision = (int)m_r.uint8();
+				numText->leading = m_r.string();
+				numText->trailing = m_r.string();
+				numText->separators.resize(m_r.uint8());
+				for (std::string & s : numText->separators)
+					s = m_r.string();
+				if (numText->separators.empty() || count == 0 || numText->precision == 0 || m_numbers.size() - m_numberPos < count)
+					throw IBK::Exception("Invalid number text, binary container file is corrupt.", FUNC_ID);
+				numText->values.assign(m_numbers.begin() + m_numberPos, m_numbers.begin() + m_numberPos + count);
+				m_numberPos += count;
+				return new TiXmlText(numText.release());
+			}
+
+			case NT_Comment : {
+				TiXmlComment * comment = new TiXmlComment;
+				comment->SetValue(m_r.string());
+				return comment;
+			}
+
+			case NT_Declaration : {
+				std::string version = m_r.string();
+				std::string encoding = m_r.string();
+				std::string standalone = m_r.string();
+				return new TiXmlDeclaration(version, encoding, standalone);
+			}
+
+			default:
+				throw IBK::Exception(IBK::FormatString("Unknown node type %1, binary container file is corrupt.").arg(type), FUNC_ID);
+		}
+	}
+
+private:
+	const std::string & name() {
+		FUNCID(NANDRAD::readBinaryContainer);
+		std::uint32_t idx = m_r.uint32();
+		if (idx >= m_names.size())
+			throw IBK::Exception("Invalid name index, binary container file is corrupt.", FUNC_ID);
+		return m_names[idx];
+	}
+
+	ContainerReader					&m_r;
+	const std::vector<std::string>	&m_names;
+	const std::vector<double>		&m_numbers;
+	std::size_t						m_numberPos = 0;
+};
+
+
+// *** Public functions ***
+
+bool isBinaryContainer(const IBK::Path & fname) {
+	std::ifstream in;
+	if (!IBK::open_ifstream(in, fname, std::ios_base::binary))
+		return false;
+	char sig[sizeof(BINARY_CONTAINER_SIGNATURE)];
+	if (!in.read(sig, sizeof(sig)))
+		return false;
+	return std::memcmp(sig, BINARY_CONTAINER_SIGNATURE, sizeof(sig)) == 0;
+}
+
+
+void writeBinaryContainer(const TiXmlDocument & doc, const IBK::Path & fname, bool compress) {
+	FUNCID(NANDRAD::writeBinaryContainer);
+
+	ContainerWriter writer;
+	writer.writeChildren(&doc);
+
+	std::string buf(BINARY_CONTAINER_SIGNATURE, sizeof(BINARY_CONTAINER_SIGNATURE));
+	appendUInt32(buf, BINARY_CONTAINER_VERSION);
+	appendUInt32(buf, 0);
+	appendSection(buf, SID_Names, writer.namesSection());
+	appendSection(buf, SID_Numbers, writer.numbersSection(compress));
+	appendSection(buf, SID_Tree, writer.m_tree);
+
+	std::ofstream out;
+	if (!IBK::open_ofstream(out, fname, std::ios_base::binary | std::ios_base::trunc))
+		throw IBK::Exception(IBK::FormatString("Cannot open file '%1' for writing.").arg(fname), FUNC_ID);
+	if (!out.write(buf.data(), (std::streamsize)buf.size()))
+		throw IBK::Exception(IBK::FormatString("Error writing file '%1'.").arg(fname), FUNC_ID);
+}
+
+
+void readBinaryContainer(const IBK::Path & fname, TiXmlDocument & doc) {
+	FUNCID(NANDRAD::readBinaryContainer);
+
+	std::ifstream in;
+	if (!IBK::open_ifstream(in, fname, std::ios_base::binary))
+		throw IBK::Exception(IBK::FormatString("Cannot open file '%1' for reading.").arg(fname), FUNC_ID);
+	std::string buf((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+	try {
+		ContainerReader r(buf.data(), buf.data() + buf.size());
+		if (buf.size() < sizeof(BINARY_CONTAINER_SIGNATURE) ||
+			std::memcmp(r.skip(sizeof(BINARY_CONTAINER_SIGNATURE)), BINARY_CONTAINER_SIGNATURE, sizeof(BINARY_CONTAINER_SIGNATURE)) != 0)
+		{
+			throw IBK::Exception("Missing binary container signature.", FUNC_ID);
+		}
+		std::uint32_t version = r.uint32();
+		if (version > BINARY_CONTAINER_VERSION)
+			throw IBK::Exception(IBK::FormatString("Unsupported binary container version %1.").arg(version), FUNC_ID);
+		r.uint32(); // flags
+
+		// locate sections, unknown sections are skipped
+		const char * sections[SID_Tree+1] = { nullptr };
+		std::uint64_t sectionSizes[SID_Tree+1] = { 0 };
+		while (!r.atEnd()) {
+			std::uint32_t id = r.uint32();
+			std::uint64_t size = r.uint64();
+			const char * data = r.skip(size);
+			if (id >= SID_Names && id <= SID_Tree) {
+				sections[id] = data;
+				sectionSizes[id] = size;
+			}
+		}
+		if (sections[SID_Names] == nullptr || sections[SID_Tree] == nullptr)
+			throw IBK::Exception("Missing sections in binary container file.", FUNC_ID);
+
+		std::vector<std::string> names;
+		ContainerReader namesReader(sections[SID_Names], sections[SID_Names] + sectionSizes[SID_Names]);
+		std::uint32_t nameCount = namesReader.uint32();
+		for (std::uint32_t i=0; i<nameCount; ++i)
+			names.push_back(namesReader.string());
+
+		std::vector<double> numbers;
+		if (sections[SID_Numbers] != nullptr) {
+			ContainerReader numbersReader(sections[SID_Numbers], sections[SID_Numbers] + sectionSizes[SID_Numbers]);
+			decodeNumbers(numbersReader, numbers);
+		}
+
+		ContainerReader treeReader(sections[SID_Tree], sections[SID_Tree] + sectionSizes[SID_Tree]);
+		TreeReader tree(treeReader, names, numbers);
+		tree.readChildren(&doc);
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception(ex, IBK::FormatString("Error reading binary container file '%1'.").arg(fname), FUNC_ID);
+	}
+}
+
+} // namespace NANDRAD
@@ -0,0 +1,82 @@
+/*	The NANDRAD data model library.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NANDRAD_BinaryContainerH
+#define NANDRAD_BinaryContainerH
+
+class TiXmlDocument;
+
+namespace IBK {
+	class Path;
+}
+
+namespace NANDRAD {
+
+/*! Returns true, if the file starts with the signature of the binary container format.
+	Returns false for XML files and files that cannot be opened.
+*/
+bool isBinaryContainer(const IBK::Path & fname);
+
+/*! Writes an XML document (as composed by the generated writeXML() functions) into a binary container file.
+
+	The binary container is an alternative to the XML text file for NANDRAD projects. It stores the
+	document tree, so that the generated read/write code can be used unchanged and reading a container gives
+	the same document as reading the XML file.
+
+	File layout (all numbers are stored in little-endian byte order):
+	\code
+	"NDRBIN\r\n"			file signature, 8 bytes
+	uint32					format version
+	uint32					flags (currently unused, 0)
+	section*				sequence of sections until end of file
+	\endcode
+
+	Each section starts with an uint32 section ID and an uint64 section size in bytes, so that readers can
+	skip unknown sections. The following sections are written:
+
+	- names: table of all element and attribute names, referenced by index in the tree section
+	- numbers: values of all numeric element texts as raw double array, optionally compressed
+	- tree: the document nodes (elements with attributes, texts, comments, declaration)
+
+	Element texts with lists of numbers (vertexes, spline and table values, ...) are stored as numbers, if the
+	text can be restored exactly from the values (same number formatting and separators), otherwise the text
+	is stored unmodified.
+
+	If compress is true, the bytes of the number section are regrouped by significance (all sign/exponent bytes
+	first, last mantissa bytes last) and run-length encoded, which reduces the size of typical geometry data.
+
+	Throws an IBK::Exception in case of error.
+*/
+void writeBinaryContainer(const TiXmlDocument & doc, const IBK::Path & fname, bool compress);
+
+/*! Reads a binary container file written by writeBinaryContainer() into an (empty) XML document.
+	Element texts stored as numbers are kept as values in the text nodes (see TiXmlNumberText). Number readers
+	take them via TiXmlElement::GetNumbers(), the text is only composed when GetText() is called.
+	\note Elements read from binary containers do not have row/column information, so error messages
+		  will refer to line 0.
+
+	Throws an IBK::Exception in case of error.
+*/
+void readBinaryContainer(const IBK::Path & fname, TiXmlDocument & doc);
+
+} // namespace NANDRAD
+
+#endif // NANDRAD_BinaryContainerH
@@ -33,6 +33,7 @@ bool ConstructionType::operator!=(const ConstructionType & other) const {
 	if (m_id != other.m_id) return true;
 	if (m_displayName != other.m_displayName) return true;
 	if (m_materialLayers != other.m_materialLayers) return true;
+	if (m_reducedModeCount != other.m_reducedModeCount) return true;
 	return  false;
 }
 
@@ -60,6 +61,14 @@ void ConstructionType::checkParameters(const std::vector<Material> & materials)
 	if (m_activeLayerIndex != NANDRAD::INVALID_ID && m_activeLayerIndex >= m_materialLayers.size())
 		throw IBK::Exception( IBK::FormatString("Active layer index %1 exceeds number of material layers (%2). Mind: layer index is zero-based!")
 							  .arg(m_activeLayerIndex).arg(m_materialLayers.size()), FUNC_ID);
+
+	// check settings for reduced construction model
+	if (m_reducedModeCount != NANDRAD::INVALID_ID) {
+		if (m_reducedModeCount < 2)
+			throw IBK::Exception( IBK::FormatString("Reduced mode count must be at least 2."), FUNC_ID);
+		if (m_activeLayerIndex != NANDRAD::INVALID_ID)
+			throw IBK::Exception( IBK::FormatString("Reduced construction model cannot be used for constructions with active layer."), FUNC_ID);
+	}
 }
 
 } // namespace NANDRAD
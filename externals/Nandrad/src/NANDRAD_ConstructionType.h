@@ -54,6 +54,10 @@ public:
 
 	/*! Optional active layer index (use INVALID_ID to disable). */
 	unsigned int				m_activeLayerIndex = INVALID_ID;		// XML:E
+	/*! Optional number of modes used in a reduced construction model (use INVALID_ID to calculate
+		with the full finite-volume grid). Must be at least 2 and cannot be combined with an active layer.
+	*/
+	unsigned int				m_reducedModeCount = INVALID_ID;		// XML:E
 	/*! IBK-language encoded name of construction. */
 	std::string					m_displayName;							// XML:A
 
@@ -24,6 +24,8 @@
 #include <map>
 #include <limits>
 #include <iostream>
+#include <algorithm>
+#include <cstring>
 
 #include <IBK_FormatString.h>
 #include <IBK_Exception.h>
@@ -123,678 +125,152 @@ namespace NANDRAD {
 		"Zone::para_t"
 	};
 
-	/*! Converts a category string to respective enumeration value. */
-	int enum2index(const std::string & enumtype) {
-		for (int i=0; i<86; ++i) {
-			if (enumtype == ENUM_TYPES[i]) return i;
-		}
-		//std::cerr << "Unknown enumeration type '" << enumtype<< "'." << std::endl;
-		return -1;
-	}
-	
-
-	/*! Returns a keyword string for a given category (typenum) and type number t. */
-	const char * theKeyword(int typenum, int t) {
-		switch (typenum) {
-			// ConstructionInstance::para_t
-			case 0 :
-			switch (t) {
-				case 0 : return "Orientation";
-				case 1 : return "Inclination";
-				case 2 : return "Area";
-			} break;
-			// DailyCycle::interpolation_t
-			case 1 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "Linear";
-			} break;
-			// EmbeddedObject::para_t
-			case 2 :
-			switch (t) {
-				case 0 : return "Area";
-			} break;
-			// EmbeddedObject::objectType_t
-			case 3 :
-			switch (t) {
-				case 0 : return "Window";
-				case 1 : return "Door";
-				case 2 : return "Hole";
-			} break;
-			// HVACControlModel::modelType_t
-			case 4 :
-			switch (t) {
-				case 0 : return "Heating";
-			} break;
-			// HVACControlModel::OperatingMode
-			case 5 :
-			switch (t) {
-				case 0 : return "Parallel";
-			} break;
-			// HydraulicFluid::para_t
-			case 6 :
-			switch (t) {
-				case 0 : return "Density";
-				case 1 : return "HeatCapacity";
-				case 2 : return "Conductivity";
-			} break;
-			// HydraulicNetwork::ModelType
-			case 7 :
-			switch (t) {
-				case 0 : return "HydraulicNetwork";
-				case 1 : return "ThermalHydraulicNetwork";
-				case 2 : return "AirNetwork";
-			} break;
-			// HydraulicNetwork::para_t
-			case 8 :
-			switch (t) {
-				case 0 : return "DefaultFluidTemperature";
-				case 1 : return "InitialFluidTemperature";
-				case 2 : return "ReferencePressure";
-			} break;
-			// HydraulicNetworkComponent::ModelType
-			case 9 :
-			switch (t) {
-				case 0 : return "SimplePipe";
-				case 1 : return "DynamicPipe";
-				case 2 : return "ConstantPressurePump";
-				case 3 : return "ConstantMassFluxPump";
-				case 4 : return "ControlledPump";
-				case 5 : return "VariablePressurePump";
-				case 6 : return "HeatExchanger";
-				case 7 : return "HeatPumpVariableIdealCarnotSourceSide";
-				case 8 : return "HeatPumpVariableIdealCarnotSupplySide";
-				case 9 : return "HeatPumpVariableSourceSide";
-				case 10 : return "HeatPumpOnOffSourceSide";
-				case 11 : return "ControlledValve";
-				case 12 : return "ConstantPressureLossValve";
-				case 13 : return "IdealHeaterCooler";
-				case 14 : return "PressureLossElement";
-			} break;
-			// HydraulicNetworkComponent::para_t
-			case 10 :
-			switch (t) {
-				case 0 : return "HydraulicDiameter";
-				case 1 : return "PressureLossCoefficient";
-				case 2 : return "PressureHead";
-				case 3 : return "MassFlux";
-				case 4 : return "PumpMaximumEfficiency";
-				case 5 : return "FractionOfMotorInefficienciesToFluidStream";
-				case 6 : return "MaximumPressureHead";
-				case 7 : return "PumpMaximumElectricalPower";
-				case 8 : return "DesignPressureHead";
-				case 9 : return "DesignMassFlux";
-				case 10 : return "PressureHeadReductionFactor";
-				case 11 : return "Volume";
-				case 12 : return "PipeMaxDiscretizationWidth";
-				case 13 : return "CarnotEfficiency";
-				case 14 : return "MaximumHeatingPower";
-				case 15 : return "MaximumCoolingPower";
-				case 16 : return "PressureLoss";
-				case 17 : return "MinimumOutletTemperature";
-				case 18 : return "HeatingPowerB0W35";
-				case 19 : return "HeatingBufferSupplyTemperature";
-				case 20 : return "HeatingBufferReturnTemperature";
-				case 21 : return "DHWBufferSupplyTemperature";
-				case 22 : return "DHWBufferReturnTemperature";
-				case 23 : return "HeatingBufferVolume";
-				case 24 : return "DHWBufferVolume";
-			} break;
-			// HydraulicNetworkControlElement::ModelType
-			case 11 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "Scheduled";
-			} break;
-			// HydraulicNetworkControlElement::ControlledProperty
-			case 12 :
-			switch (t) {
-				case 0 : return "TemperatureDifference";
-				case 1 : return "TemperatureDifferenceOfFollowingElement";
-				case 2 : return "ThermostatValue";
-				case 3 : return "MassFlux";
-				case 4 : return "PumpOperation";
-				case 5 : return "PressureDifferenceWorstpoint";
-			} break;
-			// HydraulicNetworkControlElement::ControllerType
-			case 13 :
-			switch (t) {
-				case 0 : return "PController";
-				case 1 : return "PIController";
-				case 2 : return "PIDController";
-				case 3 : return "OnOffController";
-			} break;
-			// HydraulicNetworkControlElement::para_t
-			case 14 :
-			switch (t) {
-				case 0 : return "Kp";
-				case 1 : return "Ki";
-				case 2 : return "Kd";
-				case 3 : return "TemperatureDifferenceSetpoint";
-				case 4 : return "MassFluxSetpoint";
-				case 5 : return "HeatLossOfFollowingElementThreshold";
-				case 6 : return "RelControllerErrorForIntegratorReset";
-				case 7 : return "PressureDifferenceSetpoint";
-			} break;
-			// HydraulicNetworkControlElement::References
-			case 15 :
-			switch (t) {
-				case 0 : return "ThermostatZoneId";
-			} break;
-			// HydraulicNetworkElement::para_t
-			case 16 :
-			switch (t) {
-				case 0 : return "Length";
-			} break;
-			// HydraulicNetworkElement::intPara_t
-			case 17 :
-			switch (t) {
-				case 0 : return "NumberParallelPipes";
-				case 1 : return "NumberParallelElements";
-			} break;
-			// HydraulicNetworkHeatExchange::ModelType
-			case 18 :
-			switch (t) {
-				case 0 : return "TemperatureConstant";
-				case 1 : return "TemperatureSpline";
-				case 2 : return "TemperatureSplineEvaporator";
-				case 3 : return "TemperatureZone";
-				case 4 : return "TemperatureConstructionLayer";
-				case 5 : return "HeatLossConstant";
-				case 6 : return "HeatLossSpline";
-				case 7 : return "HeatLossSplineCondenser";
-				case 8 : return "HeatingDemandSpaceHeating";
-			} break;
-			// HydraulicNetworkHeatExchange::para_t
-			case 19 :
-			switch (t) {
-				case 0 : return "Temperature";
-				case 1 : return "HeatLoss";
-				case 2 : return "ExternalHeatTransferCoefficient";
-			} break;
-			// HydraulicNetworkHeatExchange::splinePara_t
-			case 20 :
-			switch (t) {
-				case 0 : return "Temperature";
-				case 1 : return "HeatLoss";
-			} break;
-			// HydraulicNetworkHeatExchange::References
-			case 21 :
-			switch (t) {
-				case 0 : return "ZoneId";
-				case 1 : return "ConstructionInstanceId";
-			} break;
-			// HydraulicNetworkPipeProperties::para_t
-			case 22 :
-			switch (t) {
-				case 0 : return "PipeRoughness";
-				case 1 : return "PipeInnerDiameter";
-				case 2 : return "PipeOuterDiameter";
-				case 3 : return "UValueWall";
-				case 4 : return "HeatCapacityWall";
-				case 5 : return "DensityWall";
-			} break;
-			// IdealHeatingCoolingModel::para_t
-			case 23 :
-			switch (t) {
-				case 0 : return "MaxHeatingPowerPerArea";
-				case 1 : return "MaxCoolingPowerPerArea";
-				case 2 : return "Kp";
-				case 3 : return "Ki";
-			} break;
-			// IdealPipeRegisterModel::modelType_t
-			case 24 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "Scheduled";
-			} break;
-			// IdealPipeRegisterModel::para_t
-			case 25 :
-			switch (t) {
-				case 0 : return "SupplyTemperature";
-				case 1 : return "MaxMassFlux";
-				case 2 : return "PipeLength";
-				case 3 : return "PipeInnerDiameter";
-				case 4 : return "UValuePipeWall";
-			} break;
-			// IdealPipeRegisterModel::intPara_t
-			case 26 :
-			switch (t) {
-				case 0 : return "NumberParallelPipes";
-			} break;
-			// IdealSurfaceHeatingCoolingModel::para_t
-			case 27 :
-			switch (t) {
-				case 0 : return "MaxHeatingPowerPerArea";
-				case 1 : return "MaxCoolingPowerPerArea";
-			} break;
-			// InterfaceAirFlow::splinePara_t
-			case 28 :
-			switch (t) {
-				case 0 : return "PressureCoefficient";
-			} break;
-			// InterfaceAirFlow::modelType_t
-			case 29 :
-			switch (t) {
-				case 0 : return "WindFlow";
-			} break;
-			// InterfaceHeatConduction::modelType_t
-			case 30 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "None";
-			} break;
-			// InterfaceHeatConduction::para_t
-			case 31 :
-			switch (t) {
-				case 0 : return "HeatTransferCoefficient";
-			} break;
-			// InterfaceLongWaveEmission::modelType_t
-			case 32 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "None";
-			} break;
-			// InterfaceLongWaveEmission::para_t
-			case 33 :
-			switch (t) {
-				case 0 : return "Emissivity";
-			} break;
-			// InterfaceSolarAbsorption::modelType_t
-			case 34 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "None";
-			} break;
-			// InterfaceSolarAbsorption::para_t
-			case 35 :
-			switch (t) {
-				case 0 : return "AbsorptionCoefficient";
-			} break;
-			// InterfaceVaporDiffusion::para_t
-			case 36 :
-			switch (t) {
-				case 0 : return "VaporTransferCoefficient";
-			} break;
-			// InterfaceVaporDiffusion::modelType_t
-			case 37 :
-			switch (t) {
-				case 0 : return "Constant";
-			} break;
-			// InternalLoadsModel::modelType_t
-			case 38 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "Scheduled";
-			} break;
-			// InternalLoadsModel::para_t
-			case 39 :
-			switch (t) {
-				case 0 : return "EquipmentRadiationFraction";
-				case 1 : return "PersonRadiationFraction";
-				case 2 : return "LightingRadiationFraction";
-				case 3 : return "EquipmentHeatLoadPerArea";
-				case 4 : return "PersonHeatLoadPerArea";
-				case 5 : return "LightingHeatLoadPerArea";
-			} break;
-			// InternalMoistureLoadsModel::modelType_t
-			case 40 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "Scheduled";
-			} break;
-			// InternalMoistureLoadsModel::para_t
-			case 41 :
-			switch (t) {
-				case 0 : return "MoistureLoadPerArea";
-			} break;
-			// Interval::para_t
-			case 42 :
-			switch (t) {
-				case 0 : return "Start";
-				case 1 : return "End";
-				case 2 : return "StepSize";
-			} break;
-			// KeywordList::MyParameters
-			case 43 :
-			switch (t) {
-				case 0 : return "Temperature";
-				case 1 : return "Mass";
-			} break;
-			// LinearSplineParameter::interpolationMethod_t
-			case 44 :
-			switch (t) {
-				case 0 : return "constant";
-				case 1 : return "linear";
-			} break;
-			// LinearSplineParameter::wrapMethod_t
-			case 45 :
-			switch (t) {
-				case 0 : return "continuous";
-				case 1 : return "cyclic";
-			} break;
-			// Location::para_t
-			case 46 :
-			switch (t) {
-				case 0 : return "Latitude";
-				case 1 : return "Longitude";
-				case 2 : return "Albedo";
-				case 3 : return "Altitude";
-			} break;
-			// Location::flag_t
-			case 47 :
-			switch (t) {
-				case 0 : return "PerezDiffuseRadiationModel";
-				case 1 : return "ContinuousShadingFactorData";
-			} break;
-			// Material::para_t
-			case 48 :
-			switch (t) {
-				case 0 : return "Density";
-				case 1 : return "HeatCapacity";
-				case 2 : return "Conductivity";
-			} break;
-			// ModelInputReference::referenceType_t
-			case 49 :
-			switch (t) {
-				case 0 : return "Location";
-				case 1 : return "Zone";
-				case 2 : return "ConstructionInstance";
-				case 3 : return "EmbeddedObject";
-				case 4 : return "Schedule";
-				case 5 : return "Model";
-				case 6 : return "Network";
-				case 7 : return "NetworkElement";
-			} break;
-			// NaturalVentilationModel::modelType_t
-			case 50 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "Scheduled";
-				case 2 : return "ScheduledWithBaseACR";
-				case 3 : return "ScheduledWithBaseACRDynamicTLimit";
-			} break;
-			// NaturalVentilationModel::para_t
-			case 51 :
-			switch (t) {
-				case 0 : return "VentilationRate";
-				case 1 : return "VentilationMaxAirTemperature";
-				case 2 : return "VentilationMinAirTemperature";
-				case 3 : return "MaxWindSpeed";
-			} break;
-			// OutputDefinition::timeType_t
-			case 52 :
-			switch (t) {
-				case 0 : return "None";
-				case 1 : return "Mean";
-				case 2 : return "Integral";
-			} break;
-			// Schedule::ScheduledDayType
-			case 53 :
-			switch (t) {
-				case 0 : return "AllDays";
-				case 1 : return "WeekDay";
-				case 2 : return "WeekEnd";
-				case 3 : return "Monday";
-				case 4 : return "Tuesday";
-				case 5 : return "Wednesday";
-				case 6 : return "Thursday";
-				case 7 : return "Friday";
-				case 8 : return "Saturday";
-				case 9 : return "Sunday";
-				case 10 : return "Holiday";
-			} break;
-			// Schedules::day_t
-			case 54 :
-			switch (t) {
-				case 0 : return "Mon";
-				case 1 : return "Tue";
-				case 2 : return "Wed";
-				case 3 : return "Thu";
-				case 4 : return "Fri";
-				case 5 : return "Sat";
-				case 6 : return "Sun";
-			} break;
-			// Schedules::flag_t
-			case 55 :
-			switch (t) {
-				case 0 : return "EnableCyclicSchedules";
-			} break;
-			// SerializationTest::test_t
-			case 56 :
-			switch (t) {
-				case 0 : return "X1";
-				case 1 : return "X2";
-			} break;
-			// SerializationTest::intPara_t
-			case 57 :
-			switch (t) {
-				case 0 : return "I1";
-				case 1 : return "I2";
-			} break;
-			// SerializationTest::splinePara_t
-			case 58 :
-			switch (t) {
-				case 0 : return "ParameterSet1";
-				case 1 : return "ParameterSet2";
-			} break;
-			// SerializationTest::ReferencedIDTypes
-			case 59 :
-			switch (t) {
-				case 0 : return "SomeStove";
-				case 1 : return "SomeOven";
-				case 2 : return "SomeHeater";
-				case 3 : return "SomeFurnace";
-			} break;
-			// ShadingControlModel::para_t
-			case 60 :
-			switch (t) {
-				case 0 : return "MaxIntensity";
-				case 1 : return "MinIntensity";
-			} break;
-			// SimulationParameter::para_t
-			case 61 :
-			switch (t) {
-				case 0 : return "InitialTemperature";
-				case 1 : return "InitialRelativeHumidity";
-				case 2 : return "DomesticWaterSensitiveHeatGainFraction";
-				case 3 : return "AirExchangeRateN50";
-				case 4 : return "ShieldingCoefficient";
-				case 5 : return "HeatingDesignAmbientTemperature";
-			} break;
-			// SimulationParameter::intPara_t
-			case 62 :
-			switch (t) {
-				case 0 : return "StartYear";
-			} break;
-			// SimulationParameter::flag_t
-			case 63 :
-			switch (t) {
-				case 0 : return "EnableMoistureBalance";
-				case 1 : return "EnableCO2Balance";
-				case 2 : return "EnableJointVentilation";
-				case 3 : return "ExportClimateDataFMU";
-			} break;
-			// SolarLoadsDistributionModel::distribution_t
-			case 64 :
-			switch (t) {
-				case 0 : return "AreaWeighted";
-				case 1 : return "SurfaceTypeFactor";
-				case 2 : return "ViewFactor";
-			} break;
-			// SolarLoadsDistributionModel::para_t
-			case 65 :
-			switch (t) {
-				case 0 : return "RadiationLoadFractionZone";
-				case 1 : return "RadiationLoadFractionFloor";
-				case 2 : return "RadiationLoadFractionCeiling";
-				case 3 : return "RadiationLoadFractionWalls";
-			} break;
-			// SolverParameter::para_t
-			case 66 :
-			switch (t) {
-				case 0 : return "RelTol";
-				case 1 : return "AbsTol";
-				case 2 : return "MaxTimeStep";
-				case 3 : return "MinTimeStep";
-				case 4 : return "InitialTimeStep";
-				case 5 : return "NonlinSolverConvCoeff";
-				case 6 : return "IterativeSolverConvCoeff";
-				case 7 : return "DiscMinDx";
-				case 8 : return "DiscStretchFactor";
-				case 9 : return "ViewfactorTileWidth";
-				case 10 : return "SurfaceDiscretizationDensity";
-				case 11 : return "ControlTemperatureTolerance";
-				case 12 : return "KinsolRelTol";
-				case 13 : return "KinsolAbsTol";
-				case 14 : return "HydraulicNetworkAbsTol";
-				case 15 : return "HydraulicNetworkMassFluxScale";
-			} break;
-			// SolverParameter::intPara_t
-			case 67 :
-			switch (t) {
-				case 0 : return "PreILUWidth";
-				case 1 : return "MaxKrylovDim";
-				case 2 : return "MaxNonlinIter";
-				case 3 : return "MaxOrder";
-				case 4 : return "KinsolMaxNonlinIter";
-				case 5 : return "DiscMaxElementsPerLayer";
-			} break;
-			// SolverParameter::flag_t
-			case 68 :
-			switch (t) {
-				case 0 : return "DetectMaxTimeStep";
-				case 1 : return "KinsolDisableLineSearch";
-				case 2 : return "KinsolStrictNewton";
-			} break;
-			// SolverParameter::integrator_t
-			case 69 :
-			switch (t) {
-				case 0 : return "CVODE";
-				case 1 : return "ExplicitEuler";
-				case 2 : return "ImplicitEuler";
-				case 3 : return "auto";
-			} break;
-			// SolverParameter::lesSolver_t
-			case 70 :
-			switch (t) {
-				case 0 : return "Dense";
-				case 1 : return "KLU";
-				case 2 : return "GMRES";
-				case 3 : return "BiCGStab";
-				case 4 : return "auto";
-			} break;
-			// SolverParameter::precond_t
-			case 71 :
-			switch (t) {
-				case 0 : return "ILU";
-				case 1 : return "auto";
-			} break;
-			// Thermostat::modelType_t
-			case 72 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "Scheduled";
-			} break;
-			// Thermostat::para_t
-			case 73 :
-			switch (t) {
-				case 0 : return "HeatingSetpoint";
-				case 1 : return "CoolingSetpoint";
-				case 2 : return "TemperatureTolerance";
-				case 3 : return "TemperatureBand";
-			} break;
-			// Thermostat::TemperatureType
-			case 74 :
-			switch (t) {
-				case 0 : return "AirTemperature";
-				case 1 : return "OperativeTemperature";
-			} break;
-			// Thermostat::ControllerType
-			case 75 :
-			switch (t) {
-				case 0 : return "Analog";
-				case 1 : return "Digital";
-			} break;
-			// WindowGlazingLayer::type_t
-			case 76 :
-			switch (t) {
-				case 0 : return "Gas";
-				case 1 : return "Glass";
-			} break;
-			// WindowGlazingLayer::para_t
-			case 77 :
-			switch (t) {
-				case 0 : return "Thickness";
-				case 1 : return "Conductivity";
-				case 2 : return "MassDensity";
-				case 3 : return "Height";
-				case 4 : return "Width";
-				case 5 : return "LongWaveEmissivityInside";
-				case 6 : return "P_LongWaveEmissivityOutside";
-			} break;
-			// WindowGlazingLayer::splinePara_t
-			case 78 :
-			switch (t) {
-				case 0 : return "ShortWaveTransmittance";
-				case 1 : return "ShortWaveReflectanceOutside";
-				case 2 : return "ShortWaveReflectanceInside";
-				case 3 : return "Conductivity";
-				case 4 : return "DynamicViscosity";
-				case 5 : return "HeatCapacity";
-			} break;
-			// WindowGlazingSystem::modelType_t
-			case 79 :
-			switch (t) {
-				case 0 : return "Simple";
-				case 1 : return "Detailed";
-			} break;
-			// WindowGlazingSystem::para_t
-			case 80 :
-			switch (t) {
-				case 0 : return "ThermalTransmittance";
-			} break;
-			// WindowGlazingSystem::splinePara_t
-			case 81 :
-			switch (t) {
-				case 0 : return "SHGC";
-			} break;
-			// WindowShading::modelType_t
-			case 82 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "Precomputed";
-				case 2 : return "Controlled";
-			} break;
-			// WindowShading::para_t
-			case 83 :
-			switch (t) {
-				case 0 : return "ReductionFactor";
-			} break;
-			// Zone::type_t
-			case 84 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "Scheduled";
-				case 2 : return "Active";
-				case 3 : return "Ground";
-			} break;
-			// Zone::para_t
-			case 85 :
-			switch (t) {
-				case 0 : return "Temperature";
-				case 1 : return "RelativeHumidity";
-				case 2 : return "CO2Concentration";
-				case 3 : return "Area";
-				case 4 : return "Volume";
-				case 5 : return "HeatCapacity";
-			} break;
-		} // switch
-		return INVALID_KEYWORD_INDEX_STRING;
+	/*! Holds the hashes of all enum types/categories (see KeywordList::CategoryHash()). */
+	const unsigned int ENUM_TYPE_HASHES[86] = {
+		11051402u, // ConstructionInstance::para_t
+		3094830849u, // DailyCycle::interpolation_t
+		3724324869u, // EmbeddedObject::para_t
+		3573732u, // EmbeddedObject::objectType_t
+		3951027721u, // HVACControlModel::modelType_t
+		3844704787u, // HVACControlModel::OperatingMode
+		1835644103u, // HydraulicFluid::para_t
+		46758837u, // HydraulicNetwork::ModelType
+		3396862925u, // HydraulicNetwork::para_t
+		2468028072u, // HydraulicNetworkComponent::ModelType
+		2457179814u, // HydraulicNetworkComponent::para_t
+		1496420048u, // HydraulicNetworkControlElement::ModelType
+		3083571740u, // HydraulicNetworkControlElement::ControlledProperty
+		2165334703u, // HydraulicNetworkControlElement::ControllerType
+		272500046u, // HydraulicNetworkControlElement::para_t
+		3580085609u, // HydraulicNetworkControlElement::References
+		3161978533u, // HydraulicNetworkElement::para_t
+		1635608508u, // HydraulicNetworkElement::intPara_t
+		3797964268u, // HydraulicNetworkHeatExchange::ModelType
+		1550721818u, // HydraulicNetworkHeatExchange::para_t
+		1679045435u, // HydraulicNetworkHeatExchange::splinePara_t
+		273178405u, // HydraulicNetworkHeatExchange::References
+		219123904u, // HydraulicNetworkPipeProperties::para_t
+		4269679569u, // IdealHeatingCoolingModel::para_t
+		4230438038u, // IdealPipeRegisterModel::modelType_t
+		2084987925u, // IdealPipeRegisterModel::para_t
+		3557626924u, // IdealPipeRegisterModel::intPara_t
+		1788975408u, // IdealSurfaceHeatingCoolingModel::para_t
+		1155136572u, // InterfaceAirFlow::splinePara_t
+		4069591494u, // InterfaceAirFlow::modelType_t
+		1263235890u, // InterfaceHeatConduction::modelType_t
+		2085903553u, // InterfaceHeatConduction::para_t
+		2078346770u, // InterfaceLongWaveEmission::modelType_t
+		1728456929u, // InterfaceLongWaveEmission::para_t
+		4204131886u, // InterfaceSolarAbsorption::modelType_t
+		2183876541u, // InterfaceSolarAbsorption::para_t
+		1698700344u, // InterfaceVaporDiffusion::para_t
+		2061779409u, // InterfaceVaporDiffusion::modelType_t
+		1320411256u, // InternalLoadsModel::modelType_t
+		3611357867u, // InternalLoadsModel::para_t
+		2184683354u, // InternalMoistureLoadsModel::modelType_t
+		3043349241u, // InternalMoistureLoadsModel::para_t
+		1294585361u, // Interval::para_t
+		3557163906u, // KeywordList::MyParameters
+		903214808u, // LinearSplineParameter::interpolationMethod_t
+		1597169446u, // LinearSplineParameter::wrapMethod_t
+		3422305311u, // Location::para_t
+		4164529375u, // Location::flag_t
+		2168334281u, // Material::para_t
+		1310696163u, // ModelInputReference::referenceType_t
+		609360880u, // NaturalVentilationModel::modelType_t
+		1849369715u, // NaturalVentilationModel::para_t
+		3215482783u, // OutputDefinition::timeType_t
+		3566200375u, // Schedule::ScheduledDayType
+		2953478270u, // Schedules::day_t
+		871970300u, // Schedules::flag_t
+		2608275196u, // SerializationTest::test_t
+		3852630849u, // SerializationTest::intPara_t
+		159889079u, // SerializationTest::splinePara_t
+		2072942974u, // SerializationTest::ReferencedIDTypes
+		176678870u, // ShadingControlModel::para_t
+		3658777892u, // SimulationParameter::para_t
+		1942302295u, // SimulationParameter::intPara_t
+		193753656u, // SimulationParameter::flag_t
+		2839927523u, // SolarLoadsDistributionModel::distribution_t
+		2292849863u, // SolarLoadsDistributionModel::para_t
+		628770772u, // SolverParameter::para_t
+		3826491207u, // SolverParameter::intPara_t
+		96591464u, // SolverParameter::flag_t
+		2833730587u, // SolverParameter::integrator_t
+		3442197627u, // SolverParameter::lesSolver_t
+		3949790197u, // SolverParameter::precond_t
+		1474625278u, // Thermostat::modelType_t
+		3805880781u, // Thermostat::para_t
+		4271933130u, // Thermostat::TemperatureType
+		1334605072u, // Thermostat::ControllerType
+		3722478699u, // WindowGlazingLayer::type_t
+		1539371397u, // WindowGlazingLayer::para_t
+		855588092u, // WindowGlazingLayer::splinePara_t
+		221473760u, // WindowGlazingSystem::modelType_t
+		367462819u, // WindowGlazingSystem::para_t
+		3130539690u, // WindowGlazingSystem::splinePara_t
+		3859026593u, // WindowShading::modelType_t
+		486790024u, // WindowShading::para_t
+		3697700668u, // Zone::type_t
+		3106604794u // Zone::para_t
+	};
+
+	/*! Collision-free hash table, maps ((hash*682147101u) >> 23) to category index (-1 for empty slots). */
+	const short ENUM_TYPE_HASH_TABLE[512] = {
+		-1,-1,-1,25,-1,-1,57,-1,-1,-1,-1,-1,-1,-1,18,75,
+		71,-1,-1,-1,51,-1,48,72,-1,-1,65,9,-1,-1,69,-1,
+		-1,8,-1,36,-1,43,-1,-1,17,41,-1,-1,3,20,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,60,-1,-1,-1,23,77,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,0,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,6,-1,-1,-1,-1,-1,-1,83,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,33,10,-1,5,-1,-1,-1,73,-1,
+		-1,-1,81,-1,-1,-1,-1,32,-1,-1,-1,-1,-1,-1,-1,-1,
+		79,-1,-1,-1,-1,-1,-1,56,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,37,-1,-1,-1,-1,14,-1,-1,39,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,12,-1,
+		74,-1,-1,-1,85,-1,-1,-1,-1,31,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,27,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,82,-1,-1,-1,-1,40,-1,-1,-1,-1,-1,-1,-1,
+		4,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,42,21,-1,-1,
+		-1,-1,-1,-1,76,-1,-1,-1,-1,-1,-1,-1,-1,-1,1,7,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,16,-1,-1,
+		-1,-1,50,49,-1,-1,-1,-1,-1,35,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,78,-1,52,-1,-1,-1,-1,-1,
+		46,-1,-1,-1,-1,-1,28,-1,30,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,55,-1,-1,-1,-1,-1,
+		-1,-1,59,62,-1,-1,-1,63,-1,54,-1,-1,-1,70,-1,-1,
+		45,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,38,58,-1,-1,-1,
+		-1,-1,66,15,26,-1,-1,-1,-1,-1,-1,-1,44,-1,-1,-1,
+		-1,-1,-1,-1,24,13,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,
+		80,-1,-1,-1,61,-1,-1,-1,64,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,19,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,29,-1,11,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,67,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,22,84,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,68,-1,53,47,-1,2,-1,-1
+	};
+
+	/*! Converts a category string to respective enumeration value. */
+	int enum2index(const char * const enumtype) {
+		int idx = ENUM_TYPE_HASH_TABLE[(KeywordList::CategoryHash(enumtype)*682147101u) >> 23];
+		if (idx != -1 && std::strcmp(enumtype, ENUM_TYPES[idx]) == 0)
+			return idx;
+		//std::cerr << "Unknown enumeration type '" << enumtype<< "'." << std::endl;
+		return -1;
 	}
+	
+	/*! Converts a category hash to respective enumeration value. */
+	int hash2index(unsigned int categoryHash) {
+		int idx = ENUM_TYPE_HASH_TABLE[(categoryHash*682147101u) >> 23];
+		if (idx != -1 && ENUM_TYPE_HASHES[idx] == categoryHash)
+			return idx;
+		return -1;
+	}
+	
 
-	/*! Returns all keywords including deprecated for a given category (typenum) and type number (t). */
-	const char * allKeywords(int typenum, int t) {
+	/*! Returns a keyword string for a given category (typenum) and type number t. */
+	const char * theKeyword(int typenum, int t) {
 		switch (typenum) {
 			// ConstructionInstance::para_t
 			case 0 :
@@ -1188,6 +664,8 @@ namespace NANDRAD {
 				case 0 : return "None";
 				case 1 : return "Mean";
 				case 2 : return "Integral";
+				case 3 : return "Minimum";
+				case 4 : return "Maximum";
 			} break;
 			// Schedule::ScheduledDayType
 			case 53 :
@@ -1274,6 +752,7 @@ namespace NANDRAD {
 				case 1 : return "EnableCO2Balance";
 				case 2 : return "EnableJointVentilation";
 				case 3 : return "ExportClimateDataFMU";
+				case 4 : return "ExactLongWaveRadiationExchange";
 			} break;
 			// SolarLoadsDistributionModel::distribution_t
 			case 64 :
@@ -1326,6 +805,7 @@ namespace NANDRAD {
 				case 0 : return "DetectMaxTimeStep";
 				case 1 : return "KinsolDisableLineSearch";
 				case 2 : return "KinsolStrictNewton";
+				case 3 : return "JacobianFreeNewtonKrylov";
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -1348,7 +828,8 @@ namespace NANDRAD {
 			case 71 :
 			switch (t) {
 				case 0 : return "ILU";
-				case 1 : return "auto";
+				case 1 : return "Block";
+				case 2 : return "auto";
 			} break;
 			// Thermostat::modelType_t
 			case 72 :
@@ -1453,6 +934,442 @@ namespace NANDRAD {
 		return INVALID_KEYWORD_INDEX_STRING;
 	}
 
+	/*! Entry in keyword table. */
+	struct KeywordTableEntry {
+		/*! Keyword (current or deprecated). */
+		const char *	keyword;
+		/*! Enumeration value. */
+		int				index;
+		/*! True if keyword is deprecated. */
+		bool			deprecated;
+	};
+
+	/*! All keywords including deprecated, sorted by keyword within each category. */
+	const KeywordTableEntry KEYWORD_TABLE[314] = {
+		// ConstructionInstance::para_t
+		{ "Area", 2, false },
+		{ "Inclination", 1, false },
+		{ "Orientation", 0, false },
+		// DailyCycle::interpolation_t
+		{ "Constant", 0, false },
+		{ "Linear", 1, false },
+		// EmbeddedObject::para_t
+		{ "Area", 0, false },
+		// EmbeddedObject::objectType_t
+		{ "Door", 1, false },
+		{ "Hole", 2, false },
+		{ "Window", 0, false },
+		// HVACControlModel::modelType_t
+		{ "Heating", 0, false },
+		// HVACControlModel::OperatingMode
+		{ "Parallel", 0, false },
+		// HydraulicFluid::para_t
+		{ "Conductivity", 2, false },
+		{ "Density", 0, false },
+		{ "HeatCapacity", 1, false },
+		// HydraulicNetwork::ModelType
+		{ "AirNetwork", 2, false },
+		{ "HydraulicNetwork", 0, false },
+		{ "ThermalHydraulicNetwork", 1, false },
+		// HydraulicNetwork::para_t
+		{ "DefaultFluidTemperature", 0, false },
+		{ "InitialFluidTemperature", 1, false },
+		{ "ReferencePressure", 2, false },
+		// HydraulicNetworkComponent::ModelType
+		{ "ConstantMassFluxPump", 3, false },
+		{ "ConstantPressureLossValve", 12, false },
+		{ "ConstantPressurePump", 2, false },
+		{ "ControlledPump", 4, false },
+		{ "ControlledValve", 11, false },
+		{ "DynamicPipe", 1, false },
+		{ "HeatExchanger", 6, false },
+		{ "HeatPumpOnOffSourceSide", 10, false },
+		{ "HeatPumpVariableIdealCarnotSourceSide", 7, false },
+		{ "HeatPumpVariableIdealCarnotSupplySide", 8, false },
+		{ "HeatPumpVariableSourceSide", 9, false },
+		{ "IdealHeaterCooler", 13, false },
+		{ "PressureLossElement", 14, false },
+		{ "SimplePipe", 0, false },
+		{ "VariablePressurePump", 5, false },
+		// HydraulicNetworkComponent::para_t
+		{ "CarnotEfficiency", 13, false },
+		{ "DHWBufferReturnTemperature", 22, false },
+		{ "DHWBufferSupplyTemperature", 21, false },
+		{ "DHWBufferVolume", 24, false },
+		{ "DesignMassFlux", 9, false },
+		{ "DesignPressureHead", 8, false },
+		{ "FractionOfMotorInefficienciesToFluidStream", 5, false },
+		{ "HeatingBufferReturnTemperature", 20, false },
+		{ "HeatingBufferSupplyTemperature", 19, false },
+		{ "HeatingBufferVolume", 23, false },
+		{ "HeatingPowerB0W35", 18, false },
+		{ "HydraulicDiameter", 0, false },
+		{ "MassFlux", 3, false },
+		{ "MaximumCoolingPower", 15, false },
+		{ "MaximumHeatingPower", 14, false },
+		{ "MaximumPressureHead", 6, false },
+		{ "MinimumOutletTemperature", 17, false },
+		{ "PipeMaxDiscretizationWidth", 12, false },
+		{ "PressureHead", 2, false },
+		{ "PressureHeadReductionFactor", 10, false },
+		{ "PressureLoss", 16, false },
+		{ "PressureLossCoefficient", 1, false },
+		{ "PumpMaximumEfficiency", 4, false },
+		{ "PumpMaximumElectricalPower", 7, false },
+		{ "Volume", 11, false },
+		// HydraulicNetworkControlElement::ModelType
+		{ "Constant", 0, false },
+		{ "Scheduled", 1, false },
+		// HydraulicNetworkControlElement::ControlledProperty
+		{ "MassFlux", 3, false },
+		{ "PressureDifferenceWorstpoint", 5, false },
+		{ "PumpOperation", 4, false },
+		{ "TemperatureDifference", 0, false },
+		{ "TemperatureDifferenceOfFollowingElement", 1, false },
+		{ "ThermostatValue", 2, false },
+		// HydraulicNetworkControlElement::ControllerType
+		{ "OnOffController", 3, false },
+		{ "PController", 0, false },
+		{ "PIController", 1, false },
+		{ "PIDController", 2, false },
+		// HydraulicNetworkControlElement::para_t
+		{ "HeatLossOfFollowingElementThreshold", 5, false },
+		{ "Kd", 2, false },
+		{ "Ki", 1, false },
+		{ "Kp", 0, false },
+		{ "MassFluxSetpoint", 4, false },
+		{ "PressureDifferenceSetpoint", 7, false },
+		{ "RelControllerErrorForIntegratorReset", 6, false },
+		{ "TemperatureDifferenceSetpoint", 3, false },
+		// HydraulicNetworkControlElement::References
+		{ "ThermostatZoneId", 0, false },
+		// HydraulicNetworkElement::para_t
+		{ "Length", 0, false },
+		// HydraulicNetworkElement::intPara_t
+		{ "NumberParallelElements", 1, false },
+		{ "NumberParallelPipes", 0, false },
+		// HydraulicNetworkHeatExchange::ModelType
+		{ "HeatLossConstant", 5, false },
+		{ "HeatLossSpline", 6, false },
+		{ "HeatLossSplineCondenser", 7, false },
+		{ "HeatingDemandSpaceHeating", 8, false },
+		{ "TemperatureConstant", 0, false },
+		{ "TemperatureConstructionLayer", 4, false },
+		{ "TemperatureSpline", 1, false },
+		{ "TemperatureSplineEvaporator", 2, false },
+		{ "TemperatureZone", 3, false },
+		// HydraulicNetworkHeatExchange::para_t
+		{ "ExternalHeatTransferCoefficient", 2, false },
+		{ "HeatLoss", 1, false },
+		{ "Temperature", 0, false },
+		// HydraulicNetworkHeatExchange::splinePara_t
+		{ "HeatLoss", 1, false },
+		{ "Temperature", 0, false },
+		// HydraulicNetworkHeatExchange::References
+		{ "ConstructionInstanceId", 1, false },
+		{ "ZoneId", 0, false },
+		// HydraulicNetworkPipeProperties::para_t
+		{ "DensityWall", 5, false },
+		{ "HeatCapacityWall", 4, false },
+		{ "PipeInnerDiameter", 1, false },
+		{ "PipeOuterDiameter", 2, false },
+		{ "PipeRoughness", 0, false },
+		{ "UValueWall", 3, false },
+		// IdealHeatingCoolingModel::para_t
+		{ "Ki", 3, false },
+		{ "Kp", 2, false },
+		{ "MaxCoolingPowerPerArea", 1, false },
+		{ "MaxHeatingPowerPerArea", 0, false },
+		// IdealPipeRegisterModel::modelType_t
+		{ "Constant", 0, false },
+		{ "Scheduled", 1, false },
+		// IdealPipeRegisterModel::para_t
+		{ "MaxMassFlux", 1, false },
+		{ "PipeInnerDiameter", 3, false },
+		{ "PipeLength", 2, false },
+		{ "SupplyTemperature", 0, false },
+		{ "UValuePipeWall", 4, false },
+		// IdealPipeRegisterModel::intPara_t
+		{ "NumberParallelPipes", 0, false },
+		// IdealSurfaceHeatingCoolingModel::para_t
+		{ "MaxCoolingPowerPerArea", 1, false },
+		{ "MaxHeatingPowerPerArea", 0, false },
+		// InterfaceAirFlow::splinePara_t
+		{ "PressureCoefficient", 0, false },
+		// InterfaceAirFlow::modelType_t
+		{ "WindFlow", 0, false },
+		// InterfaceHeatConduction::modelType_t
+		{ "Constant", 0, false },
+		{ "None", 1, false },
+		// InterfaceHeatConduction::para_t
+		{ "HeatTransferCoefficient", 0, false },
+		// InterfaceLongWaveEmission::modelType_t
+		{ "Constant", 0, false },
+		{ "None", 1, false },
+		// InterfaceLongWaveEmission::para_t
+		{ "Emissivity", 0, false },
+		// InterfaceSolarAbsorption::modelType_t
+		{ "Constant", 0, false },
+		{ "None", 1, false },
+		// InterfaceSolarAbsorption::para_t
+		{ "AbsorptionCoefficient", 0, false },
+		// InterfaceVaporDiffusion::para_t
+		{ "VaporTransferCoefficient", 0, false },
+		// InterfaceVaporDiffusion::modelType_t
+		{ "Constant", 0, false },
+		// InternalLoadsModel::modelType_t
+		{ "Constant", 0, false },
+		{ "Scheduled", 1, false },
+		// InternalLoadsModel::para_t
+		{ "EquipmentHeatLoadPerArea", 3, false },
+		{ "EquipmentRadiationFraction", 0, false },
+		{ "LightingHeatLoadPerArea", 5, false },
+		{ "LightingRadiationFraction", 2, false },
+		{ "PersonHeatLoadPerArea", 4, false },
+		{ "PersonRadiationFraction", 1, false },
+		// InternalMoistureLoadsModel::modelType_t
+		{ "Constant", 0, false },
+		{ "Scheduled", 1, false },
+		// InternalMoistureLoadsModel::para_t
+		{ "MoistureLoadPerArea", 0, false },
+		// Interval::para_t
+		{ "End", 1, false },
+		{ "Start", 0, false },
+		{ "StepSize", 2, false },
+		// KeywordList::MyParameters
+		{ "Mass", 1, false },
+		{ "Temperature", 0, false },
+		// LinearSplineParameter::interpolationMethod_t
+		{ "constant", 0, false },
+		{ "linear", 1, false },
+		// LinearSplineParameter::wrapMethod_t
+		{ "continuous", 0, false },
+		{ "cyclic", 1, false },
+		// Location::para_t
+		{ "Albedo", 2, false },
+		{ "Altitude", 3, false },
+		{ "Latitude", 0, false },
+		{ "Longitude", 1, false },
+		// Location::flag_t
+		{ "ContinuousShadingFactorData", 1, false },
+		{ "PerezDiffuseRadiationModel", 0, false },
+		// Material::para_t
+		{ "Conductivity", 2, false },
+		{ "Density", 0, false },
+		{ "HeatCapacity", 1, false },
+		// ModelInputReference::referenceType_t
+		{ "ConstructionInstance", 2, false },
+		{ "EmbeddedObject", 3, false },
+		{ "Location", 0, false },
+		{ "Model", 5, false },
+		{ "Network", 6, false },
+		{ "NetworkElement", 7, false },
+		{ "Schedule", 4, false },
+		{ "Zone", 1, false },
+		// NaturalVentilationModel::modelType_t
+		{ "Constant", 0, false },
+		{ "Scheduled", 1, false },
+		{ "ScheduledWithBaseACR", 2, false },
+		{ "ScheduledWithBaseACRDynamicTLimit", 3, false },
+		// NaturalVentilationModel::para_t
+		{ "MaxWindSpeed", 3, false },
+		{ "VentilationMaxAirTemperature", 1, false },
+		{ "VentilationMinAirTemperature", 2, false },
+		{ "VentilationRate", 0, false },
+		// OutputDefinition::timeType_t
+		{ "Integral", 2, false },
+		{ "Maximum", 4, false },
+		{ "Mean", 1, false },
+		{ "Minimum", 3, false },
+		{ "None", 0, false },
+		// Schedule::ScheduledDayType
+		{ "AllDays", 0, false },
+		{ "Friday", 7, false },
+		{ "Holiday", 10, false },
+		{ "Monday", 3, false },
+		{ "Saturday", 8, false },
+		{ "Sunday", 9, false },
+		{ "Thursday", 6, false },
+		{ "Tuesday", 4, false },
+		{ "Wednesday", 5, false },
+		{ "WeekDay", 1, false },
+		{ "WeekEnd", 2, false },
+		// Schedules::day_t
+		{ "Fri", 4, false },
+		{ "Mon", 0, false },
+		{ "Sat", 5, false },
+		{ "Sun", 6, false },
+		{ "Thu", 3, false },
+		{ "Tue", 1, false },
+		{ "Wed", 2, false },
+		// Schedules::flag_t
+		{ "EnableCyclicSchedules", 0, false },
+		// SerializationTest::test_t
+		{ "X1", 0, false },
+		{ "X2", 1, false },
+		// SerializationTest::intPara_t
+		{ "I1", 0, false },
+		{ "I2", 1, false },
+		// SerializationTest::splinePara_t
+		{ "ParameterSet1", 0, false },
+		{ "ParameterSet2", 1, false },
+		// SerializationTest::ReferencedIDTypes
+		{ "SomeFurnace", 3, false },
+		{ "SomeHeater", 2, false },
+		{ "SomeOven", 1, false },
+		{ "SomeStove", 0, false },
+		// ShadingControlModel::para_t
+		{ "MaxIntensity", 0, false },
+		{ "MinIntensity", 1, false },
+		// SimulationParameter::para_t
+		{ "AirExchangeRateN50", 3, false },
+		{ "DomesticWaterSensitiveHeatGainFraction", 2, false },
+		{ "HeatingDesignAmbientTemperature", 5, false },
+		{ "InitialRelativeHumidity", 1, false },
+		{ "InitialTemperature", 0, false },
+		{ "ShieldingCoefficient", 4, false },
+		// SimulationParameter::intPara_t
+		{ "StartYear", 0, false },
+		// SimulationParameter::flag_t
+		{ "EnableCO2Balance", 1, false },
+		{ "EnableJointVentilation", 2, false },
+		{ "EnableMoistureBalance", 0, false },
+		{ "ExactLongWaveRadiationExchange", 4, false },
+		{ "ExportClimateDataFMU", 3, false },
+		// SolarLoadsDistributionModel::distribution_t
+		{ "AreaWeighted", 0, false },
+		{ "SurfaceTypeFactor", 1, false },
+		{ "ViewFactor", 2, false },
+		// SolarLoadsDistributionModel::para_t
+		{ "RadiationLoadFractionCeiling", 2, false },
+		{ "RadiationLoadFractionFloor", 1, false },
+		{ "RadiationLoadFractionWalls", 3, false },
+		{ "RadiationLoadFractionZone", 0, false },
+		// SolverParameter::para_t
+		{ "AbsTol", 1, false },
+		{ "ControlTemperatureTolerance", 11, false },
+		{ "DiscMinDx", 7, false },
+		{ "DiscStretchFactor", 8, false },
+		{ "HydraulicNetworkAbsTol", 14, false },
+		{ "HydraulicNetworkMassFluxScale", 15, false },
+		{ "InitialTimeStep", 4, false },
+		{ "IterativeSolverConvCoeff", 6, false },
+		{ "KinsolAbsTol", 13, false },
+		{ "KinsolRelTol", 12, false },
+		{ "MaxTimeStep", 2, false },
+		{ "MinTimeStep", 3, false },
+		{ "NonlinSolverConvCoeff", 5, false },
+		{ "RelTol", 0, false },
+		{ "SurfaceDiscretizationDensity", 10, false },
+		{ "ViewfactorTileWidth", 9, false },
+		// SolverParameter::intPara_t
+		{ "DiscMaxElementsPerLayer", 5, false },
+		{ "KinsolMaxNonlinIter", 4, false },
+		{ "MaxKrylovDim", 1, false },
+		{ "MaxNonlinIter", 2, false },
+		{ "MaxOrder", 3, false },
+		{ "PreILUWidth", 0, false },
+		// SolverParameter::flag_t
+		{ "DetectMaxTimeStep", 0, false },
+		{ "JacobianFreeNewtonKrylov", 3, false },
+		{ "KinsolDisableLineSearch", 1, false },
+		{ "KinsolStrictNewton", 2, false },
+		// SolverParameter::integrator_t
+		{ "CVODE", 0, false },
+		{ "ExplicitEuler", 1, false },
+		{ "ImplicitEuler", 2, false },
+		{ "auto", 3, false },
+		// SolverParameter::lesSolver_t
+		{ "BiCGStab", 3, false },
+		{ "Dense", 0, false },
+		{ "GMRES", 2, false },
+		{ "KLU", 1, false },
+		{ "auto", 4, false },
+		// SolverParameter::precond_t
+		{ "Block", 1, false },
+		{ "ILU", 0, false },
+		{ "auto", 2, false },
+		// Thermostat::modelType_t
+		{ "Constant", 0, false },
+		{ "Scheduled", 1, false },
+		// Thermostat::para_t
+		{ "CoolingSetpoint", 1, false },
+		{ "HeatingSetpoint", 0, false },
+		{ "TemperatureBand", 3, false },
+		{ "TemperatureTolerance", 2, false },
+		// Thermostat::TemperatureType
+		{ "AirTemperature", 0, false },
+		{ "OperativeTemperature", 1, false },
+		// Thermostat::ControllerType
+		{ "Analog", 0, false },
+		{ "Digital", 1, false },
+		// WindowGlazingLayer::type_t
+		{ "Gas", 0, false },
+		{ "Glass", 1, false },
+		// WindowGlazingLayer::para_t
+		{ "Conductivity", 1, false },
+		{ "Height", 3, false },
+		{ "LongWaveEmissivityInside", 5, false },
+		{ "MassDensity", 2, false },
+		{ "P_LongWaveEmissivityOutside", 6, false },
+		{ "Thickness", 0, false },
+		{ "Width", 4, false },
+		// WindowGlazingLayer::splinePara_t
+		{ "Conductivity", 3, false },
+		{ "DynamicViscosity", 4, false },
+		{ "HeatCapacity", 5, false },
+		{ "ShortWaveReflectanceInside", 2, false },
+		{ "ShortWaveReflectanceOutside", 1, false },
+		{ "ShortWaveTransmittance", 0, false },
+		// WindowGlazingSystem::modelType_t
+		{ "Detailed", 1, false },
+		{ "Simple", 0, false },
+		// WindowGlazingSystem::para_t
+		{ "ThermalTransmittance", 0, false },
+		// WindowGlazingSystem::splinePara_t
+		{ "SHGC", 0, false },
+		// WindowShading::modelType_t
+		{ "Constant", 0, false },
+		{ "Controlled", 2, false },
+		{ "Precomputed", 1, false },
+		// WindowShading::para_t
+		{ "ReductionFactor", 0, false },
+		// Zone::type_t
+		{ "Active", 2, false },
+		{ "Constant", 0, false },
+		{ "Ground", 3, false },
+		{ "Scheduled", 1, false },
+		// Zone::para_t
+		{ "Area", 3, false },
+		{ "CO2Concentration", 2, false },
+		{ "HeatCapacity", 5, false },
+		{ "RelativeHumidity", 1, false },
+		{ "Temperature", 0, false },
+		{ "Volume", 4, false }
+	};
+
+	/*! Index of first keyword of each category in KEYWORD_TABLE, last value is the table size. */
+	const unsigned int KEYWORD_TABLE_OFFSETS[87] = {
+		0,3,5,6,9,10,11,14,17,20,35,60,62,68,72,80,
+		81,82,84,93,96,98,100,106,110,112,117,118,120,121,122,124,
+		125,127,128,130,131,132,133,135,141,143,144,147,149,151,153,157,
+		159,162,170,174,178,183,194,201,202,204,206,208,212,214,220,221,
+		226,229,233,249,255,259,263,268,271,273,277,279,281,283,290,296,
+		298,299,300,303,304,308,314
+	};
+
+	/*! Returns keyword table entry for given keyword in category with index typenum, or nullptr if not found. */
+	const KeywordTableEntry * findKeyword(int typenum, const std::string & kw) {
+		const KeywordTableEntry * first = KEYWORD_TABLE + KEYWORD_TABLE_OFFSETS[typenum];
+		const KeywordTableEntry * last = KEYWORD_TABLE + KEYWORD_TABLE_OFFSETS[typenum+1];
+		const char * const kwStr = kw.c_str();
+		first = std::lower_bound(first, last, kwStr,
+			[](const KeywordTableEntry & e, const char * k) { return std::strcmp(e.keyword, k) < 0; });
+		if (first != last && kw == first->keyword)
+			return first;
+		return nullptr;
+	}
+
 	const char * KeywordList::Description(const char * const enumtype, int t, bool * no_description) {
 		if (no_description != nullptr)
 			*no_description = false; // we are optimistic
@@ -1849,6 +1766,8 @@ namespace NANDRAD {
 				case 0 : return "Write values as calculated at output times.";
 				case 1 : return "Average values in time (mean value in output step).";
 				case 2 : return "Integrate values in time.";
+				case 3 : return "Minimum value in output step.";
+				case 4 : return "Maximum value in output step.";
 			} break;
 			// Schedule::ScheduledDayType
 			case 53 :
@@ -1935,6 +1854,7 @@ namespace NANDRAD {
 				case 1 : return "Flag activating CO2 balance calculation if enabled.";
 				case 2 : return "Flag activating ventilation through joints and openings.";
 				case 3 : return "Flag activating FMU export of climate data.";
+				case 4 : return "Flag activating exact gray-body radiosity method for inside long wave radiation exchange (instead of net exchange approximation).";
 			} break;
 			// SolarLoadsDistributionModel::distribution_t
 			case 64 :
@@ -1987,6 +1907,7 @@ namespace NANDRAD {
 				case 0 : return "Check schedules to determine minimum distances between steps and adjust MaxTimeStep.";
 				case 1 : return "Disable line search for steady state cycles.";
 				case 2 : return "Enable strict Newton for steady state cycles.";
+				case 3 : return "Use matrix-free Jacobian-vector products in iterative LES solvers and update preconditioner only when convergence degrades.";
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -2009,7 +1930,8 @@ namespace NANDRAD {
 			case 71 :
 			switch (t) {
 				case 0 : return "Incomplete LU preconditioner";
-				case 1 : return "Automatic selection of preconditioner";
+				case 1 : return "Block preconditioner with exact solution of construction blocks";
+				case 2 : return "Automatic selection of preconditioner";
 			} break;
 			// Thermostat::modelType_t
 			case 72 :
@@ -2509,6 +2431,8 @@ namespace NANDRAD {
 				case 0 : return "";
 				case 1 : return "";
 				case 2 : return "";
+				case 3 : return "";
+				case 4 : return "";
 			} break;
 			// Schedule::ScheduledDayType
 			case 53 :
@@ -2595,6 +2519,7 @@ namespace NANDRAD {
 				case 1 : return "";
 				case 2 : return "";
 				case 3 : return "";
+				case 4 : return "";
 			} break;
 			// SolarLoadsDistributionModel::distribution_t
 			case 64 :
@@ -2647,6 +2572,7 @@ namespace NANDRAD {
 				case 0 : return "";
 				case 1 : return "";
 				case 2 : return "";
+				case 3 : return "";
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -2670,6 +2596,7 @@ namespace NANDRAD {
 			switch (t) {
 				case 0 : return "";
 				case 1 : return "";
+				case 2 : return "";
 			} break;
 			// Thermostat::modelType_t
 			case 72 :
@@ -3169,6 +3096,8 @@ namespace NANDRAD {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
 				case 2 : return "#FFFFFF";
+				case 3 : return "#FFFFFF";
+				case 4 : return "#FFFFFF";
 			} break;
 			// Schedule::ScheduledDayType
 			case 53 :
@@ -3255,6 +3184,7 @@ namespace NANDRAD {
 				case 1 : return "#FFFFFF";
 				case 2 : return "#FFFFFF";
 				case 3 : return "#FFFFFF";
+				case 4 : return "#FFFFFF";
 			} break;
 			// SolarLoadsDistributionModel::distribution_t
 			case 64 :
@@ -3307,6 +3237,7 @@ namespace NANDRAD {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
 				case 2 : return "#FFFFFF";
+				case 3 : return "#FFFFFF";
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -3330,6 +3261,7 @@ namespace NANDRAD {
 			switch (t) {
 				case 0 : return "#FFFFFF";
 				case 1 : return "#FFFFFF";
+				case 2 : return "#FFFFFF";
 			} break;
 			// Thermostat::modelType_t
 			case 72 :
@@ -3829,6 +3761,8 @@ namespace NANDRAD {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
 				case 2 : return std::numeric_limits<double>::quiet_NaN();
+				case 3 : return std::numeric_limits<double>::quiet_NaN();
+				case 4 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// Schedule::ScheduledDayType
 			case 53 :
@@ -3915,6 +3849,7 @@ namespace NANDRAD {
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
 				case 2 : return std::numeric_limits<double>::quiet_NaN();
 				case 3 : return std::numeric_limits<double>::quiet_NaN();
+				case 4 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// SolarLoadsDistributionModel::distribution_t
 			case 64 :
@@ -3967,6 +3902,7 @@ namespace NANDRAD {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
 				case 2 : return std::numeric_limits<double>::quiet_NaN();
+				case 3 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// SolverParameter::integrator_t
 			case 69 :
@@ -3990,6 +3926,7 @@ namespace NANDRAD {
 			switch (t) {
 				case 0 : return std::numeric_limits<double>::quiet_NaN();
 				case 1 : return std::numeric_limits<double>::quiet_NaN();
+				case 2 : return std::numeric_limits<double>::quiet_NaN();
 			} break;
 			// Thermostat::modelType_t
 			case 72 :
@@ -4203,7 +4140,7 @@ namespace NANDRAD {
 			// NaturalVentilationModel::para_t
 			case 51 : return 4;
 			// OutputDefinition::timeType_t
-			case 52 : return 3;
+			case 52 : return 5;
 			// Schedule::ScheduledDayType
 			case 53 : return 11;
 			// Schedules::day_t
@@ -4225,7 +4162,7 @@ namespace NANDRAD {
 			// SimulationParameter::intPara_t
 			case 62 : return 1;
 			// SimulationParameter::flag_t
-			case 63 : return 4;
+			case 63 : return 5;
 			// SolarLoadsDistributionModel::distribution_t
 			case 64 : return 3;
 			// SolarLoadsDistributionModel::para_t
@@ -4235,13 +4172,13 @@ namespace NANDRAD {
 			// SolverParameter::intPara_t
 			case 67 : return 6;
 			// SolverParameter::flag_t
-			case 68 : return 3;
+			case 68 : return 4;
 			// SolverParameter::integrator_t
 			case 69 : return 4;
 			// SolverParameter::lesSolver_t
 			case 70 : return 5;
 			// SolverParameter::precond_t
-			case 71 : return 2;
+			case 71 : return 3;
 			// Thermostat::modelType_t
 			case 72 : return 2;
 			// Thermostat::para_t
@@ -4383,7 +4320,7 @@ namespace NANDRAD {
 			// NaturalVentilationModel::para_t
 			case 51 : return 3;
 			// OutputDefinition::timeType_t
-			case 52 : return 2;
+			case 52 : return 4;
 			// Schedule::ScheduledDayType
 			case 53 : return 10;
 			// Schedules::day_t
@@ -4405,7 +4342,7 @@ namespace NANDRAD {
 			// SimulationParameter::intPara_t
 			case 62 : return 0;
 			// SimulationParameter::flag_t
-			case 63 : return 3;
+			case 63 : return 4;
 			// SolarLoadsDistributionModel::distribution_t
 			case 64 : return 2;
 			// SolarLoadsDistributionModel::para_t
@@ -4415,13 +4352,13 @@ namespace NANDRAD {
 			// SolverParameter::intPara_t
 			case 67 : return 5;
 			// SolverParameter::flag_t
-			case 68 : return 2;
+			case 68 : return 3;
 			// SolverParameter::integrator_t
 			case 69 : return 3;
 			// SolverParameter::lesSolver_t
 			case 70 : return 4;
 			// SolverParameter::precond_t
-			case 71 : return 1;
+			case 71 : return 2;
 			// Thermostat::modelType_t
 			case 72 : return 1;
 			// Thermostat::para_t
@@ -4466,49 +4403,48 @@ namespace NANDRAD {
 
 	bool KeywordList::KeywordExists(const char * const enumtype, const std::string & kw) {
 		int typenum = enum2index(enumtype);
-		int i = 0;
-		int maxIndexInCategory = MaxIndex( enumtype ); 
-		for ( ; i <= maxIndexInCategory; ++i ) {
-			std::string keywords = allKeywords(typenum, i);
-			if (keywords == INVALID_KEYWORD_INDEX_STRING)
-				continue;
-			std::stringstream strm(keywords);
-			int j = 0;
-			std::string kws;
-			while (strm >> kws) {
-				if (kws == kw) {
-					return true; // keyword exists
-				}
-				++j;
-			}
-		}
-		return false; // nothing found keyword doesn't exist.
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type '%1'.")
+				.arg(enumtype), "[KeywordList::KeywordExists]");
+		return findKeyword(typenum, kw) != nullptr;
+	}
+
+	bool KeywordList::KeywordExists(unsigned int categoryHash, const std::string & kw) {
+		int typenum = hash2index(categoryHash);
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type hash '%1'.")
+				.arg(categoryHash), "[KeywordList::KeywordExists]");
+		return findKeyword(typenum, kw) != nullptr;
 	}
 
 	int KeywordList::Enumeration(const char * const enumtype, const std::string & kw, bool * deprecated) {
 		int typenum = enum2index(enumtype);
-		int i = 0;
-		int maxIndexInCategory = MaxIndex( enumtype ); 
-		for ( ; i <= maxIndexInCategory; ++i ) {
-			std::string keywords = allKeywords(typenum, i);
-			if (keywords == INVALID_KEYWORD_INDEX_STRING)
-				continue;
-			std::stringstream strm(keywords);
-			int j = 0;
-			std::string kws;
-			while (strm >> kws) {
-				if (kws == kw) {
-					if (deprecated != nullptr) {
-						*deprecated = (j != 0);
-					}
-					return i;
-				}
-				++j;
-			}
-		} // for ( ; i < maxIndexInCategory; ++i ) {
-		throw IBK::Exception(IBK::FormatString("Cannot determine enumeration value for "
-			"enumeration type '%1' and keyword '%2'.")
-			.arg(enumtype).arg(kw), "[KeywordList::Enumeration]");
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type '%1'.")
+				.arg(enumtype), "[KeywordList::Enumeration]");
+		const KeywordTableEntry * entry = findKeyword(typenum, kw);
+		if (entry == nullptr)
+			throw IBK::Exception(IBK::FormatString("Cannot determine enumeration value for "
+				"enumeration type '%1' and keyword '%2'.")
+				.arg(enumtype).arg(kw), "[KeywordList::Enumeration]");
+		if (deprecated != nullptr)
+			*deprecated = entry->deprecated;
+		return entry->index;
+	}
+
+	int KeywordList::Enumeration(unsigned int categoryHash, const std::string & kw, bool * deprecated) {
+		int typenum = hash2index(categoryHash);
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type hash '%1'.")
+				.arg(categoryHash), "[KeywordList::Enumeration]");
+		const KeywordTableEntry * entry = findKeyword(typenum, kw);
+		if (entry == nullptr)
+			throw IBK::Exception(IBK::FormatString("Cannot determine enumeration value for "
+				"enumeration type '%1' and keyword '%2'.")
+				.arg(ENUM_TYPES[typenum]).arg(kw), "[KeywordList::Enumeration]");
+		if (deprecated != nullptr)
+			*deprecated = entry->deprecated;
+		return entry->index;
 	}
 
 	bool KeywordList::CategoryExists(const char * const enumtype) {
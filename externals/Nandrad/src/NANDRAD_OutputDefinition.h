@@ -51,6 +51,10 @@ public:
 		OTT_MEAN,		// Keyword: Mean			'Average values in time (mean value in output step).'
 		/*! Time integral of output value. */
 		OTT_INTEGRAL,	// Keyword: Integral		'Integrate values in time.'
+		/*! Minimum value in last output interval (from values at all solver steps). */
+		OTT_MINIMUM,	// Keyword: Minimum			'Minimum value in output step.'
+		/*! Maximum value in last output interval (from values at all solver steps). */
+		OTT_MAXIMUM,	// Keyword: Maximum			'Maximum value in output step.'
 		NUM_OTT
 	};
 
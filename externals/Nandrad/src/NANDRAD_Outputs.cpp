@@ -28,6 +28,7 @@ bool Outputs::operator!=(const Outputs & other) const {
 	if (m_grids != other.m_grids) return true;
 	if (m_binaryFormat != other.m_binaryFormat) return true;
 	if (m_timeUnit != other.m_timeUnit) return true;
+	if (m_thinningTolerance != other.m_thinningTolerance) return true;
 
 	return false;
 }
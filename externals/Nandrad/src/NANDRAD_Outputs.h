@@ -27,6 +27,7 @@
 
 #include <IBK_Unit.h>
 #include <IBK_Flag.h>
+#include <IBK_Parameter.h>
 
 #include "NANDRAD_OutputGrid.h"
 #include "NANDRAD_OutputDefinition.h"
@@ -61,6 +62,13 @@ public:
 	/*! (optional) If true, output files are written in binary format (the default, if flag is missing). */
 	IBK::Flag									m_binaryFormat;				// XML:E
 
+	/*! (optional) Relative tolerance for thinning of output files.
+		If given and > 0, output rows are skipped when all their values can be reconstructed by linear
+		interpolation between the neighboring written rows with an error below this tolerance (relative to the
+		magnitude of the values). Peaks are thus always retained.
+	*/
+	IBK::Parameter								m_thinningTolerance;		// XML:E
+
 };
 
 
@@ -31,9 +31,23 @@
 #include <tinyxml.h>
 
 #include "NANDRAD_Utilities.h"
+#include "NANDRAD_BinaryContainer.h"
+#include "NANDRAD_XMLStreamReader.h"
 
 namespace NANDRAD {
 
+/*! Elements with lists of numbers (time series, table values), read directly into values. */
+static const std::set<std::string> NUMBER_LIST_ELEMENTS = {
+	"IBK:UnitVector", "X", "Y", "TimePoints", "Values", "DblVec"
+};
+
+/*! Collections of objects in the 'Project' element, read in batches. */
+static const std::set<std::string> COLLECTION_ELEMENTS = {
+	"Zones", "ConstructionInstances", "HydraulicNetworks", "ConstructionTypes", "Materials",
+	"WindowGlazingSystems", "ObjectLists"
+};
+
+
 
 /*! Test function that checks that all objects in the given vector have different m_id parameters. */
 template <typename T>
@@ -85,39 +99,39 @@ void checkForUniqueNames(const std::vector<T> & vec, const char * const typeIDSt
 void Project::readXML(const IBK::Path & filename) {
 	FUNCID(Project::readXML);
 
-	TiXmlDocument doc;
 	IBK::Path filenamePath(filename);
-	TiXmlElement * xmlElem = openXMLFile(m_placeholders, filenamePath, "NandradProject", doc);
-	if (!xmlElem)
+	XMLStreamReader reader;
+	reader.setNumberListElements(NUMBER_LIST_ELEMENTS);
+	if (!reader.open(filenamePath.withReplacedPlaceholders(m_placeholders), "NandradProject"))
 		return; // empty project, this means we are using only defaults
 
-	// we read our subsections from this handle
-	TiXmlHandle xmlRoot = TiXmlHandle(xmlElem);
-
-	// Directory Placeholders
-	xmlElem = xmlRoot.FirstChild("DirectoryPlaceholders").Element();
-	if (xmlElem) {
-		readDirectoryPlaceholdersXML(xmlElem);
-		// check for duplicate sections
-		xmlElem = xmlRoot.Child("DirectoryPlaceholders", 1).Element();
-		if (xmlElem != nullptr) {
-			throw IBK::Exception(IBK::FormatString("Duplicate section 'DirectoryPlaceholders'."), FUNC_ID);
+	bool havePlaceholders = false;
+	bool haveProject = false;
+	while (reader.readNextStartElement()) {
+		// Directory Placeholders
+		if (reader.name() == "DirectoryPlaceholders") {
+			if (havePlaceholders)
+				throw IBK::Exception(IBK::FormatString("Duplicate section 'DirectoryPlaceholders'."), FUNC_ID);
+			readDirectoryPlaceholdersXML(reader.readElement());
+			havePlaceholders = true;
+		}
+		else if (reader.name() == "Project" && !haveProject) {
+			try {
+				// sections are read one by one, large collections in batches of objects
+				reader.readSections(COLLECTION_ELEMENTS, [this](const TiXmlElement * e) { readXMLPrivate(e); });
+			}
+			catch (IBK::Exception & ex) {
+				throw IBK::Exception(ex, IBK::FormatString("Error reading project '%1'.").arg(filename), FUNC_ID);
+			}
+			haveProject = true;
 		}
+		else
+			reader.skipElement();
 	}
 
 	// add the project directory to the placeholders map
 	m_placeholders[IBK::PLACEHOLDER_PROJECT_DIR] = filenamePath.parentPath();
 
-	try {
-		xmlElem = xmlRoot.FirstChild("Project").Element();
-		if (xmlElem) {
-			readXMLPrivate(xmlElem);
-		}
-	}
-	catch (IBK::Exception & ex) {
-		throw IBK::Exception(ex, IBK::FormatString("Error reading project '%1'.").arg(filename), FUNC_ID);
-	}
-
 	// check uniqueness of all IDs in all separate id spaces
 	// Note: all objects in the ID-based object lists have an m_id data member. Hence, we can implement
 	//       the check in a template function.
@@ -196,6 +210,19 @@ void Project::readXML(const IBK::Path & filename) {
 
 void Project::writeXML(const IBK::Path & filename) const {
 	TiXmlDocument doc;
+	writeXMLDocument(doc);
+	doc.SaveFile( filename.c_str() );
+}
+
+
+void Project::writeBinary(const IBK::Path & filename, bool compress) const {
+	TiXmlDocument doc;
+	writeXMLDocument(doc);
+	writeBinaryContainer(doc, filename, compress);
+}
+
+
+void Project::writeXMLDocument(TiXmlDocument & doc) const {
 	TiXmlDeclaration * decl = new TiXmlDeclaration( "1.0", "UTF-8", "" );
 	doc.LinkEndChild( decl );
 
@@ -212,8 +239,6 @@ void Project::writeXML(const IBK::Path & filename) const {
 
 	writeDirectoryPlaceholdersXML(root);
 	writeXMLPrivate(root);
-
-	doc.SaveFile( filename.c_str() );
 }
 
 
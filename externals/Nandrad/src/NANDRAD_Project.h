@@ -44,6 +44,8 @@
 #include "NANDRAD_KeywordList.h"
 #include "NANDRAD_FMIDescription.h"
 
+class TiXmlDocument;
+
 /*! The namespace NANDRAD contains the data model classes that make up
 	the NANDRAD solver input data. The main class is NANDRAD::Project.
 */
@@ -58,7 +60,9 @@ public:
 
 	// *** PUBLIC MEMBER FUNCTIONS ***
 
-	/*! Reads the project data from an XML file.
+	/*! Reads the project data from an XML file (or binary container file).
+		The file is read with XMLStreamReader, sections of the 'Project' element are composed and read one at
+		a time and collections of objects in batches, so that the entire document is never held in memory.
 		\param filename  The full path to the project file.
 	*/
 	void readXML(const IBK::Path & filename);
@@ -68,6 +72,13 @@ public:
 	*/
 	void writeXML(const IBK::Path & filename) const;
 
+	/*! Writes the project file as binary container (see NANDRAD::writeBinaryContainer()).
+		Binary containers are detected automatically by readXML(), so the solver accepts both formats.
+		\param filename  The full path to the project file.
+		\param compress  If true, number data is compressed.
+	*/
+	void writeBinary(const IBK::Path & filename, bool compress = true) const;
+
 	/*! Initializes project defaults.
 		This function is called during solver run before readXML(). Hence, default values can be overwritten during
 		project file reading.
@@ -118,10 +129,10 @@ public:
 	std::vector<Zone>								m_zones;							// XML:E
 
 	/*! All construction instances refernce a construction and a thermal zone. */
-	std::vector<ConstructionInstance>				m_constructionInstances;			// XML:E
+	std::vector<ConstructionInstance>				m_constructionInstances;			// XML:E:parallel
 
 	/*! All hydraulic networks defined for this project. */
-	std::vector<HydraulicNetwork>					m_hydraulicNetworks;				// XML:E
+	std::vector<HydraulicNetwork>					m_hydraulicNetworks;				// XML:E:parallel
 
 	/*! All construction types reference construction parameters. */
 	std::vector<ConstructionType>					m_constructionTypes;				// XML:E
@@ -157,6 +168,8 @@ private:
 		\param parent The parent tag.
 	*/
 	void writeDirectoryPlaceholdersXML(TiXmlElement * parent) const;
+	/*! Composes the XML document with the entire project data, used by writeXML() and writeBinary(). */
+	void writeXMLDocument(TiXmlDocument & doc) const;
 
 };
 
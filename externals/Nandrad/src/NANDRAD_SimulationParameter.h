@@ -62,6 +62,7 @@ public:
 		F_EnableCO2Balance,							// Keyword: EnableCO2Balance							'Flag activating CO2 balance calculation if enabled.'
 		F_EnableJointVentilation,					// Keyword: EnableJointVentilation						'Flag activating ventilation through joints and openings.'
 		F_ExportClimateDataFMU,						// Keyword: ExportClimateDataFMU						'Flag activating FMU export of climate data.'
+		F_ExactLongWaveRadiationExchange,			// Keyword: ExactLongWaveRadiationExchange				'Flag activating exact gray-body radiosity method for inside long wave radiation exchange (instead of net exchange approximation).'
 		NUM_F
 	};
 
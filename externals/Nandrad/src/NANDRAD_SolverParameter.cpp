@@ -60,6 +60,7 @@ void SolverParameter::initDefaults() {
 
 	m_flag[F_DetectMaxTimeStep].set( KeywordList::Keyword("SolverParameter::flag_t", F_DetectMaxTimeStep), true );
 	m_flag[F_KinsolDisableLineSearch].set(KeywordList::Keyword("SolverParameter::flag_t", F_KinsolDisableLineSearch), false);
+	m_flag[F_JacobianFreeNewtonKrylov].set(KeywordList::Keyword("SolverParameter::flag_t", F_JacobianFreeNewtonKrylov), false);
 }
 
 
@@ -83,6 +83,8 @@ public:
 		F_DetectMaxTimeStep,				// Keyword: DetectMaxTimeStep			'Check schedules to determine minimum distances between steps and adjust MaxTimeStep.'
 		F_KinsolDisableLineSearch,			// Keyword: KinsolDisableLineSearch		'Disable line search for steady state cycles.'
 		F_KinsolStrictNewton,				// Keyword: KinsolStrictNewton			'Enable strict Newton for steady state cycles.'
+		/*! Use matrix-free J*v products in iterative LES solvers, Jacobian is only composed for the preconditioner. */
+		F_JacobianFreeNewtonKrylov,			// Keyword: JacobianFreeNewtonKrylov	'Use matrix-free Jacobian-vector products in iterative LES solvers and update preconditioner only when convergence degrades.'
 		NUM_F
 	};
 
@@ -108,6 +110,7 @@ public:
 	/*! Enumeration of available preconditioners, to be used with iterative LES solvers. */
 	enum precond_t {
 		PRE_ILU,						// Keyword: ILU							'Incomplete LU preconditioner'
+		PRE_Block,						// Keyword: Block						'Block preconditioner with exact solution of construction blocks'
 		NUM_PRE							// Keyword: auto						'Automatic selection of preconditioner'
 	};
 
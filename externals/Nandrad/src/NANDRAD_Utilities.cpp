@@ -31,6 +31,7 @@
 #include <IBK_Parameter.h>
 #include <IBK_IntPara.h>
 
+#include "NANDRAD_BinaryContainer.h"
 #include "NANDRAD_Constants.h"
 #include "NANDRAD_KeywordList.h"
 
@@ -47,7 +48,11 @@ TiXmlElement * openXMLFile(const std::map<std::string,IBK::Path> & pathPlaceHold
 		throw IBK::Exception(IBK::FormatString("File '%1' does not exist or cannot be opened for reading.")
 				.arg(fname), FUNC_ID);
 
-	if (!doc.LoadFile(fname.str().c_str(), TIXML_ENCODING_UTF8)) {
+	// binary container files are detected by their signature, regardless of file extension
+	if (isBinaryContainer(fname)) {
+		readBinaryContainer(fname, doc);
+	}
+	else if (!doc.LoadFile(fname.str().c_str(), TIXML_ENCODING_UTF8)) {
 		throw IBK::Exception(IBK::FormatString("Error in line %1 of project file '%2':\n%3")
 				.arg(doc.ErrorRow())
 				.arg(filename)
@@ -218,13 +223,18 @@ TiXmlElement * writeVector3D(TiXmlElement * parent, const std::string & name, co
 		TiXmlElement * child = new TiXmlElement(name);
 		parent->LinkEndChild(child);
 
-		std::stringstream vals;
+		// values are kept in the text node and only formatted when printed, gives "x1 y1 z1, x2 y2 z2, ..."
+		TiXmlNumberText * numText = new TiXmlNumberText;
+		numText->values.resize(3*vec.size());
 		for (unsigned int i=0; i<vec.size(); ++i) {
-			vals << vec[i].m_x << " " << vec[i].m_y << " " << vec[i].m_z;
-			if (i<vec.size()-1)  vals << ", ";
+			numText->values[i*3] = vec[i].m_x;
+			numText->values[i*3+1] = vec[i].m_y;
+			numText->values[i*3+2] = vec[i].m_z;
 		}
-		TiXmlText * text = new TiXmlText( vals.str() );
-		child->LinkEndChild( text );
+		numText->separators.push_back(" ");
+		numText->separators.push_back(" ");
+		numText->separators.push_back(", ");
+		child->LinkEndChild( new TiXmlText( numText ) );
 		return child;
 	}
 	return nullptr;
@@ -233,11 +243,14 @@ TiXmlElement * writeVector3D(TiXmlElement * parent, const std::string & name, co
 
 void readVector3D(const TiXmlElement * element, const std::string & name, std::vector<IBKMK::Vector3D> & vec) {
 	FUNCID(NANDRAD::readVector3D);
-	std::string text = element->GetText();
-	text = IBK::replace_string(text, ",", " ");
 	std::vector<double> vals;
 	try {
-		IBK::string2valueVector(text, vals);
+		// take values read from binary container directly, otherwise parse element text (comma or white-space separated)
+		const std::vector<double> * numbers = element->GetNumbers();
+		if (numbers != nullptr)
+			vals = *numbers;
+		else
+			IBK::string2valueVector(element->GetText(), vals, true);
 		// must have n*3 elements
 		if (vals.size() % 3 != 0)
 			throw IBK::Exception("Mismatching number of values.", FUNC_ID);
@@ -253,13 +266,31 @@ void readVector3D(const TiXmlElement * element, const std::string & name, std::v
 	}
 }
 
+template<>
+void writeVector<double>(TiXmlElement * parent, const std::string & name, const std::vector<double> & vec) {
+	if (!vec.empty()) {
+		TiXmlElement * child = new TiXmlElement(name);
+		parent->LinkEndChild(child);
+
+		// values are kept in the text node and only formatted when printed, gives "v1,v2,...,vn"
+		TiXmlNumberText * numText = new TiXmlNumberText;
+		numText->values = vec;
+		numText->separators.push_back(",");
+		child->LinkEndChild( new TiXmlText( numText ) );
+	}
+}
+
+
 template<>
 void readVector<double>(const TiXmlElement * element, const std::string & name, std::vector<double> & vec) {
 	FUNCID(NANDRAD::readVector);
-	std::string text = element->GetText();
-	text = IBK::replace_string(text, ",", " ");
 	try {
-		IBK::string2valueVector(text, vec);
+		// take values read from binary container directly, otherwise parse element text (comma or white-space separated)
+		const std::vector<double> * numbers = element->GetNumbers();
+		if (numbers != nullptr)
+			vec = *numbers;
+		else
+			IBK::string2valueVector(element->GetText(), vec, true);
 	} catch (IBK::Exception & ex) {
 		throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
 			IBK::FormatString("Error reading vector element '%1'.").arg(name) ), FUNC_ID);
@@ -270,10 +301,9 @@ void readVector<double>(const TiXmlElement * element, const std::string & name,
 template<>
 void readPoint2D<double>(const TiXmlElement * element, const std::string & name, IBK::point2D<double> & p) {
 	FUNCID(NANDRAD::readVector);
-	std::string text = element->GetText();
 	try {
 		std::vector<double> vec;
-		IBK::string2valueVector(text, vec);
+		IBK::string2valueVector(element->GetText(), vec, true);
 		if (vec.size() != 2)
 			throw IBK::Exception("Size mismatch, expected 2 numbers separated by , .", FUNC_ID);
 		p.m_x = vec[0];
@@ -24,6 +24,9 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include <exception>
+#include <limits>
 
 #include <tinyxml.h>
 
@@ -32,6 +35,7 @@
 #include <IBK_LinearSpline.h>
 #include <IBK_StringUtils.h>
 #include <IBK_point.h>
+#include <IBK_messages.h>
 
 #include <IBKMK_Vector3D.h>
 
@@ -51,6 +55,7 @@ namespace NANDRAD {
 
 /*! Attempts to open an XML file, hereby substituting placeholders in the file name and checking if
 	the top-level XML tag matches the requested tag name.
+	Binary container files (see writeBinaryContainer()) are detected and read as well.
 */
 TiXmlElement * openXMLFile(const std::map<std::string,IBK::Path>  &pathPlaceHolders, const IBK::Path & filename,
 	const std::string & parentXmlTag, TiXmlDocument & doc);
@@ -87,9 +92,24 @@ void readFlagElement(const TiXmlElement * element, IBK::Flag & f);
 template <typename T>
 void readVector(const TiXmlElement * element, const std::string & name, std::vector<T> & vec) {
 	FUNCID(NANDRAD::readVector);
-	std::string text = element->GetText();
-	text = IBK::replace_string(text, ",", " ");
 	try {
+		// ID lists may have been read as numbers already (see XMLStreamReader)
+		const std::vector<double> * numbers = element->GetNumbers();
+		if (numbers != nullptr) {
+			vec.resize(numbers->size());
+			for (unsigned int i=0; i<vec.size(); ++i) {
+				double v = (*numbers)[i];
+				if (v < (double)std::numeric_limits<T>::lowest() || v > (double)std::numeric_limits<T>::max() ||
+					static_cast<double>(static_cast<T>(v)) != v)
+				{
+					throw IBK::Exception(IBK::FormatString("Invalid value '%1'.").arg(v), FUNC_ID);
+				}
+				vec[i] = static_cast<T>(v);
+			}
+			return;
+		}
+		std::string text = element->GetText();
+		text = IBK::replace_string(text, ",", " ");
 		IBK::string2vector(text, vec);
 	} catch (IBK::Exception & ex) {
 		throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -118,6 +138,10 @@ void writeVector(TiXmlElement * parent, const std::string & name, const std::vec
 	}
 }
 
+/*! Special implementation for double-type vectors, values are stored in the text node and only formatted when printed. */
+template <>
+void writeVector(TiXmlElement * parent, const std::string & name, const std::vector<double> & vec);
+
 
 template <typename T>
 T readPODAttributeValue(const TiXmlElement * element, const TiXmlAttribute * attrib) {
@@ -152,6 +176,54 @@ TiXmlElement * writeVector3D(TiXmlElement * parent, const std::string & name, co
 /*! Reads a vector of Vector3D elements. */
 void readVector3D(const TiXmlElement * element, const std::string & name, std::vector<IBKMK::Vector3D> & vec);
 
+/*! Reads all child elements of a collection element and appends the objects to vector vec.
+	Objects are constructed in place and read with T::readXML(). Child elements with a tag name other than
+	childTagName generate a warning but are read nonetheless (same as generated readXML() code).
+
+	If the collection holds at least minParallelCount elements (and OpenMP is enabled), the objects are
+	read concurrently. T::readXML() must then only modify the object itself and the sub-tree of its own
+	element. If reading fails for several objects, the exception of the first object in document order is
+	rethrown.
+*/
+template <typename T>
+void readVectorOfObjects(const TiXmlElement * element, const std::string & childTagName, std::vector<T> & vec,
+						 unsigned int minParallelCount = 4)
+{
+	FUNCID(NANDRAD::readVectorOfObjects);
+	std::vector<const TiXmlElement *> children;
+	for (const TiXmlElement * c2 = element->FirstChildElement(); c2 != nullptr; c2 = c2->NextSiblingElement()) {
+		if (c2->ValueStr() != childTagName)
+			IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2->ValueStr()).arg(c2->Row()),
+							 IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
+		children.push_back(c2);
+	}
+	std::size_t offset = vec.size();
+	vec.resize(offset + children.size());
+	int count = (int)children.size();
+#if defined(_OPENMP)
+	if (children.size() >= minParallelCount) {
+		std::vector<std::exception_ptr> errors(children.size());
+#pragma omp parallel for schedule(dynamic)
+		for (int i=0; i<count; ++i) {
+			try {
+				vec[offset + i].readXML(children[i]);
+			}
+			catch (...) {
+				errors[i] = std::current_exception();
+			}
+		}
+		for (const std::exception_ptr & e : errors)
+			if (e)
+				std::rethrow_exception(e);
+		return;
+	}
+#else
+	(void)minParallelCount;
+#endif // _OPENMP
+	for (int i=0; i<count; ++i)
+		vec[offset + i].readXML(children[i]);
+}
+
 
 template <typename T>
 void readPoint2D(const TiXmlElement * element, const std::string & name, IBK::point2D<T> & p) {
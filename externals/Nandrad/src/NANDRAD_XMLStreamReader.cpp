@@ -0,0 +1,734 @@
+/*	The NANDRAD data model library.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#include "NANDRAD_XMLStreamReader.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include <tinyxml.h>
+
+#include <IBK_Exception.h>
+#include <IBK_FileUtils.h>
+#include <IBK_StringUtils.h>
+
+#include "NANDRAD_BinaryContainer.h"
+
+namespace NANDRAD {
+
+/*! Size of the read buffer. */
+static const std::size_t READ_BUFFER_SIZE = 256*1024;
+/*! Maximum number of objects passed at once by readSections(). */
+static const unsigned int MAX_BATCH_OBJECTS = 256;
+/*! Maximum XML text size of objects passed at once by readSections(). */
+static const std::uint64_t MAX_BATCH_TEXT_SIZE = 8*1024*1024;
+/*! Maximum number of different separators in number lists (3 for lists of 3D vectors). */
+static const unsigned int MAX_SEPARATOR_PERIOD = 3;
+
+
+static bool isWhiteSpace(int ch) {
+	return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+}
+
+
+/*! Characters that start an element name, other tags are skipped (same as TinyXML does). */
+static bool isNameStart(int ch) {
+	return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_' || ch >= 0x80;
+}
+
+
+static bool isDelimiter(char ch) {
+	return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == ',';
+}
+
+
+/*! Appends unicode character as UTF8 sequence. */
+static void appendUTF8(std::string & str, unsigned long c) {
+	if (c < 0x80)
+		str += (char)c;
+	else if (c < 0x800) {
+		str += (char)(0xC0 | (c >> 6));
+		str += (char)(0x80 | (c & 0x3F));
+	}
+	else if (c < 0x10000) {
+		str += (char)(0xE0 | (c >> 12));
+		str += (char)(0x80 | ((c >> 6) & 0x3F));
+		str += (char)(0x80 | (c & 0x3F));
+	}
+	else {
+		str += (char)(0xF0 | (c >> 18));
+		str += (char)(0x80 | ((c >> 12) & 0x3F));
+		str += (char)(0x80 | ((c >> 6) & 0x3F));
+		str += (char)(0x80 | (c & 0x3F));
+	}
+}
+
+
+/*! Parses a text with a list of numbers into numText.
+	Returns false if the text holds less than two numbers, other tokens or irregular separators.
+*/
+static bool parseNumberText(const std::string & text, TiXmlNumberText & numText) {
+	try {
+		IBK::string2valueVector(text.c_str(), numText.values, true);
+	}
+	catch (...) {
+		return false;
+	}
+	if (numText.values.size() < 2)
+		return false;
+
+	// Determine separators and precision, so that GetText() composes a text similar to the original. Readers
+	// of number lists take the values directly, so that the text is only used in messages.
+	std::size_t pos = 0;
+	std::size_t n = text.size();
+	while (pos < n && isDelimiter(text[pos]))
+		++pos;
+	numText.leading = text.substr(0, pos);
+	numText.precision = 1;
+	std::vector<std::pair<std::size_t, std::size_t> > separators;
+	while (pos < n) {
+		// count significant digits in mantissa
+		int digits = 0;
+		bool exponent = false;
+		for (; pos < n && !isDelimiter(text[pos]); ++pos) {
+			char ch = text[pos];
+			if (ch == 'e' || ch == 'E')
+				exponent = true;
+			else if (!exponent && ((ch >= '1' && ch <= '9') || (ch == '0' && digits > 0)))
+				++digits;
+		}
+		numText.precision = std::max(numText.precision, std::min(digits, 17));
+		std::size_t start = pos;
+		while (pos < n && isDelimiter(text[pos]))
+			++pos;
+		if (pos < n)
+			separators.push_back(std::make_pair(start, pos - start));
+		else
+			numText.trailing = text.substr(start);
+	}
+
+	// separators must follow a periodic pattern
+	unsigned int period = 1;
+	for (; period <= MAX_SEPARATOR_PERIOD; ++period) {
+		std::size_t i = period;
+		for (; i<separators.size(); ++i) {
+			const std::pair<std::size_t, std::size_t> & s = separators[i];
+			const std::pair<std::size_t, std::size_t> & ref = separators[i % period];
+			if (s.second != ref.second || text.compare(s.first, s.second, text, ref.first, ref.second) != 0)
+				break;
+		}
+		if (i == separators.size())
+			break;
+	}
+	if (period > MAX_SEPARATOR_PERIOD)
+		return false;
+	for (unsigned int i=0; i<period && i<separators.size(); ++i)
+		numText.separators.push_back(text.substr(separators[i].first, separators[i].second));
+	return true;
+}
+
+
+XMLStreamReader::XMLStreamReader() :
+	m_pos(0),
+	m_end(0),
+	m_bufferOffset(0),
+	m_row(1),
+	m_elementRow(0),
+	m_emptyElement(false),
+	m_condenseWhiteSpace(TiXmlBase::IsWhiteSpaceCondensed())
+{
+}
+
+
+XMLStreamReader::~XMLStreamReader() {
+}
+
+
+bool XMLStreamReader::open(const IBK::Path & fname, const std::string & rootName) {
+	FUNCID(XMLStreamReader::open);
+
+	m_filename = fname;
+	if (!fname.isFile())
+		throw IBK::Exception(IBK::FormatString("File '%1' does not exist or cannot be opened for reading.")
+				.arg(fname), FUNC_ID);
+
+	// binary container files hold the document tree, we read the document and walk through it
+	if (isBinaryContainer(fname)) {
+		m_document.reset(new TiXmlDocument);
+		readBinaryContainer(fname, *m_document);
+		const TiXmlElement * root = m_document->FirstChildElement();
+		if (root == nullptr)
+			return false;
+		if (root->ValueStr() != rootName)
+			throw IBK::Exception( IBK::FormatString("Expected '%1' as root node in XML file.").arg(rootName), FUNC_ID);
+		m_name = root->ValueStr();
+		m_openDocElements.push_back(std::make_pair(root, (const TiXmlElement *)nullptr));
+		return true;
+	}
+
+	if (!IBK::open_ifstream(m_stream, fname, std::ios_base::binary))
+		throw IBK::Exception(IBK::FormatString("File '%1' does not exist or cannot be opened for reading.")
+				.arg(fname), FUNC_ID);
+	m_buffer.resize(READ_BUFFER_SIZE);
+
+	// skip UTF8 byte order mark
+	if (peek() == 0xEF) {
+		get();
+		if (get() != 0xBB || get() != 0xBF)
+			throwError("Invalid byte order mark.");
+	}
+
+	// skip declaration, comments and DOCTYPE before root element
+	for (;;) {
+		skipWhiteSpace();
+		int ch = get();
+		if (ch == EOF)
+			return false; // empty file
+		if (ch != '<')
+			throwError("Unexpected text before root element.");
+		ch = peek();
+		if (ch == '?') {
+			get();
+			skipProcessingInstruction();
+		}
+		else if (ch == '!') {
+			get();
+			if (readMarkupDeclaration(nullptr))
+				throwError("Unexpected CDATA section before root element.");
+		}
+		else
+			break;
+	}
+	readStartTag();
+	if (m_name != rootName)
+		throw IBK::Exception( IBK::FormatString("Expected '%1' as root node in XML file.").arg(rootName), FUNC_ID);
+	return true;
+}
+
+
+bool XMLStreamReader::readNextStartElement() {
+	if (m_document != nullptr) {
+		if (m_openDocElements.empty())
+			return false;
+		std::pair<const TiXmlElement *, const TiXmlElement *> & parent = m_openDocElements.back();
+		const TiXmlElement * e = parent.second == nullptr ? parent.first->FirstChildElement() : parent.second->NextSiblingElement();
+		if (e == nullptr) {
+			m_openDocElements.pop_back();
+			return false;
+		}
+		parent.second = e;
+		m_name = e->ValueStr();
+		m_openDocElements.push_back(std::make_pair(e, (const TiXmlElement *)nullptr));
+		return true;
+	}
+
+	if (m_openElements.empty())
+		return false;
+	// an empty element tag has no children
+	if (m_emptyElement) {
+		m_emptyElement = false;
+		m_openElements.pop_back();
+		return false;
+	}
+	// texts and comments between elements are skipped, generated readers only look at elements
+	for (;;) {
+		int ch = get();
+		if (ch == EOF)
+			throwError(IBK::FormatString("Unexpected end of file, missing end tag of element '%1'.").arg(m_openElements.back()).str());
+		if (ch != '<')
+			continue;
+		ch = peek();
+		if (ch == '/') {
+			get();
+			readEndTag();
+			return false;
+		}
+		else if (ch == '!') {
+			get();
+			readMarkupDeclaration(nullptr);
+		}
+		else if (ch == '?') {
+			get();
+			skipProcessingInstruction();
+		}
+		else if (!isNameStart(ch))
+			skipUnknownTag();
+		else {
+			readStartTag();
+			return true;
+		}
+	}
+}
+
+
+const TiXmlElement * XMLStreamReader::readElement() {
+	if (m_document != nullptr) {
+		const TiXmlElement * e = m_openDocElements.back().first;
+		m_openDocElements.pop_back();
+		return e;
+	}
+	m_element.reset(); // release the previous element first
+	m_element.reset(composeElement());
+	return m_element.get();
+}
+
+
+void XMLStreamReader::skipElement() {
+	if (m_document != nullptr) {
+		m_openDocElements.pop_back();
+		return;
+	}
+	if (m_emptyElement) {
+		m_emptyElement = false;
+		m_openElements.pop_back();
+		return;
+	}
+	readContent(nullptr);
+}
+
+
+void XMLStreamReader::readSections(const std::set<std::string> & collectionNames,
+								   const std::function<void(const TiXmlElement *)> & readFunc)
+{
+	// the document has been read entirely already, so pass the element itself
+	if (m_document != nullptr) {
+		readFunc(readElement());
+		return;
+	}
+
+	m_element.reset();
+	std::unique_ptr<TiXmlElement> wrapper(createElement());
+	while (readNextStartElement()) {
+		if (collectionNames.find(m_name) == collectionNames.end()) {
+			wrapper->LinkEndChild(composeElement());
+			readFunc(wrapper.get());
+			wrapper->Clear();
+			continue;
+		}
+
+		// collection of objects, pass objects in batches
+		TiXmlElement * section = createElement();
+		wrapper->LinkEndChild(section);
+		unsigned int count = 0;
+		bool passed = false;
+		std::uint64_t batchStart = position();
+		while (readNextStartElement()) {
+			section->LinkEndChild(composeElement());
+			++count;
+			if (count >= MAX_BATCH_OBJECTS || position() - batchStart >= MAX_BATCH_TEXT_SIZE) {
+				readFunc(wrapper.get());
+				section->Clear();
+				passed = true;
+				count = 0;
+				batchStart = position();
+			}
+		}
+		// also pass empty collections
+		if (count > 0 || !passed)
+			readFunc(wrapper.get());
+		wrapper->Clear();
+	}
+}
+
+
+int XMLStreamReader::peek() {
+	if (m_pos == m_end && !fillBuffer())
+		return EOF;
+	return (unsigned char)m_buffer[m_pos];
+}
+
+
+int XMLStreamReader::get() {
+	if (m_pos == m_end && !fillBuffer())
+		return EOF;
+	int ch = (unsigned char)m_buffer[m_pos++];
+	// line ends are normalized to '\n', like TiXmlDocument::LoadFile() does
+	if (ch == '\r') {
+		if (peek() == '\n')
+			++m_pos;
+		ch = '\n';
+	}
+	if (ch == '\n')
+		++m_row;
+	return ch;
+}
+
+
+bool XMLStreamReader::fillBuffer() {
+	if (!m_stream.is_open())
+		return false;
+	m_bufferOffset += m_end;
+	m_stream.read(&m_buffer[0], (std::streamsize)m_buffer.size());
+	m_end = (std::size_t)m_stream.gcount();
+	m_pos = 0;
+	return m_end > 0;
+}
+
+
+void XMLStreamReader::throwError(const std::string & msg) const {
+	FUNCID(XMLStreamReader::throwError);
+	throw IBK::Exception(IBK::FormatString("Error in line %1 of XML file '%2':\n%3")
+						 .arg(m_row).arg(m_filename).arg(msg), FUNC_ID);
+}
+
+
+void XMLStreamReader::skipWhiteSpace() {
+	while (isWhiteSpace(peek()))
+		get();
+}
+
+
+void XMLStreamReader::expect(const char * str) {
+	for (; *str != 0; ++str) {
+		if (get() != (unsigned char)*str)
+			throwError(IBK::FormatString("Malformed XML, expected '%1'.").arg(str).str());
+	}
+}
+
+
+void XMLStreamReader::readName(std::string & name) {
+	name.clear();
+	for (;;) {
+		int ch = peek();
+		if (ch == EOF || isWhiteSpace(ch) || ch == '/' || ch == '>' || ch == '=' || ch == '<')
+			break;
+		name += (char)get();
+	}
+	if (name.empty())
+		throwError("Malformed XML, missing name.");
+}
+
+
+void XMLStreamReader::readEntity(std::string & str) {
+	// read up to ';' (entities are short), unknown entities are kept as they are (same as TinyXML)
+	std::string entity;
+	for (;;) {
+		int ch = peek();
+		if (ch == ';' || ch == '#' || (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9')) {
+			entity += (char)get();
+			if (ch == ';' || entity.size() > 10)
+				break;
+		}
+		else
+			break;
+	}
+	if (!entity.empty() && entity[entity.size()-1] == ';') {
+		if (entity == "amp;")			{ str += '&'; return; }
+		else if (entity == "lt;")		{ str += '<'; return; }
+		else if (entity == "gt;")		{ str += '>'; return; }
+		else if (entity == "quot;")		{ str += '\"'; return; }
+		else if (entity == "apos;")		{ str += '\''; return; }
+		else if (entity.size() > 2 && entity[0] == '#') {
+			unsigned long code = 0;
+			bool valid = true;
+			if (entity[1] == 'x' || entity[1] == 'X') {
+				for (std::size_t i=2; i<entity.size()-1 && valid; ++i) {
+					char ch = entity[i];
+					if (ch >= '0' && ch <= '9')			code = code*16 + (unsigned long)(ch - '0');
+					else if (ch >= 'a' && ch <= 'f')	code = code*16 + (unsigned long)(ch - 'a' + 10);
+					else if (ch >= 'A' && ch <= 'F')	code = code*16 + (unsigned long)(ch - 'A' + 10);
+					else								valid = false;
+				}
+				valid = valid && entity.size() > 3;
+			}
+			else {
+				for (std::size_t i=1; i<entity.size()-1 && valid; ++i) {
+					char ch = entity[i];
+					if (ch >= '0' && ch <= '9')			code = code*10 + (unsigned long)(ch - '0');
+					else								valid = false;
+				}
+			}
+			if (valid && code < 0x110000) {
+				appendUTF8(str, code);
+				return;
+			}
+		}
+	}
+	str += '&';
+	str += entity;
+}
+
+
+void XMLStreamReader::readStartTag() {
+	m_elementRow = m_row;
+	readName(m_name);
+	m_attributes.clear();
+	m_emptyElement = false;
+	for (;;) {
+		skipWhiteSpace();
+		int ch = peek();
+		if (ch == '>') {
+			get();
+			break;
+		}
+		if (ch == '/') {
+			get();
+			expect(">");
+			m_emptyElement = true;
+			break;
+		}
+		if (ch == EOF)
+			throwError(IBK::FormatString("Unexpected end of file in start tag of element '%1'.").arg(m_name).str());
+		m_attributes.push_back(std::make_pair(std::string(), std::string()));
+		std::pair<std::string, std::string> & attrib = m_attributes.back();
+		readName(attrib.first);
+		skipWhiteSpace();
+		expect("=");
+		skipWhiteSpace();
+		int quote = peek();
+		if (quote == '\"' || quote == '\'') {
+			get();
+			for (;;) {
+				ch = get();
+				if (ch == quote)
+					break;
+				if (ch == EOF)
+					throwError(IBK::FormatString("Unexpected end of file in attribute '%1'.").arg(attrib.first).str());
+				if (ch == '&')
+					readEntity(attrib.second);
+				else
+					attrib.second += (char)ch;
+			}
+		}
+		else {
+			// unquoted attribute values are accepted by TinyXML as well
+			for (ch = peek(); ch != EOF && !isWhiteSpace(ch) && ch != '/' && ch != '>'; ch = peek()) {
+				get();
+				if (ch == '&')
+					readEntity(attrib.second);
+				else
+					attrib.second += (char)ch;
+			}
+		}
+	}
+	m_openElements.push_back(m_name);
+}
+
+
+void XMLStreamReader::readEndTag() {
+	std::string name;
+	readName(name);
+	skipWhiteSpace();
+	expect(">");
+	if (m_openElements.empty() || name != m_openElements.back())
+		throwError(IBK::FormatString("Mismatching end tag '%1'.").arg(name).str());
+	m_openElements.pop_back();
+}
+
+
+bool XMLStreamReader::readMarkupDeclaration(std::string * str) {
+	int ch = get();
+	if (ch == '-') {
+		// comment
+		expect("-");
+		int dashes = 0;
+		for (;;) {
+			ch = get();
+			if (ch == EOF)
+				throwError("Unexpected end of file in comment.");
+			if (ch == '>' && dashes >= 2)
+				return false;
+			dashes = (ch == '-') ? dashes + 1 : 0;
+		}
+	}
+	else if (ch == '[') {
+		// CDATA section, content is kept as is
+		expect("CDATA[");
+		int brackets = 0;
+		for (;;) {
+			ch = get();
+			if (ch == EOF)
+				throwError("Unexpected end of file in CDATA section.");
+			if (ch == '>' && brackets >= 2)
+				break;
+			if (ch == ']')
+				++brackets;
+			else {
+				if (str != nullptr) {
+					for (; brackets > 0; --brackets)
+						*str += ']';
+					*str += (char)ch;
+				}
+				brackets = 0;
+			}
+		}
+		// the two brackets before the '>' close the section, additional brackets are content
+		if (str != nullptr)
+			for (; brackets > 2; --brackets)
+				*str += ']';
+		return true;
+	}
+	else {
+		// DOCTYPE or other declaration, may contain an internal subset in brackets
+		int depth = 0;
+		for (; ch != EOF; ch = get()) {
+			if (ch == '[')
+				++depth;
+			else if (ch == ']')
+				--depth;
+			else if (ch == '>' && depth <= 0)
+				return false;
+		}
+		throwError("Unexpected end of file in declaration.");
+	}
+	return false;
+}
+
+
+void XMLStreamReader::skipProcessingInstruction() {
+	bool question = false;
+	for (;;) {
+		int ch = get();
+		if (ch == EOF)
+			throwError("Unexpected end of file in processing instruction.");
+		if (ch == '>' && question)
+			return;
+		question = (ch == '?');
+	}
+}
+
+
+void XMLStreamReader::skipUnknownTag() {
+	for (;;) {
+		int ch = get();
+		if (ch == EOF)
+			throwError("Unexpected end of file in tag.");
+		if (ch == '>')
+			return;
+	}
+}
+
+
+TiXmlElement * XMLStreamReader::createElement() const {
+	TiXmlElement * e = new TiXmlElement(m_name);
+	e->SetRow(m_elementRow);
+	for (const std::pair<std::string, std::string> & attrib : m_attributes)
+		e->SetAttribute(attrib.first, attrib.second);
+	return e;
+}
+
+
+void XMLStreamReader::readContent(TiXmlElement * parent) {
+	// Texts are composed like TiXmlElement::ReadValue() does: texts with only white space are dropped,
+	// unless white space is condensed the text is kept as is.
+	for (;;) {
+		m_text.clear();
+		int textRow = m_row;
+		bool whiteSpace = false;
+		int ch;
+		for (ch = get(); ch != '<'; ch = get()) {
+			if (ch == EOF)
+				throwError(IBK::FormatString("Unexpected end of file, missing end tag of element '%1'.").arg(m_openElements.back()).str());
+			if (parent == nullptr)
+				continue; // skipping the element
+			if (isWhiteSpace(ch)) {
+				if (m_condenseWhiteSpace) {
+					whiteSpace = !m_text.empty();
+					continue;
+				}
+			}
+			else if (whiteSpace) {
+				m_text += ' ';
+				whiteSpace = false;
+			}
+			if (ch == '&')
+				readEntity(m_text);
+			else
+				m_text += (char)ch;
+		}
+
+		bool blank = true;
+		for (char c : m_text) {
+			if (!isWhiteSpace(c)) {
+				blank = false;
+				break;
+			}
+		}
+
+		ch = peek();
+		if (ch == '/') {
+			get();
+			readEndTag();
+			if (parent != nullptr && !blank) {
+				// number lists are stored as values, if the text is the only child
+				if (parent->FirstChild() == nullptr && m_numberListElements.find(parent->ValueStr()) != m_numberListElements.end()) {
+					std::unique_ptr<TiXmlNumberText> numText(new TiXmlNumberText);
+					if (parseNumberText(m_text, *numText)) {
+						TiXmlText * text = new TiXmlText(numText.release());
+						text->SetRow(textRow);
+						parent->LinkEndChild(text);
+						return;
+					}
+				}
+				TiXmlText * text = new TiXmlText(m_text);
+				text->SetRow(textRow);
+				parent->LinkEndChild(text);
+			}
+			return;
+		}
+
+		if (parent != nullptr && !blank) {
+			TiXmlText * text = new TiXmlText(m_text);
+			text->SetRow(textRow);
+			parent->LinkEndChild(text);
+		}
+
+		if (ch == '!') {
+			get();
+			textRow = m_row;
+			m_text.clear();
+			if (readMarkupDeclaration(parent != nullptr ? &m_text : nullptr) && parent != nullptr) {
+				TiXmlText * text = new TiXmlText(m_text);
+				text->SetCDATA(true);
+				text->SetRow(textRow);
+				parent->LinkEndChild(text);
+			}
+		}
+		else if (ch == '?') {
+			get();
+			skipProcessingInstruction();
+		}
+		else if (!isNameStart(ch))
+			skipUnknownTag();
+		else {
+			readStartTag();
+			if (parent != nullptr)
+				parent->LinkEndChild(composeElement());
+			else
+				skipElement();
+		}
+	}
+}
+
+
+TiXmlElement * XMLStreamReader::composeElement() {
+	std::unique_ptr<TiXmlElement> e(createElement());
+	if (m_emptyElement) {
+		m_emptyElement = false;
+		m_openElements.pop_back();
+	}
+	else
+		readContent(e.get());
+	return e.release();
+}
+
+
+} // namespace NANDRAD
@@ -0,0 +1,205 @@
+/*	The NANDRAD data model library.
+
+	Copyright (c) 2012-today, Institut für Bauklimatik, TU Dresden, Germany
+
+	Primary authors:
+	  Andreas Nicolai  <andreas.nicolai -[at]- tu-dresden.de>
+	  Anne Paepcke     <anne.paepcke -[at]- tu-dresden.de>
+
+	This library is part of SIM-VICUS (https://github.com/ghorwin/SIM-VICUS)
+
+	This library is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+*/
+
+#ifndef NANDRAD_XMLStreamReaderH
+#define NANDRAD_XMLStreamReaderH
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <IBK_Path.h>
+
+class TiXmlDocument;
+class TiXmlElement;
+
+namespace NANDRAD {
+
+/*! Pull parser for project files, reads the file in small blocks instead of loading the entire document.
+
+	The reader walks through the elements like QXmlStreamReader. Elements that shall be read with the generated
+	readXML() functions are composed as small TinyXML element trees, which are released again once the next
+	element is read. readSections() composes the children of an element one at a time and passes collections
+	of objects in batches, so that only a small part of the document is held in memory at any time.
+
+	Texts of number list elements (vertexes, time series and ID lists, see setNumberListElements()) are
+	parsed directly into values and stored in the text node (see TiXmlNumberText). Readers take the values
+	with TiXmlElement::GetNumbers() and do not parse the text again.
+
+	Texts and attributes are decoded like TinyXML does (entities, white space condensing). Comments,
+	processing instructions, DOCTYPE declarations and tags without valid element name are skipped.
+
+	Binary container files (see NANDRAD_BinaryContainer.h) are detected and read into a document, the reader
+	then walks through the document, so that reading code can handle both formats the same way.
+
+	\code
+	XMLStreamReader reader;
+	if (reader.open(fname, "NandradProject")) {
+		while (reader.readNextStartElement()) {
+			if (reader.name() == "Project")
+				reader.readSections(collectionNames, [this](const TiXmlElement * e) { readXMLPrivate(e); });
+			else
+				reader.skipElement();
+		}
+	}
+	\endcode
+*/
+class XMLStreamReader {
+public:
+	XMLStreamReader();
+	~XMLStreamReader();
+
+	/*! Sets the names of elements that hold a list of numbers as text.
+		Texts of these elements are stored as values, if they hold at least two numbers separated
+		by white space and/or commas in a regular pattern. Otherwise the text is kept.
+	*/
+	void setNumberListElements(const std::set<std::string> & elementNames) { m_numberListElements = elementNames; }
+
+	/*! Opens the file and reads up to the start tag of the root element, which becomes the current element.
+		\return Returns false, if the file does not contain any element.
+		Throws an IBK::Exception if the file cannot be read or if the root element is not named rootName.
+	*/
+	bool open(const IBK::Path & fname, const std::string & rootName);
+
+	/*! Reads up to the start tag of the next child element of the current element, which then becomes the
+		current element. If the end of the current element is reached instead, the function returns false
+		and the parent element is the current element again.
+	*/
+	bool readNextStartElement();
+
+	/*! Name of the current element. */
+	const std::string & name() const { return m_name; }
+
+	/*! Reads the current element with all attributes and children and returns it.
+		The element is owned by the reader and only valid until the next call to any of the read functions.
+		Afterwards, the parent element is the current element again.
+	*/
+	const TiXmlElement * readElement();
+
+	/*! Skips the current element with all children, afterwards the parent element is the current element again. */
+	void skipElement();
+
+	/*! Reads all children of the current element and passes them one at a time to readFunc.
+
+		Each child is wrapped into an element with the name and attributes of the current element, so that
+		the generated readXML() function of the current element can read it. Since readFunc is called several times,
+		the read function must append to collections (as generated readXML() code does).
+
+		Children with a name in collectionNames hold lists of objects. These are passed in batches of objects
+		(limited by number and text size), so that objects of a batch can be read in parallel
+		(see readVectorOfObjects()) without composing the entire collection.
+
+		Afterwards, the parent element is the current element again.
+	*/
+	void readSections(const std::set<std::string> & collectionNames,
+					  const std::function<void(const TiXmlElement *)> & readFunc);
+
+private:
+	/*! Returns the next character without consuming it, or EOF. */
+	int peek();
+	/*! Returns and consumes the next character, or EOF. */
+	int get();
+	/*! Reads the next block of the file into the buffer, returns false at end of file. */
+	bool fillBuffer();
+	/*! Number of bytes consumed so far. */
+	std::uint64_t position() const { return m_bufferOffset + m_pos; }
+
+	/*! Throws an IBK::Exception with given message and the current line number. */
+	void throwError(const std::string & msg) const;
+
+	void skipWhiteSpace();
+	/*! Consumes the given characters, throws an exception if the input differs. */
+	void expect(const char * str);
+	/*! Reads element or attribute name. */
+	void readName(std::string & name);
+	/*! Reads an entity after the '&' and appends the decoded character(s) to str. */
+	void readEntity(std::string & str);
+	/*! Reads start tag after the '<' into m_name, m_attributes and m_emptyElement and makes it the current element. */
+	void readStartTag();
+	/*! Reads end tag after the '</' and checks that it closes the current element. */
+	void readEndTag();
+	/*! Skips comment, CDATA section or DOCTYPE after the '<!', CDATA content is stored in str unless nullptr.
+		Returns true for CDATA sections.
+	*/
+	bool readMarkupDeclaration(std::string * str);
+	/*! Skips processing instruction after the '<?'. */
+	void skipProcessingInstruction();
+	/*! Skips a tag that does not start with a valid element name, up to the next '>'. */
+	void skipUnknownTag();
+
+	/*! Creates an element from the current start tag. */
+	TiXmlElement * createElement() const;
+	/*! Reads the children of the current element (after its start tag) into parent (or skips them if parent is nullptr)
+		and closes the current element.
+	*/
+	void readContent(TiXmlElement * parent);
+	/*! Reads the current element into a new element, closes it and returns it (caller takes ownership). */
+	TiXmlElement * composeElement();
+
+	/*! Source file. */
+	IBK::Path										m_filename;
+	/*! Input stream, not used when reading a binary container. */
+	std::ifstream									m_stream;
+	/*! Read buffer. */
+	std::vector<char>								m_buffer;
+	/*! Read position in buffer. */
+	std::size_t										m_pos;
+	/*! Number of valid bytes in buffer. */
+	std::size_t										m_end;
+	/*! Number of bytes in buffers read before the current one. */
+	std::uint64_t									m_bufferOffset;
+	/*! Current line number (1-based). */
+	int												m_row;
+
+	/*! Names of all open elements, the last is the current element. */
+	std::vector<std::string>						m_openElements;
+	/*! Name of the last element start tag. */
+	std::string										m_name;
+	/*! Line number of the last element start tag. */
+	int												m_elementRow;
+	/*! Attributes of the last element start tag. */
+	std::vector<std::pair<std::string, std::string> >	m_attributes;
+	/*! True if the last start tag was an empty element tag (<tag/>) which has not yet been closed. */
+	bool											m_emptyElement;
+	/*! Cached TiXmlBase::IsWhiteSpaceCondensed(). */
+	bool											m_condenseWhiteSpace;
+	/*! Text buffer, reused for all texts. */
+	std::string										m_text;
+	/*! Element returned by readElement(). */
+	std::unique_ptr<TiXmlElement>					m_element;
+
+	/*! Names of elements with number lists. */
+	std::set<std::string>							m_numberListElements;
+
+	/*! Document read from a binary container, nullptr when reading XML text. */
+	std::unique_ptr<TiXmlDocument>					m_document;
+	/*! Open elements when walking through m_document, each with the last child returned by readNextStartElement(). */
+	std::vector<std::pair<const TiXmlElement *, const TiXmlElement *> >	m_openDocElements;
+};
+
+} // namespace NANDRAD
+
+#endif // NANDRAD_XMLStreamReaderH
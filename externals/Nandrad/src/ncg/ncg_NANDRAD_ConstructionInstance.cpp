@@ -71,7 +71,7 @@ void ConstructionInstance::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("ConstructionInstance::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("ConstructionInstance::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -84,9 +84,8 @@ void ConstructionInstance::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "EmbeddedObject")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					EmbeddedObject obj;
-					obj.readXML(c2);
-					m_embeddedObjects.push_back(obj);
+					m_embeddedObjects.emplace_back();
+					m_embeddedObjects.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -61,15 +61,16 @@ void ConstructionType::readXML(const TiXmlElement * element) {
 			const std::string & cName = c->ValueStr();
 			if (cName == "ActiveLayerIndex")
 				m_activeLayerIndex = NANDRAD::readPODElement<unsigned int>(c, cName);
+			else if (cName == "ReducedModeCount")
+				m_reducedModeCount = NANDRAD::readPODElement<unsigned int>(c, cName);
 			else if (cName == "MaterialLayers") {
 				const TiXmlElement * c2 = c->FirstChildElement();
 				while (c2) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "MaterialLayer")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					MaterialLayer obj;
-					obj.readXML(c2);
-					m_materialLayers.push_back(obj);
+					m_materialLayers.emplace_back();
+					m_materialLayers.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -98,6 +99,8 @@ TiXmlElement * ConstructionType::writeXML(TiXmlElement * parent) const {
 		e->SetAttribute("displayName", m_displayName);
 	if (m_activeLayerIndex != NANDRAD::INVALID_ID)
 		TiXmlElement::appendSingleAttributeElement(e, "ActiveLayerIndex", nullptr, std::string(), IBK::val2string<unsigned int>(m_activeLayerIndex));
+	if (m_reducedModeCount != NANDRAD::INVALID_ID)
+		TiXmlElement::appendSingleAttributeElement(e, "ReducedModeCount", nullptr, std::string(), IBK::val2string<unsigned int>(m_reducedModeCount));
 
 	if (!m_materialLayers.empty()) {
 		TiXmlElement * child = new TiXmlElement("MaterialLayers");
@@ -44,7 +44,7 @@ void DailyCycle::readXML(const TiXmlElement * element) {
 			const std::string & attribName = attrib->NameStr();
 			if (attribName == "interpolation")
 				try {
-					m_interpolation = (interpolation_t)KeywordList::Enumeration("DailyCycle::interpolation_t", attrib->ValueStr());
+					m_interpolation = (interpolation_t)KeywordList::Enumeration<KeywordList::CategoryHash("DailyCycle::interpolation_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
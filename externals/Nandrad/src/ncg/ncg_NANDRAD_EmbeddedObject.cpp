@@ -65,7 +65,7 @@ void EmbeddedObject::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("EmbeddedObject::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("EmbeddedObject::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
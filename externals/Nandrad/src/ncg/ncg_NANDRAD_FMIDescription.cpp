@@ -48,9 +48,8 @@ void FMIDescription::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "FMIVariableDefinition")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					FMIVariableDefinition obj;
-					obj.readXML(c2);
-					m_inputVariables.push_back(obj);
+					m_inputVariables.emplace_back();
+					m_inputVariables.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -60,9 +59,8 @@ void FMIDescription::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "FMIVariableDefinition")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					FMIVariableDefinition obj;
-					obj.readXML(c2);
-					m_outputVariables.push_back(obj);
+					m_outputVariables.emplace_back();
+					m_outputVariables.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -58,7 +58,7 @@ void HVACControlModel::readXML(const TiXmlElement * element) {
 				m_id = NANDRAD::readPODAttributeValue<unsigned int>(element, attrib);
 			else if (attribName == "modelType")
 				try {
-					m_modelType = (modelType_t)KeywordList::Enumeration("HVACControlModel::modelType_t", attrib->ValueStr());
+					m_modelType = (modelType_t)KeywordList::Enumeration<KeywordList::CategoryHash("HVACControlModel::modelType_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -66,7 +66,7 @@ void HVACControlModel::readXML(const TiXmlElement * element) {
 				}
 			else if (attribName == "operatingMode")
 				try {
-					m_operatingMode = (OperatingMode)KeywordList::Enumeration("HVACControlModel::OperatingMode", attrib->ValueStr());
+					m_operatingMode = (OperatingMode)KeywordList::Enumeration<KeywordList::CategoryHash("HVACControlModel::OperatingMode")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -59,7 +59,7 @@ void HydraulicFluid::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("HydraulicFluid::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicFluid::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -60,7 +60,7 @@ void HydraulicNetwork::readXMLPrivate(const TiXmlElement * element) {
 				m_displayName = attrib->ValueStr();
 			else if (attribName == "modelType")
 				try {
-					m_modelType = (ModelType)KeywordList::Enumeration("HydraulicNetwork::ModelType", attrib->ValueStr());
+					m_modelType = (ModelType)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetwork::ModelType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -88,7 +88,7 @@ void HydraulicNetwork::readXMLPrivate(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("HydraulicNetwork::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetwork::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -101,9 +101,8 @@ void HydraulicNetwork::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "HydraulicNetworkPipeProperties")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					HydraulicNetworkPipeProperties obj;
-					obj.readXML(c2);
-					m_pipeProperties.push_back(obj);
+					m_pipeProperties.emplace_back();
+					m_pipeProperties.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -113,9 +112,8 @@ void HydraulicNetwork::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "HydraulicNetworkComponent")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					HydraulicNetworkComponent obj;
-					obj.readXML(c2);
-					m_components.push_back(obj);
+					m_components.emplace_back();
+					m_components.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -125,9 +123,8 @@ void HydraulicNetwork::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "HydraulicNetworkNode")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					HydraulicNetworkNode obj;
-					obj.readXML(c2);
-					m_nodes.push_back(obj);
+					m_nodes.emplace_back();
+					m_nodes.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -137,9 +134,8 @@ void HydraulicNetwork::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "HydraulicNetworkElement")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					HydraulicNetworkElement obj;
-					obj.readXML(c2);
-					m_elements.push_back(obj);
+					m_elements.emplace_back();
+					m_elements.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -149,9 +145,8 @@ void HydraulicNetwork::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "HydraulicNetworkControlElement")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					HydraulicNetworkControlElement obj;
-					obj.readXML(c2);
-					m_controlElements.push_back(obj);
+					m_controlElements.emplace_back();
+					m_controlElements.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
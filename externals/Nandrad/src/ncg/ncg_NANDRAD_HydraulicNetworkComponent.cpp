@@ -56,7 +56,7 @@ void HydraulicNetworkComponent::readXML(const TiXmlElement * element) {
 				m_displayName = attrib->ValueStr();
 			else if (attribName == "modelType")
 				try {
-					m_modelType = (ModelType)KeywordList::Enumeration("HydraulicNetworkComponent::ModelType", attrib->ValueStr());
+					m_modelType = (ModelType)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkComponent::ModelType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -78,7 +78,7 @@ void HydraulicNetworkComponent::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("HydraulicNetworkComponent::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkComponent::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
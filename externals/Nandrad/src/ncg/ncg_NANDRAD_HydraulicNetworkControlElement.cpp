@@ -58,7 +58,7 @@ void HydraulicNetworkControlElement::readXML(const TiXmlElement * element) {
 				m_id = (IDType)NANDRAD::readPODAttributeValue<unsigned int>(element, attrib);
 			else if (attribName == "modelType")
 				try {
-					m_modelType = (ModelType)KeywordList::Enumeration("HydraulicNetworkControlElement::ModelType", attrib->ValueStr());
+					m_modelType = (ModelType)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkControlElement::ModelType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -66,7 +66,7 @@ void HydraulicNetworkControlElement::readXML(const TiXmlElement * element) {
 				}
 			else if (attribName == "controllerType")
 				try {
-					m_controllerType = (ControllerType)KeywordList::Enumeration("HydraulicNetworkControlElement::ControllerType", attrib->ValueStr());
+					m_controllerType = (ControllerType)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkControlElement::ControllerType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -74,7 +74,7 @@ void HydraulicNetworkControlElement::readXML(const TiXmlElement * element) {
 				}
 			else if (attribName == "controlledProperty")
 				try {
-					m_controlledProperty = (ControlledProperty)KeywordList::Enumeration("HydraulicNetworkControlElement::ControlledProperty", attrib->ValueStr());
+					m_controlledProperty = (ControlledProperty)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkControlElement::ControlledProperty")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -98,7 +98,7 @@ void HydraulicNetworkControlElement::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("HydraulicNetworkControlElement::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkControlElement::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
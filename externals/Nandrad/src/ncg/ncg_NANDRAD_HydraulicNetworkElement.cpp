@@ -79,7 +79,7 @@ void HydraulicNetworkElement::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("HydraulicNetworkElement::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkElement::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -91,7 +91,7 @@ void HydraulicNetworkElement::readXML(const TiXmlElement * element) {
 				NANDRAD::readIntParaElement(c, p);
 				bool success = false;
 				try {
-					intPara_t ptype = (intPara_t)KeywordList::Enumeration("HydraulicNetworkElement::intPara_t", p.name);
+					intPara_t ptype = (intPara_t)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkElement::intPara_t")>(p.name);
 					m_intPara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
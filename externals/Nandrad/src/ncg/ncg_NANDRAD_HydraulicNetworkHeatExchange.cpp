@@ -44,7 +44,7 @@ void HydraulicNetworkHeatExchange::readXML(const TiXmlElement * element) {
 			const std::string & attribName = attrib->NameStr();
 			if (attribName == "modelType")
 				try {
-					m_modelType = (ModelType)KeywordList::Enumeration("HydraulicNetworkHeatExchange::ModelType", attrib->ValueStr());
+					m_modelType = (ModelType)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkHeatExchange::ModelType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -66,7 +66,7 @@ void HydraulicNetworkHeatExchange::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("HydraulicNetworkHeatExchange::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkHeatExchange::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -79,7 +79,7 @@ void HydraulicNetworkHeatExchange::readXML(const TiXmlElement * element) {
 				bool success = false;
 				try {
 					splinePara_t ptype;
-					ptype = (splinePara_t)KeywordList::Enumeration("HydraulicNetworkHeatExchange::splinePara_t", p.m_name);
+					ptype = (splinePara_t)KeywordList::Enumeration<KeywordList::CategoryHash("HydraulicNetworkHeatExchange::splinePara_t")>(p.m_name);
 					m_splPara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -56,7 +56,7 @@ void IdealPipeRegisterModel::readXML(const TiXmlElement * element) {
 				m_displayName = attrib->ValueStr();
 			else if (attribName == "modelType")
 				try {
-					m_modelType = (modelType_t)KeywordList::Enumeration("IdealPipeRegisterModel::modelType_t", attrib->ValueStr());
+					m_modelType = (modelType_t)KeywordList::Enumeration<KeywordList::CategoryHash("IdealPipeRegisterModel::modelType_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -94,7 +94,7 @@ void IdealPipeRegisterModel::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("IdealPipeRegisterModel::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("IdealPipeRegisterModel::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -106,7 +106,7 @@ void IdealPipeRegisterModel::readXML(const TiXmlElement * element) {
 				NANDRAD::readIntParaElement(c, p);
 				bool success = false;
 				try {
-					intPara_t ptype = (intPara_t)KeywordList::Enumeration("IdealPipeRegisterModel::intPara_t", p.name);
+					intPara_t ptype = (intPara_t)KeywordList::Enumeration<KeywordList::CategoryHash("IdealPipeRegisterModel::intPara_t")>(p.name);
 					m_intPara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
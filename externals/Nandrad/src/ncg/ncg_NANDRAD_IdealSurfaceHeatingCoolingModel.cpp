@@ -77,7 +77,7 @@ void IdealSurfaceHeatingCoolingModel::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("IdealSurfaceHeatingCoolingModel::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("IdealSurfaceHeatingCoolingModel::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
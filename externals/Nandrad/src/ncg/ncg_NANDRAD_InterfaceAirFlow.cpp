@@ -47,7 +47,7 @@ void InterfaceAirFlow::readXMLPrivate(const TiXmlElement * element) {
 			const std::string & attribName = attrib->NameStr();
 			if (attribName == "modelType")
 				try {
-					m_modelType = (modelType_t)KeywordList::Enumeration("InterfaceAirFlow::modelType_t", attrib->ValueStr());
+					m_modelType = (modelType_t)KeywordList::Enumeration<KeywordList::CategoryHash("InterfaceAirFlow::modelType_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
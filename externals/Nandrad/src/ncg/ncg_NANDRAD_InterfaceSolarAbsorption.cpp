@@ -48,7 +48,7 @@ void InterfaceSolarAbsorption::readXMLPrivate(const TiXmlElement * element) {
 			const std::string & attribName = attrib->NameStr();
 			if (attribName == "modelType")
 				try {
-					m_modelType = (modelType_t)KeywordList::Enumeration("InterfaceSolarAbsorption::modelType_t", attrib->ValueStr());
+					m_modelType = (modelType_t)KeywordList::Enumeration<KeywordList::CategoryHash("InterfaceSolarAbsorption::modelType_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -70,7 +70,7 @@ void InterfaceSolarAbsorption::readXMLPrivate(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("InterfaceSolarAbsorption::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("InterfaceSolarAbsorption::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
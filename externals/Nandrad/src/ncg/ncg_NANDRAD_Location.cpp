@@ -47,7 +47,7 @@ void Location::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("Location::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("Location::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -59,7 +59,7 @@ void Location::readXML(const TiXmlElement * element) {
 				NANDRAD::readFlagElement(c, f);
 				bool success = false;
 				try {
-					flag_t ftype = (flag_t)KeywordList::Enumeration("Location::flag_t", f.name());
+					flag_t ftype = (flag_t)KeywordList::Enumeration<KeywordList::CategoryHash("Location::flag_t")>(f.name());
 					m_flags[ftype] = f; success=true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -78,9 +78,8 @@ void Location::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Sensor")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Sensor obj;
-					obj.readXML(c2);
-					m_sensors.push_back(obj);
+					m_sensors.emplace_back();
+					m_sensors.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
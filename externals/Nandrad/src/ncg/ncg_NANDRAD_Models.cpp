@@ -46,9 +46,8 @@ void Models::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "NaturalVentilationModel")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					NaturalVentilationModel obj;
-					obj.readXML(c2);
-					m_naturalVentilationModels.push_back(obj);
+					m_naturalVentilationModels.emplace_back();
+					m_naturalVentilationModels.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -58,9 +57,8 @@ void Models::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "InternalLoadsModel")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					InternalLoadsModel obj;
-					obj.readXML(c2);
-					m_internalLoadsModels.push_back(obj);
+					m_internalLoadsModels.emplace_back();
+					m_internalLoadsModels.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -70,9 +68,8 @@ void Models::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "InternalMoistureLoadsModel")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					InternalMoistureLoadsModel obj;
-					obj.readXML(c2);
-					m_internalMoistureLoadsModels.push_back(obj);
+					m_internalMoistureLoadsModels.emplace_back();
+					m_internalMoistureLoadsModels.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -82,9 +79,8 @@ void Models::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "ShadingControlModel")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					ShadingControlModel obj;
-					obj.readXML(c2);
-					m_shadingControlModels.push_back(obj);
+					m_shadingControlModels.emplace_back();
+					m_shadingControlModels.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -94,9 +90,8 @@ void Models::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Thermostat")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Thermostat obj;
-					obj.readXML(c2);
-					m_thermostats.push_back(obj);
+					m_thermostats.emplace_back();
+					m_thermostats.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -106,9 +101,8 @@ void Models::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "IdealHeatingCoolingModel")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					IdealHeatingCoolingModel obj;
-					obj.readXML(c2);
-					m_idealHeatingCoolingModels.push_back(obj);
+					m_idealHeatingCoolingModels.emplace_back();
+					m_idealHeatingCoolingModels.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -118,9 +112,8 @@ void Models::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "IdealSurfaceHeatingCoolingModel")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					IdealSurfaceHeatingCoolingModel obj;
-					obj.readXML(c2);
-					m_idealSurfaceHeatingCoolingModels.push_back(obj);
+					m_idealSurfaceHeatingCoolingModels.emplace_back();
+					m_idealSurfaceHeatingCoolingModels.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -130,9 +123,8 @@ void Models::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "IdealPipeRegisterModel")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					IdealPipeRegisterModel obj;
-					obj.readXML(c2);
-					m_idealPipeRegisterModels.push_back(obj);
+					m_idealPipeRegisterModels.emplace_back();
+					m_idealPipeRegisterModels.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -142,9 +134,8 @@ void Models::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "HeatLoadSummationModel")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					HeatLoadSummationModel obj;
-					obj.readXML(c2);
-					m_heatLoadSummationModels.push_back(obj);
+					m_heatLoadSummationModels.emplace_back();
+					m_heatLoadSummationModels.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -154,9 +145,8 @@ void Models::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "NetworkInterfaceAdapterModel")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					NetworkInterfaceAdapterModel obj;
-					obj.readXML(c2);
-					m_networkInterfaceAdapterModels.push_back(obj);
+					m_networkInterfaceAdapterModels.emplace_back();
+					m_networkInterfaceAdapterModels.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -63,7 +63,7 @@ void OutputDefinition::readXML(const TiXmlElement * element) {
 				m_gridName = c->GetText();
 			else if (cName == "TimeType") {
 				try {
-					m_timeType = (timeType_t)KeywordList::Enumeration("OutputDefinition::timeType_t", c->GetText());
+					m_timeType = (timeType_t)KeywordList::Enumeration<KeywordList::CategoryHash("OutputDefinition::timeType_t")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
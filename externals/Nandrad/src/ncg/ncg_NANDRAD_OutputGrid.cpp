@@ -58,9 +58,8 @@ void OutputGrid::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Interval")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Interval obj;
-					obj.readXML(c2);
-					m_intervals.push_back(obj);
+					m_intervals.emplace_back();
+					m_intervals.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -47,9 +47,8 @@ void Outputs::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "OutputDefinition")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					OutputDefinition obj;
-					obj.readXML(c2);
-					m_definitions.push_back(obj);
+					m_definitions.emplace_back();
+					m_definitions.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -59,9 +58,8 @@ void Outputs::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "OutputGrid")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					OutputGrid obj;
-					obj.readXML(c2);
-					m_grids.push_back(obj);
+					m_grids.emplace_back();
+					m_grids.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -77,6 +75,18 @@ void Outputs::readXMLPrivate(const TiXmlElement * element) {
 				if (!success)
 					IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_NAME).arg(f.name()).arg(cName).arg(c->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
 			}
+			else if (cName == "IBK:Parameter") {
+				IBK::Parameter p;
+				NANDRAD::readParameterElement(c, p);
+				bool success = false;
+				if (p.name == "ThinningTolerance") {
+					m_thinningTolerance = p; success = true;
+				}
+				if (!success) {
+				}
+				if (!success)
+					IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_NAME).arg(p.name).arg(cName).arg(c->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
+			}
 			else {
 				IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(cName).arg(c->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
 			}
@@ -125,6 +135,10 @@ TiXmlElement * Outputs::writeXMLPrivate(TiXmlElement * parent) const {
 		IBK_ASSERT("BinaryFormat" == m_binaryFormat.name());
 		TiXmlElement::appendSingleAttributeElement(e, "IBK:Flag", "name", "BinaryFormat", m_binaryFormat.isEnabled() ? "true" : "false");
 	}
+	if (!m_thinningTolerance.name.empty()) {
+		IBK_ASSERT("ThinningTolerance" == m_thinningTolerance.name);
+		TiXmlElement::appendIBKParameterElement(e, "ThinningTolerance", m_thinningTolerance.IO_unit.name(), m_thinningTolerance.get_value(m_thinningTolerance.IO_unit));
+	}
 	return e;
 }
 
@@ -26,6 +26,7 @@
 #include <IBK_Exception.h>
 #include <IBK_StringUtils.h>
 #include <NANDRAD_Constants.h>
+#include <NANDRAD_Utilities.h>
 
 #include <tinyxml.h>
 
@@ -46,45 +47,23 @@ void Project::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Zone")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Zone obj;
-					obj.readXML(c2);
-					m_zones.push_back(obj);
-					c2 = c2->NextSiblingElement();
-				}
-			}
-			else if (cName == "ConstructionInstances") {
-				const TiXmlElement * c2 = c->FirstChildElement();
-				while (c2) {
-					const std::string & c2Name = c2->ValueStr();
-					if (c2Name != "ConstructionInstance")
-						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					ConstructionInstance obj;
-					obj.readXML(c2);
-					m_constructionInstances.push_back(obj);
-					c2 = c2->NextSiblingElement();
-				}
-			}
-			else if (cName == "HydraulicNetworks") {
-				const TiXmlElement * c2 = c->FirstChildElement();
-				while (c2) {
-					const std::string & c2Name = c2->ValueStr();
-					if (c2Name != "HydraulicNetwork")
-						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					HydraulicNetwork obj;
-					obj.readXML(c2);
-					m_hydraulicNetworks.push_back(obj);
+					m_zones.emplace_back();
+					m_zones.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
+			else if (cName == "ConstructionInstances")
+				NANDRAD::readVectorOfObjects(c, "ConstructionInstance", m_constructionInstances);
+			else if (cName == "HydraulicNetworks")
+				NANDRAD::readVectorOfObjects(c, "HydraulicNetwork", m_hydraulicNetworks);
 			else if (cName == "ConstructionTypes") {
 				const TiXmlElement * c2 = c->FirstChildElement();
 				while (c2) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "ConstructionType")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					ConstructionType obj;
-					obj.readXML(c2);
-					m_constructionTypes.push_back(obj);
+					m_constructionTypes.emplace_back();
+					m_constructionTypes.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -94,9 +73,8 @@ void Project::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Material")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Material obj;
-					obj.readXML(c2);
-					m_materials.push_back(obj);
+					m_materials.emplace_back();
+					m_materials.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -106,9 +84,8 @@ void Project::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "WindowGlazingSystem")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					WindowGlazingSystem obj;
-					obj.readXML(c2);
-					m_windowGlazingSystems.push_back(obj);
+					m_windowGlazingSystems.emplace_back();
+					m_windowGlazingSystems.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -118,9 +95,8 @@ void Project::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "ObjectList")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					ObjectList obj;
-					obj.readXML(c2);
-					m_objectLists.push_back(obj);
+					m_objectLists.emplace_back();
+					m_objectLists.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
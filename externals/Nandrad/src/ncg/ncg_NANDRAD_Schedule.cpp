@@ -48,7 +48,7 @@ void Schedule::readXML(const TiXmlElement * element) {
 			const std::string & attribName = attrib->NameStr();
 			if (attribName == "type")
 				try {
-					m_type = (ScheduledDayType)KeywordList::Enumeration("Schedule::ScheduledDayType", attrib->ValueStr());
+					m_type = (ScheduledDayType)KeywordList::Enumeration<KeywordList::CategoryHash("Schedule::ScheduledDayType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -74,9 +74,8 @@ void Schedule::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "DailyCycle")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					DailyCycle obj;
-					obj.readXML(c2);
-					m_dailyCycles.push_back(obj);
+					m_dailyCycles.emplace_back();
+					m_dailyCycles.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
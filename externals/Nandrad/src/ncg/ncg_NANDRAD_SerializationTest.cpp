@@ -56,7 +56,7 @@ void SerializationTest::readXML(const TiXmlElement * element) {
 				m_val1 = NANDRAD::readPODAttributeValue<double>(element, attrib);
 			else if (attribName == "testBla")
 				try {
-					m_testBla = (test_t)KeywordList::Enumeration("SerializationTest::test_t", attrib->ValueStr());
+					m_testBla = (test_t)KeywordList::Enumeration<KeywordList::CategoryHash("SerializationTest::test_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -119,7 +119,7 @@ void SerializationTest::readXML(const TiXmlElement * element) {
 					m_f2 = f; success=true;
 				}
 				try {
-					test_t ftype = (test_t)KeywordList::Enumeration("SerializationTest::test_t", f.name());
+					test_t ftype = (test_t)KeywordList::Enumeration<KeywordList::CategoryHash("SerializationTest::test_t")>(f.name());
 					m_flags[ftype] = f; success=true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -142,9 +142,8 @@ void SerializationTest::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Interface")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Interface obj;
-					obj.readXML(c2);
-					m_interfaces.push_back(obj);
+					m_interfaces.emplace_back();
+					m_interfaces.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -158,7 +157,7 @@ void SerializationTest::readXML(const TiXmlElement * element) {
 				if (!success) {
 				test_t ptype;
 				try {
-					ptype = (test_t)KeywordList::Enumeration("SerializationTest::test_t", p.name);
+					ptype = (test_t)KeywordList::Enumeration<KeywordList::CategoryHash("SerializationTest::test_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -174,7 +173,7 @@ void SerializationTest::readXML(const TiXmlElement * element) {
 					m_singleIntegerPara = p; success = true;
 				}
 				try {
-					intPara_t ptype = (intPara_t)KeywordList::Enumeration("SerializationTest::intPara_t", p.name);
+					intPara_t ptype = (intPara_t)KeywordList::Enumeration<KeywordList::CategoryHash("SerializationTest::intPara_t")>(p.name);
 					m_intPara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -206,7 +205,7 @@ void SerializationTest::readXML(const TiXmlElement * element) {
 				}
 				try {
 					splinePara_t ptype;
-					ptype = (splinePara_t)KeywordList::Enumeration("SerializationTest::splinePara_t", p.m_name);
+					ptype = (splinePara_t)KeywordList::Enumeration<KeywordList::CategoryHash("SerializationTest::splinePara_t")>(p.m_name);
 					m_splinePara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -217,7 +216,7 @@ void SerializationTest::readXML(const TiXmlElement * element) {
 				NANDRAD::readPoint2D(c, "Coordinate2D", m_coordinate2D);
 			else if (cName == "TestBlo") {
 				try {
-					m_testBlo = (test_t)KeywordList::Enumeration("SerializationTest::test_t", c->GetText());
+					m_testBlo = (test_t)KeywordList::Enumeration<KeywordList::CategoryHash("SerializationTest::test_t")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -47,7 +47,7 @@ void SimulationParameter::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("SimulationParameter::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("SimulationParameter::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -59,7 +59,7 @@ void SimulationParameter::readXML(const TiXmlElement * element) {
 				NANDRAD::readIntParaElement(c, p);
 				bool success = false;
 				try {
-					intPara_t ptype = (intPara_t)KeywordList::Enumeration("SimulationParameter::intPara_t", p.name);
+					intPara_t ptype = (intPara_t)KeywordList::Enumeration<KeywordList::CategoryHash("SimulationParameter::intPara_t")>(p.name);
 					m_intPara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -71,7 +71,7 @@ void SimulationParameter::readXML(const TiXmlElement * element) {
 				NANDRAD::readFlagElement(c, f);
 				bool success = false;
 				try {
-					flag_t ftype = (flag_t)KeywordList::Enumeration("SimulationParameter::flag_t", f.name());
+					flag_t ftype = (flag_t)KeywordList::Enumeration<KeywordList::CategoryHash("SimulationParameter::flag_t")>(f.name());
 					m_flags[ftype] = f; success=true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -48,7 +48,7 @@ void SolarLoadsDistributionModel::readXMLPrivate(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("SolarLoadsDistributionModel::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("SolarLoadsDistributionModel::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -57,7 +57,7 @@ void SolarLoadsDistributionModel::readXMLPrivate(const TiXmlElement * element) {
 			}
 			else if (cName == "DistributionType") {
 				try {
-					m_distributionType = (distribution_t)KeywordList::Enumeration("SolarLoadsDistributionModel::distribution_t", c->GetText());
+					m_distributionType = (distribution_t)KeywordList::Enumeration<KeywordList::CategoryHash("SolarLoadsDistributionModel::distribution_t")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -48,7 +48,7 @@ void SolverParameter::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("SolverParameter::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("SolverParameter::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -60,7 +60,7 @@ void SolverParameter::readXML(const TiXmlElement * element) {
 				NANDRAD::readIntParaElement(c, p);
 				bool success = false;
 				try {
-					intPara_t ptype = (intPara_t)KeywordList::Enumeration("SolverParameter::intPara_t", p.name);
+					intPara_t ptype = (intPara_t)KeywordList::Enumeration<KeywordList::CategoryHash("SolverParameter::intPara_t")>(p.name);
 					m_intPara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -72,7 +72,7 @@ void SolverParameter::readXML(const TiXmlElement * element) {
 				NANDRAD::readFlagElement(c, f);
 				bool success = false;
 				try {
-					flag_t ftype = (flag_t)KeywordList::Enumeration("SolverParameter::flag_t", f.name());
+					flag_t ftype = (flag_t)KeywordList::Enumeration<KeywordList::CategoryHash("SolverParameter::flag_t")>(f.name());
 					m_flag[ftype] = f; success=true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -81,7 +81,7 @@ void SolverParameter::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "Integrator") {
 				try {
-					m_integrator = (integrator_t)KeywordList::Enumeration("SolverParameter::integrator_t", c->GetText());
+					m_integrator = (integrator_t)KeywordList::Enumeration<KeywordList::CategoryHash("SolverParameter::integrator_t")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -90,7 +90,7 @@ void SolverParameter::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "LesSolver") {
 				try {
-					m_lesSolver = (lesSolver_t)KeywordList::Enumeration("SolverParameter::lesSolver_t", c->GetText());
+					m_lesSolver = (lesSolver_t)KeywordList::Enumeration<KeywordList::CategoryHash("SolverParameter::lesSolver_t")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -99,7 +99,7 @@ void SolverParameter::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "Preconditioner") {
 				try {
-					m_preconditioner = (precond_t)KeywordList::Enumeration("SolverParameter::precond_t", c->GetText());
+					m_preconditioner = (precond_t)KeywordList::Enumeration<KeywordList::CategoryHash("SolverParameter::precond_t")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -56,7 +56,7 @@ void Thermostat::readXML(const TiXmlElement * element) {
 				m_displayName = attrib->ValueStr();
 			else if (attribName == "modelType")
 				try {
-					m_modelType = (modelType_t)KeywordList::Enumeration("Thermostat::modelType_t", attrib->ValueStr());
+					m_modelType = (modelType_t)KeywordList::Enumeration<KeywordList::CategoryHash("Thermostat::modelType_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -84,7 +84,7 @@ void Thermostat::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("Thermostat::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("Thermostat::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -95,7 +95,7 @@ void Thermostat::readXML(const TiXmlElement * element) {
 				m_referenceZoneId = NANDRAD::readPODElement<unsigned int>(c, cName);
 			else if (cName == "TemperatureType") {
 				try {
-					m_temperatureType = (TemperatureType)KeywordList::Enumeration("Thermostat::TemperatureType", c->GetText());
+					m_temperatureType = (TemperatureType)KeywordList::Enumeration<KeywordList::CategoryHash("Thermostat::TemperatureType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -104,7 +104,7 @@ void Thermostat::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "ControllerType") {
 				try {
-					m_controllerType = (ControllerType)KeywordList::Enumeration("Thermostat::ControllerType", c->GetText());
+					m_controllerType = (ControllerType)KeywordList::Enumeration<KeywordList::CategoryHash("Thermostat::ControllerType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -52,7 +52,7 @@ void WindowGlazingLayer::readXML(const TiXmlElement * element) {
 			const std::string & attribName = attrib->NameStr();
 			if (attribName == "type")
 				try {
-					m_type = (type_t)KeywordList::Enumeration("WindowGlazingLayer::type_t", attrib->ValueStr());
+					m_type = (type_t)KeywordList::Enumeration<KeywordList::CategoryHash("WindowGlazingLayer::type_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -78,7 +78,7 @@ void WindowGlazingLayer::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("WindowGlazingLayer::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("WindowGlazingLayer::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -91,7 +91,7 @@ void WindowGlazingLayer::readXML(const TiXmlElement * element) {
 				bool success = false;
 				try {
 					splinePara_t ptype;
-					ptype = (splinePara_t)KeywordList::Enumeration("WindowGlazingLayer::splinePara_t", p.m_name);
+					ptype = (splinePara_t)KeywordList::Enumeration<KeywordList::CategoryHash("WindowGlazingLayer::splinePara_t")>(p.m_name);
 					m_splinePara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -56,7 +56,7 @@ void WindowGlazingSystem::readXML(const TiXmlElement * element) {
 				m_displayName = attrib->ValueStr();
 			else if (attribName == "modelType")
 				try {
-					m_modelType = (modelType_t)KeywordList::Enumeration("WindowGlazingSystem::modelType_t", attrib->ValueStr());
+					m_modelType = (modelType_t)KeywordList::Enumeration<KeywordList::CategoryHash("WindowGlazingSystem::modelType_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -78,7 +78,7 @@ void WindowGlazingSystem::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("WindowGlazingSystem::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("WindowGlazingSystem::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -91,7 +91,7 @@ void WindowGlazingSystem::readXML(const TiXmlElement * element) {
 				bool success = false;
 				try {
 					splinePara_t ptype;
-					ptype = (splinePara_t)KeywordList::Enumeration("WindowGlazingSystem::splinePara_t", p.m_name);
+					ptype = (splinePara_t)KeywordList::Enumeration<KeywordList::CategoryHash("WindowGlazingSystem::splinePara_t")>(p.m_name);
 					m_splinePara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -104,9 +104,8 @@ void WindowGlazingSystem::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "WindowGlazingLayer")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					WindowGlazingLayer obj;
-					obj.readXML(c2);
-					m_layers.push_back(obj);
+					m_layers.emplace_back();
+					m_layers.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -56,7 +56,7 @@ void Zone::readXMLPrivate(const TiXmlElement * element) {
 				m_displayName = attrib->ValueStr();
 			else if (attribName == "type")
 				try {
-					m_type = (type_t)KeywordList::Enumeration("Zone::type_t", attrib->ValueStr());
+					m_type = (type_t)KeywordList::Enumeration<KeywordList::CategoryHash("Zone::type_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -78,7 +78,7 @@ void Zone::readXMLPrivate(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("Zone::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("Zone::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
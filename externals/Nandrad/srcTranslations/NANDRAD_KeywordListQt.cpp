@@ -205,6 +205,8 @@ KeywordListQt::KeywordListQt() {
 	tr("Write values as calculated at output times.");
 	tr("Average values in time (mean value in output step).");
 	tr("Integrate values in time.");
+	tr("Minimum value in output step.");
+	tr("Maximum value in output step.");
 	tr("All days (Weekend days and Weekdays).");
 	tr("Weekday schedule.");
 	tr("Weekend schedule.");
@@ -247,6 +249,7 @@ KeywordListQt::KeywordListQt() {
 	tr("Flag activating CO2 balance calculation if enabled.");
 	tr("Flag activating ventilation through joints and openings.");
 	tr("Flag activating FMU export of climate data.");
+	tr("Flag activating exact gray-body radiosity method for inside long wave radiation exchange (instead of net exchange approximation).");
 	tr("Distribution based on surface area");
 	tr("Distribution based on surface type");
 	tr("Distribution based on zone-specific view factors");
@@ -279,6 +282,7 @@ KeywordListQt::KeywordListQt() {
 	tr("Check schedules to determine minimum distances between steps and adjust MaxTimeStep.");
 	tr("Disable line search for steady state cycles.");
 	tr("Enable strict Newton for steady state cycles.");
+	tr("Use matrix-free Jacobian-vector products in iterative LES solvers and update preconditioner only when convergence degrades.");
 	tr("CVODE based solver");
 	tr("Explicit Euler solver");
 	tr("Implicit Euler solver");
@@ -289,6 +293,7 @@ KeywordListQt::KeywordListQt() {
 	tr("BICGSTAB iterative solver");
 	tr("Automatic selection of linear equation system solver");
 	tr("Incomplete LU preconditioner");
+	tr("Block preconditioner with exact solution of construction blocks");
 	tr("Automatic selection of preconditioner");
 	tr("Constant set points");
 	tr("Scheduled set points");
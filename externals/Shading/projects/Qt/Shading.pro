@@ -35,11 +35,13 @@ INCLUDEPATH +=	\
 SOURCES += \
 		../../src/SH_Constants.cpp \
 		../../src/SH_ShadedSurfaceObject.cpp \
+		../../src/SH_ShadowMap.cpp \
 		../../src/SH_StructuralShading.cpp
 
 
 HEADERS += \
 		../../src/SH_Constants.h \
 		../../src/SH_ShadedSurfaceObject.h \
+		../../src/SH_ShadowMap.h \
 		../../src/SH_StructuralShading.h
 
@@ -81,7 +81,7 @@ void ShadedSurfaceObject::setPolygon(unsigned int id, std::string name, const IB
 }
 
 
-double ShadedSurfaceObject::calcShadingFactorWithRayTracing(const IBKMK::Vector3D &sunNormal, const std::vector<StructuralShading::ShadingObject> & obstacles) const {
+double ShadedSurfaceObject::calcShadingFactorWithRayTracing(const IBKMK::Vector3D &sunNormal, const std::vector<const StructuralShading::ShadingObject *> & obstacles) const {
 	unsigned int counterShadedPoints=0;
 
 	unsigned int sizeMiddlePoints = m_gridPoints.size();
@@ -91,25 +91,10 @@ double ShadedSurfaceObject::calcShadingFactorWithRayTracing(const IBKMK::Vector3
 		// process all obstacles
 		for (size_t j=0; j<obstacles.size(); ++j) {
 
-			if (m_id == obstacles[j].m_idVicus)
+			if (m_id == obstacles[j]->m_idVicus)
 				continue;
 
-			// compute intersection point of sun beam onto obstacle's plane
-			const IBKMK::Vector3D & offset = obstacles[j].m_polygon.vertexes()[0];
-			IBKMK::Vector3D intersectionPoint;
-			double dist;
-			if (!IBKMK::linePlaneIntersectionWithNormalCheck(offset, obstacles[j].m_polygon.normal(), // plane
-											  m_gridPoints[i], sunNormal, // line
-											  intersectionPoint, dist, !obstacles[j].m_isObstacle))
-				continue; // no intersection, next obstacle plane
-
-			// compute local coordinates of intersection point with obstacle
-			double x,y;
-			if (!IBKMK::planeCoordinates(offset, obstacles[j].m_polygon.localX(), obstacles[j].m_polygon.localY(), intersectionPoint, x, y))
-				continue; // projection not possible - this shouldn't happen, really!
-
-			// now test if x,y coordinates are inside obstacle's polyline
-			if (IBKMK::pointInPolygon(obstacles[j].m_polygon.polyline().vertexes(), IBK::point2D<double>(x,y)) >= 0) {
+			if (isPointShadedByObstacle(m_gridPoints[i], sunNormal, *obstacles[j])) {
 				++counterShadedPoints;
 				break; // we are shaded, stop searching
 			}
@@ -120,8 +105,30 @@ double ShadedSurfaceObject::calcShadingFactorWithRayTracing(const IBKMK::Vector3
 	return sf;
 }
 
+
+bool ShadedSurfaceObject::isPointShadedByObstacle(const IBKMK::Vector3D & p, const IBKMK::Vector3D & sunNormal,
+												  const StructuralShading::ShadingObject & obstacle)
+{
+	// compute intersection point of sun beam onto obstacle's plane
+	const IBKMK::Vector3D & offset = obstacle.m_polygon.vertexes()[0];
+	IBKMK::Vector3D intersectionPoint;
+	double dist;
+	if (!IBKMK::linePlaneIntersectionWithNormalCheck(offset, obstacle.m_polygon.normal(), // plane
+									  p, sunNormal, // line
+									  intersectionPoint, dist, !obstacle.m_isObstacle))
+		return false; // no intersection
+
+	// compute local coordinates of intersection point with obstacle
+	double x,y;
+	if (!IBKMK::planeCoordinates(offset, obstacle.m_polygon.localX(), obstacle.m_polygon.localY(), intersectionPoint, x, y))
+		return false; // projection not possible - this shouldn't happen, really!
+
+	// now test if x,y coordinates are inside obstacle's polyline
+	return IBKMK::pointInPolygon(obstacle.m_polygon.polyline().vertexes(), IBK::point2D<double>(x,y)) >= 0;
+}
+
 double ShadedSurfaceObject::calcShadingFactorWithClipping(unsigned int idxSun, const IBKMK::Vector3D &sunNormal,
-														  const std::vector<StructuralShading::ShadingObject> & obstacles) const {
+														  const std::vector<const StructuralShading::ShadingObject *> & obstacles) const {
 	// process all obstacles
 
 #ifdef WRITE_OUTPUT
@@ -182,7 +189,7 @@ double ShadedSurfaceObject::calcShadingFactorWithClipping(unsigned int idxSun, c
 	for (size_t j=0; j<obstacles.size(); ++j) {
 
 		ClipperLib::Path pathObstacle;
-		for(const IBKMK::Vector2D &v2D : obstacles[j].m_projectedPolys[idxSun])
+		for(const IBKMK::Vector2D &v2D : obstacles[j]->m_projectedPolys[idxSun])
 			pathObstacle << convertVector2D2ClipperIntPoint(v2D);
 
 		bool obstacleOrientation = ClipperLib::Orientation(pathObstacle);
@@ -195,14 +202,14 @@ double ShadedSurfaceObject::calcShadingFactorWithClipping(unsigned int idxSun, c
 		*m_outputFile << "------------------------------" << std::endl;
 		writePathToOutputFile("Obstacle Point: ", pathObstacle);
 		// *m_outputFile << "Parent ID of Surface: " << m_idParent << " | " << INVALID_ID;
-		// *m_outputFile << "Obstacle ID: " <<  obstacles[j].m_id;
+		// *m_outputFile << "Obstacle ID: " <<  obstacles[j]->m_id;
 #endif
 
 
-		if(m_idParent == INVALID_ID || m_idParent != obstacles[j].m_idVicus)
+		if(m_idParent == INVALID_ID || m_idParent != obstacles[j]->m_idVicus)
 			continue;
 
-		for(const std::vector<IBKMK::Vector2D> &hole : obstacles[j].m_projectedHoles[idxSun] ) {
+		for(const std::vector<IBKMK::Vector2D> &hole : obstacles[j]->m_projectedHoles[idxSun] ) {
 
 
 			ClipperLib::Path pathHole;
@@ -20,16 +20,27 @@ public:
 	void setPolygon(unsigned int id, std::string name, const IBKMK::Polygon3D & surface, const std::vector<IBKMK::Polygon2D> &holes,
 					unsigned int idParent = INVALID_ID, double gridWidth = 0.1, bool useClipping = false);
 
-	/*! Computes and returns shading factor for the given sun normal vector. */
-	double calcShadingFactorWithRayTracing(const IBKMK::Vector3D &sunNormal, const std::vector<StructuralShading::ShadingObject> & obstacles) const;
-
-	/*! Computes and returns shading factor for the given sun normal vector. */
+	/*! Computes and returns shading factor for the given sun normal vector.
+		\param obstacles Pointers to all obstacles that are potentially visible from this surface.
+	*/
+	double calcShadingFactorWithRayTracing(const IBKMK::Vector3D &sunNormal, const std::vector<const StructuralShading::ShadingObject *> & obstacles) const;
+
+	/*! Computes and returns shading factor for the given sun normal vector.
+		\param obstacles Pointers to all obstacles that are potentially visible from this surface.
+	*/
 	double calcShadingFactorWithClipping(unsigned int idxSun, const IBKMK::Vector3D & sunNormal,
-										 const std::vector<StructuralShading::ShadingObject> & obstacles) const;
+										 const std::vector<const StructuralShading::ShadingObject *> & obstacles) const;
 
 	/*! Updates the projected polygon 2D. */
 	void setProjectedPolygonAndHoles(const std::vector<IBKMK::Vector2D> & poly, const std::vector<std::vector<IBKMK::Vector2D> > & holes);
 
+	/*! Grid points (centers of sub-polygons) used for ray tracing and shadow map calculation, computed in setPolygon(). */
+	const std::vector<IBKMK::Vector3D> & gridPoints() const { return m_gridPoints; }
+
+	/*! Returns true, if the sun beam from point p towards the sun (direction sunNormal) hits the obstacle. */
+	static bool isPointShadedByObstacle(const IBKMK::Vector3D & p, const IBKMK::Vector3D &sunNormal,
+										const StructuralShading::ShadingObject & obstacle);
+
 #ifdef WRITE_OUTPUT
 	void setOutputFile(std::ofstream * newOutputFile);
 #endif
@@ -0,0 +1,154 @@
+#include "SH_ShadowMap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <IBK_assert.h>
+
+#include "SH_Constants.h"
+
+namespace SH {
+
+const unsigned int ShadowMap::MAX_TEXEL_COUNT = 16*1024*1024;
+
+
+void ShadowMap::setup(const IBKMK::Vector3D & sunNormal, const std::vector<IBKMK::Vector3D> & points, double texelSize,
+					  unsigned int maxTexelCount)
+{
+	IBK_ASSERT(texelSize > 0);
+	IBK_ASSERT(maxTexelCount > 0);
+
+	// compose sun plane coordinate system
+	m_s = sunNormal;
+	m_s.normalize();
+	// use the coordinate axis that is least aligned with the sun normal as helper vector
+	IBKMK::Vector3D helper(1,0,0);
+	if (std::fabs(m_s.m_y) < std::fabs(m_s.m_x) && std::fabs(m_s.m_y) <= std::fabs(m_s.m_z))
+		helper = IBKMK::Vector3D(0,1,0);
+	else if (std::fabs(m_s.m_z) < std::fabs(m_s.m_x) && std::fabs(m_s.m_z) < std::fabs(m_s.m_y))
+		helper = IBKMK::Vector3D(0,0,1);
+	m_u = m_s.crossProduct(helper);
+	m_u.normalize();
+	m_v = m_s.crossProduct(m_u);
+	m_v.normalize();
+
+	m_nu = m_nv = 0;
+	// Note: clear() keeps the capacity, so that memory is reused when the map is set up again
+	m_depth.clear();
+	m_owner.clear();
+	if (points.empty())
+		return;
+
+	// extent of all points in sun plane
+	double uMin = std::numeric_limits<double>::max();
+	double uMax = -std::numeric_limits<double>::max();
+	double vMin = uMin;
+	double vMax = uMax;
+	for (const IBKMK::Vector3D & p : points) {
+		double u = p.scalarProduct(m_u);
+		double v = p.scalarProduct(m_v);
+		uMin = std::min(uMin, u);
+		uMax = std::max(uMax, u);
+		vMin = std::min(vMin, v);
+		vMax = std::max(vMax, v);
+	}
+
+	// add a margin of one texel to each side
+	double width = uMax - uMin + 2*texelSize;
+	double height = vMax - vMin + 2*texelSize;
+	// limit map size
+	double texelCount = (width/texelSize)*(height/texelSize);
+	if (texelCount > maxTexelCount)
+		texelSize *= std::sqrt(texelCount/maxTexelCount)*1.001;
+
+	m_texelSize = texelSize;
+	m_u0 = uMin - texelSize;
+	m_v0 = vMin - texelSize;
+	m_nu = (unsigned int)std::ceil(width/texelSize);
+	m_nv = (unsigned int)std::ceil(height/texelSize);
+	m_depth.resize(m_nu*m_nv, -std::numeric_limits<float>::max());
+	m_owner.resize(m_nu*m_nv, INVALID_ID);
+}
+
+
+void ShadowMap::rasterize(const std::vector<std::vector<IBKMK::Vector3D> > & rings, const IBKMK::Vector3D & normal, unsigned int ownerId) {
+	if (m_nu == 0 || rings.empty() || rings[0].empty())
+		return;
+
+	// polygons parallel to the sun beam do not cast a shadow
+	double nS = normal.scalarProduct(m_s);
+	if (std::fabs(nS) < 1e-8)
+		return;
+
+	// depth on polygon plane as function of sun plane coordinates: t = t0 + dtdu*u + dtdv*v
+	double t0 = normal.scalarProduct(rings[0][0])/nS;
+	double dtdu = -normal.scalarProduct(m_u)/nS;
+	double dtdv = -normal.scalarProduct(m_v)/nS;
+
+	// project all rings into sun plane
+	std::vector<std::vector<std::pair<double, double> > > projRings(rings.size());
+	double vMin = std::numeric_limits<double>::max();
+	double vMax = -std::numeric_limits<double>::max();
+	for (unsigned int r=0; r<rings.size(); ++r) {
+		projRings[r].reserve(rings[r].size());
+		for (const IBKMK::Vector3D & p : rings[r]) {
+			double u = (p.scalarProduct(m_u) - m_u0)/m_texelSize;
+			double v = (p.scalarProduct(m_v) - m_v0)/m_texelSize;
+			projRings[r].push_back(std::make_pair(u, v));
+			vMin = std::min(vMin, v);
+			vMax = std::max(vMax, v);
+		}
+	}
+
+	// range of texel rows whose centers lie within the polygon's extent
+	int rowStart = std::max(0, (int)std::ceil(vMin - 0.5));
+	int rowEnd = std::min((int)m_nv - 1, (int)std::floor(vMax - 0.5));
+
+	// scan line algorithm with even-odd rule
+	std::vector<double> crossings;
+	for (int row = rowStart; row <= rowEnd; ++row) {
+		double vc = row + 0.5;
+		crossings.clear();
+		for (const std::vector<std::pair<double, double> > & ring : projRings) {
+			for (unsigned int i=0, count=(unsigned int)ring.size(); i<count; ++i) {
+				const std::pair<double, double> & a = ring[i];
+				const std::pair<double, double> & b = ring[(i+1) % count];
+				if ((a.second <= vc) != (b.second <= vc))
+					crossings.push_back(a.first + (vc - a.second)/(b.second - a.second)*(b.first - a.first));
+			}
+		}
+		std::sort(crossings.begin(), crossings.end());
+
+		double vWorld = m_v0 + vc*m_texelSize;
+		for (unsigned int k=0; k+1<crossings.size(); k += 2) {
+			int colStart = std::max(0, (int)std::ceil(crossings[k] - 0.5));
+			int colEnd = std::min((int)m_nu - 1, (int)std::floor(crossings[k+1] - 0.5));
+			unsigned int idx = (unsigned int)row*m_nu + (unsigned int)colStart;
+			for (int col = colStart; col <= colEnd; ++col, ++idx) {
+				double uWorld = m_u0 + (col + 0.5)*m_texelSize;
+				float t = (float)(t0 + dtdu*uWorld + dtdv*vWorld);
+				if (t > m_depth[idx]) {
+					m_depth[idx] = t;
+					m_owner[idx] = ownerId;
+				}
+			}
+		}
+	}
+}
+
+
+bool ShadowMap::isShaded(const IBKMK::Vector3D & p, double bias, unsigned int ignoreId1, unsigned int ignoreId2) const {
+	if (m_nu == 0)
+		return false;
+	int col = (int)std::floor((p.scalarProduct(m_u) - m_u0)/m_texelSize);
+	int row = (int)std::floor((p.scalarProduct(m_v) - m_v0)/m_texelSize);
+	if (col < 0 || row < 0 || col >= (int)m_nu || row >= (int)m_nv)
+		return false;
+	unsigned int idx = (unsigned int)row*m_nu + (unsigned int)col;
+	if (m_owner[idx] == INVALID_ID || m_owner[idx] == ignoreId1 || m_owner[idx] == ignoreId2)
+		return false;
+	return m_depth[idx] > p.scalarProduct(m_s) + bias;
+}
+
+} // namespace SH
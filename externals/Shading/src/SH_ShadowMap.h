@@ -0,0 +1,79 @@
+#ifndef SH_ShadowMapH
+#define SH_ShadowMapH
+
+#include <vector>
+
+#include <IBKMK_Vector3D.h>
+
+namespace SH {
+
+/*! An orthographic shadow map (depth buffer) for a single sun direction.
+
+	The map lies in the sun plane, which is spanned by two vectors perpendicular to the sun normal. All obstacles
+	are rasterized into the map, whereby each texel stores the depth (coordinate along sun normal, larger values are
+	closer to the sun) of the obstacle closest to the sun, and the ID of this obstacle.
+	A point is shaded, if the depth stored in its texel is larger than the point's own depth.
+
+	The effort for rasterization is proportional to the number of texels covered by the obstacles, so that the
+	overall effort for a shading calculation grows roughly linear with the scene size.
+*/
+class ShadowMap {
+public:
+	/*! Initializes sun plane coordinate system and map extent.
+		\param sunNormal Normal vector pointing to the sun.
+		\param points All points that need to be looked up later (receiver sample points), the map is sized to cover
+			all of them.
+		\param texelSize Requested texel size in [m], may be increased if the map would get too large.
+		\param maxTexelCount Maximum number of texels in the map, texel size is increased accordingly.
+			When calling setup() on an existing map, memory of the previous map is reused.
+	*/
+	void setup(const IBKMK::Vector3D & sunNormal, const std::vector<IBKMK::Vector3D> & points, double texelSize,
+			   unsigned int maxTexelCount = MAX_TEXEL_COUNT);
+
+	/*! Rasterizes a planar polygon into the depth buffer.
+		\param rings Outer polygon and holes, all given with 3D coordinates. Holes are handled with even-odd rule.
+		\param normal Normal vector of the polygon's plane.
+		\param ownerId ID stored in all texels where this polygon is closest to the sun.
+	*/
+	void rasterize(const std::vector<std::vector<IBKMK::Vector3D> > & rings, const IBKMK::Vector3D & normal, unsigned int ownerId);
+
+	/*! Returns true if the point p is shaded.
+		\param bias Depth tolerance in [m] to avoid self-shading due to the finite texel size.
+		\param ignoreId1 Obstacles with this ID do not shade the point (usually the ID of the receiving surface).
+		\param ignoreId2 Obstacles with this ID do not shade the point (usually the ID of the parent surface).
+	*/
+	bool isShaded(const IBKMK::Vector3D & p, double bias, unsigned int ignoreId1, unsigned int ignoreId2) const;
+
+	/*! Texel size in [m] actually used. */
+	double texelSize() const { return m_texelSize; }
+
+	/*! Default maximum number of texels in the map (limits memory use to about 128 MB per map). */
+	static const unsigned int MAX_TEXEL_COUNT;
+
+private:
+	/*! First vector spanning the sun plane. */
+	IBKMK::Vector3D				m_u;
+	/*! Second vector spanning the sun plane. */
+	IBKMK::Vector3D				m_v;
+	/*! Sun normal (depth direction). */
+	IBKMK::Vector3D				m_s;
+
+	/*! Sun plane coordinates of lower left corner of the map. */
+	double						m_u0 = 0;
+	double						m_v0 = 0;
+	/*! Texel size in [m]. */
+	double						m_texelSize = 0.1;
+	/*! Number of texels in u direction. */
+	unsigned int				m_nu = 0;
+	/*! Number of texels in v direction. */
+	unsigned int				m_nv = 0;
+
+	/*! Depth of obstacle closest to sun (size m_nu*m_nv, row-major). */
+	std::vector<float>			m_depth;
+	/*! ID of obstacle closest to sun (size m_nu*m_nv, row-major). */
+	std::vector<unsigned int>	m_owner;
+};
+
+} // namespace SH
+
+#endif // SH_ShadowMapH
@@ -36,12 +36,14 @@
 #include <DATAIO_DataIO.h>
 
 #include <cmath>
+#include <algorithm>
 
 #include <QMatrix4x4>
 
 #include <fstream>
 
 #include "SH_ShadedSurfaceObject.h"
+#include "SH_ShadowMap.h"
 
 #if defined(_OPENMP)
 #include <omp.h> // needed for omp_get_num_threads()
@@ -76,6 +78,52 @@ static double angleVectors(const IBKMK::Vector3D &v1, const IBKMK::Vector3D &v2)
 }
 
 
+/*! Combines hash value h with the bytes of the given memory block (FNV-1a, 64 bit).
+	We do not use std::hash here, since the cache keys are stored in files and must not depend on the
+	standard library implementation.
+*/
+static void hashCombine(unsigned long long & h, const void * data, std::size_t size) {
+	const unsigned char * bytes = reinterpret_cast<const unsigned char *>(data);
+	for (std::size_t i=0; i<size; ++i) {
+		h ^= bytes[i];
+		h *= 1099511628211ull;
+	}
+}
+
+template <typename T>
+static void hashCombine(unsigned long long & h, const T & val) {
+	hashCombine(h, &val, sizeof(T));
+}
+
+
+/*! Computes hash value of a shading object's geometry (including holes) and its ID properties. */
+static unsigned long long geometryHash(const StructuralShading::ShadingObject & so) {
+	unsigned long long h = 14695981039346656037ull;
+	hashCombine(h, so.m_idVicus);
+	hashCombine(h, so.m_idParent);
+	hashCombine(h, so.m_isObstacle);
+	for (const IBKMK::Vector3D & v : so.m_polygon.vertexes()) {
+		hashCombine(h, v.m_x);
+		hashCombine(h, v.m_y);
+		hashCombine(h, v.m_z);
+	}
+	for (const IBKMK::Polygon2D & hole : so.m_holes) {
+		unsigned int n = (unsigned int)hole.vertexes().size();
+		hashCombine(h, n);
+		for (const IBKMK::Vector2D & v : hole.vertexes()) {
+			hashCombine(h, v.m_x);
+			hashCombine(h, v.m_y);
+		}
+	}
+	return h;
+}
+
+
+/*! Magic header and version of shading factor cache files. */
+static const unsigned int SHADING_CACHE_MAGIC = 0x53484643; // 'SHFC'
+static const unsigned int SHADING_CACHE_VERSION = 1;
+
+
 void StructuralShading::initializeShadingCalculation(int timeZone, double longitudeInDeg, double latitudeInDeg,
 													 const IBK::Time & startTime, unsigned int duration, unsigned int samplingPeriod,
 													 double sunConeDeg)
@@ -120,9 +168,11 @@ void StructuralShading::setGeometry(const std::vector<ShadingObject> & surfaces,
 	}
 }
 
-void StructuralShading::calculateShadingFactors(Notification * notify, double gridWidth, bool useClippingMethod, IBK::Path currentDir) {
+void StructuralShading::calculateShadingFactors(Notification * notify, double gridWidth, CalculationMethod method, IBK::Path currentDir) {
 	FUNCID(StructuralShading::calculateShadingFactors);
 
+	bool useClippingMethod = method == SCM_SurfaceClipping;
+
 	// TODO Stephan, input data check
 	m_gridWidth = gridWidth;
 	if (gridWidth <= 0)
@@ -151,11 +201,29 @@ void StructuralShading::calculateShadingFactors(Notification * notify, double gr
 	// Find visible shading surfaces for each surface
 	findVisibleSurfaces(useClippingMethod);
 
+	// take shading factors of unchanged surfaces from cache and collect all surfaces that need to be computed
+	computeSurfaceCacheKeys(method);
+	std::vector<unsigned int> surfacesToCompute;
+	std::vector<char> surfaceDone(m_surfaces.size(), false); // Note: no vector<bool> since it is written to in parallel
+	m_cachedSurfaceCount = 0;
+	for (unsigned int i=0; i<m_surfaces.size(); ++i) {
+		std::map<unsigned long long, std::vector<double> >::const_iterator it = m_shadingFactorCache.find(m_surfaceCacheKeys[i]);
+		if (it != m_shadingFactorCache.end() && it->second.size() == m_sunConeNormals.size()) {
+			m_shadingFactors[i] = it->second;
+			surfaceDone[i] = true;
+			++m_cachedSurfaceCount;
+		}
+		else
+			surfacesToCompute.push_back(i);
+	}
+	if (m_cachedSurfaceCount > 0)
+		IBK::IBK_Message(IBK::FormatString("Shading factors of %1 of %2 surfaces taken from cache.\n")
+						 .arg(m_cachedSurfaceCount).arg(m_surfaces.size()));
+
 	IBK::IBK_Message(IBK::FormatString("Initialize shading calculation"));
 
-#if defined(_OPENMP)
 	int threadCount = 1;
-
+#if defined(_OPENMP)
 #pragma omp parallel
 	{
 		if (omp_get_thread_num() == 0) {
@@ -176,7 +244,6 @@ void StructuralShading::calculateShadingFactors(Notification * notify, double gr
 	w.start();
 	v.start();
 	notify->notify(0);
-	int surfacesCompleted = 0;
 
 #ifdef WRITE_OUTPUT
 	// Create Shading debugging path
@@ -186,119 +253,377 @@ void StructuralShading::calculateShadingFactors(Notification * notify, double gr
 	IBK::Path::makePath(path);
 #endif
 
+	if (method == SCM_ShadowMap) {
+		calculateShadingFactorsWithShadowMap(notify, surfacesToCompute, surfaceDone);
+	}
+	else {
+		// prepare sub-polygon grids and lists of visible obstacles for all surfaces
+		std::vector<ShadedSurfaceObject> surfaceObjects(surfacesToCompute.size());
+		// Note: obstacles are referenced by pointers into m_obstacles, which is not modified during the calculation
+		std::vector<std::vector<const ShadingObject *> > surfaceObstacles(surfacesToCompute.size());
 #if defined(_OPENMP)
 #pragma omp parallel for schedule(dynamic, 1)
 #endif
-	for (int surfCounter = 0; surfCounter < (int)m_surfaces.size(); ++surfCounter) {
-		try {
-			if (notify->m_aborted)
-				continue; // skip ahead to quickly stop loop
-
-			// our thread "owns" the shading factor vector, hence we can directly write to it without
-			// openmp blocking sections
-			// 'shadingFactors' is just a readability improvement to the existing vector
-			std::vector<double> & shadingFactors = m_shadingFactors[(unsigned int)surfCounter];
-
-			// readability improvement
-			const ShadingObject & so = m_surfaces[(unsigned int)surfCounter];
-
+		for (int surfCounter = 0; surfCounter < (int)surfacesToCompute.size(); ++surfCounter) {
+			const ShadingObject & so = m_surfaces[surfacesToCompute[(unsigned int)surfCounter]];
 
 			// 1. split polygon 'surf' into sub-polygons based on grid information and compute center point of these sub-polygons
-
-			ShadedSurfaceObject surfaceObject;
-			surfaceObject.setPolygon(so.m_idVicus, so.m_name, so.m_polygon, so.m_holes, so.m_idParent, m_gridWidth, useClippingMethod);
-
-			std::vector<ShadingObject> shadingObstacles;
+			surfaceObjects[(unsigned int)surfCounter].setPolygon(so.m_idVicus, so.m_name, so.m_polygon, so.m_holes, so.m_idParent, m_gridWidth, useClippingMethod);
 
 			// must only use read-only access to shared-memory variables
 			for (const ShadingObject &shading : m_obstacles)
 				if (so.m_visibleSurfaces.find(shading.m_id) != so.m_visibleSurfaces.end())
-					shadingObstacles.push_back(shading);
+					surfaceObstacles[(unsigned int)surfCounter].push_back(&shading);
+		}
 
+		// We parallelize over surfaces and sun cones: each work item is a surface together with a contiguous
+		// block of sun cones. The sun cones are only split into blocks when there are too few surfaces to keep
+		// all threads busy (e.g. a single building with a few large surfaces).
+		const unsigned int coneCount = m_sunConeNormals.size();
+		unsigned int blocksPerSurface = 1;
+		if (!surfacesToCompute.empty()) {
+			unsigned int minWorkItems = 8*(unsigned int)threadCount;
+			blocksPerSurface = (minWorkItems + surfacesToCompute.size() - 1)/surfacesToCompute.size();
+			blocksPerSurface = std::max(1u, std::min(blocksPerSurface, coneCount));
+		}
+		const unsigned int blockSize = coneCount == 0 ? 1 : (coneCount + blocksPerSurface - 1)/blocksPerSurface;
+		const int workItemCount = (int)(surfacesToCompute.size()*blocksPerSurface);
+		unsigned int conesCompleted = 0;
+		// flag for surfaces where calculation failed for at least one sun cone, these are not put into the cache
+		std::vector<char> surfaceFailed(m_surfaces.size(), false);
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+		for (int workItem = 0; workItem < workItemCount; ++workItem) {
+			// index of surface in surfacesToCompute and in m_surfaces
+			unsigned int surfCounter = (unsigned int)workItem/blocksPerSurface;
+			unsigned int surfIdx = surfacesToCompute[surfCounter];
+			// range of sun cones processed in this work item
+			unsigned int coneStart = ((unsigned int)workItem % blocksPerSurface)*blockSize;
+			unsigned int coneEnd = std::min(coneStart + blockSize, coneCount);
+			try {
+				if (notify->m_aborted)
+					continue; // skip ahead to quickly stop loop
+
+				// each work item "owns" its range of the shading factor vector, hence we can directly write to it without
+				// openmp blocking sections
+				// 'shadingFactors' is just a readability improvement to the existing vector
+				std::vector<double> & shadingFactors = m_shadingFactors[surfIdx];
 
-			// 2. for each center point perform intersection tests again _all_ obstacle polygons
-			for (unsigned int i=0; i<m_sunConeNormals.size(); ++i) {
+				// readability improvement
+				const ShadingObject & so = m_surfaces[surfIdx];
+				const std::vector<const ShadingObject *> & shadingObstacles = surfaceObstacles[surfCounter];
+
+				// the clipping algorithm stores the projected polygon in the surface object, hence we need our own copy
+				ShadedSurfaceObject clippingSurfaceObject;
+				if (useClippingMethod)
+					clippingSurfaceObject = surfaceObjects[surfCounter];
+
+				// 2. for each center point perform intersection tests again _all_ obstacle polygons
+				for (unsigned int i=coneStart; i<coneEnd; ++i) {
 
 #ifdef WRITE_OUTPUT
 
 
-				std::ofstream out(QString("%3/shading_info_%1_%2.txt")
-								  .arg(QString::fromStdString(so.m_name))
-								  .arg(i)
-								  .arg(QString::fromStdString(path.absolutePath().str())).toStdString());
-				out << "Shading calculation for surface " << so.m_name << std::endl;
-				out << "Sun normal: X:" << m_sunConeNormals[i].m_x << " Y: " << m_sunConeNormals[i].m_y << "Z: " << m_sunConeNormals[i].m_z;
-				out << std::endl;
-//				out << "Visible Shading objects:" << std::endl;
-//				for (const ShadingObject &shading : shadingObstacles)
-//					out << shading.m_idVicus << ": " <<shading.m_name << std::endl;
-//				out << std::endl;
+					std::ofstream out(QString("%3/shading_info_%1_%2.txt")
+									  .arg(QString::fromStdString(so.m_name))
+									  .arg(i)
+									  .arg(QString::fromStdString(path.absolutePath().str())).toStdString());
+					out << "Shading calculation for surface " << so.m_name << std::endl;
+					out << "Sun normal: X:" << m_sunConeNormals[i].m_x << " Y: " << m_sunConeNormals[i].m_y << "Z: " << m_sunConeNormals[i].m_z;
+					out << std::endl;
+	//				out << "Visible Shading objects:" << std::endl;
+	//				for (const ShadingObject &shading : shadingObstacles)
+	//					out << shading.m_idVicus << ": " <<shading.m_name << std::endl;
+	//				out << std::endl;
 #endif
 
-				if (notify->m_aborted)
-					continue; // skip ahead to quickly stop loop
+					if (notify->m_aborted)
+						continue; // skip ahead to quickly stop loop
 
-				double angle = angleVectors(m_sunConeNormals[i], so.m_polygon.normal());
-				//				// if sun does not shine uppon surface, no shading factor needed
-				if (angle >= 90)
-					continue;
+					double angle = angleVectors(m_sunConeNormals[i], so.m_polygon.normal());
+					//				// if sun does not shine uppon surface, no shading factor needed
+					if (angle >= 90)
+						continue;
 
-				double sf;
-				if (!useClippingMethod)
-					sf = surfaceObject.calcShadingFactorWithRayTracing(m_sunConeNormals[i], shadingObstacles);
-				else {
-					surfaceObject.setProjectedPolygonAndHoles(so.m_projectedPolys[i], so.m_projectedHoles[i]);
+					double sf;
+					if (!useClippingMethod)
+						sf = surfaceObjects[surfCounter].calcShadingFactorWithRayTracing(m_sunConeNormals[i], shadingObstacles);
+					else {
+						clippingSurfaceObject.setProjectedPolygonAndHoles(so.m_projectedPolys[i], so.m_projectedHoles[i]);
 #ifdef WRITE_OUTPUT
-					surfaceObject.setOutputFile(&out);
+						clippingSurfaceObject.setOutputFile(&out);
 #endif
-					sf = surfaceObject.calcShadingFactorWithClipping(i, m_sunConeNormals[i], shadingObstacles);
-				}
+						sf = clippingSurfaceObject.calcShadingFactorWithClipping(i, m_sunConeNormals[i], shadingObstacles);
+					}
 
-				//				// 3. store shaded/not shaded information for sub-polygon and its surface area
-				//				// 4. compute area-weighted sum of shading factors and devide by orginal polygon surface
-				//				// 5. store in result vector
-				shadingFactors[i] = sf;
+					//				// 3. store shaded/not shaded information for sub-polygon and its surface area
+					//				// 4. compute area-weighted sum of shading factors and devide by orginal polygon surface
+					//				// 5. store in result vector
+					shadingFactors[i] = sf;
 
 #ifdef WRITE_OUTPUT
-				out << "Calculated shading factor for sun cone index " << i  << ": " << sf << std::endl;
-				out.flush();
+					out << "Calculated shading factor for sun cone index " << i  << ": " << sf << std::endl;
+					out.flush();
 #endif
 
-				// master thread 0 updates the progress dialog; this should be good enough for longer runs
+					// master thread 0 updates the progress dialog; this should be good enough for longer runs
 #if defined(_OPENMP)
-				if ( omp_get_thread_num() == 0) {
+					if ( omp_get_thread_num() == 0) {
 #endif
-					// only notify every second or so
-					if (!notify->m_aborted && w.difference() > 1000) {
-						notify->notify(double(surfacesCompleted*m_sunConeNormals.size() + i) / (m_surfaces.size()*m_sunConeNormals.size()) );
-						w.start();
-					}
+						// only notify every second or so
+						if (!notify->m_aborted && w.difference() > 1000) {
+							notify->notify(double(conesCompleted + i - coneStart) / (surfacesToCompute.size()*coneCount) );
+							w.start();
+						}
 #if defined(_OPENMP)
+					}
+#endif
 				}
+
+			}
+			catch (...) {
+				// notify->m_aborted = true;
+				// IBK::IBK_Message(IBK::FormatString("Shading calculation encountered errors"), IBK::MSG_ERROR, FUNC_ID);
+#if defined(_OPENMP)
+#pragma omp critical
 #endif
+				surfaceFailed[surfIdx] = true;
 			}
 
-
-			// increase number of completed surfaces (done by all threads, hence in critical section)
+			// increase number of completed sun cone evaluations (done by all threads, hence in critical section)
 #if defined(_OPENMP)
 #pragma omp critical
 #endif
-			++surfacesCompleted;
+			conesCompleted += coneEnd - coneStart;
 
-		}
-		catch (...) {
-			// notify->m_aborted = true;
-			// IBK::IBK_Message(IBK::FormatString("Shading calculation encountered errors"), IBK::MSG_ERROR, FUNC_ID);
-		}
+		} // omp for loop
 
-	} // omp for loop
+		// only completely computed surfaces are stored in cache
+		if (!notify->m_aborted)
+			for (unsigned int surfIdx : surfacesToCompute)
+				surfaceDone[surfIdx] = !surfaceFailed[surfIdx];
+	}
 	notify->notify(1.0);
 
+	// update cache with shading factors of all surfaces of this calculation; entries of surfaces no longer
+	// present (or with changed geometry) are dropped
+	if (!notify->m_aborted) {
+		std::map<unsigned long long, std::vector<double> > cache;
+		for (unsigned int i=0; i<m_surfaces.size(); ++i)
+			if (surfaceDone[i])
+				cache[m_surfaceCacheKeys[i]] = m_shadingFactors[i];
+		m_shadingFactorCache.swap(cache);
+	}
+
 
 	IBK::IBK_Message(IBK::FormatString("Finished after %1.\n").arg(totalTimer.diff_str()));
 }
 
 
+void StructuralShading::calculateShadingFactorsWithShadowMap(Notification * notify, const std::vector<unsigned int> & surfaceIndexes,
+															 std::vector<char> & surfaceDone)
+{
+	// *** prepare receivers
+
+	// sample points of all surfaces (same as used for ray tracing), also collected in a single vector for sizing the map
+	std::vector<std::vector<IBKMK::Vector3D> > samplePoints(surfaceIndexes.size());
+	std::vector<IBKMK::Vector3D> allSamplePoints;
+	// obstacles that belong to a surface (e.g. window reveals) only shade this surface, hence they are not rasterized
+	// into the shadow map but ray-traced for their surface only
+	std::vector<std::vector<const ShadingObject *> > localObstacles(surfaceIndexes.size());
+	for (unsigned int k=0; k<surfaceIndexes.size(); ++k) {
+		const ShadingObject & so = m_surfaces[surfaceIndexes[k]];
+		ShadedSurfaceObject surfaceObject;
+		surfaceObject.setPolygon(so.m_idVicus, so.m_name, so.m_polygon, so.m_holes, so.m_idParent, m_gridWidth, false);
+		samplePoints[k] = surfaceObject.gridPoints();
+		allSamplePoints.insert(allSamplePoints.end(), samplePoints[k].begin(), samplePoints[k].end());
+		for (const ShadingObject & obst : m_obstacles)
+			if (obst.m_idParent == so.m_idVicus && so.m_visibleSurfaces.find(obst.m_id) != so.m_visibleSurfaces.end())
+				localObstacles[k].push_back(&obst);
+	}
+
+	// *** prepare obstacles: outer polygon and holes in 3D coordinates
+
+	std::vector<const ShadingObject *> globalObstacles;
+	std::vector<std::vector<std::vector<IBKMK::Vector3D> > > obstacleRings;
+	for (const ShadingObject & obst : m_obstacles) {
+		if (obst.m_idParent != INVALID_ID)
+			continue;
+		globalObstacles.push_back(&obst);
+		std::vector<std::vector<IBKMK::Vector3D> > rings(1, obst.m_polygon.vertexes());
+		const IBKMK::Polygon3D & p = obst.m_polygon;
+		for (const IBKMK::Polygon2D & hole : obst.m_holes) {
+			rings.push_back(std::vector<IBKMK::Vector3D>());
+			for (const IBKMK::Vector2D & v2D : hole.vertexes())
+				rings.back().push_back(p.offset() + p.localX()*v2D.m_x + p.localY()*v2D.m_y);
+		}
+		obstacleRings.push_back(rings);
+	}
+
+	// *** compute shadow maps for all sun cones in parallel
+
+	IBK::StopWatch w;
+	w.start();
+	int conesCompleted = 0;
+	// set when computation for any sun cone failed, in this case no surface is put into the cache
+	bool calculationFailed = false;
+
+	// each thread holds one shadow map at a time; we limit the total memory of all maps to that of a single
+	// map with default size by reducing the texel count per map
+	unsigned int maxTexelCount = ShadowMap::MAX_TEXEL_COUNT;
+#if defined(_OPENMP)
+	maxTexelCount /= (unsigned int)std::max(1, omp_get_max_threads());
+#pragma omp parallel
+#endif
+	{
+		// one shadow map per thread, memory is reused for all sun cones processed by this thread
+		ShadowMap shadowMap;
+
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic, 1)
+#endif
+		for (int i = 0; i < (int)m_sunConeNormals.size(); ++i) {
+			if (notify->m_aborted)
+				continue; // skip ahead to quickly stop loop
+
+			const IBKMK::Vector3D & sunNormal = m_sunConeNormals[(unsigned int)i];
+
+			try {
+				shadowMap.setup(sunNormal, allSamplePoints, m_gridWidth, maxTexelCount);
+				for (unsigned int j=0; j<globalObstacles.size(); ++j) {
+					// same as with ray tracing: surfaces of buildings only cast shadows with their sun-averted side
+					// (the closed building volume yields the same shadow), this also avoids self-shading artifacts
+					const IBKMK::Vector3D & n = globalObstacles[j]->m_polygon.normal();
+					if (!globalObstacles[j]->m_isObstacle && n.scalarProduct(sunNormal) >= 0)
+						continue;
+					shadowMap.rasterize(obstacleRings[j], n, globalObstacles[j]->m_idVicus);
+				}
+
+				for (unsigned int k=0; k<surfaceIndexes.size(); ++k) {
+					const ShadingObject & so = m_surfaces[surfaceIndexes[k]];
+					double angle = angleVectors(sunNormal, so.m_polygon.normal());
+					// if sun does not shine uppon surface, no shading factor needed
+					if (angle >= 90 || samplePoints[k].empty())
+						continue;
+
+					// depth tolerance grows with inclination of the surface towards the sun beam, limited to 10 texels
+					double cosAngle = std::cos(angle*IBK::DEG2RAD);
+					double slope = std::min(10.0, std::sqrt(1 - cosAngle*cosAngle)/std::max(cosAngle, 1e-8));
+					double bias = shadowMap.texelSize()*(1 + slope);
+
+					unsigned int shadedPoints = 0;
+					for (const IBKMK::Vector3D & p : samplePoints[k]) {
+						bool shaded = shadowMap.isShaded(p, bias, so.m_idVicus, so.m_idParent);
+						for (unsigned int l=0; !shaded && l<localObstacles[k].size(); ++l)
+							shaded = ShadedSurfaceObject::isPointShadedByObstacle(p, sunNormal, *localObstacles[k][l]);
+						if (shaded)
+							++shadedPoints;
+					}
+					m_shadingFactors[surfaceIndexes[k]][(unsigned int)i] = 1 - double(shadedPoints)/samplePoints[k].size();
+				}
+			}
+			catch (...) {
+				// exceptions must not leave the parallel region; shading factors of this sun cone remain 0
+#if defined(_OPENMP)
+#pragma omp critical
+#endif
+				calculationFailed = true;
+			}
+
+#if defined(_OPENMP)
+#pragma omp critical
+#endif
+			++conesCompleted;
+
+			// master thread 0 updates the progress dialog
+#if defined(_OPENMP)
+			if ( omp_get_thread_num() == 0) {
+#endif
+				if (!notify->m_aborted && w.difference() > 1000) {
+					notify->notify(double(conesCompleted) / m_sunConeNormals.size());
+					w.start();
+				}
+#if defined(_OPENMP)
+			}
+#endif
+		} // omp for loop
+	} // omp parallel
+
+	if (calculationFailed)
+		IBK::IBK_Message("Shadow map calculation failed for some sun positions, results are not cached.", IBK::MSG_WARNING);
+
+	if (!notify->m_aborted && !calculationFailed)
+		for (unsigned int surfIdx : surfaceIndexes)
+			surfaceDone[surfIdx] = true;
+}
+
+
+void StructuralShading::readShadingCache(const IBK::Path & cacheFile) {
+	FUNCID(StructuralShading::readShadingCache);
+
+	std::ifstream in;
+	if (!IBK::open_ifstream(in, cacheFile, std::ios_base::in | std::ios_base::binary))
+		throw IBK::Exception(IBK::FormatString("Could not open shading cache file '%1'.").arg(cacheFile), FUNC_ID);
+
+	unsigned int magic = 0, version = 0, count = 0;
+	in.read(reinterpret_cast<char*>(&magic), sizeof(unsigned int));
+	in.read(reinterpret_cast<char*>(&version), sizeof(unsigned int));
+	in.read(reinterpret_cast<char*>(&count), sizeof(unsigned int));
+	if (!in || magic != SHADING_CACHE_MAGIC || version != SHADING_CACHE_VERSION)
+		throw IBK::Exception(IBK::FormatString("'%1' is not a valid shading cache file (or has been written by a different version).")
+							 .arg(cacheFile), FUNC_ID);
+	// Note: the cache may hold entries of surfaces that have been removed since the last calculation. These are
+	//       never matched in calculateShadingFactors() and dropped when the cache is written again.
+	std::map<unsigned long long, std::vector<double> > cache;
+	for (unsigned int i=0; i<count; ++i) {
+		unsigned long long key;
+		unsigned int n;
+		in.read(reinterpret_cast<char*>(&key), sizeof(unsigned long long));
+		in.read(reinterpret_cast<char*>(&n), sizeof(unsigned int));
+		if (!in)
+			break;
+		// each entry holds one shading factor per sun cone normal, anything else is a
+		// corrupt file or a cache from a calculation with different sun positions
+		if (n != m_sunConeNormals.size())
+			throw IBK::Exception(IBK::FormatString("Shading cache file '%1' holds %2 shading factors per surface, "
+												   "expected %3.").arg(cacheFile).arg(n).arg(m_sunConeNormals.size()), FUNC_ID);
+		std::vector<double> & sf = cache[key];
+		sf.resize(n);
+		if (n > 0)
+			in.read(reinterpret_cast<char*>(&sf[0]), (std::streamsize)(n*sizeof(double)));
+	}
+	if (!in)
+		throw IBK::Exception(IBK::FormatString("Error reading shading cache file '%1', file is truncated.").arg(cacheFile), FUNC_ID);
+
+	m_shadingFactorCache.swap(cache);
+}
+
+
+void StructuralShading::writeShadingCache(const IBK::Path & cacheFile) const {
+	FUNCID(StructuralShading::writeShadingCache);
+
+	std::ofstream out;
+	if (!IBK::open_ofstream(out, cacheFile, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary))
+		throw IBK::Exception(IBK::FormatString("Could not write shading cache file '%1'.").arg(cacheFile), FUNC_ID);
+
+	unsigned int count = (unsigned int)m_shadingFactorCache.size();
+	out.write(reinterpret_cast<const char*>(&SHADING_CACHE_MAGIC), sizeof(unsigned int));
+	out.write(reinterpret_cast<const char*>(&SHADING_CACHE_VERSION), sizeof(unsigned int));
+	out.write(reinterpret_cast<const char*>(&count), sizeof(unsigned int));
+	for (const std::pair<const unsigned long long, std::vector<double> > & entry : m_shadingFactorCache) {
+		unsigned int n = (unsigned int)entry.second.size();
+		out.write(reinterpret_cast<const char*>(&entry.first), sizeof(unsigned long long));
+		out.write(reinterpret_cast<const char*>(&n), sizeof(unsigned int));
+		if (n > 0)
+			out.write(reinterpret_cast<const char*>(&entry.second[0]), (std::streamsize)(n*sizeof(double)));
+	}
+	if (!out)
+		throw IBK::Exception(IBK::FormatString("Error writing shading cache file '%1'.").arg(cacheFile), FUNC_ID);
+}
+
+
 void StructuralShading::writeShadingFactorsToTSV(const IBK::Path & path, const std::vector<unsigned int> & surfaceIDs,
 												 const std::vector<std::string> & surfaceDisplayNames)
 {
@@ -488,6 +813,18 @@ void StructuralShading::writeShadingFactorsToDataIO(const IBK::Path & path, cons
 }
 
 
+/*! Returns key of the cell in the sun cone binning grid that contains the unit vector n, shifted by dx, dy and dz cells.
+	Cell indexes are encoded with 21 bits per component, which is sufficient for cell sizes down to 1e-6.
+*/
+static unsigned long long sunConeBinKey(const IBKMK::Vector3D & n, double cellSize, int dx, int dy, int dz) {
+	const long long OFFSET = 1 << 20;
+	unsigned long long ix = (unsigned long long)((long long)std::floor(n.m_x/cellSize) + dx + OFFSET);
+	unsigned long long iy = (unsigned long long)((long long)std::floor(n.m_y/cellSize) + dy + OFFSET);
+	unsigned long long iz = (unsigned long long)((long long)std::floor(n.m_z/cellSize) + dz + OFFSET);
+	return (ix << 42) | (iy << 21) | iz;
+}
+
+
 void StructuralShading::createSunNormals() {
 
 	// *** first calculation sun positions for each sampling interval
@@ -515,12 +852,23 @@ void StructuralShading::createSunNormals() {
 
 	m_sunConeNormals.clear();
 	m_indexesOfSimilarNormals.clear();
+	m_sunConeBins.clear();
+	// The cell size is the largest distance (chord length) of two unit vectors accepted by findSimilarNormals().
+	// Note: angleVectors() returns atan2(sin^2(a), cos(a)) for vectors with angle a, hence the cosine c of the
+	//       largest accepted angle solves (1 - c^2)/c = tan(m_sunConeDeg).
+	m_sunConeBinSize = 2;
+	if (m_sunConeDeg < 90) {
+		double t = std::tan(m_sunConeDeg*IBK::DEG2RAD);
+		double c = 0.5*(std::sqrt(t*t + 4) - t);
+		// small tolerance accounts for rounding; lower limit keeps cell indexes within the range of sunConeBinKey()
+		m_sunConeBinSize = std::max(1e-5, std::sqrt(2*(1 - c))*(1 + 1e-6));
+	}
 
 	// We initialize all our coresponding sun normals.
 	//
 	// For each sampling interval we first compute the corresponding sun' normal vector.
 	// Then, we search through our vector of previously computed sun normals and check if we are close enough.
-	// This is done in function findSimilarNormal(). This function returns the index of the existing normal vector
+	// This is done in function findSimilarNormal(), which only checks the normals in neighboring cells of m_sunConeBins. This function returns the index of the existing normal vector
 	// if we are close enough, or -1 if we are too far away or -2 if sun is beyond horizon
 	//
 	// NOTE: in angles around 90 Deg between our surface normal and the sun beam
@@ -534,6 +882,7 @@ void StructuralShading::createSunNormals() {
 
 		// record new different sun normal
 		if (id == -1) {
+			m_sunConeBins[sunConeBinKey(n, m_sunConeBinSize, 0, 0, 0)].push_back((unsigned int)m_sunConeNormals.size());
 			m_sunConeNormals.push_back(n);
 			m_indexesOfSimilarNormals.push_back( std::vector<unsigned int>(1, i) );
 		}
@@ -552,14 +901,26 @@ int StructuralShading::findSimilarNormals(const IBKMK::Vector3D &sunNormal) cons
 	if (sunNormal.m_z < 0)
 		return -2;
 
-	// search through all previous computed normals and check if angle between normals is below threshold
-	for (unsigned int i=0; i<m_sunConeNormals.size(); ++i) {
-		double diffAngle = angleVectors(m_sunConeNormals[i], sunNormal);
-		if (std::fabs(diffAngle) <= m_sunConeDeg)
-			return (int)i;
-	}
+	// search through all previous computed normals in this and neighboring cells and check if angle between normals
+	// is below threshold; to get the same result regardless of cell order we return the first normal that was recorded
+	int id = -1;
+	for (int dx=-1; dx<=1; ++dx)
+		for (int dy=-1; dy<=1; ++dy)
+			for (int dz=-1; dz<=1; ++dz) {
+				std::unordered_map<unsigned long long, std::vector<unsigned int> >::const_iterator it =
+						m_sunConeBins.find(sunConeBinKey(sunNormal, m_sunConeBinSize, dx, dy, dz));
+				if (it == m_sunConeBins.end())
+					continue;
+				for (unsigned int i : it->second) {
+					if (id != -1 && (int)i > id)
+						continue;
+					double diffAngle = angleVectors(m_sunConeNormals[i], sunNormal);
+					if (std::fabs(diffAngle) <= m_sunConeDeg)
+						id = (int)i;
+				}
+			}
 
-	return -1;
+	return id;
 }
 
 void StructuralShading::findVisibleSurfaces(bool useClipping) {
@@ -605,6 +966,45 @@ void StructuralShading::findVisibleSurfaces(bool useClipping) {
 	}
 }
 
+void StructuralShading::computeSurfaceCacheKeys(CalculationMethod method) {
+	// hash of all parameters that affect the shading factors of all surfaces
+	unsigned long long globalHash = 14695981039346656037ull;
+	hashCombine(globalHash, m_timeZone);
+	hashCombine(globalHash, m_longitudeInDeg);
+	hashCombine(globalHash, m_latitudeInDeg);
+	hashCombine(globalHash, m_sunConeDeg);
+	int startYear = m_startTime.year();
+	double startSecondsOfYear = m_startTime.secondsOfYear();
+	hashCombine(globalHash, startYear);
+	hashCombine(globalHash, startSecondsOfYear);
+	hashCombine(globalHash, m_duration);
+	hashCombine(globalHash, m_samplingPeriod);
+	hashCombine(globalHash, m_gridWidth);
+	hashCombine(globalHash, method);
+
+	// geometry hashes of all obstacles, accessed via obstacle's (internal) m_id
+	std::map<unsigned int, unsigned long long> obstacleHashes;
+	for (const ShadingObject & obst : m_obstacles)
+		obstacleHashes[obst.m_id] = geometryHash(obst);
+
+	m_surfaceCacheKeys.resize(m_surfaces.size());
+	for (unsigned int i=0; i<m_surfaces.size(); ++i) {
+		const ShadingObject & so = m_surfaces[i];
+		// sort obstacle hashes, so that the key does not depend on the order of obstacles
+		std::vector<unsigned long long> visibleObstacleHashes;
+		for (unsigned int id : so.m_visibleSurfaces)
+			visibleObstacleHashes.push_back(obstacleHashes[id]);
+		std::sort(visibleObstacleHashes.begin(), visibleObstacleHashes.end());
+
+		unsigned long long h = globalHash;
+		hashCombine(h, geometryHash(so));
+		for (unsigned long long oh : visibleObstacleHashes)
+			hashCombine(h, oh);
+		m_surfaceCacheKeys[i] = h;
+	}
+}
+
+
 void StructuralShading::createProjectedPolygonsInSunPane() {
 
 	for (unsigned int i = 0; i<m_sunConeNormals.size(); ++i) {
@@ -19,6 +19,9 @@
 #define SH_StructuralShadingH
 
 #include <vector>
+#include <map>
+#include <set>
+#include <unordered_map>
 
 #include <IBK_LinearSpline.h>
 #include <IBK_Time.h>
@@ -45,6 +48,18 @@ public:
 class StructuralShading  {
 public:
 
+	/*! Algorithms for computing shading factors. */
+	enum CalculationMethod {
+		/*! Sun beams from grid points of each surface are intersected with all visible obstacles. */
+		SCM_RayTracing,
+		/*! Surface and obstacle polygons are projected into the sun plane and clipped. */
+		SCM_SurfaceClipping,
+		/*! For each sun cone all obstacles are rasterized into an orthographic depth buffer (shadow map) in the sun
+			plane, grid points of surfaces are then looked up in this map. Texel size equals grid width.
+		*/
+		SCM_ShadowMap
+	};
+
 	// TODO Stephan: add some documentation
 	struct SunPosition {
 
@@ -136,8 +151,32 @@ public:
 		duration + sampling period in seconds
 
 		start time and duration = whole number multiple of samplingPeriod; if not -> warning issued
+
+		\param gridWidth Grid width in [m] used for surface discretization (ray tracing and shadow map), for the
+			shadow map method this is also the texel size.
+		\param method Calculation method.
+	*/
+	void calculateShadingFactors(Notification * notify, double gridWidth = 0.1, CalculationMethod method = SCM_RayTracing,
+								 IBK::Path currentDir = IBK::Path(""));
+
+	// *** functions to manage the shading factor cache
+
+	/*! Reads shading factors computed in a previous calculation from a cache file.
+		Existing cache entries are replaced. The cache is used by calculateShadingFactors() to skip
+		all surfaces whose cache key is unchanged.
+		Must be called after initializeShadingCalculation(), since entry sizes are checked against the number
+		of sun cone normals. Entries of surfaces that no longer exist are kept until the next calculation.
+		Throws an IBK::Exception if the file cannot be read or is not a valid cache file.
 	*/
-	void calculateShadingFactors(Notification * notify, double gridWidth = 0.1, bool useClippingMethod = false, IBK::Path currentDir = IBK::Path(""));
+	void readShadingCache(const IBK::Path & cacheFile);
+
+	/*! Writes cache file with shading factors of all surfaces of the last calculation. */
+	void writeShadingCache(const IBK::Path & cacheFile) const;
+
+	/*! Returns the number of surfaces whose shading factors were taken from the cache in the
+		last call to calculateShadingFactors().
+	*/
+	unsigned int cachedSurfaceCount() const { return m_cachedSurfaceCount; }
 
 	// *** functions to retrieve calculation results
 
@@ -156,6 +195,8 @@ private:
 	void createSunNormals();
 
 	/*! Tries to find similar normal vector in m_sunConeNormals that is within the same sun cone with inside angle m_sunConeDeg.
+		Only normals in the neighboring cells of m_sunConeBins are checked. If several normals are within the cone,
+		the one with the lowest index is returned.
 		\param sunNormal			normal vector of sun beam ( pointing from window to sun )
 		\return Returns -1 if no sun cone was found and a new entry needs to be recorded
 				Returns -2 if sun does not shine on the surface ( vector between normals is bigger than 90 Deg )
@@ -172,6 +213,20 @@ private:
 	/*! Creates all Projected polygons in all sun panes. */
 	void createProjectedPolygonsInSunPane();
 
+	/*! Computes shading factors for the given surfaces with the shadow map method, runs in parallel over all sun cones.
+		\param surfaceIndexes Indexes of surfaces in m_surfaces to compute.
+		\param surfaceDone Set to true for each computed surface, unless the calculation was aborted.
+	*/
+	void calculateShadingFactorsWithShadowMap(Notification * notify, const std::vector<unsigned int> & surfaceIndexes,
+											  std::vector<char> & surfaceDone);
+
+	/*! Computes cache keys for all surfaces (populates m_surfaceCacheKeys).
+		The key of a surface combines the hash of its own geometry, the hashes of all obstacles in its set of
+		visible surfaces (order independent), as well as location, time frame, sun cone and calculation method.
+		Hence, findVisibleSurfaces() must have been called before.
+	*/
+	void computeSurfaceCacheKeys(CalculationMethod method);
+
 	// ** input variables **
 
 	int													m_timeZone = 13;
@@ -217,6 +272,28 @@ private:
 	/*! Vector stores indexes of sun positions with similar normals to m_sunConeNormals. Size and indexes match those of m_sunConeNormals. */
 	std::vector<std::vector<unsigned int> >				m_indexesOfSimilarNormals;
 
+	/*! Spatial index of m_sunConeNormals, used to cluster sun positions in createSunNormals().
+		Normals are binned into a uniform grid over their x, y and z components with cell size m_sunConeBinSize
+		(chord length of the sun cone angle). Hence, all normals within the sun cone of a given normal are
+		located in the same or in directly neighboring cells.
+		Key is the encoded cell index (see sunConeBinKey()), value are the indexes of normals in m_sunConeNormals.
+	*/
+	std::unordered_map<unsigned long long, std::vector<unsigned int> >	m_sunConeBins;
+	/*! Cell size of m_sunConeBins. */
+	double												m_sunConeBinSize = 1;
+
+	/*! Cache keys of all surfaces in m_surfaces, computed in calculateShadingFactors(). */
+	std::vector<unsigned long long>						m_surfaceCacheKeys;
+
+	/*! Shading factor cache, key is the surface cache key, value is the vector of shading factors for
+		each sun cone (same as in m_shadingFactors).
+		After a calculation the cache only holds the entries for the surfaces of this calculation.
+	*/
+	std::map<unsigned long long, std::vector<double> >	m_shadingFactorCache;
+
+	/*! Number of surfaces taken from the cache in last calculation. */
+	unsigned int										m_cachedSurfaceCount = 0;
+
 //	SunShadingAlgorithm									m_shading;							///< Object for shading calculation
 };
 
@@ -36,6 +36,7 @@ distribution.
 #endif // _WIN32
 
 #ifdef TIXML_USE_IBK_EXTENSIONS
+#include <locale>
 #include <IBK_StringUtils.h>
 #endif // TIXML_USE_IBK_EXTENSIONS
 
@@ -1125,11 +1126,16 @@ void TiXmlElement::appendIBKUnitVectorElement( TiXmlElement * parent,
 	if (!useEmbeddedForm)
 		xmlElement->SetAttribute("name", name);
 	xmlElement->SetAttribute("unit", unit);
-	std::stringstream para;
-	for (unsigned int i=0; i<data.size(); ++i)
-		para << data[i] << " ";
-	TiXmlText * text = new TiXmlText( para.str() );
-	xmlElement->LinkEndChild( text );
+	if (data.empty()) {
+		xmlElement->LinkEndChild( new TiXmlText( "" ) );
+		return;
+	}
+	// values are kept in the text node and only formatted when printed, gives "v1 v2 ... vn "
+	TiXmlNumberText * numText = new TiXmlNumberText;
+	numText->values = data;
+	numText->trailing = " ";
+	numText->separators.push_back(" ");
+	xmlElement->LinkEndChild( new TiXmlText( numText ) );
 }
 
 
@@ -1160,12 +1166,25 @@ void TiXmlElement::readIBKUnitVectorElement( const TiXmlElement * element,
 	}
 	unit = attrib->Value();
 
+	// values read from binary project files are taken directly, unless they are comma separated
+	// (the text parser below only accepts white-space)
+	const TiXmlText * numText = element->FirstChild() ? element->FirstChild()->ToText() : NULL;
+	if (numText != NULL && numText->NumberText() != NULL) {
+		const TiXmlNumberText * n = numText->NumberText();
+		bool commaSeparated = n->leading.find(',') != std::string::npos || n->trailing.find(',') != std::string::npos;
+		for (unsigned int i=0; i<n->separators.size(); ++i)
+			commaSeparated = commaSeparated || n->separators[i].find(',') != std::string::npos;
+		if (!commaSeparated) {
+			data = n->values;
+			return;
+		}
+	}
+
 	const char * const str = element->GetText();
-	std::string valstr;
 	if (str) {
-		valstr = str;
 		try {
-			IBK::string2valueVector(valstr, data);
+			// parse directly from element text, avoids copying large value vectors
+			IBK::string2valueVector(str, data, false);
 		} catch (IBK::Exception & ex) {
 			std::stringstream strm;
 			strm << "Error in XML file, line " << element->Row() << ": ";
@@ -1795,6 +1814,9 @@ const char* TiXmlElement::GetText() const
 	if ( child ) {
 		const TiXmlText* childText = child->ToText();
 		if ( childText ) {
+			#ifdef TIXML_USE_IBK_EXTENSIONS
+			childText->ComposeNumberText();
+			#endif
 			return childText->Value();
 		}
 	}
@@ -1808,6 +1830,9 @@ const char* TiXmlElement::GetTextUnsafe() const
 	if ( child ) {
 		const TiXmlText* childText = child->ToText();
 		if ( childText ) {
+			#ifdef TIXML_USE_IBK_EXTENSIONS
+			childText->ComposeNumberText();
+			#endif
 			return childText->Value();
 		}
 	}
@@ -1815,6 +1840,20 @@ const char* TiXmlElement::GetTextUnsafe() const
 }
 
 
+#ifdef TIXML_USE_IBK_EXTENSIONS
+const std::vector<double> * TiXmlElement::GetNumbers() const
+{
+	const TiXmlNode* child = this->FirstChild();
+	if ( child ) {
+		const TiXmlText* childText = child->ToText();
+		if ( childText && childText->NumberText() )
+			return &childText->NumberText()->values;
+	}
+	return 0;
+}
+#endif // TIXML_USE_IBK_EXTENSIONS
+
+
 TiXmlDocument::TiXmlDocument() : TiXmlNode( TiXmlNode::TINYXML_DOCUMENT )
 {
 	tabsize = 4;
@@ -2289,9 +2328,20 @@ void TiXmlComment::addSeparatorComment(TiXmlElement * e) {
 #endif // TIXML_USE_IBK_EXTENSIONS
 
 
+TiXmlText::~TiXmlText()
+{
+	#ifdef TIXML_USE_IBK_EXTENSIONS
+	delete numberText;
+	#endif
+}
+
+
 void TiXmlText::Print( FILE* cfile, int depth ) const
 {
 	assert( cfile );
+	#ifdef TIXML_USE_IBK_EXTENSIONS
+	ComposeNumberText();
+	#endif
 	if ( cdata )
 	{
 		int i;
@@ -2312,11 +2362,44 @@ void TiXmlText::Print( FILE* cfile, int depth ) const
 
 void TiXmlText::CopyTo( TiXmlText* target ) const
 {
+	#ifdef TIXML_USE_IBK_EXTENSIONS
+	ComposeNumberText();
+	#endif
 	TiXmlNode::CopyTo( target );
 	target->cdata = cdata;
+	#ifdef TIXML_USE_IBK_EXTENSIONS
+	delete target->numberText;
+	target->numberText = numberText ? new TiXmlNumberText( *numberText ) : 0;
+	#endif
+}
+
+
+#ifdef TIXML_USE_IBK_EXTENSIONS
+void TiXmlText::ComposeNumberText() const
+{
+	// text is composed only once, number texts always hold at least one value
+	if ( numberText && value.empty() )
+		numberText->Compose( const_cast<TiXmlText*>(this)->value );
 }
 
 
+void TiXmlNumberText::Compose(TIXML_STRING & text) const
+{
+	std::ostringstream strm;
+	strm.imbue(std::locale::classic());
+	strm.precision(precision);
+	strm << leading;
+	for (unsigned int i=0; i<values.size(); ++i) {
+		if (i > 0)
+			strm << separators[(i-1) % separators.size()];
+		strm << values[i];
+	}
+	strm << trailing;
+	text = strm.str();
+}
+#endif // TIXML_USE_IBK_EXTENSIONS
+
+
 bool TiXmlText::Accept( TiXmlVisitor* visitor ) const
 {
 	return visitor->Visit( *this );
@@ -2788,6 +2871,9 @@ bool TiXmlPrinter::VisitExit( const TiXmlElement& element )
 
 bool TiXmlPrinter::Visit( const TiXmlText& text )
 {
+	#ifdef TIXML_USE_IBK_EXTENSIONS
+	text.ComposeNumberText();
+	#endif
 	if ( text.CDATA() )
 	{
 		DoIndent();
@@ -249,6 +249,13 @@ public:
 	int Row() const			{ return location.row + 1; }
 	int Column() const		{ return location.col + 1; }	///< See Row()
 
+#ifdef TIXML_USE_IBK_EXTENSIONS
+	/*! Sets the 1-based row, used by readers that create the nodes themselves instead of calling Parse().
+		\warning This is an IBK-specific extension to TiXML
+	*/
+	void SetRow( int row )	{ location.row = row - 1; }
+#endif // TIXML_USE_IBK_EXTENSIONS
+
 	void  SetUserData( void* user )			{ userData = user; }	///< Set a pointer to arbitrary user data.
 	void* GetUserData()						{ return userData; }	///< Get a pointer to arbitrary user data.
 	const void* GetUserData() const 		{ return userData; }	///< Get a pointer to arbitrary user data.
@@ -1137,6 +1144,15 @@ public:
 	/*! Unsafe version of above function, may return 0 whereas the other is guaranteed to return a "". */
 	const char* GetTextUnsafe() const;
 
+#ifdef TIXML_USE_IBK_EXTENSIONS
+	/*! Returns the values of the first child, if it is a text node holding numbers (see TiXmlNumberText),
+		otherwise a NULL pointer. Number readers use this to take values read from binary project files
+		directly and fall back to parsing GetText() otherwise.
+		\warning This is an IBK-specific extension to TiXML
+	*/
+	const std::vector<double> * GetNumbers() const;
+#endif // TIXML_USE_IBK_EXTENSIONS
+
 	/// Creates a new Element and returns it - the returned element is a copy.
 	virtual TiXmlNode* Clone() const;
 	// Print the Element to a FILE stream.
@@ -1562,6 +1578,34 @@ private:
 };
 
 
+#ifdef TIXML_USE_IBK_EXTENSIONS
+/*! Element text with a list of numbers, stored as values instead of text.
+	Used by readers of binary project files, so that number readers can take the values
+	directly (see TiXmlElement::GetNumbers()) and the text is only composed when needed.
+	\warning This is an IBK-specific extension to TiXML
+*/
+struct TiXmlNumberText {
+	TiXmlNumberText() : precision(6) {}
+
+	/*! Composes the text, values are formatted like a std::stringstream with default flags
+		and given precision (independent of locale).
+	*/
+	void Compose(TIXML_STRING & text) const;
+
+	/*! The values. */
+	std::vector<double>			values;
+	/*! Precision used to format the values. */
+	int							precision;
+	/*! Delimiters before first value. */
+	std::string					leading;
+	/*! Delimiters after last value. */
+	std::string					trailing;
+	/*! Separators between values, separator i is used after value i % separators.size(). */
+	std::vector<std::string>	separators;
+};
+#endif // TIXML_USE_IBK_EXTENSIONS
+
+
 /** XML text. A text node can have 2 ways to output the next. "normal" output
 	and CDATA. It will default to the mode it was parsed from the XML file and
 	you generally want to leave it alone, but you can change the output mode with
@@ -1579,8 +1623,11 @@ public:
 	{
 		SetValue( initValue );
 		cdata = false;
+		#ifdef TIXML_USE_IBK_EXTENSIONS
+		numberText = 0;
+		#endif
 	}
-	virtual ~TiXmlText() {}
+	virtual ~TiXmlText();
 
 	#ifdef TIXML_USE_STL
 	/// Constructor.
@@ -1588,10 +1635,17 @@ public:
 	{
 		SetValue( initValue );
 		cdata = false;
+		#ifdef TIXML_USE_IBK_EXTENSIONS
+		numberText = 0;
+		#endif
 	}
 	#endif
 
+	#ifdef TIXML_USE_IBK_EXTENSIONS
+	TiXmlText( const TiXmlText& copy ) : TiXmlNode( TiXmlNode::TINYXML_TEXT ), numberText( 0 )	{ copy.CopyTo( this ); }
+	#else
 	TiXmlText( const TiXmlText& copy ) : TiXmlNode( TiXmlNode::TINYXML_TEXT )	{ copy.CopyTo( this ); }
+	#endif
 	TiXmlText& operator=( const TiXmlText& base )							 	{ base.CopyTo( this ); return *this; }
 
 	// Write this text object to a FILE stream.
@@ -1611,6 +1665,29 @@ public:
 	*/
 	virtual bool Accept( TiXmlVisitor* content ) const;
 
+#ifdef TIXML_USE_IBK_EXTENSIONS
+	/*! Creates a text node holding a list of numbers (takes ownership of numText).
+		The text is composed on first access through TiXmlElement::GetText(), Print() or TiXmlPrinter.
+		\warning Value() and ValueStr() return an empty string until the text was composed.
+		\warning This is an IBK-specific extension to TiXML
+	*/
+	explicit TiXmlText( TiXmlNumberText * numText ) : TiXmlNode (TiXmlNode::TINYXML_TEXT)
+	{
+		cdata = false;
+		numberText = numText;
+	}
+
+	/*! Returns the numbers of a text node created from a TiXmlNumberText, otherwise a NULL pointer.
+		\warning This is an IBK-specific extension to TiXML
+	*/
+	const TiXmlNumberText * NumberText() const { return numberText; }
+
+	/*! Composes the text of a text node created from a TiXmlNumberText, if not yet done.
+		\warning This is an IBK-specific extension to TiXML
+	*/
+	void ComposeNumberText() const;
+#endif // TIXML_USE_IBK_EXTENSIONS
+
 protected :
 	///  [internal use] Creates a new Element and returns it.
 	virtual TiXmlNode* Clone() const;
@@ -1624,6 +1701,9 @@ protected :
 
 private:
 	bool cdata;			// true if this should be input and output as a CDATA style text element
+#ifdef TIXML_USE_IBK_EXTENSIONS
+	TiXmlNumberText * numberText;	// values of a number text, NULL for regular text
+#endif // TIXML_USE_IBK_EXTENSIONS
 };
 
 
@@ -25,6 +25,8 @@
 
 #include "VICUS_AbstractDBElement.h"
 
+#include <functional>
+
 #include <QCoreApplication>
 
 namespace VICUS {
@@ -49,6 +51,11 @@ void AbstractDBElement::collectLocalChildren(std::set<AbstractDBElement *> & loc
 }
 
 
+std::size_t AbstractDBElement::contentHash() const {
+	return std::hash<std::string>()(m_displayName.encodedString());
+}
+
+
 const QString AbstractDBElement::sourceName() const {
 	if (m_builtIn)
 		return qApp->translate("AbstractDBElement", "BuiltIn DB");
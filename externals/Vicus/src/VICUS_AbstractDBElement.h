@@ -68,6 +68,13 @@ public:
 	/*! Comparison of database element by content, without ID. */
 	virtual ComparisonResult equal(const AbstractDBElement * other) const = 0;
 
+	/*! Hash value of the content, used to speed up duplicate search.
+		Must be consistent with equal(): elements that compare as Equal must have the same hash value.
+		The default implementation hashes the display name, which is compared by all equal() implementations.
+		Re-implement in derived classes with large databases to include further discriminating data.
+	*/
+	virtual std::size_t contentHash() const;
+
 	/*! Collects all pointers to child elements */
 	void collectChildren(std::set<const AbstractDBElement *> & allChildrenRefs) const;
 
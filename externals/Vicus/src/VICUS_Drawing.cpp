@@ -1033,12 +1033,15 @@ void Drawing::PolyLine::readXMLPrivate(const TiXmlElement *element){
 
 		// reading elements
 		// read vertexes
-		std::string text = element->GetText();
-		text = IBK::replace_string(text, ",", " ");
 		std::vector<IBKMK::Vector2D> verts;
 		try {
 			std::vector<double> vals;
-			IBK::string2valueVector(text, vals);
+			// take values read from binary container directly, otherwise parse element text
+			const std::vector<double> * numbers = element->GetNumbers();
+			if (numbers != nullptr)
+				vals = *numbers;
+			else
+				IBK::string2valueVector(element->GetText(), vals, true);
 			// must have n*2 elements
 			if (vals.size() % 2 != 0)
 				throw IBK::Exception("Mismatching number of values.", FUNC_ID);
@@ -2393,9 +2396,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Block")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Drawing::Block obj;
-					obj.readXML(c2);
-					m_blocks.push_back(obj);
+					m_blocks.emplace_back();
+					m_blocks.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2405,9 +2407,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "DrawingLayer")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					DrawingLayer obj;
-					obj.readXML(c2);
-					m_drawingLayers.push_back(obj);
+					m_drawingLayers.emplace_back();
+					m_drawingLayers.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2417,9 +2418,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Point")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Point obj;
-					obj.readXML(c2);
-					m_points.push_back(obj);
+					m_points.emplace_back();
+					m_points.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2429,9 +2429,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Line")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Line obj;
-					obj.readXML(c2);
-					m_lines.push_back(obj);
+					m_lines.emplace_back();
+					m_lines.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2441,9 +2440,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "PolyLine")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					PolyLine obj;
-					obj.readXML(c2);
-					m_polylines.push_back(obj);
+					m_polylines.emplace_back();
+					m_polylines.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2453,9 +2451,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Circle")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Circle obj;
-					obj.readXML(c2);
-					m_circles.push_back(obj);
+					m_circles.emplace_back();
+					m_circles.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2465,9 +2462,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Ellipse")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Ellipse obj;
-					obj.readXML(c2);
-					m_ellipses.push_back(obj);
+					m_ellipses.emplace_back();
+					m_ellipses.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2477,9 +2473,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Arc")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Arc obj;
-					obj.readXML(c2);
-					m_arcs.push_back(obj);
+					m_arcs.emplace_back();
+					m_arcs.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2489,9 +2484,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Solid")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Solid obj;
-					obj.readXML(c2);
-					m_solids.push_back(obj);
+					m_solids.emplace_back();
+					m_solids.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2501,9 +2495,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Text")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Text obj;
-					obj.readXML(c2);
-					m_texts.push_back(obj);
+					m_texts.emplace_back();
+					m_texts.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2513,9 +2506,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "LinearDimension")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					LinearDimension obj;
-					obj.readXML(c2);
-					m_linearDimensions.push_back(obj);
+					m_linearDimensions.emplace_back();
+					m_linearDimensions.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2525,9 +2517,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "DimStyle")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					DimStyle obj;
-					obj.readXML(c2);
-					m_dimensionStyles.push_back(obj);
+					m_dimensionStyles.emplace_back();
+					m_dimensionStyles.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -2537,9 +2528,8 @@ void Drawing::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Insert")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Insert obj;
-					obj.readXML(c2);
-					m_inserts.push_back(obj);
+					m_inserts.emplace_back();
+					m_inserts.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
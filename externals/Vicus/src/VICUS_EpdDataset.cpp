@@ -26,6 +26,10 @@
 #include "VICUS_EpdDataset.h"
 #include "VICUS_KeywordList.h"
 
+#include <functional>
+
+#include <QHash>
+
 namespace VICUS {
 
 VICUS::EpdDataset VICUS::EpdDataset::scaleByFactor(const double & factor) const {
@@ -115,6 +119,16 @@ AbstractDBElement::ComparisonResult EpdDataset::equal(const AbstractDBElement *o
 	return Equal;
 }
 
+std::size_t EpdDataset::contentHash() const {
+	// only use data that is compared in equal(), so that equal elements yield the same hash
+	std::size_t h = AbstractDBElement::contentHash();
+	h ^= qHash(m_uuid) + 0x9e3779b9 + (h << 6) + (h >> 2);
+	h ^= std::hash<int>()((int)m_type) + 0x9e3779b9 + (h << 6) + (h >> 2);
+	h ^= std::hash<std::size_t>()(m_epdModuleDataset.size()) + 0x9e3779b9 + (h << 6) + (h >> 2);
+	return h;
+}
+
+
 EpdDataset EpdDataset::operator+(const EpdDataset & epd) {
 	VICUS::EpdDataset addedEpd = *this; // Copy of element
 
@@ -78,6 +78,9 @@ public:
 	/*! Comparison operator */
 	ComparisonResult equal(const AbstractDBElement *other) const override;
 
+	/*! Content hash, includes UUID and type in addition to the display name. */
+	std::size_t contentHash() const override;
+
 	/*! Defines Operator + .*/
 	EpdDataset operator+(const EpdDataset& epd);
 
@@ -24,6 +24,8 @@
 #include <map>
 #include <limits>
 #include <iostream>
+#include <algorithm>
+#include <cstring>
 
 #include <IBK_FormatString.h>
 #include <IBK_Exception.h>
@@ -118,708 +120,147 @@ namespace VICUS {
 		"ZoneTemplate::SubTemplateType"
 	};
 
-	/*! Converts a category string to respective enumeration value. */
-	int enum2index(const std::string & enumtype) {
-		for (int i=0; i<81; ++i) {
-			if (enumtype == ENUM_TYPES[i]) return i;
-		}
-		//std::cerr << "Unknown enumeration type '" << enumtype<< "'." << std::endl;
-		return -1;
-	}
-	
-
-	/*! Returns a keyword string for a given category (typenum) and type number t. */
-	const char * theKeyword(int typenum, int t) {
-		switch (typenum) {
-			// AcousticBuildingTemplate::AcousticBuildingType
-			case 0 :
-			switch (t) {
-				case 0 : return "MultiFamilyHouse";
-				case 1 : return "Hotel";
-				case 2 : return "Hospital";
-				case 3 : return "School";
-				case 4 : return "SingleFamilyHouse";
-				case 5 : return "Office";
-			} break;
-			// AcousticComponent::para_t
-			case 1 :
-			switch (t) {
-				case 0 : return "Area";
-				case 1 : return "Fraction";
-			} break;
-			// AcousticComponent::SizeMethod
-			case 2 :
-			switch (t) {
-				case 0 : return "AreaTotal";
-				case 1 : return "AreaFraction";
-			} break;
-			// AcousticReferenceComponent::RequirementType
-			case 3 :
-			switch (t) {
-				case 0 : return "basic";
-				case 1 : return "advanced";
-			} break;
-			// AcousticReferenceComponent::ComponentType
-			case 4 :
-			switch (t) {
-				case 0 : return "Ceiling";
-				case 1 : return "Wall";
-				case 2 : return "Door";
-				case 3 : return "Stairs";
-			} break;
-			// AcousticSoundAbsorptionPartition::para_t
-			case 5 :
-			switch (t) {
-				case 0 : return "AreaFraction";
-			} break;
-			// AcousticSoundProtectionTemplate::AcousticBuildingType
-			case 6 :
-			switch (t) {
-				case 0 : return "MultiFamilyHouse";
-				case 1 : return "Hotel";
-				case 2 : return "Hospital";
-				case 3 : return "School";
-				case 4 : return "SingleFamilyHouse";
-				case 5 : return "Office";
-			} break;
-			// AcousticTemplate::splinePara_t
-			case 7 :
-			switch (t) {
-				case 0 : return "MaxValue";
-				case 1 : return "MinValue";
-			} break;
-			// Component::ComponentType
-			case 8 :
-			switch (t) {
-				case 0 : return "OutsideWall";
-				case 1 : return "OutsideWallToGround";
-				case 2 : return "InsideWall";
-				case 3 : return "FloorToCellar";
-				case 4 : return "FloorToAir";
-				case 5 : return "FloorToGround";
-				case 6 : return "Ceiling";
-				case 7 : return "SlopedRoof";
-				case 8 : return "FlatRoof";
-				case 9 : return "ColdRoof";
-				case 10 : return "WarmRoof";
-				case 11 : return "Miscellaneous";
-			} break;
-			// Construction::UsageType
-			case 9 :
-			switch (t) {
-				case 0 : return "OutsideWall";
-				case 1 : return "OutsideWallToGround";
-				case 2 : return "InsideWall";
-				case 3 : return "FloorToCellar";
-				case 4 : return "FloorToGround";
-				case 5 : return "Ceiling";
-				case 6 : return "SlopedRoof";
-				case 7 : return "FlatRoof";
-				case 8 : return "---";
-			} break;
-			// Construction::InsulationKind
-			case 10 :
-			switch (t) {
-				case 0 : return "NotInsulated";
-				case 1 : return "InsideInsulation";
-				case 2 : return "CoreInsulation";
-				case 3 : return "OutsideInsulation";
-				case 4 : return "---";
-			} break;
-			// Construction::MaterialKind
-			case 11 :
-			switch (t) {
-				case 0 : return "BrickMasonry";
-				case 1 : return "NaturalStoneMasonry";
-				case 2 : return "Concrete";
-				case 3 : return "Wood";
-				case 4 : return "FrameWork";
-				case 5 : return "Loam";
-				case 6 : return "---";
-			} break;
-			// Construction::para_t
-			case 12 :
-			switch (t) {
-				case 0 : return "ImpactSoundValue";
-				case 1 : return "AirSoundResistanceValue";
-			} break;
-			// EpdCategorySet::Category
-			case 13 :
-			switch (t) {
-				case 0 : return "IDCategoryA";
-				case 1 : return "IDCategoryB";
-				case 2 : return "IDCategoryC";
-				case 3 : return "IDCategoryD";
-			} break;
-			// EpdDataset::Type
-			case 14 :
-			switch (t) {
-				case 0 : return "Generic";
-				case 1 : return "Specific";
-				case 2 : return "Average";
-				case 3 : return "Representative";
-				case 4 : return "Template";
-			} break;
-			// EpdDataset::Category
-			case 15 :
-			switch (t) {
-				case 0 : return "A";
-				case 1 : return "B";
-				case 2 : return "C";
-				case 3 : return "D";
-			} break;
-			// EpdModuleDataset::para_t
-			case 16 :
-			switch (t) {
-				case 0 : return "AreaDensity";
-				case 1 : return "DryDensity";
-				case 2 : return "GWP";
-				case 3 : return "ODP";
-				case 4 : return "POCP";
-				case 5 : return "AP";
-				case 6 : return "EP";
-				case 7 : return "PENRT";
-				case 8 : return "PERT";
-			} break;
-			// EpdModuleDataset::Module
-			case 17 :
-			switch (t) {
-				case 0 : return "A1";
-				case 1 : return "A2";
-				case 2 : return "A3";
-				case 3 : return "A4";
-				case 4 : return "A5";
-				case 5 : return "B1";
-				case 6 : return "B2";
-				case 7 : return "B3";
-				case 8 : return "B4";
-				case 9 : return "B5";
-				case 10 : return "B6";
-				case 11 : return "B7";
-				case 12 : return "C1";
-				case 13 : return "C2";
-				case 14 : return "C3";
-				case 15 : return "C4";
-				case 16 : return "D";
-			} break;
-			// Infiltration::para_t
-			case 18 :
-			switch (t) {
-				case 0 : return "AirChangeRate";
-				case 1 : return "ShieldingCoefficient";
-			} break;
-			// Infiltration::AirChangeType
-			case 19 :
-			switch (t) {
-				case 0 : return "normal";
-				case 1 : return "n50";
-			} break;
-			// InterfaceHeatConduction::modelType_t
-			case 20 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "None";
-			} break;
-			// InterfaceHeatConduction::OtherZoneType
-			case 21 :
-			switch (t) {
-				case 0 : return "Standard";
-				case 1 : return "Constant";
-				case 2 : return "Scheduled";
-			} break;
-			// InterfaceHeatConduction::para_t
-			case 22 :
-			switch (t) {
-				case 0 : return "HeatTransferCoefficient";
-				case 1 : return "ConstTemperature";
-			} break;
-			// InternalLoad::para_t
-			case 23 :
-			switch (t) {
-				case 0 : return "PersonCount";
-				case 1 : return "PersonPerArea";
-				case 2 : return "AreaPerPerson";
-				case 3 : return "Power";
-				case 4 : return "PowerPerArea";
-				case 5 : return "MoistureProductionRatePerArea";
-				case 6 : return "ConvectiveHeatFactor";
-				case 7 : return "LatentHeatFactor";
-				case 8 : return "LossHeatFactor";
-			} break;
-			// InternalLoad::Category
-			case 24 :
-			switch (t) {
-				case 0 : return "Person";
-				case 1 : return "ElectricEquiment";
-				case 2 : return "Lighting";
-				case 3 : return "Other";
-			} break;
-			// InternalLoad::PersonCountMethod
-			case 25 :
-			switch (t) {
-				case 0 : return "PersonPerArea";
-				case 1 : return "AreaPerPerson";
-				case 2 : return "PersonCount";
-			} break;
-			// InternalLoad::PowerMethod
-			case 26 :
-			switch (t) {
-				case 0 : return "PowerPerArea";
-				case 1 : return "Power";
-			} break;
-			// KeywordList::MyParameters
-			case 27 :
-			switch (t) {
-				case 0 : return "Temperature";
-				case 1 : return "Mass";
-			} break;
-			// LcaSettings::para_t
-			case 28 :
-			switch (t) {
-				case 0 : return "TimePeriod";
-				case 1 : return "FactorSimpleMode";
-				case 2 : return "NetUsageArea";
-			} break;
-			// LcaSettings::Module
-			case 29 :
-			switch (t) {
-				case 0 : return "A1";
-				case 1 : return "A2";
-				case 2 : return "A3";
-				case 3 : return "A4";
-				case 4 : return "A5";
-				case 5 : return "B1";
-				case 6 : return "B2";
-				case 7 : return "B3";
-				case 8 : return "B4";
-				case 9 : return "B5";
-				case 10 : return "B6";
-				case 11 : return "B7";
-				case 12 : return "C1";
-				case 13 : return "C2";
-				case 14 : return "C3";
-				case 15 : return "C4";
-				case 16 : return "D";
-			} break;
-			// LcaSettings::LcaCategory
-			case 30 :
-			switch (t) {
-				case 0 : return "A";
-				case 1 : return "B";
-				case 2 : return "C";
-				case 3 : return "D";
-			} break;
-			// LcaSettings::UsageType
-			case 31 :
-			switch (t) {
-				case 0 : return "Gas";
-				case 1 : return "Electricity";
-				case 2 : return "Coal";
-			} break;
-			// LcaSettings::CalculationMode
-			case 32 :
-			switch (t) {
-				case 0 : return "Simple";
-				case 1 : return "Detailed";
-			} break;
-			// LcaSettings::CertificationSytem
-			case 33 :
-			switch (t) {
-				case 0 : return "BNB";
-			} break;
-			// LccSettings::para_t
-			case 34 :
-			switch (t) {
-				case 0 : return "PriceIncreaseGeneral";
-				case 1 : return "PriceIncreaseEnergy";
-				case 2 : return "DiscountingInterestRate";
-				case 3 : return "CoalConsumption";
-				case 4 : return "GasConsumption";
-				case 5 : return "ElectricityConsumption";
-			} break;
-			// LccSettings::intPara_t
-			case 35 :
-			switch (t) {
-				case 0 : return "CoalPrice";
-				case 1 : return "GasPrice";
-				case 2 : return "ElectricityPrice";
-			} break;
-			// Material::para_t
-			case 36 :
-			switch (t) {
-				case 0 : return "Density";
-				case 1 : return "HeatCapacity";
-				case 2 : return "Conductivity";
-				case 3 : return "Mu";
-				case 4 : return "W80";
-				case 5 : return "Wsat";
-			} break;
-			// Material::Category
-			case 37 :
-			switch (t) {
-				case 0 : return "Coating";
-				case 1 : return "Plaster";
-				case 2 : return "Bricks";
-				case 3 : return "NaturalStones";
-				case 4 : return "Cementitious";
-				case 5 : return "Insulations";
-				case 6 : return "BuildingBoards";
-				case 7 : return "Woodbased";
-				case 8 : return "NaturalMaterials";
-				case 9 : return "Soils";
-				case 10 : return "CladdingSystems";
-				case 11 : return "Foils";
-				case 12 : return "Miscellaneous";
-			} break;
-			// MaterialLayer::para_t
-			case 38 :
-			switch (t) {
-				case 0 : return "Thickness";
-				case 1 : return "Lifetime";
-			} break;
-			// Network::PipeModel
-			case 39 :
-			switch (t) {
-				case 0 : return "SimplePipe";
-				case 1 : return "DynamicPipe";
-			} break;
-			// Network::ModelType
-			case 40 :
-			switch (t) {
-				case 0 : return "HydraulicNetwork";
-				case 1 : return "ThermalHydraulicNetwork";
-			} break;
-			// Network::NetworkType
-			case 41 :
-			switch (t) {
-				case 0 : return "SinglePipe";
-				case 1 : return "DoublePipe";
-			} break;
-			// Network::para_t
-			case 42 :
-			switch (t) {
-				case 0 : return "TemperatureSetpoint";
-				case 1 : return "TemperatureDifference";
-				case 2 : return "MaxPressureLoss";
-				case 3 : return "ReferencePressure";
-				case 4 : return "DefaultFluidTemperature";
-				case 5 : return "InitialFluidTemperature";
-				case 6 : return "MaxPipeDiscretization";
-			} break;
-			// NetworkBuriedPipeProperties::SoilType
-			case 43 :
-			switch (t) {
-				case 0 : return "Sand";
-				case 1 : return "Loam";
-				case 2 : return "Silt";
-			} break;
-			// NetworkBuriedPipeProperties::para_t
-			case 44 :
-			switch (t) {
-				case 0 : return "PipeSpacing";
-				case 1 : return "PipeDepth";
-			} break;
-			// NetworkComponent::ModelType
-			case 45 :
-			switch (t) {
-				case 0 : return "SimplePipe";
-				case 1 : return "DynamicPipe";
-				case 2 : return "ConstantPressurePump";
-				case 3 : return "ConstantMassFluxPump";
-				case 4 : return "ControlledPump";
-				case 5 : return "VariablePressurePump";
-				case 6 : return "HeatExchanger";
-				case 7 : return "HeatPumpVariableIdealCarnotSourceSide";
-				case 8 : return "HeatPumpVariableIdealCarnotSupplySide";
-				case 9 : return "HeatPumpVariableSourceSide";
-				case 10 : return "HeatPumpOnOffSourceSide";
-				case 11 : return "ControlledValve";
-				case 12 : return "ConstantPressureLossValve";
-				case 13 : return "IdealHeaterCooler";
-				case 14 : return "PressureLossElement";
-			} break;
-			// NetworkComponent::para_t
-			case 46 :
-			switch (t) {
-				case 0 : return "HydraulicDiameter";
-				case 1 : return "PressureLossCoefficient";
-				case 2 : return "PressureHead";
-				case 3 : return "MassFlux";
-				case 4 : return "PumpMaximumEfficiency";
-				case 5 : return "FractionOfMotorInefficienciesToFluidStream";
-				case 6 : return "MaximumPressureHead";
-				case 7 : return "PumpMaximumElectricalPower";
-				case 8 : return "DesignPressureHead";
-				case 9 : return "DesignMassFlux";
-				case 10 : return "PressureHeadReductionFactor";
-				case 11 : return "Volume";
-				case 12 : return "PipeMaxDiscretizationWidth";
-				case 13 : return "CarnotEfficiency";
-				case 14 : return "MaximumHeatingPower";
-				case 15 : return "MaximumCoolingPower";
-				case 16 : return "PressureLoss";
-				case 17 : return "MinimumOutletTemperature";
-				case 18 : return "HeatingPowerB0W35";
-				case 19 : return "HeatingBufferSupplyTemperature";
-				case 20 : return "HeatingBufferReturnTemperature";
-				case 21 : return "DHWBufferSupplyTemperature";
-				case 22 : return "DHWBufferReturnTemperature";
-				case 23 : return "HeatingBufferVolume";
-				case 24 : return "DHWBufferVolume";
-				case 25 : return "PipeLength";
-			} break;
-			// NetworkComponent::intPara_t
-			case 47 :
-			switch (t) {
-				case 0 : return "NumberParallelPipes";
-				case 1 : return "NumberParallelElements";
-			} break;
-			// NetworkController::ModelType
-			case 48 :
-			switch (t) {
-				case 0 : return "Constant";
-				case 1 : return "Scheduled";
-			} break;
-			// NetworkController::ControlledProperty
-			case 49 :
-			switch (t) {
-				case 0 : return "TemperatureDifference";
-				case 1 : return "TemperatureDifferenceOfFollowingElement";
-				case 2 : return "ThermostatValue";
-				case 3 : return "MassFlux";
-				case 4 : return "PumpOperation";
-				case 5 : return "PressureDifferenceWorstpoint";
-			} break;
-			// NetworkController::ControllerType
-			case 50 :
-			switch (t) {
-				case 0 : return "PController";
-				case 1 : return "PIController";
-				case 2 : return "PIDController";
-				case 3 : return "OnOffController";
-			} break;
-			// NetworkController::para_t
-			case 51 :
-			switch (t) {
-				case 0 : return "Kp";
-				case 1 : return "Ki";
-				case 2 : return "Kd";
-				case 3 : return "TemperatureDifferenceSetpoint";
-				case 4 : return "MassFluxSetpoint";
-				case 5 : return "HeatLossOfFollowingElementThreshold";
-				case 6 : return "RelControllerErrorForIntegratorReset";
-				case 7 : return "PressureDifferenceSetpoint";
-			} break;
-			// NetworkController::References
-			case 52 :
-			switch (t) {
-				case 0 : return "ThermostatZone";
-				case 1 : return "Schedule";
-			} break;
-			// NetworkFluid::para_t
-			case 53 :
-			switch (t) {
-				case 0 : return "Density";
-				case 1 : return "HeatCapacity";
-				case 2 : return "Conductivity";
-			} break;
-			// NetworkNode::NodeType
-			case 54 :
-			switch (t) {
-				case 0 : return "SubStation";
-				case 1 : return "Mixer";
-				case 2 : return "Source";
-			} break;
-			// NetworkPipe::para_t
-			case 55 :
-			switch (t) {
-				case 0 : return "DiameterOutside";
-				case 1 : return "ThicknessWall";
-				case 2 : return "RoughnessWall";
-				case 3 : return "ThermalConductivityWall";
-				case 4 : return "HeatCapacityWall";
-				case 5 : return "DensityWall";
-				case 6 : return "ThicknessInsulation";
-				case 7 : return "ThermalConductivityInsulation";
-			} break;
-			// OutputDefinition::timeType_t
-			case 56 :
-			switch (t) {
-				case 0 : return "None";
-				case 1 : return "Mean";
-				case 2 : return "Integral";
-			} break;
-			// Outputs::flag_t
-			case 57 :
-			switch (t) {
-				case 0 : return "BinaryFormat";
-				case 1 : return "CreateDefaultZoneOutputs";
-				case 2 : return "CreateDefaultNetworkOutputs";
-				case 3 : return "CreateDefaultNetworkSummationModels";
-			} break;
-			// Room::para_t
-			case 58 :
-			switch (t) {
-				case 0 : return "Area";
-				case 1 : return "Volume";
-				case 2 : return "HeatCapacity";
-			} break;
-			// SubSurfaceComponent::SubSurfaceComponentType
-			case 59 :
-			switch (t) {
-				case 0 : return "Window";
-				case 1 : return "Door";
-				case 2 : return "Miscellaneous";
-			} break;
-			// SubSurfaceComponent::para_t
-			case 60 :
-			switch (t) {
-				case 0 : return "ReductionFactor";
-			} break;
-			// SupplySystem::SupplyType
-			case 61 :
-			switch (t) {
-				case 0 : return "StandAlone";
-				case 1 : return "SubNetwork";
-				case 2 : return "DatabaseFMU";
-				case 3 : return "UserDefinedFMU";
-			} break;
-			// SupplySystem::para_t
-			case 62 :
-			switch (t) {
-				case 0 : return "MaximumMassFlux";
-				case 1 : return "SupplyTemperature";
-				case 2 : return "MaximumMassFluxFMU";
-				case 3 : return "HeatingPowerFMU";
-			} break;
-			// SurfaceHeating::para_t
-			case 63 :
-			switch (t) {
-				case 0 : return "HeatingLimit";
-				case 1 : return "CoolingLimit";
-				case 2 : return "PipeSpacing";
-				case 3 : return "MaxFluidVelocity";
-				case 4 : return "TemperatureDifferenceSupplyReturn";
-			} break;
-			// SurfaceHeating::Type
-			case 64 :
-			switch (t) {
-				case 0 : return "Ideal";
-				case 1 : return "PipeRegister";
-			} break;
-			// VentilationNatural::para_t
-			case 65 :
-			switch (t) {
-				case 0 : return "AirChangeRate";
-			} break;
-			// Window::Method
-			case 66 :
-			switch (t) {
-				case 0 : return "None";
-				case 1 : return "Fraction";
-				case 2 : return "ConstantWidth";
-			} break;
-			// Window::para_t
-			case 67 :
-			switch (t) {
-				case 0 : return "FrameWidth";
-				case 1 : return "FrameFraction";
-				case 2 : return "DividerWidth";
-				case 3 : return "DividerFraction";
-			} break;
-			// WindowDivider::para_t
-			case 68 :
-			switch (t) {
-				case 0 : return "Thickness";
-			} break;
-			// WindowFrame::para_t
-			case 69 :
-			switch (t) {
-				case 0 : return "Thickness";
-			} break;
-			// WindowGlazingSystem::modelType_t
-			case 70 :
-			switch (t) {
-				case 0 : return "Simple";
-			} break;
-			// WindowGlazingSystem::para_t
-			case 71 :
-			switch (t) {
-				case 0 : return "ThermalTransmittance";
-			} break;
-			// WindowGlazingSystem::splinePara_t
-			case 72 :
-			switch (t) {
-				case 0 : return "SHGC";
-			} break;
-			// ZoneControlNaturalVentilation::para_t
-			case 73 :
-			switch (t) {
-				case 0 : return "MaximumAirChangeRateComfort";
-				case 1 : return "TemperatureAirMax";
-				case 2 : return "TemperatureAirMin";
-				case 3 : return "WindSpeedMax";
-			} break;
-			// ZoneControlShading::para_t
-			case 74 :
-			switch (t) {
-				case 0 : return "GlobalHorizontal";
-				case 1 : return "GlobalNorth";
-				case 2 : return "GlobalEast";
-				case 3 : return "GlobalSouth";
-				case 4 : return "GlobalWest";
-				case 5 : return "DeadBand";
-			} break;
-			// ZoneControlShading::Category
-			case 75 :
-			switch (t) {
-				case 0 : return "GlobalHorizontalSensor";
-				case 1 : return "GlobalHorizontalAndVerticalSensors";
-			} break;
-			// ZoneControlThermostat::para_t
-			case 76 :
-			switch (t) {
-				case 0 : return "Tolerance";
-				case 1 : return "DeadBand";
-			} break;
-			// ZoneControlThermostat::ControlValue
-			case 77 :
-			switch (t) {
-				case 0 : return "AirTemperature";
-				case 1 : return "OperativeTemperature";
-			} break;
-			// ZoneControlThermostat::ControllerType
-			case 78 :
-			switch (t) {
-				case 0 : return "Analog";
-				case 1 : return "Digital";
-			} break;
-			// ZoneIdealHeatingCooling::para_t
-			case 79 :
-			switch (t) {
-				case 0 : return "HeatingLimit";
-				case 1 : return "CoolingLimit";
-			} break;
-			// ZoneTemplate::SubTemplateType
-			case 80 :
-			switch (t) {
-				case 0 : return "IntLoadPerson";
-				case 1 : return "IntLoadEquipment";
-				case 2 : return "IntLoadLighting";
-				case 3 : return "IntLoadOther";
-				case 4 : return "ControlThermostat";
-				case 5 : return "ControlShading";
-				case 6 : return "ControlVentilationNatural";
-				case 7 : return "Infiltration";
-				case 8 : return "NaturalVentilation";
-				case 9 : return "IdealHeatingCooling";
-			} break;
-		} // switch
-		return INVALID_KEYWORD_INDEX_STRING;
+	/*! Holds the hashes of all enum types/categories (see KeywordList::CategoryHash()). */
+	const unsigned int ENUM_TYPE_HASHES[81] = {
+		3477681155u, // AcousticBuildingTemplate::AcousticBuildingType
+		1470652948u, // AcousticComponent::para_t
+		2229684273u, // AcousticComponent::SizeMethod
+		1652106161u, // AcousticReferenceComponent::RequirementType
+		1546045981u, // AcousticReferenceComponent::ComponentType
+		3818047515u, // AcousticSoundAbsorptionPartition::para_t
+		2264796907u, // AcousticSoundProtectionTemplate::AcousticBuildingType
+		1443841220u, // AcousticTemplate::splinePara_t
+		2942486179u, // Component::ComponentType
+		64020775u, // Construction::UsageType
+		3314229568u, // Construction::InsulationKind
+		1550008527u, // Construction::MaterialKind
+		1218313237u, // Construction::para_t
+		2915664656u, // EpdCategorySet::Category
+		4116964768u, // EpdDataset::Type
+		375652928u, // EpdDataset::Category
+		1430738029u, // EpdModuleDataset::para_t
+		3414421304u, // EpdModuleDataset::Module
+		2937064905u, // Infiltration::para_t
+		1889063976u, // Infiltration::AirChangeType
+		1263235890u, // InterfaceHeatConduction::modelType_t
+		2234891296u, // InterfaceHeatConduction::OtherZoneType
+		2085903553u, // InterfaceHeatConduction::para_t
+		2018625061u, // InternalLoad::para_t
+		233952016u, // InternalLoad::Category
+		1821958677u, // InternalLoad::PersonCountMethod
+		1844232404u, // InternalLoad::PowerMethod
+		3557163906u, // KeywordList::MyParameters
+		1532192799u, // LcaSettings::para_t
+		1410329238u, // LcaSettings::Module
+		2662702814u, // LcaSettings::LcaCategory
+		1001903805u, // LcaSettings::UsageType
+		3582232272u, // LcaSettings::CalculationMode
+		3486847758u, // LcaSettings::CertificationSytem
+		2479772853u, // LccSettings::para_t
+		4220113932u, // LccSettings::intPara_t
+		2168334281u, // Material::para_t
+		660374548u, // Material::Category
+		4106758344u, // MaterialLayer::para_t
+		129833214u, // Network::PipeModel
+		936240874u, // Network::ModelType
+		3857695869u, // Network::NetworkType
+		1253899208u, // Network::para_t
+		2266463162u, // NetworkBuriedPipeProperties::SoilType
+		4184781168u, // NetworkBuriedPipeProperties::para_t
+		3085047137u, // NetworkComponent::ModelType
+		3352508393u, // NetworkComponent::para_t
+		779407768u, // NetworkComponent::intPara_t
+		3972136646u, // NetworkController::ModelType
+		1126446154u, // NetworkController::ControlledProperty
+		3191845773u, // NetworkController::ControllerType
+		741338900u, // NetworkController::para_t
+		309750935u, // NetworkController::References
+		302904582u, // NetworkFluid::para_t
+		1611224717u, // NetworkNode::NodeType
+		3359500444u, // NetworkPipe::para_t
+		3215482783u, // OutputDefinition::timeType_t
+		273100196u, // Outputs::flag_t
+		1304870659u, // Room::para_t
+		1744088609u, // SubSurfaceComponent::SubSurfaceComponentType
+		2139363598u, // SubSurfaceComponent::para_t
+		573439484u, // SupplySystem::SupplyType
+		694636626u, // SupplySystem::para_t
+		540391995u, // SurfaceHeating::para_t
+		2677644486u, // SurfaceHeating::Type
+		3358712316u, // VentilationNatural::para_t
+		3256717288u, // Window::Method
+		2159227280u, // Window::para_t
+		3984655351u, // WindowDivider::para_t
+		4079343559u, // WindowFrame::para_t
+		221473760u, // WindowGlazingSystem::modelType_t
+		367462819u, // WindowGlazingSystem::para_t
+		3130539690u, // WindowGlazingSystem::splinePara_t
+		1449916333u, // ZoneControlNaturalVentilation::para_t
+		955316059u, // ZoneControlShading::para_t
+		2784247214u, // ZoneControlShading::Category
+		2470816152u, // ZoneControlThermostat::para_t
+		1280929151u, // ZoneControlThermostat::ControlValue
+		755520233u, // ZoneControlThermostat::ControllerType
+		3429514200u, // ZoneIdealHeatingCooling::para_t
+		2254301011u // ZoneTemplate::SubTemplateType
+	};
+
+	/*! Collision-free hash table, maps ((hash*4042699997u) >> 23) to category index (-1 for empty slots). */
+	const short ENUM_TYPE_HASH_TABLE[512] = {
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,19,
+		-1,-1,-1,-1,49,-1,-1,-1,59,-1,-1,-1,32,-1,-1,-1,
+		64,1,-1,-1,77,35,-1,-1,-1,-1,9,-1,41,16,-1,-1,
+		-1,-1,-1,18,-1,-1,-1,-1,-1,-1,-1,52,-1,68,80,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,66,47,-1,-1,-1,
+		61,-1,-1,-1,60,55,79,-1,-1,-1,-1,-1,-1,46,25,-1,
+		45,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,70,-1,-1,40,
+		-1,-1,-1,-1,-1,-1,4,-1,-1,48,-1,-1,-1,-1,-1,58,
+		-1,-1,-1,-1,-1,-1,-1,-1,5,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,65,-1,-1,10,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,51,-1,-1,
+		-1,-1,-1,-1,31,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,75,-1,-1,-1,-1,-1,43,-1,
+		-1,26,-1,-1,-1,-1,-1,3,-1,69,-1,71,-1,-1,-1,-1,
+		-1,-1,62,-1,-1,-1,-1,-1,-1,-1,23,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,53,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,30,
+		-1,-1,-1,-1,-1,27,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,8,-1,-1,21,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,76,-1,74,-1,
+		-1,-1,-1,-1,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,20,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		13,-1,-1,-1,-1,44,-1,33,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,12,-1,37,-1,-1,-1,-1,57,73,-1,-1,-1,22,
+		-1,72,-1,67,-1,-1,-1,-1,14,-1,-1,38,-1,-1,-1,-1,
+		-1,50,-1,-1,-1,34,-1,-1,-1,-1,-1,-1,-1,-1,-1,39,
+		-1,-1,-1,-1,56,-1,-1,-1,-1,-1,-1,-1,-1,29,15,-1,
+		-1,-1,-1,6,-1,-1,-1,-1,54,17,-1,-1,78,-1,-1,-1,
+		42,-1,-1,-1,63,-1,-1,7,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,11,-1,-1,24,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,36,-1,-1,-1,-1,-1,2,-1,-1,-1,-1,-1,-1,
+		-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1
+	};
+
+	/*! Converts a category string to respective enumeration value. */
+	int enum2index(const char * const enumtype) {
+		int idx = ENUM_TYPE_HASH_TABLE[(KeywordList::CategoryHash(enumtype)*4042699997u) >> 23];
+		if (idx != -1 && std::strcmp(enumtype, ENUM_TYPES[idx]) == 0)
+			return idx;
+		//std::cerr << "Unknown enumeration type '" << enumtype<< "'." << std::endl;
+		return -1;
+	}
+	
+	/*! Converts a category hash to respective enumeration value. */
+	int hash2index(unsigned int categoryHash) {
+		int idx = ENUM_TYPE_HASH_TABLE[(categoryHash*4042699997u) >> 23];
+		if (idx != -1 && ENUM_TYPE_HASHES[idx] == categoryHash)
+			return idx;
+		return -1;
 	}
+	
 
-	/*! Returns all keywords including deprecated for a given category (typenum) and type number (t). */
-	const char * allKeywords(int typenum, int t) {
+	/*! Returns a keyword string for a given category (typenum) and type number t. */
+	const char * theKeyword(int typenum, int t) {
 		switch (typenum) {
 			// AcousticBuildingTemplate::AcousticBuildingType
 			case 0 :
@@ -1508,6 +949,482 @@ namespace VICUS {
 		return INVALID_KEYWORD_INDEX_STRING;
 	}
 
+	/*! Entry in keyword table. */
+	struct KeywordTableEntry {
+		/*! Keyword (current or deprecated). */
+		const char *	keyword;
+		/*! Enumeration value. */
+		int				index;
+		/*! True if keyword is deprecated. */
+		bool			deprecated;
+	};
+
+	/*! All keywords including deprecated, sorted by keyword within each category. */
+	const KeywordTableEntry KEYWORD_TABLE[359] = {
+		// AcousticBuildingTemplate::AcousticBuildingType
+		{ "Hospital", 2, false },
+		{ "Hotel", 1, false },
+		{ "MultiFamilyHouse", 0, false },
+		{ "Office", 5, false },
+		{ "School", 3, false },
+		{ "SingleFamilyHouse", 4, false },
+		// AcousticComponent::para_t
+		{ "Area", 0, false },
+		{ "Fraction", 1, false },
+		// AcousticComponent::SizeMethod
+		{ "AreaFraction", 1, false },
+		{ "AreaTotal", 0, false },
+		// AcousticReferenceComponent::RequirementType
+		{ "advanced", 1, false },
+		{ "basic", 0, false },
+		// AcousticReferenceComponent::ComponentType
+		{ "Ceiling", 0, false },
+		{ "Door", 2, false },
+		{ "Stairs", 3, false },
+		{ "Wall", 1, false },
+		// AcousticSoundAbsorptionPartition::para_t
+		{ "AreaFraction", 0, false },
+		// AcousticSoundProtectionTemplate::AcousticBuildingType
+		{ "Hospital", 2, false },
+		{ "Hotel", 1, false },
+		{ "MultiFamilyHouse", 0, false },
+		{ "Office", 5, false },
+		{ "School", 3, false },
+		{ "SingleFamilyHouse", 4, false },
+		// AcousticTemplate::splinePara_t
+		{ "MaxValue", 0, false },
+		{ "MinValue", 1, false },
+		// Component::ComponentType
+		{ "Ceiling", 6, false },
+		{ "ColdRoof", 9, false },
+		{ "FlatRoof", 8, false },
+		{ "FloorToAir", 4, false },
+		{ "FloorToCellar", 3, false },
+		{ "FloorToGround", 5, false },
+		{ "InsideWall", 2, false },
+		{ "Miscellaneous", 11, false },
+		{ "OutsideWall", 0, false },
+		{ "OutsideWallToGround", 1, false },
+		{ "SlopedRoof", 7, false },
+		{ "WarmRoof", 10, false },
+		// Construction::UsageType
+		{ "---", 8, false },
+		{ "Ceiling", 5, false },
+		{ "FlatRoof", 7, false },
+		{ "FloorToCellar", 3, false },
+		{ "FloorToGround", 4, false },
+		{ "InsideWall", 2, false },
+		{ "OutsideWall", 0, false },
+		{ "OutsideWallToGround", 1, false },
+		{ "SlopedRoof", 6, false },
+		// Construction::InsulationKind
+		{ "---", 4, false },
+		{ "CoreInsulation", 2, false },
+		{ "InsideInsulation", 1, false },
+		{ "NotInsulated", 0, false },
+		{ "OutsideInsulation", 3, false },
+		// Construction::MaterialKind
+		{ "---", 6, false },
+		{ "BrickMasonry", 0, false },
+		{ "Concrete", 2, false },
+		{ "FrameWork", 4, false },
+		{ "Loam", 5, false },
+		{ "NaturalStoneMasonry", 1, false },
+		{ "Wood", 3, false },
+		// Construction::para_t
+		{ "AirSoundResistanceValue", 1, false },
+		{ "ImpactSoundValue", 0, false },
+		// EpdCategorySet::Category
+		{ "IDCategoryA", 0, false },
+		{ "IDCategoryB", 1, false },
+		{ "IDCategoryC", 2, false },
+		{ "IDCategoryD", 3, false },
+		// EpdDataset::Type
+		{ "Average", 2, false },
+		{ "Generic", 0, false },
+		{ "Representative", 3, false },
+		{ "Specific", 1, false },
+		{ "Template", 4, false },
+		// EpdDataset::Category
+		{ "A", 0, false },
+		{ "B", 1, false },
+		{ "C", 2, false },
+		{ "D", 3, false },
+		// EpdModuleDataset::para_t
+		{ "AP", 5, false },
+		{ "AreaDensity", 0, false },
+		{ "DryDensity", 1, false },
+		{ "EP", 6, false },
+		{ "GWP", 2, false },
+		{ "ODP", 3, false },
+		{ "PENRT", 7, false },
+		{ "PERT", 8, false },
+		{ "POCP", 4, false },
+		// EpdModuleDataset::Module
+		{ "A1", 0, false },
+		{ "A2", 1, false },
+		{ "A3", 2, false },
+		{ "A4", 3, false },
+		{ "A5", 4, false },
+		{ "B1", 5, false },
+		{ "B2", 6, false },
+		{ "B3", 7, false },
+		{ "B4", 8, false },
+		{ "B5", 9, false },
+		{ "B6", 10, false },
+		{ "B7", 11, false },
+		{ "C1", 12, false },
+		{ "C2", 13, false },
+		{ "C3", 14, false },
+		{ "C4", 15, false },
+		{ "D", 16, false },
+		// Infiltration::para_t
+		{ "AirChangeRate", 0, false },
+		{ "ShieldingCoefficient", 1, false },
+		// Infiltration::AirChangeType
+		{ "n50", 1, false },
+		{ "normal", 0, false },
+		// InterfaceHeatConduction::modelType_t
+		{ "Constant", 0, false },
+		{ "None", 1, false },
+		// InterfaceHeatConduction::OtherZoneType
+		{ "Constant", 1, false },
+		{ "Scheduled", 2, false },
+		{ "Standard", 0, false },
+		// InterfaceHeatConduction::para_t
+		{ "ConstTemperature", 1, false },
+		{ "HeatTransferCoefficient", 0, false },
+		// InternalLoad::para_t
+		{ "AreaPerPerson", 2, false },
+		{ "ConvectiveHeatFactor", 6, false },
+		{ "LatentHeatFactor", 7, false },
+		{ "LossHeatFactor", 8, false },
+		{ "MoistureProductionRatePerArea", 5, false },
+		{ "PersonCount", 0, false },
+		{ "PersonPerArea", 1, false },
+		{ "Power", 3, false },
+		{ "PowerPerArea", 4, false },
+		// InternalLoad::Category
+		{ "ElectricEquiment", 1, false },
+		{ "Lighting", 2, false },
+		{ "Other", 3, false },
+		{ "Person", 0, false },
+		// InternalLoad::PersonCountMethod
+		{ "AreaPerPerson", 1, false },
+		{ "PersonCount", 2, false },
+		{ "PersonPerArea", 0, false },
+		// InternalLoad::PowerMethod
+		{ "Power", 1, false },
+		{ "PowerPerArea", 0, false },
+		// KeywordList::MyParameters
+		{ "Mass", 1, false },
+		{ "Temperature", 0, false },
+		// LcaSettings::para_t
+		{ "FactorSimpleMode", 1, false },
+		{ "NetUsageArea", 2, false },
+		{ "TimePeriod", 0, false },
+		// LcaSettings::Module
+		{ "A1", 0, false },
+		{ "A2", 1, false },
+		{ "A3", 2, false },
+		{ "A4", 3, false },
+		{ "A5", 4, false },
+		{ "B1", 5, false },
+		{ "B2", 6, false },
+		{ "B3", 7, false },
+		{ "B4", 8, false },
+		{ "B5", 9, false },
+		{ "B6", 10, false },
+		{ "B7", 11, false },
+		{ "C1", 12, false },
+		{ "C2", 13, false },
+		{ "C3", 14, false },
+		{ "C4", 15, false },
+		{ "D", 16, false },
+		// LcaSettings::LcaCategory
+		{ "A", 0, false },
+		{ "B", 1, false },
+		{ "C", 2, false },
+		{ "D", 3, false },
+		// LcaSettings::UsageType
+		{ "Coal", 2, false },
+		{ "Electricity", 1, false },
+		{ "Gas", 0, false },
+		// LcaSettings::CalculationMode
+		{ "Detailed", 1, false },
+		{ "Simple", 0, false },
+		// LcaSettings::CertificationSytem
+		{ "BNB", 0, false },
+		// LccSettings::para_t
+		{ "CoalConsumption", 3, false },
+		{ "DiscountingInterestRate", 2, false },
+		{ "ElectricityConsumption", 5, false },
+		{ "GasConsumption", 4, false },
+		{ "PriceIncreaseEnergy", 1, false },
+		{ "PriceIncreaseGeneral", 0, false },
+		// LccSettings::intPara_t
+		{ "CoalPrice", 0, false },
+		{ "ElectricityPrice", 2, false },
+		{ "GasPrice", 1, false },
+		// Material::para_t
+		{ "Conductivity", 2, false },
+		{ "Density", 0, false },
+		{ "HeatCapacity", 1, false },
+		{ "Mu", 3, false },
+		{ "W80", 4, false },
+		{ "Wsat", 5, false },
+		// Material::Category
+		{ "Bricks", 2, false },
+		{ "BuildingBoards", 6, false },
+		{ "Cementitious", 4, false },
+		{ "CladdingSystems", 10, false },
+		{ "Coating", 0, false },
+		{ "Foils", 11, false },
+		{ "Insulations", 5, false },
+		{ "Miscellaneous", 12, false },
+		{ "NaturalMaterials", 8, false },
+		{ "NaturalStones", 3, false },
+		{ "Plaster", 1, false },
+		{ "Soils", 9, false },
+		{ "Woodbased", 7, false },
+		// MaterialLayer::para_t
+		{ "Lifetime", 1, false },
+		{ "Thickness", 0, false },
+		// Network::PipeModel
+		{ "DynamicPipe", 1, false },
+		{ "SimplePipe", 0, false },
+		// Network::ModelType
+		{ "HydraulicNetwork", 0, false },
+		{ "ThermalHydraulicNetwork", 1, false },
+		// Network::NetworkType
+		{ "DoublePipe", 1, false },
+		{ "SinglePipe", 0, false },
+		// Network::para_t
+		{ "DefaultFluidTemperature", 4, false },
+		{ "InitialFluidTemperature", 5, false },
+		{ "MaxPipeDiscretization", 6, false },
+		{ "MaxPressureLoss", 2, false },
+		{ "ReferencePressure", 3, false },
+		{ "TemperatureDifference", 1, false },
+		{ "TemperatureSetpoint", 0, false },
+		// NetworkBuriedPipeProperties::SoilType
+		{ "Loam", 1, false },
+		{ "Sand", 0, false },
+		{ "Silt", 2, false },
+		// NetworkBuriedPipeProperties::para_t
+		{ "PipeDepth", 1, false },
+		{ "PipeSpacing", 0, false },
+		// NetworkComponent::ModelType
+		{ "ConstantMassFluxPump", 3, false },
+		{ "ConstantPressureLossValve", 12, false },
+		{ "ConstantPressurePump", 2, false },
+		{ "ControlledPump", 4, false },
+		{ "ControlledValve", 11, false },
+		{ "DynamicPipe", 1, false },
+		{ "HeatExchanger", 6, false },
+		{ "HeatPumpOnOffSourceSide", 10, false },
+		{ "HeatPumpVariableIdealCarnotSourceSide", 7, false },
+		{ "HeatPumpVariableIdealCarnotSupplySide", 8, false },
+		{ "HeatPumpVariableSourceSide", 9, false },
+		{ "IdealHeaterCooler", 13, false },
+		{ "PressureLossElement", 14, false },
+		{ "SimplePipe", 0, false },
+		{ "VariablePressurePump", 5, false },
+		// NetworkComponent::para_t
+		{ "CarnotEfficiency", 13, false },
+		{ "DHWBufferReturnTemperature", 22, false },
+		{ "DHWBufferSupplyTemperature", 21, false },
+		{ "DHWBufferVolume", 24, false },
+		{ "DesignMassFlux", 9, false },
+		{ "DesignPressureHead", 8, false },
+		{ "FractionOfMotorInefficienciesToFluidStream", 5, false },
+		{ "HeatingBufferReturnTemperature", 20, false },
+		{ "HeatingBufferSupplyTemperature", 19, false },
+		{ "HeatingBufferVolume", 23, false },
+		{ "HeatingPowerB0W35", 18, false },
+		{ "HydraulicDiameter", 0, false },
+		{ "MassFlux", 3, false },
+		{ "MaximumCoolingPower", 15, false },
+		{ "MaximumHeatingPower", 14, false },
+		{ "MaximumPressureHead", 6, false },
+		{ "MinimumOutletTemperature", 17, false },
+		{ "PipeLength", 25, false },
+		{ "PipeMaxDiscretizationWidth", 12, false },
+		{ "PressureHead", 2, false },
+		{ "PressureHeadReductionFactor", 10, false },
+		{ "PressureLoss", 16, false },
+		{ "PressureLossCoefficient", 1, false },
+		{ "PumpMaximumEfficiency", 4, false },
+		{ "PumpMaximumElectricalPower", 7, false },
+		{ "Volume", 11, false },
+		// NetworkComponent::intPara_t
+		{ "NumberParallelElements", 1, false },
+		{ "NumberParallelPipes", 0, false },
+		// NetworkController::ModelType
+		{ "Constant", 0, false },
+		{ "Scheduled", 1, false },
+		// NetworkController::ControlledProperty
+		{ "MassFlux", 3, false },
+		{ "PressureDifferenceWorstpoint", 5, false },
+		{ "PumpOperation", 4, false },
+		{ "TemperatureDifference", 0, false },
+		{ "TemperatureDifferenceOfFollowingElement", 1, false },
+		{ "ThermostatValue", 2, false },
+		// NetworkController::ControllerType
+		{ "OnOffController", 3, false },
+		{ "PController", 0, false },
+		{ "PIController", 1, false },
+		{ "PIDController", 2, false },
+		// NetworkController::para_t
+		{ "HeatLossOfFollowingElementThreshold", 5, false },
+		{ "Kd", 2, false },
+		{ "Ki", 1, false },
+		{ "Kp", 0, false },
+		{ "MassFluxSetpoint", 4, false },
+		{ "PressureDifferenceSetpoint", 7, false },
+		{ "RelControllerErrorForIntegratorReset", 6, false },
+		{ "TemperatureDifferenceSetpoint", 3, false },
+		// NetworkController::References
+		{ "Schedule", 1, false },
+		{ "ThermostatZone", 0, false },
+		// NetworkFluid::para_t
+		{ "Conductivity", 2, false },
+		{ "Density", 0, false },
+		{ "HeatCapacity", 1, false },
+		// NetworkNode::NodeType
+		{ "Mixer", 1, false },
+		{ "Source", 2, false },
+		{ "SubStation", 0, false },
+		// NetworkPipe::para_t
+		{ "DensityWall", 5, false },
+		{ "DiameterOutside", 0, false },
+		{ "HeatCapacityWall", 4, false },
+		{ "RoughnessWall", 2, false },
+		{ "ThermalConductivityInsulation", 7, false },
+		{ "ThermalConductivityWall", 3, false },
+		{ "ThicknessInsulation", 6, false },
+		{ "ThicknessWall", 1, false },
+		// OutputDefinition::timeType_t
+		{ "Integral", 2, false },
+		{ "Mean", 1, false },
+		{ "None", 0, false },
+		// Outputs::flag_t
+		{ "BinaryFormat", 0, false },
+		{ "CreateDefaultNetworkOutputs", 2, false },
+		{ "CreateDefaultNetworkSummationModels", 3, false },
+		{ "CreateDefaultZoneOutputs", 1, false },
+		// Room::para_t
+		{ "Area", 0, false },
+		{ "HeatCapacity", 2, false },
+		{ "Volume", 1, false },
+		// SubSurfaceComponent::SubSurfaceComponentType
+		{ "Door", 1, false },
+		{ "Miscellaneous", 2, false },
+		{ "Window", 0, false },
+		// SubSurfaceComponent::para_t
+		{ "ReductionFactor", 0, false },
+		// SupplySystem::SupplyType
+		{ "DatabaseFMU", 2, false },
+		{ "StandAlone", 0, false },
+		{ "SubNetwork", 1, false },
+		{ "UserDefinedFMU", 3, false },
+		// SupplySystem::para_t
+		{ "HeatingPowerFMU", 3, false },
+		{ "MaximumMassFlux", 0, false },
+		{ "MaximumMassFluxFMU", 2, false },
+		{ "SupplyTemperature", 1, false },
+		// SurfaceHeating::para_t
+		{ "CoolingLimit", 1, false },
+		{ "HeatingLimit", 0, false },
+		{ "MaxFluidVelocity", 3, false },
+		{ "PipeSpacing", 2, false },
+		{ "TemperatureDifferenceSupplyReturn", 4, false },
+		// SurfaceHeating::Type
+		{ "Ideal", 0, false },
+		{ "PipeRegister", 1, false },
+		// VentilationNatural::para_t
+		{ "AirChangeRate", 0, false },
+		// Window::Method
+		{ "ConstantWidth", 2, false },
+		{ "Fraction", 1, false },
+		{ "None", 0, false },
+		// Window::para_t
+		{ "DividerFraction", 3, false },
+		{ "DividerWidth", 2, false },
+		{ "FrameFraction", 1, false },
+		{ "FrameWidth", 0, false },
+		// WindowDivider::para_t
+		{ "Thickness", 0, false },
+		// WindowFrame::para_t
+		{ "Thickness", 0, false },
+		// WindowGlazingSystem::modelType_t
+		{ "Simple", 0, false },
+		// WindowGlazingSystem::para_t
+		{ "ThermalTransmittance", 0, false },
+		// WindowGlazingSystem::splinePara_t
+		{ "SHGC", 0, false },
+		// ZoneControlNaturalVentilation::para_t
+		{ "MaximumAirChangeRateComfort", 0, false },
+		{ "TemperatureAirMax", 1, false },
+		{ "TemperatureAirMin", 2, false },
+		{ "WindSpeedMax", 3, false },
+		// ZoneControlShading::para_t
+		{ "DeadBand", 5, false },
+		{ "GlobalEast", 2, false },
+		{ "GlobalHorizontal", 0, false },
+		{ "GlobalNorth", 1, false },
+		{ "GlobalSouth", 3, false },
+		{ "GlobalWest", 4, false },
+		// ZoneControlShading::Category
+		{ "GlobalHorizontalAndVerticalSensors", 1, false },
+		{ "GlobalHorizontalSensor", 0, false },
+		// ZoneControlThermostat::para_t
+		{ "DeadBand", 1, false },
+		{ "Tolerance", 0, false },
+		// ZoneControlThermostat::ControlValue
+		{ "AirTemperature", 0, false },
+		{ "OperativeTemperature", 1, false },
+		// ZoneControlThermostat::ControllerType
+		{ "Analog", 0, false },
+		{ "Digital", 1, false },
+		// ZoneIdealHeatingCooling::para_t
+		{ "CoolingLimit", 1, false },
+		{ "HeatingLimit", 0, false },
+		// ZoneTemplate::SubTemplateType
+		{ "ControlShading", 5, false },
+		{ "ControlThermostat", 4, false },
+		{ "ControlVentilationNatural", 6, false },
+		{ "IdealHeatingCooling", 9, false },
+		{ "Infiltration", 7, false },
+		{ "IntLoadEquipment", 1, false },
+		{ "IntLoadLighting", 2, false },
+		{ "IntLoadOther", 3, false },
+		{ "IntLoadPerson", 0, false },
+		{ "NaturalVentilation", 8, false }
+	};
+
+	/*! Index of first keyword of each category in KEYWORD_TABLE, last value is the table size. */
+	const unsigned int KEYWORD_TABLE_OFFSETS[82] = {
+		0,6,8,10,12,16,17,23,25,37,46,51,58,60,64,69,
+		73,82,99,101,103,105,108,110,119,123,126,128,130,133,150,154,
+		157,159,160,166,169,175,188,190,192,194,196,203,206,208,223,249,
+		251,253,259,263,271,273,276,279,287,290,294,297,300,301,305,309,
+		314,316,317,320,324,325,326,327,328,329,333,339,341,343,345,347,
+		349,359
+	};
+
+	/*! Returns keyword table entry for given keyword in category with index typenum, or nullptr if not found. */
+	const KeywordTableEntry * findKeyword(int typenum, const std::string & kw) {
+		const KeywordTableEntry * first = KEYWORD_TABLE + KEYWORD_TABLE_OFFSETS[typenum];
+		const KeywordTableEntry * last = KEYWORD_TABLE + KEYWORD_TABLE_OFFSETS[typenum+1];
+		const char * const kwStr = kw.c_str();
+		first = std::lower_bound(first, last, kwStr,
+			[](const KeywordTableEntry & e, const char * k) { return std::strcmp(e.keyword, k) < 0; });
+		if (first != last && kw == first->keyword)
+			return first;
+		return nullptr;
+	}
+
 	const char * KeywordList::Description(const char * const enumtype, int t, bool * no_description) {
 		if (no_description != nullptr)
 			*no_description = false; // we are optimistic
@@ -4621,49 +4538,48 @@ namespace VICUS {
 
 	bool KeywordList::KeywordExists(const char * const enumtype, const std::string & kw) {
 		int typenum = enum2index(enumtype);
-		int i = 0;
-		int maxIndexInCategory = MaxIndex( enumtype ); 
-		for ( ; i <= maxIndexInCategory; ++i ) {
-			std::string keywords = allKeywords(typenum, i);
-			if (keywords == INVALID_KEYWORD_INDEX_STRING)
-				continue;
-			std::stringstream strm(keywords);
-			int j = 0;
-			std::string kws;
-			while (strm >> kws) {
-				if (kws == kw) {
-					return true; // keyword exists
-				}
-				++j;
-			}
-		}
-		return false; // nothing found keyword doesn't exist.
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type '%1'.")
+				.arg(enumtype), "[KeywordList::KeywordExists]");
+		return findKeyword(typenum, kw) != nullptr;
+	}
+
+	bool KeywordList::KeywordExists(unsigned int categoryHash, const std::string & kw) {
+		int typenum = hash2index(categoryHash);
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type hash '%1'.")
+				.arg(categoryHash), "[KeywordList::KeywordExists]");
+		return findKeyword(typenum, kw) != nullptr;
 	}
 
 	int KeywordList::Enumeration(const char * const enumtype, const std::string & kw, bool * deprecated) {
 		int typenum = enum2index(enumtype);
-		int i = 0;
-		int maxIndexInCategory = MaxIndex( enumtype ); 
-		for ( ; i <= maxIndexInCategory; ++i ) {
-			std::string keywords = allKeywords(typenum, i);
-			if (keywords == INVALID_KEYWORD_INDEX_STRING)
-				continue;
-			std::stringstream strm(keywords);
-			int j = 0;
-			std::string kws;
-			while (strm >> kws) {
-				if (kws == kw) {
-					if (deprecated != nullptr) {
-						*deprecated = (j != 0);
-					}
-					return i;
-				}
-				++j;
-			}
-		} // for ( ; i < maxIndexInCategory; ++i ) {
-		throw IBK::Exception(IBK::FormatString("Cannot determine enumeration value for "
-			"enumeration type '%1' and keyword '%2'.")
-			.arg(enumtype).arg(kw), "[KeywordList::Enumeration]");
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type '%1'.")
+				.arg(enumtype), "[KeywordList::Enumeration]");
+		const KeywordTableEntry * entry = findKeyword(typenum, kw);
+		if (entry == nullptr)
+			throw IBK::Exception(IBK::FormatString("Cannot determine enumeration value for "
+				"enumeration type '%1' and keyword '%2'.")
+				.arg(enumtype).arg(kw), "[KeywordList::Enumeration]");
+		if (deprecated != nullptr)
+			*deprecated = entry->deprecated;
+		return entry->index;
+	}
+
+	int KeywordList::Enumeration(unsigned int categoryHash, const std::string & kw, bool * deprecated) {
+		int typenum = hash2index(categoryHash);
+		if (typenum == -1)
+			throw IBK::Exception(IBK::FormatString("Invalid enumeration type hash '%1'.")
+				.arg(categoryHash), "[KeywordList::Enumeration]");
+		const KeywordTableEntry * entry = findKeyword(typenum, kw);
+		if (entry == nullptr)
+			throw IBK::Exception(IBK::FormatString("Cannot determine enumeration value for "
+				"enumeration type '%1' and keyword '%2'.")
+				.arg(ENUM_TYPES[typenum]).arg(kw), "[KeywordList::Enumeration]");
+		if (deprecated != nullptr)
+			*deprecated = entry->deprecated;
+		return entry->index;
 	}
 
 	bool KeywordList::CategoryExists(const char * const enumtype) {
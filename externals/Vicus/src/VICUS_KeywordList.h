@@ -97,6 +97,32 @@ public:
 	*/
 	static int Enumeration(const char * const enumtype, const std::string & kw, bool * deprecated = nullptr);
 
+	/*! Returns an enumeration value for a given keyword kw of the category identified by its hash.
+		This function throws an exception if the keyword or the enumeration type is invalid or unknown.
+		\param categoryHash	Hash of the full enumeration type, computed with CategoryHash().
+		\param kw 			The keyword string.
+		\param deprecated 	The optional argument is set the true if the keyword kw is deprecated.
+	*/
+	static int Enumeration(unsigned int categoryHash, const std::string & kw, bool * deprecated = nullptr);
+
+	/*! Returns an enumeration value for a given keyword kw, with the category hash resolved at compile time.
+		\code
+		Interval::para_t p = (Interval::para_t)KeywordList::Enumeration<KeywordList::CategoryHash("Interval::para_t")>(kw);
+		\endcode
+	*/
+	template <unsigned int CATEGORY_HASH>
+	static int Enumeration(const std::string & kw, bool * deprecated = nullptr) { return Enumeration(CATEGORY_HASH, kw, deprecated); }
+
+	/*! Computes the hash (32-bit FNV-1a) of an enumeration type name.
+		Categories are looked up via a collision-free hash table generated by the code generator.
+		The function is constexpr, so that the hash of a string literal can be computed at compile time.
+		\param enumtype 	The full enumeration type including the class name.
+		\param h			Current hash value (used in recursion).
+	*/
+	static constexpr unsigned int CategoryHash(const char * const enumtype, unsigned int h = 2166136261u) {
+		return (*enumtype == 0) ? h : CategoryHash(enumtype + 1, (h ^ (unsigned char)*enumtype) * 16777619u);
+	}
+
 
 	/*!	Returns the maximum index for entries of a category in the keyword list.
 		This function throws an exception if the enumeration type is invalid or unknown.
@@ -115,6 +141,11 @@ public:
 		\return Returns true if the keyword is valid, otherwise false.
 	*/
 	static bool KeywordExists(const char * const enumtype, const std::string & kw);
+	/*! Checks whether a keyword exists in the enumeration of the category identified by its hash.
+		\param categoryHash	Hash of the full enumeration type, computed with CategoryHash().
+		\return Returns true if the keyword is valid, otherwise false.
+	*/
+	static bool KeywordExists(unsigned int categoryHash, const std::string & kw);
 	/*! Checks whether a category of type enumtype exists.
 		\return Returns true if the category/enum type exists, otherwise false.
 	*/
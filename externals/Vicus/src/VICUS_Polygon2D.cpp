@@ -49,11 +49,14 @@ void Polygon2D::readXML(const TiXmlElement * element) {
 
 	try {
 		// read vertexes
-		std::string text = element->GetText();
-		text = IBK::replace_string(text, ",", " ");
 		std::vector<double> vals;
 		try {
-			IBK::string2valueVector(text, vals);
+			// take values read from binary container directly, otherwise parse element text
+			const std::vector<double> * numbers = element->GetNumbers();
+			if (numbers != nullptr)
+				vals = *numbers;
+			else
+				IBK::string2valueVector(element->GetText(), vals, true);
 			// must have n*2 elements
 			if (vals.size() % 2 != 0)
 				throw IBK::Exception("Mismatching number of values.", FUNC_ID);
@@ -41,6 +41,8 @@
 
 #include <NANDRAD_Utilities.h>
 #include <NANDRAD_Project.h>
+#include <NANDRAD_BinaryContainer.h>
+#include <NANDRAD_XMLStreamReader.h>
 
 #include <tinyxml.h>
 
@@ -54,6 +56,19 @@
 
 namespace VICUS {
 
+/*! Elements with lists of numbers (vertexes, time series, ID lists), read directly into values. */
+static const std::set<std::string> NUMBER_LIST_ELEMENTS = {
+	"Polygon2D", "Polygon3D", "PolyLine",
+	"IBK:UnitVector", "X", "Y", "TimePoints", "Values", "DayTypes",
+	"RoomIds", "IdsTemplate", "IdsSoundProtectionTemplate", "ScheduleIds", "SourceObjectIds", "AvailablePipes"
+};
+
+/*! Collections of objects in the 'Project' element, read in batches. */
+static const std::set<std::string> COLLECTION_ELEMENTS = {
+	"GeometricNetworks", "Buildings", "StructuralUnits", "ComponentInstances", "SubSurfaceComponentInstances"
+};
+
+
 Project::Project() {
 
 	m_location.initDefaults();
@@ -225,6 +240,19 @@ Project::Project() {
 void Project::parseHeader(const IBK::Path & filename) {
 	FUNCID(Project::parseHeader);
 
+	// binary project containers cannot be scanned line-by-line, so we load the document and read the project info
+	if (NANDRAD::isBinaryContainer(filename)) {
+		TiXmlDocument doc;
+		NANDRAD::readBinaryContainer(filename, doc);
+		TiXmlElement * root = doc.FirstChildElement("VicusProject");
+		if (root != nullptr) {
+			TiXmlElement * info = root->FirstChildElement("ProjectInfo");
+			if (info != nullptr)
+				m_projectInfo.readXML(info);
+		}
+		return;
+	}
+
 	std::ifstream inputStream;
 	if (!IBK::open_ifstream(inputStream, filename, std::ios_base::binary)) {
 		throw IBK::Exception( IBK::FormatString("Cannot open input file '%1' for reading").arg(filename.c_str()), FUNC_ID);
@@ -258,57 +286,61 @@ void Project::parseHeader(const IBK::Path & filename) {
 
 
 void Project::readXML(const IBK::Path & filename) {
-	TiXmlDocument doc;
-	IBK::Path filenamePath(filename);
-	std::map<std::string,IBK::Path> pathPlaceHolders; // only dummy for now, filenamePath does not contain placeholders
-	TiXmlElement * xmlElem = NANDRAD::openXMLFile(pathPlaceHolders, filenamePath, "VicusProject", doc); // NOTE: Throws exception in case of error
-	if (!xmlElem)
+	FUNCID(Project::readXML);
+
+	NANDRAD::XMLStreamReader reader;
+	reader.setNumberListElements(NUMBER_LIST_ELEMENTS);
+	if (!reader.open(filename, "VicusProject")) // NOTE: Throws exception in case of error
 		return; // empty project, this means we are using only defaults
 
-	readXMLDocument(xmlElem);
+	// clear existing grid planes
+	m_viewSettings.m_gridPlanes.clear();
+
+	try {
+		bool haveProjectInfo = false;
+		bool havePlaceholders = false;
+		bool haveProject = false;
+		while (reader.readNextStartElement()) {
+			if (reader.name() == "ProjectInfo" && !haveProjectInfo) {
+				m_projectInfo.readXML(reader.readElement());
+				haveProjectInfo = true;
+			}
+			else if (reader.name() == "DirectoryPlaceholders" && !havePlaceholders) {
+				readDirectoryPlaceholdersXML(reader.readElement());
+				havePlaceholders = true;
+			}
+			else if (reader.name() == "Project" && !haveProject) {
+				// sections are read one by one, large collections in batches of objects
+				reader.readSections(COLLECTION_ELEMENTS, [this](const TiXmlElement * e) { readXML(e); });
+				haveProject = true;
+			}
+			else
+				reader.skipElement();
+		}
+
+		updateAfterReading();
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception(ex, IBK::FormatString("Error reading project '%1'.").arg(filename), FUNC_ID);
+	}
 }
 
 
 void Project::readDrawingXML(const IBK::Path & filename) {
 	FUNCID(Project::readDrawingXML);
-	TiXmlDocument doc;
-	IBK::Path fname(filename);
-
-	if ( !fname.isFile() )
-		throw IBK::Exception(IBK::FormatString("File '%1' does not exist or cannot be opened for reading.")
-								 .arg(fname), FUNC_ID);
-
-	if (!doc.LoadFile(fname.str().c_str(), TIXML_ENCODING_UTF8)) {
-		throw IBK::Exception(IBK::FormatString("Error in line %1 of drawing file '%2':\n%3")
-								 .arg(doc.ErrorRow())
-								 .arg(filename)
-								 .arg(doc.ErrorDesc()), FUNC_ID);
-	}
 
-	// we use a handle so that NULL pointer checks are done during the query functions
-	TiXmlHandle xmlHandleDoc(&doc);
-	// read root element
-	TiXmlElement * xmlElem = xmlHandleDoc.FirstChildElement().Element();
-	if (!xmlElem)
+	NANDRAD::XMLStreamReader reader;
+	reader.setNumberListElements(NUMBER_LIST_ELEMENTS);
+	if (!reader.open(filename, "VicusDrawings"))
 		return; // empty file?
-	std::string rootnode = xmlElem->Value();
-	if (rootnode != "VicusDrawings")
-		throw IBK::Exception( IBK::FormatString("Expected 'VicusDrawings' as root node in XML file."), FUNC_ID);
 
-	TiXmlHandle xmlRoot = TiXmlHandle(xmlElem);
 	try {
-		TiXmlElement * child = xmlRoot.FirstChild("Drawings").Element();
-		Q_ASSERT(child);
-		const TiXmlElement * c2 = child->FirstChildElement();
-		while (c2) {
-			const std::string & c2Name = c2->ValueStr();
-			if (c2Name != "Drawing")
-				IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-			Drawing obj;
-			obj.readXML(c2);
-			m_drawings.push_back(obj);
-			c2 = c2->NextSiblingElement();
-		}
+		// drawings are independent of each other and may be large, they are read in batches and in parallel
+		reader.readSections(std::set<std::string>{"Drawings"}, [this](const TiXmlElement * e) {
+			const TiXmlElement * child = e->FirstChildElement("Drawings");
+			if (child != nullptr)
+				NANDRAD::readVectorOfObjects(child, "Drawing", m_drawings, 2);
+		});
 	}
 	catch (IBK::Exception & ex) {
 		throw IBK::Exception(ex, IBK::FormatString("Error reading drawing file."), FUNC_ID);
@@ -400,78 +432,104 @@ void Project::readXMLDocument(TiXmlElement * rootElement) {
 			readXML(xmlElem);
 		}
 
-		// if we do not have a default grid, create it
-		if (m_viewSettings.m_gridPlanes.empty()) {
-			m_viewSettings.m_gridPlanes.push_back( VICUS::GridPlane(IBKMK::Vector3D(0,0,0), IBKMK::Vector3D(0,0,1),
-																	IBKMK::Vector3D(1,0,0), QColor("white"), 200, 10 ) );
-		}
+		updateAfterReading();
+	}
+	catch (IBK::Exception & ex) {
+		throw IBK::Exception(ex, IBK::FormatString("Error reading project from text."), FUNC_ID);
+	}
 
-		// update internal pointer-based links and alongside check for data consistency
-		updatePointers();
+}
 
-		// update the colors
-		// if project has invalid colors nothing is drawn ...
-		for (VICUS::Building &b : m_buildings) {
-			for (VICUS::BuildingLevel & bl : b.m_buildingLevels) {
-				for (VICUS::Room &r : bl.m_rooms) {
-					for (VICUS::Surface &s : r.m_surfaces) {
-						if (!s.m_displayColor.isValid())
-							s.initializeColorBasedOnInclination();
-						s.m_color = s.m_displayColor;
-						for (const VICUS::SubSurface &sub : s.subSurfaces()) {
-							const_cast<VICUS::SubSurface &>(sub).updateColor();
-						}
+
+void Project::updateAfterReading() {
+	// if we do not have a default grid, create it
+	if (m_viewSettings.m_gridPlanes.empty()) {
+		m_viewSettings.m_gridPlanes.push_back( VICUS::GridPlane(IBKMK::Vector3D(0,0,0), IBKMK::Vector3D(0,0,1),
+																IBKMK::Vector3D(1,0,0), QColor("white"), 200, 10 ) );
+	}
+
+	// update internal pointer-based links and alongside check for data consistency
+	updatePointers();
+
+	// update the colors
+	// if project has invalid colors nothing is drawn ...
+	for (VICUS::Building &b : m_buildings) {
+		for (VICUS::BuildingLevel & bl : b.m_buildingLevels) {
+			for (VICUS::Room &r : bl.m_rooms) {
+				for (VICUS::Surface &s : r.m_surfaces) {
+					if (!s.m_displayColor.isValid())
+						s.initializeColorBasedOnInclination();
+					s.m_color = s.m_displayColor;
+					for (const VICUS::SubSurface &sub : s.subSurfaces()) {
+						const_cast<VICUS::SubSurface &>(sub).updateColor();
 					}
 				}
 			}
 		}
+	}
 
-		// plain geometry surfaces will be silver
-		for (VICUS::Surface &s : m_plainGeometry.m_surfaces) {
-			if (s.m_color == QColor::Invalid) {
-				s.m_color = QColor("#C0C0C0");
-			}
-		}
-
-		// set default colors for network objects
-		for (VICUS::Network & net : m_geometricNetworks) {
-			// updateColor is a const-function, this is possible since
-			// the m_color property of edges and nodes is mutable
-			net.setDefaultColors();
+	// plain geometry surfaces will be silver
+	for (VICUS::Surface &s : m_plainGeometry.m_surfaces) {
+		if (s.m_color == QColor::Invalid) {
+			s.m_color = QColor("#C0C0C0");
 		}
-
-		// in case there is no active id set, but networks exist, choose the first network as active
-		if (m_activeNetworkId == INVALID_ID && !m_geometricNetworks.empty())
-			m_activeNetworkId = m_geometricNetworks[0].m_id;
 	}
-	catch (IBK::Exception & ex) {
-		throw IBK::Exception(ex, IBK::FormatString("Error reading project from text."), FUNC_ID);
+
+	// set default colors for network objects
+	for (VICUS::Network & net : m_geometricNetworks) {
+		// updateColor is a const-function, this is possible since
+		// the m_color property of edges and nodes is mutable
+		net.setDefaultColors();
 	}
 
+	// in case there is no active id set, but networks exist, choose the first network as active
+	if (m_activeNetworkId == INVALID_ID && !m_geometricNetworks.empty())
+		m_activeNetworkId = m_geometricNetworks[0].m_id;
 }
 
 
 void Project::writeXML(const IBK::Path & filename) const {
 	TiXmlDocument doc;
-	TiXmlDeclaration * decl = new TiXmlDeclaration( "1.0", "UTF-8", "" );
-	doc.LinkEndChild( decl );
+	writeXMLDocument(doc);
+	doc.SaveFile( filename.c_str() );
+}
 
-	TiXmlElement * root = new TiXmlElement( "VicusProject" );
-	doc.LinkEndChild(root);
 
-	root->SetAttribute("fileVersion", VERSION);
+void Project::writeBinary(const IBK::Path & filename, bool compress) const {
+	TiXmlDocument doc;
+	writeXMLDocument(doc);
+	NANDRAD::writeBinaryContainer(doc, filename, compress);
+}
 
-	if (m_projectInfo != NANDRAD::ProjectInfo())
-		m_projectInfo.writeXML(root);
-	writeDirectoryPlaceholdersXML(root);
 
-	writeXML(root);
+QString Project::writeXMLText() const {
+	TiXmlDocument doc;
+	writeXMLDocument(doc);
 
-	doc.SaveFile( filename.c_str() );
+	TiXmlPrinter printer;
+	printer.SetIndent( "    " );
+
+	doc.Accept( &printer );
+	std::string xmltext = printer.CStr();
+	return QString::fromStdString(xmltext);
 }
 
-QString Project::writeXMLText() const {
-	TiXmlDocument doc;
+
+void Project::writeDrawingXML(const IBK::Path & filename) const {
+	TiXmlDocument docDraw;
+	writeDrawingXMLDocument(docDraw);
+	docDraw.SaveFile( filename.c_str() );
+}
+
+
+void Project::writeDrawingBinary(const IBK::Path & filename, bool compress) const {
+	TiXmlDocument docDraw;
+	writeDrawingXMLDocument(docDraw);
+	NANDRAD::writeBinaryContainer(docDraw, filename, compress);
+}
+
+
+void Project::writeXMLDocument(TiXmlDocument & doc) const {
 	TiXmlDeclaration * decl = new TiXmlDeclaration( "1.0", "UTF-8", "" );
 	doc.LinkEndChild( decl );
 
@@ -485,19 +543,10 @@ QString Project::writeXMLText() const {
 	writeDirectoryPlaceholdersXML(root);
 
 	writeXML(root);
-
-	TiXmlPrinter printer;
-	printer.SetIndent( "    " );
-
-	doc.Accept( &printer );
-	std::string xmltext = printer.CStr();
-	return QString::fromStdString(xmltext);
 }
 
 
-void Project::writeDrawingXML(const IBK::Path & filename) const {
-
-	TiXmlDocument docDraw;
+void Project::writeDrawingXMLDocument(TiXmlDocument & docDraw) const {
 	TiXmlDeclaration * decl = new TiXmlDeclaration( "1.0", "UTF-8", "" );
 	docDraw.LinkEndChild( decl );
 
@@ -510,8 +559,6 @@ void Project::writeDrawingXML(const IBK::Path & filename) const {
 	for (std::vector<Drawing>::const_iterator it = m_drawings.begin(); it != m_drawings.end(); ++it) {
 		it->writeXML(e);
 	}
-
-	docDraw.SaveFile( filename.c_str() );
 }
 
 
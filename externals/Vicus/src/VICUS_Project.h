@@ -63,6 +63,8 @@ namespace IBK {
 	class NotificationHandler;
 }
 
+class TiXmlDocument;
+
 namespace VICUS {
 
 /*! The project data structure for the SIM-VICUS user interface.
@@ -108,12 +110,13 @@ public:
 	*/
 	void parseHeader(const IBK::Path & filename);
 
-	/*! Reads the project data from an XML file.
+	/*! Reads the project data from an XML file (or binary container file).
+		The file is read section by section with NANDRAD::XMLStreamReader, without composing the entire document.
 		\param filename  The full path to the project file.
 	*/
 	void readXML(const IBK::Path & filename);
 
-	/*! Reads the additional drawing data from an XML file.
+	/*! Reads the additional drawing data from an XML file (or binary container file).
 		\param filename  The full path to the drawing file.
 	*/
 	void readDrawingXML(const IBK::Path & filename);
@@ -123,7 +126,7 @@ public:
 	*/
 	void readImportedXML(const QString & projectText, IBK::NotificationHandler *notifyer);
 
-	/*! Actual read function, called from both variants of readXML(). */
+	/*! Actual read function for an XML document, used by readImportedXML(). */
 	void readXMLDocument(TiXmlElement * rootElement);
 
 	/*! Writes the project file to an XML file.
@@ -131,6 +134,13 @@ public:
 	*/
 	void writeXML(const IBK::Path & filename) const;
 
+	/*! Writes the project file as compact binary container (see NANDRAD_BinaryContainer.h).
+		The file can be read with readXML() just like an XML project file.
+		\param filename  The full path to the project file.
+		\param compress  If true, the container sections are compressed.
+	*/
+	void writeBinary(const IBK::Path & filename, bool compress = true) const;
+
 	/*! Writes the project file to an XML file.
 		\param filename  The full path to the project file.
 	*/
@@ -138,6 +148,9 @@ public:
 
 	void writeDrawingXML(const IBK::Path & filename) const;
 
+	/*! Writes the drawings as compact binary container, can be read with readDrawingXML(). */
+	void writeDrawingBinary(const IBK::Path & filename, bool compress = true) const;
+
 	/*! Reads the placeholder section into m_placeholders map. */
 	void readDirectoryPlaceholdersXML(const TiXmlElement * element);
 
@@ -332,9 +345,9 @@ public:
 
 	unsigned int										m_activeNetworkId = INVALID_ID;	// XML:E
 
-	std::vector<Network>								m_geometricNetworks;		// XML:E
+	std::vector<Network>								m_geometricNetworks;		// XML:E:parallel
 
-	std::vector<Building>								m_buildings;	 			// XML:E
+	std::vector<Building>								m_buildings;	 			// XML:E:parallel
 
 	/*! Store structural units */
 	std::vector<StructuralUnit>							m_structuralUnits;			// XML:E
@@ -400,6 +413,15 @@ public:
 
 
 private:
+	/*! Updates pointers, default grid and colors after project data has been read (used by readXML() and readXMLDocument()). */
+	void updateAfterReading();
+
+	/*! Composes the XML document with the entire project data (used by writeXML(), writeBinary() and writeXMLText()). */
+	void writeXMLDocument(TiXmlDocument & doc) const;
+
+	/*! Composes the XML document with all drawings (used by writeDrawingXML() and writeDrawingBinary()). */
+	void writeDrawingXMLDocument(TiXmlDocument & doc) const;
+
 	// Functions below are implemented in VICUS_ProjectGenerator.cpp
 
 	void generateBuildingProjectData(const QString &modelName,
@@ -67,9 +67,8 @@ void AcousticBoundaryCondition::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "AcousticSoundAbsorptionPartition")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					AcousticSoundAbsorptionPartition obj;
-					obj.readXML(c2);
-					m_acousticSoundAbsorptionPartitions.push_back(obj);
+					m_acousticSoundAbsorptionPartitions.emplace_back();
+					m_acousticSoundAbsorptionPartitions.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
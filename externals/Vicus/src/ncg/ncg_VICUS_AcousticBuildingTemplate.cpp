@@ -52,7 +52,7 @@ void AcousticBuildingTemplate::readXML(const TiXmlElement * element) {
 				m_displayName.setEncodedString(attrib->ValueStr());
 			else if (attribName == "buildingType")
 				try {
-					m_buildingType = (AcousticBuildingType)KeywordList::Enumeration("AcousticBuildingTemplate::AcousticBuildingType", attrib->ValueStr());
+					m_buildingType = (AcousticBuildingType)KeywordList::Enumeration<KeywordList::CategoryHash("AcousticBuildingTemplate::AcousticBuildingType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
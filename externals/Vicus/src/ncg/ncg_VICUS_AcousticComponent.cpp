@@ -54,7 +54,7 @@ void AcousticComponent::readXML(const TiXmlElement * element) {
 				m_color.setNamedColor(QString::fromStdString(attrib->ValueStr()));
 			else if (attribName == "sizeMethod")
 				try {
-					m_sizeMethod = (SizeMethod)KeywordList::Enumeration("AcousticComponent::SizeMethod", attrib->ValueStr());
+					m_sizeMethod = (SizeMethod)KeywordList::Enumeration<KeywordList::CategoryHash("AcousticComponent::SizeMethod")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -80,7 +80,7 @@ void AcousticComponent::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("AcousticComponent::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("AcousticComponent::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
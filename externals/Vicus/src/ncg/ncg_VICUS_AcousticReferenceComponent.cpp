@@ -56,7 +56,7 @@ void AcousticReferenceComponent::readXML(const TiXmlElement * element) {
 				m_buildingType = (IDType)NANDRAD::readPODAttributeValue<unsigned int>(element, attrib);
 			else if (attribName == "requirementType")
 				try {
-					m_requirementType = (RequirementType)KeywordList::Enumeration("AcousticReferenceComponent::RequirementType", attrib->ValueStr());
+					m_requirementType = (RequirementType)KeywordList::Enumeration<KeywordList::CategoryHash("AcousticReferenceComponent::RequirementType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -86,7 +86,7 @@ void AcousticReferenceComponent::readXML(const TiXmlElement * element) {
 				m_idAcousticTemplateB = NANDRAD::readPODElement<unsigned int>(c, cName);
 			else if (cName == "Type") {
 				try {
-					m_type = (ComponentType)KeywordList::Enumeration("AcousticReferenceComponent::ComponentType", c->GetText());
+					m_type = (ComponentType)KeywordList::Enumeration<KeywordList::CategoryHash("AcousticReferenceComponent::ComponentType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -54,7 +54,7 @@ void AcousticSoundProtectionTemplate::readXML(const TiXmlElement * element) {
 				m_color.setNamedColor(QString::fromStdString(attrib->ValueStr()));
 			else if (attribName == "buildingType")
 				try {
-					m_buildingType = (AcousticBuildingType)KeywordList::Enumeration("AcousticSoundProtectionTemplate::AcousticBuildingType", attrib->ValueStr());
+					m_buildingType = (AcousticBuildingType)KeywordList::Enumeration<KeywordList::CategoryHash("AcousticSoundProtectionTemplate::AcousticBuildingType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
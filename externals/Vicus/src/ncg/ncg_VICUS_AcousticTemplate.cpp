@@ -75,7 +75,7 @@ void AcousticTemplate::readXML(const TiXmlElement * element) {
 				bool success = false;
 				try {
 					splinePara_t ptype;
-					ptype = (splinePara_t)KeywordList::Enumeration("AcousticTemplate::splinePara_t", p.m_name);
+					ptype = (splinePara_t)KeywordList::Enumeration<KeywordList::CategoryHash("AcousticTemplate::splinePara_t")>(p.m_name);
 					m_splinePara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
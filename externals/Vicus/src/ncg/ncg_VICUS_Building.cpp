@@ -69,9 +69,8 @@ void Building::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "BuildingLevel")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					BuildingLevel obj;
-					obj.readXML(c2);
-					m_buildingLevels.push_back(obj);
+					m_buildingLevels.emplace_back();
+					m_buildingLevels.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
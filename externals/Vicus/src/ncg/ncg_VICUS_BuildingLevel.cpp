@@ -73,9 +73,8 @@ void BuildingLevel::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Room")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Room obj;
-					obj.readXML(c2);
-					m_rooms.push_back(obj);
+					m_rooms.emplace_back();
+					m_rooms.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -88,7 +88,7 @@ void Component::readXML(const TiXmlElement * element) {
 				m_activeLayerIndex = NANDRAD::readPODElement<unsigned int>(c, cName);
 			else if (cName == "Type") {
 				try {
-					m_type = (ComponentType)KeywordList::Enumeration("Component::ComponentType", c->GetText());
+					m_type = (ComponentType)KeywordList::Enumeration<KeywordList::CategoryHash("Component::ComponentType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
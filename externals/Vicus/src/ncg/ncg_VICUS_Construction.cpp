@@ -70,7 +70,7 @@ void Construction::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("Construction::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("Construction::para_t")>(p.name);
 					m_acousticPara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -83,15 +83,14 @@ void Construction::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "MaterialLayer")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					MaterialLayer obj;
-					obj.readXML(c2);
-					m_materialLayers.push_back(obj);
+					m_materialLayers.emplace_back();
+					m_materialLayers.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
 			else if (cName == "UsageType") {
 				try {
-					m_usageType = (UsageType)KeywordList::Enumeration("Construction::UsageType", c->GetText());
+					m_usageType = (UsageType)KeywordList::Enumeration<KeywordList::CategoryHash("Construction::UsageType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -100,7 +99,7 @@ void Construction::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "InsulationKind") {
 				try {
-					m_insulationKind = (InsulationKind)KeywordList::Enumeration("Construction::InsulationKind", c->GetText());
+					m_insulationKind = (InsulationKind)KeywordList::Enumeration<KeywordList::CategoryHash("Construction::InsulationKind")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -109,7 +108,7 @@ void Construction::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "MaterialKind") {
 				try {
-					m_materialKind = (MaterialKind)KeywordList::Enumeration("Construction::MaterialKind", c->GetText());
+					m_materialKind = (MaterialKind)KeywordList::Enumeration<KeywordList::CategoryHash("Construction::MaterialKind")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -46,9 +46,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Material")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::Material obj;
-					obj.readXML(c2);
-					m_materials.push_back(obj);
+					m_materials.emplace_back();
+					m_materials.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -58,9 +57,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Construction")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::Construction obj;
-					obj.readXML(c2);
-					m_constructions.push_back(obj);
+					m_constructions.emplace_back();
+					m_constructions.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -70,9 +68,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Window")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::Window obj;
-					obj.readXML(c2);
-					m_windows.push_back(obj);
+					m_windows.emplace_back();
+					m_windows.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -82,9 +79,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "WindowGlazingSystem")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::WindowGlazingSystem obj;
-					obj.readXML(c2);
-					m_windowGlazingSystems.push_back(obj);
+					m_windowGlazingSystems.emplace_back();
+					m_windowGlazingSystems.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -94,9 +90,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "AcousticBoundaryCondition")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::AcousticBoundaryCondition obj;
-					obj.readXML(c2);
-					m_acousticBoundaryConditions.push_back(obj);
+					m_acousticBoundaryConditions.emplace_back();
+					m_acousticBoundaryConditions.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -106,9 +101,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "AcousticSoundAbsorption")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::AcousticSoundAbsorption obj;
-					obj.readXML(c2);
-					m_acousticSoundAbsorptions.push_back(obj);
+					m_acousticSoundAbsorptions.emplace_back();
+					m_acousticSoundAbsorptions.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -118,9 +112,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "BoundaryCondition")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::BoundaryCondition obj;
-					obj.readXML(c2);
-					m_boundaryConditions.push_back(obj);
+					m_boundaryConditions.emplace_back();
+					m_boundaryConditions.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -130,9 +123,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Component")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::Component obj;
-					obj.readXML(c2);
-					m_components.push_back(obj);
+					m_components.emplace_back();
+					m_components.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -142,9 +134,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "SubSurfaceComponent")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::SubSurfaceComponent obj;
-					obj.readXML(c2);
-					m_subSurfaceComponents.push_back(obj);
+					m_subSurfaceComponents.emplace_back();
+					m_subSurfaceComponents.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -154,9 +145,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "SurfaceHeating")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::SurfaceHeating obj;
-					obj.readXML(c2);
-					m_surfaceHeatings.push_back(obj);
+					m_surfaceHeatings.emplace_back();
+					m_surfaceHeatings.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -166,9 +156,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "SupplySystem")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::SupplySystem obj;
-					obj.readXML(c2);
-					m_supplySystems.push_back(obj);
+					m_supplySystems.emplace_back();
+					m_supplySystems.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -178,9 +167,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "NetworkPipe")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::NetworkPipe obj;
-					obj.readXML(c2);
-					m_pipes.push_back(obj);
+					m_pipes.emplace_back();
+					m_pipes.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -190,9 +178,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "NetworkFluid")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::NetworkFluid obj;
-					obj.readXML(c2);
-					m_fluids.push_back(obj);
+					m_fluids.emplace_back();
+					m_fluids.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -202,9 +189,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "NetworkComponent")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::NetworkComponent obj;
-					obj.readXML(c2);
-					m_networkComponents.push_back(obj);
+					m_networkComponents.emplace_back();
+					m_networkComponents.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -214,9 +200,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "NetworkController")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::NetworkController obj;
-					obj.readXML(c2);
-					m_networkControllers.push_back(obj);
+					m_networkControllers.emplace_back();
+					m_networkControllers.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -226,9 +211,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "SubNetwork")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::SubNetwork obj;
-					obj.readXML(c2);
-					m_subNetworks.push_back(obj);
+					m_subNetworks.emplace_back();
+					m_subNetworks.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -238,9 +222,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "EpdDataset")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::EpdDataset obj;
-					obj.readXML(c2);
-					m_EPDDatasets.push_back(obj);
+					m_EPDDatasets.emplace_back();
+					m_EPDDatasets.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -250,9 +233,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Schedule")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::Schedule obj;
-					obj.readXML(c2);
-					m_schedules.push_back(obj);
+					m_schedules.emplace_back();
+					m_schedules.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -262,9 +244,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "InternalLoad")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::InternalLoad obj;
-					obj.readXML(c2);
-					m_internalLoads.push_back(obj);
+					m_internalLoads.emplace_back();
+					m_internalLoads.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -274,9 +255,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "ZoneControlThermostat")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::ZoneControlThermostat obj;
-					obj.readXML(c2);
-					m_zoneControlThermostats.push_back(obj);
+					m_zoneControlThermostats.emplace_back();
+					m_zoneControlThermostats.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -286,9 +266,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "ZoneControlShading")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::ZoneControlShading obj;
-					obj.readXML(c2);
-					m_zoneControlShading.push_back(obj);
+					m_zoneControlShading.emplace_back();
+					m_zoneControlShading.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -298,9 +277,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "ZoneIdealHeatingCooling")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::ZoneIdealHeatingCooling obj;
-					obj.readXML(c2);
-					m_zoneIdealHeatingCooling.push_back(obj);
+					m_zoneIdealHeatingCooling.emplace_back();
+					m_zoneIdealHeatingCooling.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -310,9 +288,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "ZoneControlNaturalVentilation")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::ZoneControlNaturalVentilation obj;
-					obj.readXML(c2);
-					m_zoneControlVentilationNatural.push_back(obj);
+					m_zoneControlVentilationNatural.emplace_back();
+					m_zoneControlVentilationNatural.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -322,9 +299,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "VentilationNatural")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::VentilationNatural obj;
-					obj.readXML(c2);
-					m_ventilationNatural.push_back(obj);
+					m_ventilationNatural.emplace_back();
+					m_ventilationNatural.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -334,9 +310,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Infiltration")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::Infiltration obj;
-					obj.readXML(c2);
-					m_infiltration.push_back(obj);
+					m_infiltration.emplace_back();
+					m_infiltration.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -346,9 +321,8 @@ void EmbeddedDatabase::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "ZoneTemplate")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::ZoneTemplate obj;
-					obj.readXML(c2);
-					m_zoneTemplates.push_back(obj);
+					m_zoneTemplates.emplace_back();
+					m_zoneTemplates.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
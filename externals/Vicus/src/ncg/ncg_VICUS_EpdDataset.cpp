@@ -94,15 +94,14 @@ void EpdDataset::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "EpdModuleDataset")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					EpdModuleDataset obj;
-					obj.readXML(c2);
-					m_epdModuleDataset.push_back(obj);
+					m_epdModuleDataset.emplace_back();
+					m_epdModuleDataset.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
 			else if (cName == "Type") {
 				try {
-					m_type = (Type)KeywordList::Enumeration("EpdDataset::Type", c->GetText());
+					m_type = (Type)KeywordList::Enumeration<KeywordList::CategoryHash("EpdDataset::Type")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -68,7 +68,7 @@ void Infiltration::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("Infiltration::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("Infiltration::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -77,7 +77,7 @@ void Infiltration::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "AirChangeType") {
 				try {
-					m_airChangeType = (AirChangeType)KeywordList::Enumeration("Infiltration::AirChangeType", c->GetText());
+					m_airChangeType = (AirChangeType)KeywordList::Enumeration<KeywordList::CategoryHash("Infiltration::AirChangeType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -48,7 +48,7 @@ void InterfaceHeatConduction::readXML(const TiXmlElement * element) {
 			const std::string & attribName = attrib->NameStr();
 			if (attribName == "modelType")
 				try {
-					m_modelType = (modelType_t)KeywordList::Enumeration("InterfaceHeatConduction::modelType_t", attrib->ValueStr());
+					m_modelType = (modelType_t)KeywordList::Enumeration<KeywordList::CategoryHash("InterfaceHeatConduction::modelType_t")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -72,7 +72,7 @@ void InterfaceHeatConduction::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("InterfaceHeatConduction::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("InterfaceHeatConduction::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -81,7 +81,7 @@ void InterfaceHeatConduction::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "OtherZoneType") {
 				try {
-					m_otherZoneType = (OtherZoneType)KeywordList::Enumeration("InterfaceHeatConduction::OtherZoneType", c->GetText());
+					m_otherZoneType = (OtherZoneType)KeywordList::Enumeration<KeywordList::CategoryHash("InterfaceHeatConduction::OtherZoneType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -82,7 +82,7 @@ void InternalLoad::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("InternalLoad::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("InternalLoad::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -91,7 +91,7 @@ void InternalLoad::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "Category") {
 				try {
-					m_category = (Category)KeywordList::Enumeration("InternalLoad::Category", c->GetText());
+					m_category = (Category)KeywordList::Enumeration<KeywordList::CategoryHash("InternalLoad::Category")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -100,7 +100,7 @@ void InternalLoad::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "PersonCountMethod") {
 				try {
-					m_personCountMethod = (PersonCountMethod)KeywordList::Enumeration("InternalLoad::PersonCountMethod", c->GetText());
+					m_personCountMethod = (PersonCountMethod)KeywordList::Enumeration<KeywordList::CategoryHash("InternalLoad::PersonCountMethod")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -109,7 +109,7 @@ void InternalLoad::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "PowerMethod") {
 				try {
-					m_powerMethod = (PowerMethod)KeywordList::Enumeration("InternalLoad::PowerMethod", c->GetText());
+					m_powerMethod = (PowerMethod)KeywordList::Enumeration<KeywordList::CategoryHash("InternalLoad::PowerMethod")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -48,7 +48,7 @@ void LcaSettings::readXMLPrivate(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("LcaSettings::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("LcaSettings::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -60,7 +60,7 @@ void LcaSettings::readXMLPrivate(const TiXmlElement * element) {
 				NANDRAD::readFlagElement(c, f);
 				bool success = false;
 				try {
-					Module ftype = (Module)KeywordList::Enumeration("LcaSettings::Module", f.name());
+					Module ftype = (Module)KeywordList::Enumeration<KeywordList::CategoryHash("LcaSettings::Module")>(f.name());
 					m_flags[ftype] = f; success=true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -69,7 +69,7 @@ void LcaSettings::readXMLPrivate(const TiXmlElement * element) {
 			}
 			else if (cName == "CalculationMode") {
 				try {
-					m_calculationMode = (CalculationMode)KeywordList::Enumeration("LcaSettings::CalculationMode", c->GetText());
+					m_calculationMode = (CalculationMode)KeywordList::Enumeration<KeywordList::CategoryHash("LcaSettings::CalculationMode")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -78,7 +78,7 @@ void LcaSettings::readXMLPrivate(const TiXmlElement * element) {
 			}
 			else if (cName == "CertificationSystem") {
 				try {
-					m_certificationSystem = (CertificationSytem)KeywordList::Enumeration("LcaSettings::CertificationSytem", c->GetText());
+					m_certificationSystem = (CertificationSytem)KeywordList::Enumeration<KeywordList::CategoryHash("LcaSettings::CertificationSytem")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
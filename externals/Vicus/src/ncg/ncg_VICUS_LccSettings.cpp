@@ -47,7 +47,7 @@ void LccSettings::readXMLPrivate(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("LccSettings::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("LccSettings::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -59,7 +59,7 @@ void LccSettings::readXMLPrivate(const TiXmlElement * element) {
 				NANDRAD::readIntParaElement(c, p);
 				bool success = false;
 				try {
-					intPara_t ptype = (intPara_t)KeywordList::Enumeration("LccSettings::intPara_t", p.name);
+					intPara_t ptype = (intPara_t)KeywordList::Enumeration<KeywordList::CategoryHash("LccSettings::intPara_t")>(p.name);
 					m_intPara[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -78,7 +78,7 @@ void Material::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("Material::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("Material::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -87,7 +87,7 @@ void Material::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "Category") {
 				try {
-					m_category = (Category)KeywordList::Enumeration("Material::Category", c->GetText());
+					m_category = (Category)KeywordList::Enumeration<KeywordList::CategoryHash("Material::Category")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
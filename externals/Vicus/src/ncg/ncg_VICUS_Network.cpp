@@ -57,7 +57,7 @@ void Network::readXML(const TiXmlElement * element) {
 				m_idFluid = NANDRAD::readPODAttributeValue<unsigned int>(element, attrib);
 			else if (attribName == "modelType")
 				try {
-					m_modelType = (ModelType)KeywordList::Enumeration("Network::ModelType", attrib->ValueStr());
+					m_modelType = (ModelType)KeywordList::Enumeration<KeywordList::CategoryHash("Network::ModelType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -79,9 +79,8 @@ void Network::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "NetworkNode")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					NetworkNode obj;
-					obj.readXML(c2);
-					m_nodes.push_back(obj);
+					m_nodes.emplace_back();
+					m_nodes.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -91,9 +90,8 @@ void Network::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "NetworkEdge")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					NetworkEdge obj;
-					obj.readXML(c2);
-					m_edges.push_back(obj);
+					m_edges.emplace_back();
+					m_edges.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -113,7 +111,7 @@ void Network::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("Network::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("Network::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -139,7 +137,7 @@ void Network::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "Type") {
 				try {
-					m_type = (NetworkType)KeywordList::Enumeration("Network::NetworkType", c->GetText());
+					m_type = (NetworkType)KeywordList::Enumeration<KeywordList::CategoryHash("Network::NetworkType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -150,7 +148,7 @@ void Network::readXML(const TiXmlElement * element) {
 				m_buriedPipeProperties.readXML(c);
 			else if (cName == "PipeModel") {
 				try {
-					m_pipeModel = (PipeModel)KeywordList::Enumeration("Network::PipeModel", c->GetText());
+					m_pipeModel = (PipeModel)KeywordList::Enumeration<KeywordList::CategoryHash("Network::PipeModel")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
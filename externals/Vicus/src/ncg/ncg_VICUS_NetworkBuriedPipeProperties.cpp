@@ -48,7 +48,7 @@ void NetworkBuriedPipeProperties::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("NetworkBuriedPipeProperties::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("NetworkBuriedPipeProperties::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -59,7 +59,7 @@ void NetworkBuriedPipeProperties::readXML(const TiXmlElement * element) {
 				m_numberOfSoilModels = NANDRAD::readPODElement<unsigned int>(c, cName);
 			else if (cName == "SoilType") {
 				try {
-					m_soilType = (SoilType)KeywordList::Enumeration("NetworkBuriedPipeProperties::SoilType", c->GetText());
+					m_soilType = (SoilType)KeywordList::Enumeration<KeywordList::CategoryHash("NetworkBuriedPipeProperties::SoilType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -62,7 +62,7 @@ void NetworkController::readXML(const TiXmlElement * element) {
 				m_color.setNamedColor(QString::fromStdString(attrib->ValueStr()));
 			else if (attribName == "modelType")
 				try {
-					m_modelType = (ModelType)KeywordList::Enumeration("NetworkController::ModelType", attrib->ValueStr());
+					m_modelType = (ModelType)KeywordList::Enumeration<KeywordList::CategoryHash("NetworkController::ModelType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -70,7 +70,7 @@ void NetworkController::readXML(const TiXmlElement * element) {
 				}
 			else if (attribName == "controllerType")
 				try {
-					m_controllerType = (ControllerType)KeywordList::Enumeration("NetworkController::ControllerType", attrib->ValueStr());
+					m_controllerType = (ControllerType)KeywordList::Enumeration<KeywordList::CategoryHash("NetworkController::ControllerType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -78,7 +78,7 @@ void NetworkController::readXML(const TiXmlElement * element) {
 				}
 			else if (attribName == "controlledProperty")
 				try {
-					m_controlledProperty = (ControlledProperty)KeywordList::Enumeration("NetworkController::ControlledProperty", attrib->ValueStr());
+					m_controlledProperty = (ControlledProperty)KeywordList::Enumeration<KeywordList::CategoryHash("NetworkController::ControlledProperty")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -102,7 +102,7 @@ void NetworkController::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("NetworkController::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("NetworkController::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -59,7 +59,7 @@ void NetworkNode::readXML(const TiXmlElement * element) {
 				m_visible = NANDRAD::readPODAttributeValue<bool>(element, attrib);
 			else if (attribName == "type")
 				try {
-					m_type = (NodeType)KeywordList::Enumeration("NetworkNode::NodeType", attrib->ValueStr());
+					m_type = (NodeType)KeywordList::Enumeration<KeywordList::CategoryHash("NetworkNode::NodeType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
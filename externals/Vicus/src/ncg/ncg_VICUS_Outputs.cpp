@@ -59,9 +59,8 @@ void Outputs::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "OutputDefinition")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::OutputDefinition obj;
-					obj.readXML(c2);
-					m_definitions.push_back(obj);
+					m_definitions.emplace_back();
+					m_definitions.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -71,9 +70,8 @@ void Outputs::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "OutputGrid")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					NANDRAD::OutputGrid obj;
-					obj.readXML(c2);
-					m_grids.push_back(obj);
+					m_grids.emplace_back();
+					m_grids.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -84,7 +82,7 @@ void Outputs::readXMLPrivate(const TiXmlElement * element) {
 				NANDRAD::readFlagElement(c, f);
 				bool success = false;
 				try {
-					flag_t ftype = (flag_t)KeywordList::Enumeration("Outputs::flag_t", f.name());
+					flag_t ftype = (flag_t)KeywordList::Enumeration<KeywordList::CategoryHash("Outputs::flag_t")>(f.name());
 					m_flags[ftype] = f; success=true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -59,9 +59,8 @@ void PlainGeometry::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Surface")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Surface obj;
-					obj.readXML(c2);
-					m_surfaces.push_back(obj);
+					m_surfaces.emplace_back();
+					m_surfaces.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -43,39 +43,18 @@ void Project::readXML(const TiXmlElement * element) {
 			const std::string & cName = c->ValueStr();
 			if (cName == "ActiveNetworkId")
 				m_activeNetworkId = NANDRAD::readPODElement<unsigned int>(c, cName);
-			else if (cName == "GeometricNetworks") {
-				const TiXmlElement * c2 = c->FirstChildElement();
-				while (c2) {
-					const std::string & c2Name = c2->ValueStr();
-					if (c2Name != "Network")
-						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Network obj;
-					obj.readXML(c2);
-					m_geometricNetworks.push_back(obj);
-					c2 = c2->NextSiblingElement();
-				}
-			}
-			else if (cName == "Buildings") {
-				const TiXmlElement * c2 = c->FirstChildElement();
-				while (c2) {
-					const std::string & c2Name = c2->ValueStr();
-					if (c2Name != "Building")
-						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Building obj;
-					obj.readXML(c2);
-					m_buildings.push_back(obj);
-					c2 = c2->NextSiblingElement();
-				}
-			}
+			else if (cName == "GeometricNetworks")
+				NANDRAD::readVectorOfObjects(c, "Network", m_geometricNetworks);
+			else if (cName == "Buildings")
+				NANDRAD::readVectorOfObjects(c, "Building", m_buildings);
 			else if (cName == "StructuralUnits") {
 				const TiXmlElement * c2 = c->FirstChildElement();
 				while (c2) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "StructuralUnit")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					StructuralUnit obj;
-					obj.readXML(c2);
-					m_structuralUnits.push_back(obj);
+					m_structuralUnits.emplace_back();
+					m_structuralUnits.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -85,9 +64,8 @@ void Project::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "ComponentInstance")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					ComponentInstance obj;
-					obj.readXML(c2);
-					m_componentInstances.push_back(obj);
+					m_componentInstances.emplace_back();
+					m_componentInstances.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -97,9 +75,8 @@ void Project::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "SubSurfaceComponentInstance")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					SubSurfaceComponentInstance obj;
-					obj.readXML(c2);
-					m_subSurfaceComponentInstances.push_back(obj);
+					m_subSurfaceComponentInstances.emplace_back();
+					m_subSurfaceComponentInstances.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -83,9 +83,8 @@ void Schedule::readXML(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "ScheduleInterval")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					ScheduleInterval obj;
-					obj.readXML(c2);
-					m_periods.push_back(obj);
+					m_periods.emplace_back();
+					m_periods.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -80,7 +80,7 @@ void SubSurfaceComponent::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("SubSurfaceComponent::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("SubSurfaceComponent::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -89,7 +89,7 @@ void SubSurfaceComponent::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "Type") {
 				try {
-					m_type = (SubSurfaceComponentType)KeywordList::Enumeration("SubSurfaceComponent::SubSurfaceComponentType", c->GetText());
+					m_type = (SubSurfaceComponentType)KeywordList::Enumeration<KeywordList::CategoryHash("SubSurfaceComponent::SubSurfaceComponentType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -58,7 +58,7 @@ void SupplySystem::readXML(const TiXmlElement * element) {
 				m_color.setNamedColor(QString::fromStdString(attrib->ValueStr()));
 			else if (attribName == "supplyType")
 				try {
-					m_supplyType = (SupplyType)KeywordList::Enumeration("SupplySystem::SupplyType", attrib->ValueStr());
+					m_supplyType = (SupplyType)KeywordList::Enumeration<KeywordList::CategoryHash("SupplySystem::SupplyType")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -80,7 +80,7 @@ void SupplySystem::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("SupplySystem::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("SupplySystem::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -71,9 +71,8 @@ void Surface::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "SubSurface")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					SubSurface obj;
-					obj.readXML(c2);
-					m_subSurfaces.push_back(obj);
+					m_subSurfaces.emplace_back();
+					m_subSurfaces.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -83,9 +82,8 @@ void Surface::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "Surface")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					Surface obj;
-					obj.readXML(c2);
-					m_childSurfaces.push_back(obj);
+					m_childSurfaces.emplace_back();
+					m_childSurfaces.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -58,7 +58,7 @@ void SurfaceHeating::readXML(const TiXmlElement * element) {
 				m_color.setNamedColor(QString::fromStdString(attrib->ValueStr()));
 			else if (attribName == "type")
 				try {
-					m_type = (Type)KeywordList::Enumeration("SurfaceHeating::Type", attrib->ValueStr());
+					m_type = (Type)KeywordList::Enumeration<KeywordList::CategoryHash("SurfaceHeating::Type")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -86,7 +86,7 @@ void SurfaceHeating::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("SurfaceHeating::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("SurfaceHeating::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
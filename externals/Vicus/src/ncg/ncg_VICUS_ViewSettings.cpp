@@ -58,9 +58,8 @@ void ViewSettings::readXMLPrivate(const TiXmlElement * element) {
 					const std::string & c2Name = c2->ValueStr();
 					if (c2Name != "GridPlane")
 						IBK::IBK_Message(IBK::FormatString(XML_READ_UNKNOWN_ELEMENT).arg(c2Name).arg(c2->Row()), IBK::MSG_WARNING, FUNC_ID, IBK::VL_STANDARD);
-					VICUS::GridPlane obj;
-					obj.readXML(c2);
-					m_gridPlanes.push_back(obj);
+					m_gridPlanes.emplace_back();
+					m_gridPlanes.back().readXML(c2);
 					c2 = c2->NextSiblingElement();
 				}
 			}
@@ -56,7 +56,7 @@ void Window::readXML(const TiXmlElement * element) {
 				m_idGlazingSystem = NANDRAD::readPODAttributeValue<unsigned int>(element, attrib);
 			else if (attribName == "methodFrame")
 				try {
-					m_methodFrame = (Method)KeywordList::Enumeration("Window::Method", attrib->ValueStr());
+					m_methodFrame = (Method)KeywordList::Enumeration<KeywordList::CategoryHash("Window::Method")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -64,7 +64,7 @@ void Window::readXML(const TiXmlElement * element) {
 				}
 			else if (attribName == "methodDivider")
 				try {
-					m_methodDivider = (Method)KeywordList::Enumeration("Window::Method", attrib->ValueStr());
+					m_methodDivider = (Method)KeywordList::Enumeration<KeywordList::CategoryHash("Window::Method")>(attrib->ValueStr());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(element->Row()).arg(
@@ -90,7 +90,7 @@ void Window::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("Window::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("Window::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
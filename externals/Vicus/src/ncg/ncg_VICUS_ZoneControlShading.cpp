@@ -76,7 +76,7 @@ void ZoneControlShading::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("ZoneControlShading::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("ZoneControlShading::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -85,7 +85,7 @@ void ZoneControlShading::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "Category") {
 				try {
-					m_category = (Category)KeywordList::Enumeration("ZoneControlShading::Category", c->GetText());
+					m_category = (Category)KeywordList::Enumeration<KeywordList::CategoryHash("ZoneControlShading::Category")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -84,7 +84,7 @@ void ZoneControlThermostat::readXML(const TiXmlElement * element) {
 				bool success = false;
 				para_t ptype;
 				try {
-					ptype = (para_t)KeywordList::Enumeration("ZoneControlThermostat::para_t", p.name);
+					ptype = (para_t)KeywordList::Enumeration<KeywordList::CategoryHash("ZoneControlThermostat::para_t")>(p.name);
 					m_para[ptype] = p; success = true;
 				}
 				catch (...) { /* intentional fail */  }
@@ -93,7 +93,7 @@ void ZoneControlThermostat::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "ControlValue") {
 				try {
-					m_controlValue = (ControlValue)KeywordList::Enumeration("ZoneControlThermostat::ControlValue", c->GetText());
+					m_controlValue = (ControlValue)KeywordList::Enumeration<KeywordList::CategoryHash("ZoneControlThermostat::ControlValue")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -102,7 +102,7 @@ void ZoneControlThermostat::readXML(const TiXmlElement * element) {
 			}
 			else if (cName == "ControllerType") {
 				try {
-					m_controllerType = (ControllerType)KeywordList::Enumeration("ZoneControlThermostat::ControllerType", c->GetText());
+					m_controllerType = (ControllerType)KeywordList::Enumeration<KeywordList::CategoryHash("ZoneControlThermostat::ControllerType")>(c->GetText());
 				}
 				catch (IBK::Exception & ex) {
 					throw IBK::Exception( ex, IBK::FormatString(XML_READ_ERROR).arg(c->Row()).arg(
@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Generates a NANDRAD benchmark project with many zones, each with an outside wall, a roof and an interior
+# wall to the next zone. The project is meant for measuring the model evaluation time of large projects,
+# where most of the time is spent in construction models.
+#
+# Syntax: generate_multizone_benchmark.py [--zones N] [--days D] <climate file> <project file>
+#
+# Example (run from repository root):
+#
+# > python3 scripts/Python/generate_multizone_benchmark.py --zones 1000 data/tests/climate/DEU_Potsdam_60.c6b /tmp/MultiZone1000.nandrad
+# > NandradSolver /tmp/MultiZone1000.nandrad
+#
+# Compare IntegratorTimeFunctionEvals (time spent in model evaluation) in /tmp/MultiZone1000/log/summary.txt
+# between solver versions.
+
+import argparse
+import os
+
+
+HEADER = """<?xml version="1.0" encoding="UTF-8" ?>
+<NandradProject fileVersion="2.0">
+	<Project>
+		<ProjectInfo>
+			<Comment>Generated multi-zone benchmark with {zones} zones</Comment>
+		</ProjectInfo>
+		<Location>
+			<IBK:Parameter name="Latitude" unit="Deg">51</IBK:Parameter>
+			<IBK:Parameter name="Longitude" unit="Deg">13</IBK:Parameter>
+			<IBK:Parameter name="Albedo" unit="---">0.2</IBK:Parameter>
+			<ClimateFilePath>{climate}</ClimateFilePath>
+		</Location>
+		<SimulationParameter>
+			<IBK:Parameter name="InitialTemperature" unit="C">20</IBK:Parameter>
+			<Interval>
+				<IBK:Parameter name="Start" unit="d">0</IBK:Parameter>
+				<IBK:Parameter name="End" unit="d">{days}</IBK:Parameter>
+			</Interval>
+		</SimulationParameter>
+		<SolverParameter>
+			<IBK:Parameter name="DiscStretchFactor" unit="---">4</IBK:Parameter>
+			<IBK:Parameter name="DiscMinDx" unit="mm">2</IBK:Parameter>
+		</SolverParameter>
+"""
+
+INTERFACE = """				<Interface{side} id="{id}" zoneId="{zoneId}">
+					<InterfaceHeatConduction modelType="Constant">
+						<IBK:Parameter name="HeatTransferCoefficient" unit="W/m2K">{htc}</IBK:Parameter>
+					</InterfaceHeatConduction>
+				</Interface{side}>
+"""
+
+CONSTRUCTION = """			<ConstructionInstance id="{id}" displayName="{name}">
+				<ConstructionTypeId>{typeId}</ConstructionTypeId>
+				<IBK:Parameter name="Orientation" unit="Deg">{orientation}</IBK:Parameter>
+				<IBK:Parameter name="Inclination" unit="Deg">{inclination}</IBK:Parameter>
+				<IBK:Parameter name="Area" unit="m2">{area}</IBK:Parameter>
+{interfaces}			</ConstructionInstance>
+"""
+
+FOOTER = """		<ConstructionTypes>
+			<ConstructionType id="1" displayName="Outside wall">
+				<MaterialLayers>
+					<MaterialLayer thickness="0.2" matId="1" />
+					<MaterialLayer thickness="0.1" matId="2" />
+				</MaterialLayers>
+			</ConstructionType>
+			<ConstructionType id="2" displayName="Roof">
+				<MaterialLayers>
+					<MaterialLayer thickness="0.2" matId="3" />
+					<MaterialLayer thickness="0.2" matId="2" />
+				</MaterialLayers>
+			</ConstructionType>
+			<ConstructionType id="3" displayName="Interior wall">
+				<MaterialLayers>
+					<MaterialLayer thickness="0.15" matId="1" />
+				</MaterialLayers>
+			</ConstructionType>
+		</ConstructionTypes>
+		<Materials>
+			<Material id="1" displayName="Brick">
+				<IBK:Parameter name="Density" unit="kg/m3">1600</IBK:Parameter>
+				<IBK:Parameter name="HeatCapacity" unit="J/kgK">1000</IBK:Parameter>
+				<IBK:Parameter name="Conductivity" unit="W/mK">0.6</IBK:Parameter>
+			</Material>
+			<Material id="2" displayName="Insulation">
+				<IBK:Parameter name="Density" unit="kg/m3">30</IBK:Parameter>
+				<IBK:Parameter name="HeatCapacity" unit="J/kgK">1500</IBK:Parameter>
+				<IBK:Parameter name="Conductivity" unit="W/mK">0.04</IBK:Parameter>
+			</Material>
+			<Material id="3" displayName="Concrete">
+				<IBK:Parameter name="Density" unit="kg/m3">2300</IBK:Parameter>
+				<IBK:Parameter name="HeatCapacity" unit="J/kgK">1000</IBK:Parameter>
+				<IBK:Parameter name="Conductivity" unit="W/mK">2.0</IBK:Parameter>
+			</Material>
+		</Materials>
+		<Outputs>
+			<Definitions>
+				<OutputDefinition>
+					<Quantity>AirTemperature</Quantity>
+					<ObjectListName>All zones</ObjectListName>
+					<GridName>Hourly</GridName>
+				</OutputDefinition>
+			</Definitions>
+			<Grids>
+				<OutputGrid name="Hourly">
+					<Intervals>
+						<Interval>
+							<IBK:Parameter name="StepSize" unit="h">1</IBK:Parameter>
+						</Interval>
+					</Intervals>
+				</OutputGrid>
+			</Grids>
+		</Outputs>
+		<ObjectLists>
+			<ObjectList name="All zones">
+				<FilterID>*</FilterID>
+				<ReferenceType>Zone</ReferenceType>
+			</ObjectList>
+		</ObjectLists>
+	</Project>
+</NandradProject>
+"""
+
+
+def interface(side, interfaceId, zoneId, htc):
+	return INTERFACE.format(side=side, id=interfaceId, zoneId=zoneId, htc=htc)
+
+
+def generateProject(zones, days, climate):
+	parts = [HEADER.format(zones=zones, days=days, climate=climate)]
+
+	parts.append("\t\t<Zones>\n")
+	for z in range(1, zones+1):
+		parts.append('\t\t\t<Zone id="{0}" displayName="Zone {0}" type="Active">\n'.format(z))
+		parts.append('\t\t\t\t<IBK:Parameter name="Area" unit="m2">20</IBK:Parameter>\n')
+		parts.append('\t\t\t\t<IBK:Parameter name="Volume" unit="m3">50</IBK:Parameter>\n')
+		parts.append('\t\t\t</Zone>\n')
+	parts.append("\t\t</Zones>\n")
+
+	parts.append("\t\t<ConstructionInstances>\n")
+	# zones and constructions share the same ID space
+	conId = 100001
+	ifaceId = 1
+	orientations = [0, 90, 180, 270]
+	for z in range(1, zones+1):
+		# outside wall, orientation alternates
+		ifaces = interface("A", ifaceId, z, 8) + interface("B", ifaceId+1, 0, 25)
+		parts.append(CONSTRUCTION.format(id=conId, name="Outside wall {}".format(z), typeId=1,
+										 orientation=orientations[z % 4], inclination=90, area=12, interfaces=ifaces))
+		conId += 1
+		ifaceId += 2
+		# roof
+		ifaces = interface("A", ifaceId, z, 10) + interface("B", ifaceId+1, 0, 25)
+		parts.append(CONSTRUCTION.format(id=conId, name="Roof {}".format(z), typeId=2,
+										 orientation=0, inclination=0, area=20, interfaces=ifaces))
+		conId += 1
+		ifaceId += 2
+		# interior wall to next zone
+		if z < zones:
+			ifaces = interface("A", ifaceId, z, 8) + interface("B", ifaceId+1, z+1, 8)
+			parts.append(CONSTRUCTION.format(id=conId, name="Interior wall {}-{}".format(z, z+1), typeId=3,
+											 orientation=90, inclination=90, area=10, interfaces=ifaces))
+			conId += 1
+			ifaceId += 2
+	parts.append("\t\t</ConstructionInstances>\n")
+
+	parts.append(FOOTER)
+	return "".join(parts)
+
+
+parser = argparse.ArgumentParser("generate_multizone_benchmark.py")
+parser.add_argument('climate', help='Path to climate data file.')
+parser.add_argument('project', help='Path to generated project file.')
+parser.add_argument('--zones', type=int, default=1000, help='Number of zones (default 1000).')
+parser.add_argument('--days', type=float, default=10, help='Simulated days (default 10).')
+args = parser.parse_args()
+
+with open(args.project, 'w') as f:
+	f.write(generateProject(args.zones, args.days, os.path.abspath(args.climate)))
+print("Generated '{}' with {} zones".format(args.project, args.zones))
@@ -47,6 +47,11 @@
 #
 # Note: if run with --run-all option, test cases without reference results will always be accepted.
 #
+# Sweep tests:
+# Files with extension 'sweep' contain a list of project files (first is the base project). In regression
+# test mode, these projects are not simulated individually, but together with the solver's --sweep option.
+# Afterwards, the results of each project are compared with the project's reference results.
+#
 
 import subprocess		# import the module for calling external programs (creating subprocesses)
 import sys
@@ -139,6 +144,22 @@ def checkResults(dir1, dir2, evalTimes):
 	return True
 
 
+def readSweepList(sweepFile):
+	"""
+	Reads list of project files from sweep list file, returns list of absolute project file paths.
+	Empty lines and lines starting with # are skipped, relative paths are relative to the list file.
+	"""
+	members = []
+	fobj = open(sweepFile)
+	for line in fobj:
+		line = line.strip()
+		if len(line) == 0 or line.startswith('#'):
+			continue
+		members.append(os.path.normpath(os.path.join(os.path.dirname(sweepFile), line)))
+	fobj.close()
+	return members
+
+
 def run_performance_evaluation(args, projects):
 	# we basically do the same as the main script, but this time we run all test cases
 	# whether they have reference results or not and simply remember the run times
@@ -275,6 +296,21 @@ for root, dirs, files in os.walk(args.path, topdown=False):
 			projects.append(projectFilePath)
 
 projects.sort()
+
+# collect sweep lists and remove their projects from the list of individually simulated projects
+# (only in regression test mode)
+sweeps = []
+if not args.test_init and not args.performance:
+	for root, dirs, files in os.walk(args.path, topdown=False):
+		for name in files:
+			if name.endswith('.sweep'):
+				sweeps.append(os.path.join(root, name))
+	sweeps.sort()
+	for sweep in sweeps:
+		for member in readSweepList(sweep):
+			projects = [p for p in projects if os.path.normpath(p) != member]
+	print("Number of sweeps       : {}".format(len(sweeps)))
+
 print("Number of projects     : {}\n".format(len(projects)))
 
 # performance tests?
@@ -348,6 +384,50 @@ for project in projects:
 		printError("Error starting solver executable '{}', error: {}".format(args.solver, e))
 		exit(1)
 
+for sweep in sweeps:
+	print(sweep)
+	members = readSweepList(sweep)
+
+	# remove previous results and check for reference results of all projects in the sweep
+	missingReferences = False
+	for member in members:
+		resultsFolder = member[:-(1+len(args.extension))]
+		if os.path.exists(resultsFolder):
+			shutil.rmtree(resultsFolder)
+		if not os.path.exists(resultsFolder + "." + compilerID) and not args.run_all:
+			printError("Missing reference data directory '{}'".format(os.path.split(resultsFolder + "." + compilerID)[1]))
+			missingReferences = True
+	if missingReferences:
+		failed_projects.append(sweep)
+		continue
+
+	# projects of a sweep run one after another, so that results do not depend on the number of cores
+	cmdline = [args.solver, "--sweep", "-p=1", sweep]
+	try:
+		FNULL = open(os.devnull, 'w')
+		if platform.system() == "Windows":
+			cmdline.append("-x")
+			cmdline.append("--verbosity-level=0")
+			retcode = subprocess.call(cmdline, creationflags=subprocess.CREATE_NEW_CONSOLE)
+		else:
+			retcode = subprocess.call(cmdline, stdout=FNULL, stderr=subprocess.STDOUT)
+		if retcode != 0:
+			failed_projects.append(sweep)
+			printError("Sweep failed, see log file {}".format(sweep[:-len(".sweep")] + "_batch.log"))
+			continue
+		for member in members:
+			resultsFolder = member[:-(1+len(args.extension))]
+			referenceFolder = resultsFolder + "." + compilerID
+			if not os.path.exists(referenceFolder):
+				continue # only with --run-all
+			if not checkResults(referenceFolder, resultsFolder, eval_times):
+				if not member in failed_projects:
+					failed_projects.append(member) # mark as failed
+				printError("Mismatching results.")
+	except OSError as e:
+		printError("Error starting solver executable '{}', error: {}".format(args.solver, e))
+		exit(1)
+
 print("\nSuccessful projects:\n")
 print("{:80s} {}".format("Project path", "Wall clock time [s]"))
 filenames = eval_times.keys()